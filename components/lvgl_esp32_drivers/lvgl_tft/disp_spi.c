@@ -94,6 +94,7 @@ static spi_host_device_t spi_host;
 static spi_device_handle_t spi;
 static QueueHandle_t TransactionPool = NULL;
 static transaction_cb_t chained_post_cb;
+static void (*flush_done_cb)(void);
 
 /**********************
  *      MACROS
@@ -293,6 +294,11 @@ void disp_spi_release(void)
     spi_device_release_bus(spi);
 }
 
+void disp_spi_set_flush_done_cb(void (*cb)(void))
+{
+    flush_done_cb = cb;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -304,6 +310,10 @@ static void IRAM_ATTR spi_ready(spi_transaction_t *trans)
     if (flags & DISP_SPI_SIGNAL_FLUSH) {
         lv_disp_t * disp = NULL;
 
+        if (flush_done_cb) {
+            flush_done_cb();
+        }
+
 #if (LVGL_VERSION_MAJOR >= 7)
         disp = _lv_refr_get_disp_refreshing();
 #else /* Before v7 */
@@ -64,6 +64,10 @@ void disp_wait_for_pending_transactions(void);
 void disp_spi_acquire(void);
 void disp_spi_release(void);
 
+/* Called from the SPI ISR when the last transaction of a flush is done,
+   before LVGL is told; must be IRAM safe. NULL to remove. */
+void disp_spi_set_flush_done_cb(void (*cb)(void));
+
 static inline void disp_spi_send_data(uint8_t *data, size_t length) {
     disp_spi_transaction(data, length, DISP_SPI_SEND_POLLING, NULL, 0, 0);
 }
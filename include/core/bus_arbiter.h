@@ -0,0 +1,78 @@
+#ifndef BUS_ARBITER_H
+#define BUS_ARBITER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// cooperative arbiter for a bus shared by several drivers (display and sd on
+// one spi host). clients take the bus per chunk instead of suspending each
+// other: the owner calls bus_arbiter_yield between chunks and keeps the bus
+// (batching) until its class budget is spent or a more urgent class waits.
+// waiters past their class deadline are served before higher classes, so
+// bulk writes keep moving under a busy display.
+
+typedef enum {
+    BUS_CLASS_INTERACTIVE = 0, // display flushes
+    BUS_CLASS_BULK,            // sd writes
+    BUS_CLASS_BACKGROUND,      // stats, housekeeping
+    BUS_CLASS_COUNT
+} bus_class_t;
+
+#define BUS_ARBITER_MAX_CLIENTS 6
+#define BUS_ARBITER_HIST_BUCKETS 12 // wait time, bucket i < 16us << i, last is open ended
+
+typedef struct {
+    const char *name;
+    bus_class_t cls;
+    uint32_t acquires;
+    uint32_t hist[BUS_ARBITER_HIST_BUCKETS];
+    uint32_t wait_max_us;
+    uint64_t wait_total_us;
+    uint32_t hold_max_us;
+    uint64_t hold_total_us;
+} bus_client_t;
+
+typedef struct bus_waiter bus_waiter_t;
+
+typedef struct {
+    portMUX_TYPE mux;
+    bus_client_t clients[BUS_ARBITER_MAX_CLIENTS];
+    uint8_t client_count;
+    bus_client_t *owner;
+    TaskHandle_t owner_task;
+    uint16_t depth; // nested acquires by owner_task
+    int64_t owner_since_us;
+    bus_waiter_t *head[BUS_CLASS_COUNT];
+    bus_waiter_t *tail[BUS_CLASS_COUNT];
+    uint32_t hold_budget_us[BUS_CLASS_COUNT]; // keep the bus this long while others wait
+    uint32_t max_wait_us[BUS_CLASS_COUNT];    // then jump the class order
+} bus_arbiter_t;
+
+void bus_arbiter_init(bus_arbiter_t *arb);
+
+// clients are never unregistered; NULL when the table is full
+bus_client_t *bus_arbiter_register(bus_arbiter_t *arb, const char *name, bus_class_t cls);
+
+// all calls are no-ops with a NULL arbiter or client, so callers on boards
+// without a shared bus need no checks.
+// acquire nests: a task already holding the bus through the same client just
+// counts the hold, and the bus is handed on when the outermost hold ends.
+// release from any other task is ignored.
+void bus_arbiter_acquire(bus_arbiter_t *arb, bus_client_t *client);
+void bus_arbiter_release(bus_arbiter_t *arb, bus_client_t *client);
+// ends one hold from interrupt context without checking the task, so a hold
+// can be handed to the completion isr of a queued transfer
+void bus_arbiter_release_from_isr(bus_arbiter_t *arb, bus_client_t *client);
+// between chunks: hands the bus over if the budget is spent and someone waits,
+// or a higher class waits; returns true if the bus changed hands meanwhile.
+// never hands over from inside a nested hold
+bool bus_arbiter_yield(bus_arbiter_t *arb, bus_client_t *client);
+
+// wait-time percentile from the histogram (upper bucket bound), pct 1..100
+uint32_t bus_arbiter_wait_percentile_us(const bus_client_t *client, uint8_t pct);
+void bus_arbiter_print_stats(const bus_arbiter_t *arb);
+
+#endif // BUS_ARBITER_H
@@ -0,0 +1,84 @@
+#ifndef COMM_LINK_H
+#define COMM_LINK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// reliable framing for the dualcomm uart once both sides negotiated it.
+// frame: 0xAB, type, seq, len lo, len hi, payload, crc32 (le) over type..payload.
+// data frames are go-back-n windowed and acked cumulatively with LINK_ACK;
+// the legacy 0xAA packets keep flowing next to it for discovery and pings.
+
+#define COMM_LINK_START_BYTE 0xAB
+#define COMM_LINK_HDR_LEN 5
+#define COMM_LINK_CRC_LEN 4
+#define COMM_LINK_MAX_PAYLOAD 1024
+#define COMM_LINK_FRAME_MAX (COMM_LINK_HDR_LEN + COMM_LINK_MAX_PAYLOAD + COMM_LINK_CRC_LEN)
+#define COMM_LINK_WINDOW 4
+
+#define COMM_LINK_TYPE_ACK 0x10 // seq = next frame the receiver expects
+
+typedef enum {
+    COMM_LINK_RX_NONE = 0, // partial or corrupt frame
+    COMM_LINK_RX_CONTROL,  // valid frame consumed by the link (ack or duplicate)
+    COMM_LINK_RX_DATA,     // in-order data frame ready in rx_type/rx_payload/rx_len
+} comm_link_rx_result_t;
+
+typedef struct {
+    // sender window; slot = seq % COMM_LINK_WINDOW, holds the encoded frame
+    uint8_t tx_frames[COMM_LINK_WINDOW][COMM_LINK_FRAME_MAX];
+    uint16_t tx_frame_len[COMM_LINK_WINDOW];
+    uint8_t tx_base; // oldest unacked seq
+    uint8_t tx_sent; // next seq to put on the wire
+    uint8_t tx_next; // next seq to assign
+    bool tx_rewound; // already went back since the last forward ack
+    uint32_t tx_deadline_ms;
+    uint32_t rto_ms;
+
+    // receiver
+    uint8_t rx_expected;
+    bool ack_pending;
+    uint8_t rx_state;
+    uint16_t rx_pos;
+    uint16_t rx_len;
+    uint8_t rx_frame[COMM_LINK_FRAME_MAX];
+    uint8_t rx_type;
+    const uint8_t *rx_payload;
+
+    uint32_t frames_tx;
+    uint32_t frames_rx;
+    uint32_t retransmits;
+    uint32_t crc_errors;
+    uint32_t out_of_order;
+} comm_link_t;
+
+// rto should cover a full window of frames at the link baud rate
+void comm_link_init(comm_link_t *link, uint32_t rto_ms);
+
+// retransmit timeout for a full window at baud (8E1, 11 bits per byte) plus slack
+uint32_t comm_link_rto_for_baud(uint32_t baud);
+
+uint32_t comm_link_crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+// queue a data frame made of prefix + payload (prefix may be NULL);
+// false when the window is full or the frame is too large
+bool comm_link_queue(comm_link_t *link, uint8_t type, const uint8_t *prefix, size_t prefix_len,
+                     const uint8_t *payload, size_t len);
+bool comm_link_window_full(const comm_link_t *link);
+
+// copy the next frame to transmit (pending ack first, then new or timed out
+// data) into out, which must hold COMM_LINK_FRAME_MAX bytes; 0 when idle
+size_t comm_link_next_tx(comm_link_t *link, uint32_t now_ms, uint8_t *out);
+
+// feed one received byte; on COMM_LINK_RX_DATA the caller hands the frame on
+// and calls comm_link_rx_commit, or drops it and lets the peer retransmit
+comm_link_rx_result_t comm_link_rx_byte(comm_link_t *link, uint8_t byte, uint32_t now_ms);
+void comm_link_rx_commit(comm_link_t *link);
+
+// parser is mid-frame and owns the following bytes
+static inline bool comm_link_rx_busy(const comm_link_t *link) {
+    return link->rx_state != 0;
+}
+
+#endif // COMM_LINK_H
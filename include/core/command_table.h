@@ -0,0 +1,41 @@
+#ifndef COMMAND_TABLE_H
+#define COMMAND_TABLE_H
+
+#include <stdint.h>
+
+// open-addressed command table (fnv-1a, linear probing, backward-shift
+// deletion) and the command line tokenizer. no esp-idf dependencies so the
+// host tests can build it.
+
+// sized for every build's command set at < 50% load
+#define COMMAND_TABLE_SIZE 256
+
+typedef void (*CommandFunction)(int argc, char **argv);
+
+typedef struct Command {
+  const char *name;
+  CommandFunction function;
+} Command;
+
+typedef struct {
+  Command slots[COMMAND_TABLE_SIZE];
+  uint16_t count;
+} command_table_t;
+
+void command_table_init(command_table_t *table);
+
+// name is stored by reference and must stay valid (string literal).
+// returns 1 when added, 0 when the name is already registered (the first
+// function is kept), -1 when the table is full
+int command_table_add(command_table_t *table, const char *name, CommandFunction function);
+
+void command_table_remove(command_table_t *table, const char *name);
+
+CommandFunction command_table_find(const command_table_t *table, const char *name);
+
+// split a command line in place. arguments are separated by whitespace; an
+// argument starting with ' or " runs to the matching quote. with argv NULL
+// nothing is modified and only the count is returned, -1 on an open quote.
+int command_tokenize(char *line, char **argv);
+
+#endif // COMMAND_TABLE_H
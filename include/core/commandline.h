@@ -6,17 +6,11 @@
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-
-typedef void (*CommandFunction)(int argc, char **argv);
-
-typedef struct Command {
-  char *name;
-  CommandFunction function;
-  struct Command *next;
-} Command;
+#include "core/command_table.h"
 
 // Functions to manage commands
 void command_init();
+// name is stored by reference and must stay valid (string literal)
 void register_command(const char *name, CommandFunction function);
 void unregister_command(const char *name);
 CommandFunction find_command(const char *name);
@@ -0,0 +1,13 @@
+#ifndef FILE_INDEX_H
+#define FILE_INDEX_H
+
+// numbering for capture files named <base>_<n>.<ext>: the next free n per
+// directory, base and extension, kept in a small lru table and in a hidden
+// .ghost_index file in the directory so it survives a reboot. the cached
+// number is checked by probing for the file it names; when that and the one
+// after it are both taken the directory is scanned again.
+
+// -1 when the directory cannot be opened
+int file_index_next(const char *dir_path, const char *base, const char *ext);
+
+#endif // FILE_INDEX_H
@@ -1,7 +1,9 @@
 #ifndef GLOG_H
 #define GLOG_H
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include "managers/views/terminal_screen.h"
 
 /*
@@ -14,6 +16,25 @@ void glog(const char *fmt, ...);
 void glog_set_defer(int on);
 void glog_flush_deferred(void);
 
+/*
+ * Output sinks. Every line goes into a shared ring and each sink is drained
+ * from it by its own background task, so a slow UART, display or web client
+ * never stalls the caller and only loses its own backlog. With
+ * CONFIG_GLOG_INLINE_OUTPUT console (printf) and terminal are written from
+ * the calling task instead. Remote command responses always are.
+ */
+typedef enum {
+    GLOG_SINK_CONSOLE = 0,
+    GLOG_SINK_TERMINAL,
+    GLOG_SINK_WEB,
+    GLOG_SINK_COUNT
+} glog_sink_t;
+
+void glog_set_sink_enabled(glog_sink_t sink, bool enabled);
+
+/* lines a sink lost because it fell a full ring behind */
+uint32_t glog_sink_dropped(glog_sink_t sink);
+
 #endif /* GLOG_H */
 
 
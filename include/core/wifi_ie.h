@@ -0,0 +1,102 @@
+#ifndef WIFI_IE_H
+#define WIFI_IE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// single-pass 802.11 information element parser shared by the capture callbacks.
+// the parser never copies element bodies: ssid/wps pointers reference the frame.
+
+#define WIFI_IE_MAX_VENDOR_OUIS 4
+
+// element ids
+#define WIFI_IE_ID_SSID 0
+#define WIFI_IE_ID_DS_PARAMS 3
+#define WIFI_IE_ID_HT_CAP 45
+#define WIFI_IE_ID_RSN 48
+#define WIFI_IE_ID_HT_OPER 61
+#define WIFI_IE_ID_VHT_CAP 191
+#define WIFI_IE_ID_VENDOR 221
+#define WIFI_IE_ID_EXTENSION 255
+#define WIFI_IE_EXT_HE_CAP 35
+
+// akm suite bitmask (bit = suite type within 00:0F:AC or 00:50:F2)
+#define WIFI_IE_AKM_8021X (1u << 1)
+#define WIFI_IE_AKM_PSK (1u << 2)
+#define WIFI_IE_AKM_FT_8021X (1u << 3)
+#define WIFI_IE_AKM_FT_PSK (1u << 4)
+#define WIFI_IE_AKM_8021X_SHA256 (1u << 5)
+#define WIFI_IE_AKM_PSK_SHA256 (1u << 6)
+#define WIFI_IE_AKM_SAE (1u << 8)
+#define WIFI_IE_AKM_FT_SAE (1u << 9)
+#define WIFI_IE_AKM_SUITE_B (1u << 11)
+#define WIFI_IE_AKM_SUITE_B_192 (1u << 12)
+#define WIFI_IE_AKM_OWE (1u << 18)
+
+// cipher suite bitmask (bit = suite type)
+#define WIFI_IE_CIPHER_WEP40 (1u << 1)
+#define WIFI_IE_CIPHER_TKIP (1u << 2)
+#define WIFI_IE_CIPHER_CCMP (1u << 4)
+#define WIFI_IE_CIPHER_WEP104 (1u << 5)
+#define WIFI_IE_CIPHER_GCMP (1u << 8)
+#define WIFI_IE_CIPHER_GCMP256 (1u << 9)
+#define WIFI_IE_CIPHER_CCMP256 (1u << 10)
+
+// descriptor flags
+#define WIFI_IE_F_SSID (1u << 0)
+#define WIFI_IE_F_RSN (1u << 1)
+#define WIFI_IE_F_WPA (1u << 2)
+#define WIFI_IE_F_WPS (1u << 3)
+#define WIFI_IE_F_WPS_METHODS (1u << 4)
+#define WIFI_IE_F_HT (1u << 5)
+#define WIFI_IE_F_VHT (1u << 6)
+#define WIFI_IE_F_HE (1u << 7)
+#define WIFI_IE_F_PRIVACY (1u << 8)
+#define WIFI_IE_F_TRUNCATED (1u << 9)
+
+// rsn capabilities
+#define WIFI_IE_RSN_CAP_MFPR 0x0040
+#define WIFI_IE_RSN_CAP_MFPC 0x0080
+
+typedef struct {
+    const uint8_t *ssid;   // points into the frame, not nul terminated
+    const uint8_t *wps;    // body of the first wps vendor element (after oui+type)
+    uint16_t flags;        // WIFI_IE_F_*
+    uint16_t capability;   // fixed capability field (beacon/probe resp/assoc only)
+    uint16_t rsn_caps;
+    uint16_t wps_config_methods;
+    uint32_t rsn_akm;      // WIFI_IE_AKM_*
+    uint16_t rsn_pairwise; // WIFI_IE_CIPHER_*
+    uint16_t rsn_group;
+    uint32_t wpa_akm;
+    uint16_t wpa_pairwise;
+    uint16_t wpa_group;
+    uint32_t vendor_ouis[WIFI_IE_MAX_VENDOR_OUIS]; // distinct vendor element ouis, 0xRRGGBB
+    uint8_t vendor_oui_count;
+    uint8_t ssid_len;
+    uint8_t wps_len;
+    uint8_t ds_channel;    // from ds parameter set, 0 if absent
+    uint8_t ht_channel;    // primary channel from ht operation, 0 if absent
+} wifi_ie_info_t;
+
+// walk a raw element list once; returns false when nothing usable was found
+bool wifi_ie_parse(const uint8_t *ies, size_t len, wifi_ie_info_t *out);
+
+// locate the element list of a management frame (beacon, probe req/resp,
+// assoc/reassoc) from its subtype and parse it; returns false for other frames.
+// len is the captured length as in rx_ctrl.sig_len, including the 4 byte fcs
+bool wifi_ie_parse_mgmt(const uint8_t *frame, size_t len, wifi_ie_info_t *out);
+
+// channel advertised by the frame (ds params first, then ht operation), 0 if none
+static inline uint8_t wifi_ie_channel(const wifi_ie_info_t *info) {
+    return info->ds_channel ? info->ds_channel : info->ht_channel;
+}
+
+// copy the ssid into a nul terminated buffer, returns copied length
+size_t wifi_ie_copy_ssid(const wifi_ie_info_t *info, char *out, size_t out_sz);
+
+// short security label: "WPA3", "OWE", "WPA2", "WPA", "WEP" or "OPEN"
+const char *wifi_ie_security_label(const wifi_ie_info_t *info);
+
+#endif // WIFI_IE_H
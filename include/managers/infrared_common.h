@@ -160,11 +160,28 @@ typedef struct {
     bool toggle;
 } InfraredRc6Decoder;
 
+// Timing window that can start an idle decoder: its preamble mark, or the
+// first half bit for Manchester protocols without one. Bounds are exclusive
+// like MATCH_TIMING.
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint16_t mask;   // decoders this window can start
+    bool mark_only;
+} InfraredDecoderEntry;
+
+#define INFRARED_MAX_DECODERS 16
+
 // Main decoder interface
 struct InfraredDecoderContext {
-    InfraredCommonDecoder* decoders[16];  // Array of protocol decoders
+    InfraredCommonDecoder* decoders[INFRARED_MAX_DECODERS];  // Array of protocol decoders
     uint8_t decoder_count;
     InfraredDecodedMessage last_message;
+    // Dispatch: idle decoders only see timings that fall in one of their entry
+    // windows, so a frame is decoded by the protocols whose preamble it matches
+    InfraredDecoderEntry entries[INFRARED_MAX_DECODERS * 2];  // sorted by min
+    uint8_t entry_count;
+    uint16_t busy_mask;  // decoders that accepted a timing since their last reset
 };
 
 // Utility macros
@@ -0,0 +1,75 @@
+#ifndef INFRARED_EDGE_RING_H
+#define INFRARED_EDGE_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// edge capture for the gpio ir receiver. the isr only stamps edges into a
+// single producer / single consumer ring; the receiving task drains it in
+// batches, cuts the stream into signals at silent gaps and hands each
+// mark/space to the decoder as soon as its closing edge arrives. no esp
+// headers here so the ring and the segmenter build on the host too.
+
+#define INFRARED_EDGE_RING_SIZE 256 // power of two, ~128 mark/space pairs of slack
+#define INFRARED_EDGE_SEG_MAX 256   // timings kept per signal for the raw fallback
+
+typedef struct {
+    uint32_t head;    // written by the isr only
+    uint32_t tail;    // written by the task only
+    uint32_t dropped; // edges lost to a full ring, never reset
+    uint32_t ts[INFRARED_EDGE_RING_SIZE];
+} infrared_edge_ring_t;
+
+// isr side, inline so it lands in the iram handler. false when the ring is
+// full; *was_empty means this edge starts a batch and the consumer needs a
+// wake up.
+static inline bool infrared_edge_ring_push(infrared_edge_ring_t *r, uint32_t ts, bool *was_empty) {
+    uint32_t head = r->head;
+    uint32_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= INFRARED_EDGE_RING_SIZE) {
+        __atomic_store_n(&r->dropped, r->dropped + 1, __ATOMIC_RELAXED);
+        *was_empty = false;
+        return false;
+    }
+    r->ts[head & (INFRARED_EDGE_RING_SIZE - 1)] = ts;
+    __atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+    *was_empty = head == tail;
+    return true;
+}
+
+void infrared_edge_ring_reset(infrared_edge_ring_t *r);
+// task side: copy out up to max timestamps, oldest first
+size_t infrared_edge_ring_drain(infrared_edge_ring_t *r, uint32_t *out, size_t max);
+static inline uint32_t infrared_edge_ring_dropped(const infrared_edge_ring_t *r) {
+    return __atomic_load_n(&r->dropped, __ATOMIC_RELAXED);
+}
+
+typedef struct {
+    uint32_t gap_us;    // silence that ends a signal
+    uint32_t last_ts;   // last edge of the current signal
+    bool active;
+    bool skip;          // resyncing, edges are ignored until the next gap
+    bool level;         // level of the interval that started at last_ts, true = mark
+    bool truncated;     // more timings than fit in timings[]
+    size_t count;
+    uint32_t timings[INFRARED_EDGE_SEG_MAX];
+} infrared_edge_seg_t;
+
+void infrared_edge_seg_init(infrared_edge_seg_t *seg, uint32_t gap_us);
+// drop the current signal, e.g. after ring overflow
+void infrared_edge_seg_reset(infrared_edge_seg_t *seg);
+// the current signal lost edges: ignore everything up to the next gap, with
+// ts as the latest edge seen
+void infrared_edge_seg_resync(infrared_edge_seg_t *seg, uint32_t ts);
+// true once the current signal has been silent for gap_us at time now;
+// check before pushing the next edge so signals never merge
+bool infrared_edge_seg_expired(const infrared_edge_seg_t *seg, uint32_t now);
+// add an edge; true with the interval it closes (first edge of a signal
+// closes nothing). signals start with a mark. edges in the same microsecond
+// only flip the level, so an odd bounce counts as one edge and a blip pair
+// leaves the level as it was; timings[] then joins the intervals on either
+// side of the blip and keeps alternating.
+bool infrared_edge_seg_push(infrared_edge_seg_t *seg, uint32_t ts, bool *level, uint32_t *duration);
+
+#endif // INFRARED_EDGE_RING_H
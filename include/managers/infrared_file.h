@@ -0,0 +1,52 @@
+#ifndef INFRARED_FILE_H
+#define INFRARED_FILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "managers/infrared_manager.h"
+
+// streaming reader for flipper style .ir files. files are read in small
+// blocks in one pass, never as a whole. an index of the signals (name, type,
+// protocol, address, command, file offset) is cached next to the file as
+// ".<stem>.gidx" and rebuilt when the file's size or mtime changes, so
+// listing a large library does not parse it and single signals are parsed
+// on demand. the leading dot keeps the cache out of the sd listings.
+
+#define INFRARED_FILE_BLOCK 1024
+
+typedef struct {
+    uint32_t offset;   // file offset of the signal's name line
+    uint32_t name_off; // into names
+    uint32_t address;  // parsed signals only
+    uint32_t command;
+    uint8_t is_raw;
+    uint8_t protocol;  // index into the known protocol names, 0 if not known
+    uint16_t reserved;
+} infrared_file_entry_t;
+
+typedef struct {
+    char *path;
+    infrared_file_entry_t *entries;
+    size_t count;
+    char *names;
+    size_t names_len;
+} infrared_file_index_t;
+
+// parse every signal of an .ir file; false if it holds none (e.g. json)
+bool infrared_file_read_list(const char *path, infrared_signal_t **signals, size_t *count);
+
+// load the cached index or build (and cache) it; false for files without
+// .ir signals so callers can fall back to infrared_manager_read_list
+bool infrared_file_index_open(const char *path, infrared_file_index_t *index);
+void infrared_file_index_close(infrared_file_index_t *index);
+// drop the cached index of an .ir file that was deleted; other paths are ignored
+void infrared_file_index_forget(const char *path);
+const char *infrared_file_index_name(const infrared_file_index_t *index, size_t i);
+// protocol name of a parsed signal, NULL for raw signals and unknown names
+const char *infrared_file_index_protocol(const infrared_file_index_t *index, size_t i);
+// parse signal i from the file; free with infrared_manager_free_signal
+bool infrared_file_index_load(const infrared_file_index_t *index, size_t i,
+                              infrared_signal_t *signal);
+
+#endif // INFRARED_FILE_H
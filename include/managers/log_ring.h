@@ -0,0 +1,46 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// web ui log ring: cursors are byte counts since boot so a reader can ask
+// for everything after the last cursor it saw, and the tail only moves on
+// line starts. no locking here, ap_manager holds its log mutex around every
+// call.
+
+#define LOG_RING_SIZE (8 * 1024) // power of two
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+#define LOG_READ_CHUNK 1024      // bytes copied out of the ring per lock
+
+// gap event and id: line, each with a 10 digit number
+#define LOG_SSE_GAP_MAX 32
+#define LOG_SSE_ID_MAX 20
+// "data: " per line plus the line's own newline; one line always fits
+#define LOG_SSE_FRAME_SIZE (LOG_SSE_GAP_MAX + 7 + LOG_READ_CHUNK + LOG_SSE_ID_MAX)
+
+typedef struct {
+    char *buf;     // LOG_RING_SIZE bytes
+    uint32_t head; // cursor of the next byte to be appended
+    uint32_t tail; // cursor of the oldest byte still held
+} log_ring_t;
+
+// append len bytes, dropping whole lines from the tail until they fit; a
+// message longer than the ring keeps its end
+void log_ring_append(log_ring_t *ring, const char *msg, size_t len);
+
+// copy up to max bytes between *cursor and end into out, ending on a line
+// break when the copy is cut short. *cursor moves past the copied bytes;
+// *dropped gets the bytes that fell out of the ring before the reader got to
+// them. a cursor past the head (from before a reboot) restarts at the tail.
+size_t log_ring_read_since(const log_ring_t *ring, uint32_t *cursor, uint32_t end, char *out,
+                           size_t max, uint32_t *dropped);
+
+// frame text read from cursor start as one server-sent event; every line
+// becomes a data: field. short lines expand up to 7x, so framing stops at the
+// last whole line that fits and *used tells the caller how much of text went
+// out. out_len must be at least LOG_SSE_GAP_MAX + LOG_SSE_ID_MAX.
+size_t log_sse_format(const char *text, size_t len, size_t *used, uint32_t start,
+                      uint32_t dropped, char *out, size_t out_len);
+
+#endif // LOG_RING_H
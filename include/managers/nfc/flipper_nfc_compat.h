@@ -36,10 +36,15 @@ extern "C" {
 #define FURI_BIT_CLEAR(p, n) ((p) &= ~(1UL << (n)))
 
 // FuriString (Minimal Implementation)
+// strings keep spare capacity and grow geometrically, so the parsers' long
+// runs of small appends format in place instead of reallocating each time.
+typedef struct FuriStringArena FuriStringArena;
+
 typedef struct {
-    char* data;
+    char* data;   // never NULL, a shared "" until the first write
     size_t len;
-    size_t cap;
+    size_t cap;   // bytes at data, 0 for the shared ""
+    FuriStringArena* arena; // owner of data and of the string itself, or NULL for heap
 } FuriString;
 
 FuriString* furi_string_alloc(void);
@@ -54,15 +59,57 @@ void furi_string_cat_str(FuriString* dst, const char* cstr);
 FuriString* furi_string_alloc_set_str(const char* cstr);
 void furi_string_push_back(FuriString* str, char c);
 char furi_string_get_char(const FuriString* str, size_t index);
+// make room for len characters without changing the content
+bool furi_string_reserve(FuriString* str, size_t len);
+
+// per-parse arena: while one is current on the calling task, furi_string_alloc
+// takes strings from it and furi_string_free leaves them alone; freeing the
+// arena releases all of them in one go.
+FuriStringArena* furi_string_arena_alloc(size_t block_size);
+void furi_string_arena_free(FuriStringArena* arena);
+// returns the previously current arena so calls can nest
+FuriStringArena* furi_string_arena_set_current(FuriStringArena* arena);
+size_t furi_string_arena_used(const FuriStringArena* arena);
 
 // bit_lib shim
+// bit positions count from the most significant bit of data[0], and a field
+// comes back with its first bit as the most significant one (flipper order)
+typedef enum {
+    BitLibParityEven,    // even number of ones, parity bit included
+    BitLibParityOdd,
+    BitLibParityAlways0, // last bit of each block is 0
+    BitLibParityAlways1,
+} BitLibParity;
+
 uint64_t bit_lib_bytes_to_num_le(const uint8_t* bytes, size_t len);
 uint64_t bit_lib_bytes_to_num_be(const uint8_t* bytes, size_t len);
 void bit_lib_num_to_bytes_be(uint64_t value, size_t len, uint8_t* out);
+void bit_lib_num_to_bytes_le(uint64_t value, size_t len, uint8_t* out);
 uint64_t bit_lib_bytes_to_num_bcd(const uint8_t* bytes, size_t len, bool* is_bcd);
+bool bit_lib_get_bit(const uint8_t* data, size_t position);
+void bit_lib_set_bit(uint8_t* data, size_t position, bool bit);
+// low length bits of byte, length up to 8
+void bit_lib_set_bits(uint8_t* data, size_t position, uint8_t byte, uint8_t length);
 uint8_t bit_lib_get_bits(const uint8_t* data, size_t position, uint8_t length);
+uint16_t bit_lib_get_bits_16(const uint8_t* data, size_t position, uint8_t length);
 uint32_t bit_lib_get_bits_32(const uint8_t* data, size_t position, uint8_t length);
 uint64_t bit_lib_get_bits_64(const uint8_t* data, size_t position, uint8_t length);
+// reverse the order of length bits in place
+void bit_lib_reverse_bits(uint8_t* data, size_t position, uint8_t length);
+uint8_t bit_lib_reverse_8_fast(uint8_t byte);
+uint16_t bit_lib_reverse_16_fast(uint16_t data);
+uint32_t bit_lib_reverse_32_fast(uint32_t data);
+// parity bit that would make bits even (Even) or odd (Odd): 0 when bits
+// already includes a correct parity bit
+bool bit_lib_test_parity_32(uint32_t bits, BitLibParity parity);
+// length / parity_length blocks, each ending in its parity bit; true if
+// every block passes
+bool bit_lib_test_parity(
+    const uint8_t* bits,
+    size_t position,
+    uint8_t length,
+    BitLibParity parity,
+    uint8_t parity_length);
 
 #define REVERSE_BYTES_U32(x) __builtin_bswap32(x)
 
@@ -186,6 +233,8 @@ uint8_t mf_classic_get_first_block_num_of_sector(uint8_t sector);
 bool mf_classic_is_block_read(const MfClassicData* data, uint8_t block);
 const MfClassicSectorTrailer* mf_classic_get_sector_trailer_by_sector(const MfClassicData* data, uint8_t sector);
 const uint8_t* mf_classic_get_uid(const MfClassicData* data, size_t* uid_len);
+// sector trailer key as the plugins' key tables store it (big endian, 48 bit)
+uint64_t mf_classic_get_sector_key(const MfClassicData* data, uint8_t sector, MfClassicKeyType key_type);
 bool mf_classic_is_card_read(const MfClassicData* data);
 
 // Poller stubs (GhostESP does not use these for parsing, but plugins reference them)
@@ -204,12 +253,17 @@ MfClassicError mf_classic_poller_sync_read_block(Nfc* nfc, uint8_t block, const
 typedef bool (*NfcSupportedCardPluginVerify)(Nfc* nfc);
 typedef bool (*NfcSupportedCardPluginRead)(Nfc* nfc, NfcDevice* device);
 typedef bool (*NfcSupportedCardPluginParse)(const NfcDevice* device, FuriString* parsed_data);
+// GhostESP extension: a cheap look at the cached dump (type, uid, a key or a
+// few block bytes) run before parse. false must mean parse would fail too;
+// plugins without one are always parsed.
+typedef bool (*NfcSupportedCardPluginQuickCheck)(const MfClassicData* data);
 
 typedef struct {
     NfcProtocol protocol;
     NfcSupportedCardPluginVerify verify;
     NfcSupportedCardPluginRead read;
     NfcSupportedCardPluginParse parse;
+    NfcSupportedCardPluginQuickCheck quick_check;
 } NfcSupportedCardsPlugin;
 
 typedef struct {
@@ -229,6 +283,18 @@ typedef struct {
  */
 char* flipper_nfc_try_parse_mfclassic_from_cache(const MfClassicData* data);
 
+// per parser counters since boot, kept by the dispatcher
+typedef struct {
+    const char* name;
+    uint32_t checked;    // dumps offered to the quick check
+    uint32_t candidates; // dumps that passed it and were parsed
+    uint32_t matches;    // parses that succeeded
+    uint64_t parse_us;   // time spent in parse
+} FlipperNfcParserStats;
+
+size_t flipper_nfc_parser_count(void);
+bool flipper_nfc_get_parser_stats(size_t index, FlipperNfcParserStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,9 +2,11 @@
 #define SD_CARD_MANAGER_H
 
 #include "driver/sdmmc_host.h"
+#include "core/bus_arbiter.h"
 #include "driver/sdmmc_types.h"
 #include "esp_err.h"
 #include <stdbool.h>
+#include <stdio.h>
 
 #define MAX_PORTALS 32
 #define MAX_PORTAL_NAME 64
@@ -49,6 +51,22 @@ bool sd_card_is_virtual_storage();
 esp_err_t sd_card_mount_for_flush(bool *display_was_suspended);
 void sd_card_unmount_after_flush(bool display_was_suspended);
 
+// arbiter for an spi bus shared by display and sd (CONFIG_SD_SPI_BUS_ARBITER),
+// NULL when the bus is not shared; the bus_arbiter calls accept NULL
+bus_arbiter_t *sd_card_bus_arbiter(void);
+// one client per class: display flushes, sd writes, sd housekeeping
+bus_client_t *sd_card_bus_client(bus_class_t cls);
+// fwrite in chunks, letting display flushes through in between
+size_t sd_card_bus_fwrite(FILE *f, const void *data, size_t size);
+// stdio calls that reach the card, under the same sd client
+FILE *sd_card_bus_fopen(const char *path, const char *mode);
+int sd_card_bus_fflush(FILE *f);
+int sd_card_bus_fclose(FILE *f);
+// hold the sd client across a short sequence (open, seek, write, close);
+// sd_card_bus_* calls inside nest and keep the bus until the unlock
+void sd_card_bus_lock(void);
+void sd_card_bus_unlock(void);
+
 // cached SD stats for HUD (updated during mount operations)
 typedef struct {
     bool valid;
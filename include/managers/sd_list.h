@@ -0,0 +1,38 @@
+#ifndef SD_LIST_H
+#define SD_LIST_H
+
+#include <esp_err.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// one page of a single directory as json, streamed through a write callback
+// in chunks of at most SD_LIST_CHUNK bytes while the directory is read:
+//   {"path":..,"offset":..,"limit":..,"files":[{"name":..,"type":"folder"},
+//    {"name":..,"type":"file","path":..,"size":..},..],"total":..,"more":..}
+// hidden entries are left out. sorted listings are folders first, then by
+// name ignoring case; unsorted ones are in directory order and never hold
+// more than one name.
+
+#define SD_LIST_DEFAULT_LIMIT 100
+#define SD_LIST_MAX_LIMIT 500
+#define SD_LIST_SORT_MAX_BYTES (256 * 1024) // name arena cap for sorted listings
+#define SD_LIST_CHUNK 1024
+
+typedef esp_err_t (*sd_list_write_t)(void *ctx, const char *data, size_t len);
+
+typedef struct {
+    uint32_t offset;
+    uint32_t limit; // 0 or anything past SD_LIST_MAX_LIMIT means the max
+    bool sorted;
+    bool desc;
+} sd_list_opts_t;
+
+// nothing is written unless it returns ESP_OK or the write callback's error:
+// ESP_ERR_NOT_FOUND when dir_path cannot be opened, ESP_ERR_NO_MEM, and
+// ESP_ERR_INVALID_SIZE when the names do not fit the sort arena (sorted=false
+// still works there). the first failed write ends the listing.
+esp_err_t sd_list_dir(const char *dir_path, const sd_list_opts_t *opts, sd_list_write_t write,
+                      void *ctx);
+
+#endif // SD_LIST_H
@@ -0,0 +1,43 @@
+#ifndef SD_XFER_H
+#define SD_XFER_H
+
+#include <esp_err.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+// double buffered file transfer: the caller fills (or drains) one buffer
+// while a helper task writes (or reads) the other, so network and card
+// latency overlap and fatfs only ever sees large aligned requests.
+
+#define SD_XFER_BUF_SIZE (16 * 1024)
+#define SD_XFER_MIN_BUF_SIZE (4 * 1024)
+
+typedef struct sd_xfer sd_xfer_t;
+
+// writer side: takes ownership of fd and closes it in sd_xfer_finish.
+// prealloc > 0 reserves that many bytes up front so fatfs allocates the
+// cluster chain once; the file is truncated to what was written at the end.
+sd_xfer_t *sd_xfer_begin_write(int fd, size_t prealloc);
+// next free buffer, blocks while both are in flight; NULL once the writer failed
+uint8_t *sd_xfer_get_buffer(sd_xfer_t *x, size_t *cap);
+// hand len bytes of the buffer from sd_xfer_get_buffer to the writer
+void sd_xfer_commit(sd_xfer_t *x, size_t len);
+// wait for pending writes, trim, close and free; written may be NULL
+esp_err_t sd_xfer_finish(sd_xfer_t *x, size_t *written);
+
+// reader side: streams length bytes from offset, takes ownership of fd
+sd_xfer_t *sd_xfer_begin_read(int fd, off_t offset, size_t length);
+// next filled buffer, NULL at the end or on a read error
+const uint8_t *sd_xfer_next(sd_xfer_t *x, size_t *len);
+// give the buffer from sd_xfer_next back to the reader
+void sd_xfer_release(sd_xfer_t *x);
+// stop early if needed, close and free; ESP_FAIL if a read failed
+esp_err_t sd_xfer_end(sd_xfer_t *x);
+
+// a single "bytes=a-b" / "bytes=a-" / "bytes=-n" Range header against size.
+// returns 1 for a usable range, 0 to ignore the header, -1 for unsatisfiable
+int sd_xfer_parse_range(const char *hdr, size_t size, size_t *first, size_t *last);
+
+#endif // SD_XFER_H
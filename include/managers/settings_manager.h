@@ -138,7 +138,10 @@ typedef struct {
 void settings_init(FSettings *settings);
 void settings_deinit(void);
 void settings_load(FSettings *settings);
+// applies the settings now; nvs writes of the changed fields are batched
+// by a commit task, settings_flush forces them out immediately
 void settings_save(const FSettings *settings);
+void settings_flush(void);
 void settings_set_defaults(FSettings *settings);
 
 // Getters and Setters for core settings
@@ -261,6 +264,8 @@ void settings_print_namespace_stats(const char *namespace_name);
 // Getter and Setter for AP enabled state
 void settings_set_ap_enabled(FSettings *settings, bool enabled);
 bool settings_get_ap_enabled(const FSettings *settings);
+// true once ap_enabled has been saved, with either storage layout
+bool settings_ap_enabled_stored(void);
 
 // Getter and Setter for power save enabled state
 bool settings_get_power_save_enabled(const FSettings *settings);
@@ -0,0 +1,81 @@
+#ifndef TERMINAL_LINES_H
+#define TERMINAL_LINES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// terminal scrollback: line text is stored nul terminated in one arena used
+// as a ring; a line that would straddle the end starts over at offset 0.
+// top/top_dc are running sums of the pixel heights of every line (and of
+// every dualcomm line) laid out before this one, so either column's first
+// visible line is a binary search. no lvgl and no locking here, the terminal
+// view measures text through a callback and only touches it from the lvgl
+// task.
+
+#define TERM_MAX_LINES 400
+#define TERM_TEXT_BYTES (16 * 1024) // text arena, power of two
+#define TERM_TEXT_MASK (TERM_TEXT_BYTES - 1)
+#define TERM_MAX_LINE_LEN 1023      // longer lines are cut
+
+#define TERM_LINE_DUALCOMM 0x01
+
+enum { TERM_COL_ALL = 0, TERM_COL_LOCAL, TERM_COL_DUALCOMM };
+
+typedef struct {
+  uint16_t off;   // text offset in the arena
+  uint16_t len;
+  uint16_t pxh;   // cached pixel height at last layout width
+  uint8_t disp;   // dualcomm column text starts this far in
+  uint8_t flags;
+  uint32_t top;
+  uint32_t top_dc;
+} term_line_t;
+
+typedef struct {
+  term_line_t *lines;  // TERM_MAX_LINES records
+  char *arena;         // TERM_TEXT_BYTES of text
+  uint32_t arena_head; // next write position, free running
+  uint32_t arena_tail; // start of the oldest line, free running
+  uint16_t head;       // index of oldest
+  uint16_t count;      // number of valid lines
+  uint16_t laid_out;   // lines from the oldest with pxh/top set
+} term_lines_t;
+
+// pixel height of text at the width the caller is laying out for
+typedef uint16_t (*term_measure_t)(void *ctx, const char *text);
+
+static inline term_line_t *term_lines_at(const term_lines_t *t, uint16_t i) {
+  return &t->lines[(t->head + i) % TERM_MAX_LINES];
+}
+
+static inline bool term_line_in_column(const term_line_t *l, int col) {
+  if (col == TERM_COL_ALL) return true;
+  return ((l->flags & TERM_LINE_DUALCOMM) != 0) == (col == TERM_COL_DUALCOMM);
+}
+
+// text of line i as the column shows it, " " for an empty line
+const char *term_lines_text(const term_lines_t *t, uint16_t i, int col);
+
+void term_lines_clear(term_lines_t *t);
+// one line without its newline; drops the oldest lines until it fits
+void term_lines_append(term_lines_t *t, const char *line, size_t len);
+// measure the lines appended since the last call; after
+// term_lines_invalidate (a width change) every line is measured again
+void term_lines_layout(term_lines_t *t, term_measure_t measure, void *ctx);
+void term_lines_invalidate(term_lines_t *t);
+
+// height of the laid out lines; split columns are compacted independently,
+// the taller one sets the height
+int32_t term_lines_height(const term_lines_t *t, bool split);
+// y of line i inside its column, relative to the oldest line
+int32_t term_lines_y(const term_lines_t *t, uint16_t i, int col);
+// first laid out line whose bottom in col reaches y, laid_out if none; lines
+// of the other column count as zero height, which keeps the key monotonic
+uint16_t term_lines_first_visible(const term_lines_t *t, int col, int32_t y);
+
+// dualcomm traffic goes to the right column in split view, without its prefix
+bool terminal_is_dualcomm_line(const char *text);
+const char *terminal_dualcomm_display_text(const char *text);
+
+#endif // TERMINAL_LINES_H
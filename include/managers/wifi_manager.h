@@ -21,6 +21,7 @@ extern station_ap_pair_t station_ap_list[MAX_STATIONS];
 extern int station_count;
 extern bool manual_disconnect;
 extern wifi_ap_record_t *scanned_aps;
+extern uint16_t ap_count;
 extern wifi_ap_record_t selected_ap;
 extern wifi_ap_record_t *selected_aps;
 extern int selected_ap_count;
@@ -0,0 +1,227 @@
+#include "core/bus_arbiter.h"
+
+#include <string.h>
+#include "core/glog.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+
+struct bus_waiter {
+    bus_waiter_t *next;
+    bus_client_t *client;
+    TaskHandle_t task;
+    int64_t since_us;
+    SemaphoreHandle_t sem;
+    StaticSemaphore_t sem_buf;
+};
+
+void bus_arbiter_init(bus_arbiter_t *arb) {
+    memset(arb, 0, sizeof(*arb));
+    portMUX_INITIALIZE(&arb->mux);
+    // a display flush is one hold; bulk gets a few sd blocks per turn
+    arb->hold_budget_us[BUS_CLASS_INTERACTIVE] = 20000;
+    arb->hold_budget_us[BUS_CLASS_BULK] = 5000;
+    arb->hold_budget_us[BUS_CLASS_BACKGROUND] = 2000;
+    arb->max_wait_us[BUS_CLASS_INTERACTIVE] = 50000;
+    arb->max_wait_us[BUS_CLASS_BULK] = 40000;
+    arb->max_wait_us[BUS_CLASS_BACKGROUND] = 200000;
+}
+
+bus_client_t *bus_arbiter_register(bus_arbiter_t *arb, const char *name, bus_class_t cls) {
+    if (!arb || cls >= BUS_CLASS_COUNT) return NULL;
+    bus_client_t *client = NULL;
+    portENTER_CRITICAL(&arb->mux);
+    if (arb->client_count < BUS_ARBITER_MAX_CLIENTS) {
+        client = &arb->clients[arb->client_count++];
+        memset(client, 0, sizeof(*client));
+        client->name = name;
+        client->cls = cls;
+    }
+    portEXIT_CRITICAL(&arb->mux);
+    return client;
+}
+
+static void record_wait(bus_client_t *client, uint32_t wait_us) {
+    uint8_t b = 0;
+    while (b < BUS_ARBITER_HIST_BUCKETS - 1 && wait_us >= (16u << b)) b++;
+    client->hist[b]++;
+    client->acquires++;
+    client->wait_total_us += wait_us;
+    if (wait_us > client->wait_max_us) client->wait_max_us = wait_us;
+}
+
+// caller holds arb->mux
+static bus_waiter_t *IRAM_ATTR pick_next(bus_arbiter_t *arb, int64_t now) {
+    int cls = -1;
+    // overdue waiters first, longest waiting wins
+    for (int c = 0; c < BUS_CLASS_COUNT; c++) {
+        bus_waiter_t *w = arb->head[c];
+        if (w && now - w->since_us > arb->max_wait_us[c] &&
+            (cls < 0 || w->since_us < arb->head[cls]->since_us)) {
+            cls = c;
+        }
+    }
+    for (int c = 0; cls < 0 && c < BUS_CLASS_COUNT; c++) {
+        if (arb->head[c]) cls = c;
+    }
+    if (cls < 0) return NULL;
+
+    bus_waiter_t *w = arb->head[cls];
+    arb->head[cls] = w->next;
+    if (!arb->head[cls]) arb->tail[cls] = NULL;
+    return w;
+}
+
+void bus_arbiter_acquire(bus_arbiter_t *arb, bus_client_t *client) {
+    if (!arb || !client) return;
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    int64_t t0 = esp_timer_get_time();
+
+    portENTER_CRITICAL(&arb->mux);
+    if (arb->owner == client && arb->owner_task == self) {
+        arb->depth++;
+        portEXIT_CRITICAL(&arb->mux);
+        return;
+    }
+    if (!arb->owner) {
+        // a free bus never has waiters: release hands it straight to the next one
+        arb->owner = client;
+        arb->owner_task = self;
+        arb->depth = 1;
+        arb->owner_since_us = t0;
+        portEXIT_CRITICAL(&arb->mux);
+        record_wait(client, 0);
+        return;
+    }
+    portEXIT_CRITICAL(&arb->mux);
+
+    bus_waiter_t w = {.client = client, .task = self, .since_us = t0};
+    w.sem = xSemaphoreCreateBinaryStatic(&w.sem_buf);
+
+    portENTER_CRITICAL(&arb->mux);
+    if (!arb->owner) {
+        arb->owner = client;
+        arb->owner_task = self;
+        arb->depth = 1;
+        arb->owner_since_us = esp_timer_get_time();
+        portEXIT_CRITICAL(&arb->mux);
+    } else {
+        if (arb->tail[client->cls]) arb->tail[client->cls]->next = &w;
+        else arb->head[client->cls] = &w;
+        arb->tail[client->cls] = &w;
+        portEXIT_CRITICAL(&arb->mux);
+        // the releaser made us the owner before waking us
+        xSemaphoreTake(w.sem, portMAX_DELAY);
+    }
+    vSemaphoreDelete(w.sem);
+
+    int64_t waited = esp_timer_get_time() - t0;
+    record_wait(client, waited > UINT32_MAX ? UINT32_MAX : (uint32_t)waited);
+}
+
+// caller holds arb->mux and has ended the outermost hold of the owner;
+// returns the waiter that now owns the bus, to be woken outside the lock
+static bus_waiter_t *IRAM_ATTR hand_over_locked(bus_arbiter_t *arb, int64_t now) {
+    bus_client_t *client = arb->owner;
+    uint32_t held = (uint32_t)(now - arb->owner_since_us);
+    client->hold_total_us += held;
+    if (held > client->hold_max_us) client->hold_max_us = held;
+
+    bus_waiter_t *next = pick_next(arb, now);
+    arb->owner = next ? next->client : NULL;
+    arb->owner_task = next ? next->task : NULL;
+    arb->depth = next ? 1 : 0;
+    arb->owner_since_us = now;
+    return next;
+}
+
+void bus_arbiter_release(bus_arbiter_t *arb, bus_client_t *client) {
+    if (!arb || !client) return;
+    int64_t now = esp_timer_get_time();
+    bus_waiter_t *next = NULL;
+
+    portENTER_CRITICAL(&arb->mux);
+    if (arb->owner != client || arb->owner_task != xTaskGetCurrentTaskHandle()) {
+        portEXIT_CRITICAL(&arb->mux);
+        return;
+    }
+    if (--arb->depth == 0) next = hand_over_locked(arb, now);
+    portEXIT_CRITICAL(&arb->mux);
+
+    if (next) xSemaphoreGive(next->sem);
+}
+
+void IRAM_ATTR bus_arbiter_release_from_isr(bus_arbiter_t *arb, bus_client_t *client) {
+    if (!arb || !client) return;
+    int64_t now = esp_timer_get_time();
+    bus_waiter_t *next = NULL;
+
+    portENTER_CRITICAL_ISR(&arb->mux);
+    if (arb->owner == client && --arb->depth == 0) next = hand_over_locked(arb, now);
+    portEXIT_CRITICAL_ISR(&arb->mux);
+
+    if (next) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(next->sem, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+bool bus_arbiter_yield(bus_arbiter_t *arb, bus_client_t *client) {
+    if (!arb || !client) return false;
+    int64_t now = esp_timer_get_time();
+    bool hand_over = false;
+
+    portENTER_CRITICAL(&arb->mux);
+    if (arb->owner == client && arb->owner_task == xTaskGetCurrentTaskHandle() && arb->depth == 1) {
+        bool budget_spent = now - arb->owner_since_us >= arb->hold_budget_us[client->cls];
+        for (int c = 0; c < BUS_CLASS_COUNT && !hand_over; c++) {
+            bus_waiter_t *w = arb->head[c];
+            if (!w) continue;
+            hand_over = c < client->cls || budget_spent || now - w->since_us > arb->max_wait_us[c];
+        }
+    }
+    portEXIT_CRITICAL(&arb->mux);
+
+    if (!hand_over) return false;
+    bus_arbiter_release(arb, client);
+    bus_arbiter_acquire(arb, client);
+    return true;
+}
+
+uint32_t bus_arbiter_wait_percentile_us(const bus_client_t *client, uint8_t pct) {
+    if (!client || client->acquires == 0) return 0;
+    if (pct > 100) pct = 100;
+    uint64_t want = ((uint64_t)client->acquires * pct + 99) / 100;
+    uint64_t seen = 0;
+    for (int b = 0; b < BUS_ARBITER_HIST_BUCKETS - 1; b++) {
+        seen += client->hist[b];
+        if (seen >= want) return 16u << b;
+    }
+    return client->wait_max_us;
+}
+
+void bus_arbiter_print_stats(const bus_arbiter_t *arb) {
+    static const char *cls_name[BUS_CLASS_COUNT] = {"interactive", "bulk", "background"};
+    if (!arb || arb->client_count == 0) {
+        glog("Bus arbiter: no clients\n");
+        return;
+    }
+    for (int i = 0; i < arb->client_count; i++) {
+        const bus_client_t *c = &arb->clients[i];
+        glog("%-10s %-11s n=%lu wait avg=%luus p50<%luus p90<%luus p99<%luus max=%luus "
+               "hold avg=%luus max=%luus\n",
+               c->name, cls_name[c->cls], (unsigned long)c->acquires,
+               (unsigned long)(c->acquires ? c->wait_total_us / c->acquires : 0),
+               (unsigned long)bus_arbiter_wait_percentile_us(c, 50),
+               (unsigned long)bus_arbiter_wait_percentile_us(c, 90),
+               (unsigned long)bus_arbiter_wait_percentile_us(c, 99),
+               (unsigned long)c->wait_max_us,
+               (unsigned long)(c->acquires ? c->hold_total_us / c->acquires : 0),
+               (unsigned long)c->hold_max_us);
+        glog("           wait histogram:");
+        for (int b = 0; b < BUS_ARBITER_HIST_BUCKETS; b++) {
+            glog(" %lu", (unsigned long)c->hist[b]);
+        }
+        glog("\n");
+    }
+}
@@ -8,6 +8,7 @@
 #include "vendor/GPS/gps_logger.h"
 #include "vendor/pcap.h"
 #include "core/glog.h"
+#include "core/wifi_ie.h"
 #include <ctype.h>
 #include <esp_log.h>
 #include <string.h>
@@ -48,7 +49,6 @@ static inline bool is_on_target_channel(const wifi_promiscuous_pkt_t *pkt, uint8
 #define PROBE_DEDUPE_TIMEOUT_MS 1000
 #define MIN_RSSI_THRESHOLD -90  // Drop packets weaker than -90 dBm
 #define MIN_PACKET_LENGTH 24    // Minimum 802.11 header size
-#define MAX_IE_LEN 255
 static const uint8_t pineapple_ouis[][3] = {
     {0x00, 0x13, 0x37},
 };
@@ -884,6 +884,8 @@ void wifi_pineap_detector_callback(void *buf, wifi_promiscuous_pkt_type_t type)
         return;
 
     const wifi_promiscuous_pkt_t *ppkt = (wifi_promiscuous_pkt_t *)buf;
+    if (ppkt->rx_ctrl.sig_len < sizeof(wifi_ieee80211_mac_hdr_t))
+        return;
     const wifi_ieee80211_packet_t *ipkt = (wifi_ieee80211_packet_t *)ppkt->payload;
     wifi_ieee80211_mac_hdr_t hdr_copy;
     memcpy(&hdr_copy, &ipkt->hdr, sizeof(wifi_ieee80211_mac_hdr_t));  // Copy to avoid unaligned pointer
@@ -915,26 +917,13 @@ void wifi_pineap_detector_callback(void *buf, wifi_promiscuous_pkt_type_t type)
     log_oui_match_notice(network);
 
     // Extract SSID from beacon
-    const uint8_t *payload = ppkt->payload;
-    int len = ppkt->rx_ctrl.sig_len;
-
-    // Skip fixed parameters (24 bytes header + 12 bytes fixed params)
-    int index = 36;
-    if (index + 2 > len)
-        return;
-
-    // Look specifically for SSID element (ID = 0)
-    if (payload[index] != 0)
+    wifi_ie_info_t ie;
+    if (!wifi_ie_parse_mgmt(ppkt->payload, ppkt->rx_ctrl.sig_len, &ie) ||
+        !(ie.flags & WIFI_IE_F_SSID))
         return;
 
-    uint8_t ie_len = payload[index + 1];
-    if (ie_len > 32 || index + 2 + ie_len > len)
-        return;
-
-    // Get SSID
     char ssid[33] = {0};
-    memcpy(ssid, &payload[index + 2], ie_len);
-    ssid[ie_len] = '\0';
+    wifi_ie_copy_ssid(&ie, ssid, sizeof(ssid));
     trim_trailing(ssid);
 
     // Only proceed if this is a valid and unique SSID
@@ -997,6 +986,7 @@ void gps_event_handler(void *event_handler_arg, esp_event_base_t event_base, int
     case GPS_UPDATE:
         gps = (gps_t *)event_data;
         gps_try_sync_time_from_fix(gps);
+        gps_logger_record_fix(gps);
         break;
     default:
         break;
@@ -1114,6 +1104,9 @@ void wardriving_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
     }
 
     const wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
+    if (pkt->rx_ctrl.sig_len < sizeof(wifi_ieee80211_mac_hdr_t)) {
+        return;
+    }
     const wifi_ieee80211_packet_t *ipkt = (wifi_ieee80211_packet_t *)pkt->payload;
     wifi_ieee80211_mac_hdr_t hdr_copy;
     memcpy(&hdr_copy, &ipkt->hdr, sizeof(wifi_ieee80211_mac_hdr_t));
@@ -1128,111 +1121,33 @@ void wardriving_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
     }
 
     wardrive_wifi_frames_seen++;
+    int64_t heard_us = esp_timer_get_time();
+
+    wifi_ie_info_t ie;
+    if (!wifi_ie_parse_mgmt(payload, len, &ie)) {
+        return;
+    }
 
-    int index = 36;
     char ssid[33] = {0};
+    wifi_ie_copy_ssid(&ie, ssid, sizeof(ssid));
+    trim_trailing(ssid);
+
     uint8_t bssid[6];
     memcpy(bssid, hdr->addr3, 6);
 
     int rssi = pkt->rx_ctrl.rssi;
     int channel = pkt->rx_ctrl.channel;
 
-    char encryption_type[8] = "OPEN";
-    bool found_wpa = false;
-    bool found_rsn = false;
-
-    uint16_t capability_info = 0;
-    bool privacy_required = false;
-    if (len >= 36) {
-        capability_info = payload[34] | (payload[35] << 8);
-        privacy_required = (capability_info & (1 << 4)) != 0;
-    }
-
-    while (index + 1 < len) {
-        uint8_t id = payload[index];
-        uint8_t ie_len = payload[index + 1];
-
-        /* sanity checks: ensure IE length is reasonable and within bounds */
-        if (ie_len > MAX_IE_LEN || index + 2 + ie_len > len) {
-            break;
-        }
-
-        if (id == 0 && ie_len <= 32) {
-            memcpy(ssid, &payload[index + 2], ie_len);
-            ssid[ie_len] = '\0';
-            trim_trailing(ssid);
-        }
-
-        if (id == 48) {
-            size_t copy_len = sizeof(encryption_type) - 1;
-            strncpy(encryption_type, "WPA2", copy_len);
-            encryption_type[copy_len] = '\0';
-            found_rsn = true;
-
-            if (ie_len >= 8) {
-                const uint8_t *rsn = &payload[index + 2];
-                size_t pos = 0;
-                pos += 2; // version
-                if (pos + 4 > ie_len) goto rsn_done;
-                pos += 4; // group cipher
-                if (pos + 2 > ie_len) goto rsn_done;
-                uint16_t pairwise_count = rsn[pos] | (rsn[pos + 1] << 8);
-                pos += 2;
-                size_t pairwise_len = pairwise_count * 4;
-                if (pos + pairwise_len > ie_len) goto rsn_done;
-                pos += pairwise_len;
-                if (pos + 2 > ie_len) goto rsn_done;
-                uint16_t akm_count = rsn[pos] | (rsn[pos + 1] << 8);
-                pos += 2;
-                for (uint16_t i = 0; i < akm_count; i++) {
-                    if (pos + 4 > ie_len) break;
-                    uint32_t akm = rsn[pos] | (rsn[pos + 1] << 8) | (rsn[pos + 2] << 16) |
-                                    (rsn[pos + 3] << 24);
-                    if (akm == 0x000FAC08) {
-                        strncpy(encryption_type, "WPA3", copy_len);
-                        encryption_type[copy_len] = '\0';
-                        break;
-                    } else if (akm == 0x000FAC09) {
-                        strncpy(encryption_type, "OWE", copy_len);
-                        encryption_type[copy_len] = '\0';
-                        break;
-                    }
-                    pos += 4;
-                }
-            }
-rsn_done:
-            
-        } else if (id == 221) {
-            uint32_t oui =
-                (payload[index + 2] << 16) | (payload[index + 3] << 8) | payload[index + 4];
-            uint8_t oui_type = payload[index + 5];
-            if (oui == 0x0050f2 && oui_type == 0x01) {
-                size_t copy_len = sizeof(encryption_type) - 1;
-                strncpy(encryption_type, "WPA", copy_len);
-                encryption_type[copy_len] = '\0';
-                found_wpa = true;
-            }
-        }
-
-        index += (2 + ie_len);
-    }
-
-    if (!found_rsn && !found_wpa) {
-        size_t copy_len = sizeof(encryption_type) - 1;
-        if (privacy_required) {
-            strncpy(encryption_type, "WEP", copy_len);
-        } else {
-            strncpy(encryption_type, "OPEN", copy_len);
-        }
-        encryption_type[copy_len] = '\0';
-    }
+    char encryption_type[8];
+    strncpy(encryption_type, wifi_ie_security_label(&ie), sizeof(encryption_type) - 1);
+    encryption_type[sizeof(encryption_type) - 1] = '\0';
 
     double latitude = 0;
     double longitude = 0;
 
     if (gps != NULL) {
-        latitude = gps->latitude;
-        longitude = gps->longitude;
+        latitude = gps_latitude_deg(gps);
+        longitude = gps_longitude_deg(gps);
     }
 
     wardriving_data_t wardriving_data = {0};
@@ -1241,10 +1156,13 @@ rsn_done:
     wardriving_data.ssid[sizeof(wardriving_data.ssid) - 1] = '\0'; // Null-terminate
     snprintf(wardriving_data.bssid, sizeof(wardriving_data.bssid), "%02x:%02x:%02x:%02x:%02x:%02x",
              bssid[0], bssid[1], bssid[2], bssid[3], bssid[4], bssid[5]);
+    memcpy(wardriving_data.bssid_addr, bssid, 6);
+    wardriving_data.has_bssid_addr = true;
     wardriving_data.rssi = rssi;
     wardriving_data.channel = channel;
     wardriving_data.latitude = latitude;
     wardriving_data.longitude = longitude;
+    wardriving_data.capture_us = heard_us;
     strncpy(wardriving_data.encryption_type, encryption_type,
             sizeof(wardriving_data.encryption_type) - 1);
     wardriving_data.encryption_type[sizeof(wardriving_data.encryption_type) - 1] = '\0';
@@ -1405,24 +1323,9 @@ void wifi_eapol_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
             const uint8_t *src = frame + 10; // addr2
             // parse SSID element
             char ssid[33] = {0};
-            bool ssid_found = false;
-            int index = 24;
-            if (pkt->rx_ctrl.sig_len > index) {
-                const uint8_t *body = frame + index;
-                int body_len = pkt->rx_ctrl.sig_len - index;
-                for (int i = 0; i < body_len - 1; i += 2 + body[i+1]) {
-                    uint8_t tag_num = body[i];
-                    uint8_t tag_len = body[i+1];
-                    if (tag_num == 0 && tag_len < sizeof(ssid) && i + 2 + tag_len <= body_len) {
-                        memcpy(ssid, &body[i+2], tag_len);
-                        ssid[tag_len] = '\0';
-                        if (tag_len == 0) strcpy(ssid, "Broadcast");
-                        ssid_found = true;
-                        break;
-                    }
-                }
-                if (!ssid_found) strcpy(ssid, "Broadcast");
-            }
+            wifi_ie_info_t ie;
+            wifi_ie_parse_mgmt(frame, pkt->rx_ctrl.sig_len, &ie);
+            if (wifi_ie_copy_ssid(&ie, ssid, sizeof(ssid)) == 0) strcpy(ssid, "Broadcast");
             uint32_t h = hash_ssid(ssid);
             uint64_t now_ms = esp_timer_get_time() / 1000ULL;
             if (probe_should_emit(src, h, now_ms)) {
@@ -1433,10 +1336,11 @@ void wifi_eapol_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
 
         // limited beacons and probe responses
         if (subtype == WIFI_PKT_BEACON || subtype == WIFI_PKT_PROBE_RESP) {
-            if (pkt->rx_ctrl.sig_len >= 38) {
+            wifi_ie_info_t ie;
+            if (wifi_ie_parse_mgmt(frame, pkt->rx_ctrl.sig_len, &ie) &&
+                pkt->rx_ctrl.sig_len >= 38) {
                 const uint8_t *bssid = frame + 16;
-                uint8_t ssid_len = frame[37];
-                bool ssid_nonempty = ssid_len > 0;
+                bool ssid_nonempty = ie.ssid_len > 0;
                 if (beacon_should_emit_limited(bssid, ssid_nonempty)) {
                     enqueue_pcap_write(pkt->payload, pkt->rx_ctrl.sig_len);
                 }
@@ -1463,94 +1367,55 @@ void wifi_wps_detection_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
         return;
     }
 
-    int index = 36;
+    wifi_ie_info_t ie;
+    if (!wifi_ie_parse_mgmt(payload, len, &ie) || !(ie.flags & WIFI_IE_F_WPS)) {
+        return;
+    }
+
     char ssid[33] = {0};
-    bool wps_found = false;
+    wifi_ie_copy_ssid(&ie, ssid, sizeof(ssid));
+    trim_trailing(ssid);
+
     uint8_t bssid[6];
     memcpy(bssid, hdr->addr3, 6);
 
-    while (index + 1 < len) {
-        uint8_t id = payload[index];
-        uint8_t ie_len = payload[index + 1];
+    if (is_network_duplicate(ssid, bssid)) {
+        return;
+    }
 
-        /* sanity checks: ensure IE length is reasonable and within bounds */
-        if (ie_len > MAX_IE_LEN || index + 2 + ie_len > len) {
-            break;
-        }
+    if (!(ie.flags & WIFI_IE_F_WPS_METHODS)) {
+        return;
+    }
 
-        if (id == 0 && ie_len <= 32) {
-            memcpy(ssid, &payload[index + 2], ie_len);
-            ssid[ie_len] = '\0';
-            trim_trailing(ssid);
-        }
+    uint16_t config_methods = ie.wps_config_methods;
+    IRAM_PRINTF("Configuration Methods found: 0x%04x\n", config_methods);
 
-        if (is_network_duplicate(ssid, bssid)) {
-            return;
-        }
+    if (config_methods & WPS_CONF_METHODS_PBC) {
+        glog("WPS Push Button detected:\n%s\n", ssid);
+    } else if (config_methods & (WPS_CONF_METHODS_PIN_DISPLAY | WPS_CONF_METHODS_PIN_KEYPAD)) {
+        glog("WPS PIN detected:\n%s\n", ssid);
+    }
 
-        if (id == 221 && ie_len >= 4) {
-            uint32_t oui =
-                (payload[index + 2] << 16) | (payload[index + 3] << 8) | payload[index + 4];
-            uint8_t oui_type = payload[index + 5];
-
-            if (oui == 0x0050f2 && oui_type == 0x04) {
-                wps_found = true;
-
-                int attr_index = index + 6;
-                int wps_ie_end = index + 2 + ie_len;
-
-                while (attr_index + 4 <= wps_ie_end) {
-                    uint16_t attr_id = (payload[attr_index] << 8) | payload[attr_index + 1];
-                    uint16_t attr_len = (payload[attr_index + 2] << 8) | payload[attr_index + 3];
-
-                    /* sanity: attr_len must be reasonable and fit inside the WPS IE */
-                    if (attr_len > MAX_IE_LEN || attr_len > (wps_ie_end - (attr_index + 4))) {
-                        break;
-                    }
-
-                    if (attr_id == 0x1008 && attr_len == 2) {
-                        uint16_t config_methods =
-                            (payload[attr_index + 4] << 8) | payload[attr_index + 5];
-
-                        IRAM_PRINTF("Configuration Methods found: 0x%04x\n", config_methods);
-
-                        if (config_methods & WPS_CONF_METHODS_PBC) {
-                            glog("WPS Push Button detected:\n%s\n", ssid);
-                        } else if (config_methods &
-                                   (WPS_CONF_METHODS_PIN_DISPLAY | WPS_CONF_METHODS_PIN_KEYPAD)) {
-                            glog("WPS PIN detected:\n%s\n", ssid);
-                        }
-
-                        if (should_store_wps == 1) {
-                            wps_network_t new_network;
-                            strncpy(new_network.ssid, ssid, sizeof(new_network.ssid) - 1);
-                            new_network.ssid[sizeof(new_network.ssid) - 1] =
-                                '\0'; // Ensure null termination
-                            memcpy(new_network.bssid, bssid, sizeof(new_network.bssid));
-                            new_network.wps_enabled = true;
-                            new_network.wps_mode = config_methods & (WPS_CONF_METHODS_PIN_DISPLAY |
-                                                                     WPS_CONF_METHODS_PIN_KEYPAD)
-                                                       ? WPS_MODE_PIN
-                                                       : WPS_MODE_PBC;
-
-                            detected_wps_networks[detected_network_count++] = new_network;
-                        } else {
-                            enqueue_pcap_write(pkt->payload, pkt->rx_ctrl.sig_len);
-                        }
-
-                        if (detected_network_count >= MAX_WPS_NETWORKS) {
-                            glog("Maximum number of WPS networks detected\nStopping "
-                                 "monitor mode.\n");
-                            wifi_manager_stop_monitor_mode();
-                        }
-                    }
-
-                    attr_index += (4 + attr_len);
-                }
-            }
-        }
+    if (should_store_wps == 1) {
+        wps_network_t new_network;
+        strncpy(new_network.ssid, ssid, sizeof(new_network.ssid) - 1);
+        new_network.ssid[sizeof(new_network.ssid) - 1] = '\0'; // Ensure null termination
+        memcpy(new_network.bssid, bssid, sizeof(new_network.bssid));
+        new_network.wps_enabled = true;
+        new_network.wps_mode =
+            config_methods & (WPS_CONF_METHODS_PIN_DISPLAY | WPS_CONF_METHODS_PIN_KEYPAD)
+                ? WPS_MODE_PIN
+                : WPS_MODE_PBC;
 
-        index += (2 + ie_len);
+        detected_wps_networks[detected_network_count++] = new_network;
+    } else {
+        enqueue_pcap_write(pkt->payload, pkt->rx_ctrl.sig_len);
+    }
+
+    if (detected_network_count >= MAX_WPS_NETWORKS) {
+        glog("Maximum number of WPS networks detected\nStopping "
+             "monitor mode.\n");
+        wifi_manager_stop_monitor_mode();
     }
 }
 
@@ -1574,12 +1439,15 @@ void ble_wardriving_callback(struct ble_gap_event *event, void *arg) {
 
     wardriving_data_t wardriving_data = {0};
     wardriving_data.ble_data.is_ble_device = true;
+    wardriving_data.capture_us = esp_timer_get_time();
 
     // Get BLE MAC and RSSI
     snprintf(wardriving_data.ble_data.ble_mac, sizeof(wardriving_data.ble_data.ble_mac),
              "%02x:%02x:%02x:%02x:%02x:%02x", event->disc.addr.val[0], event->disc.addr.val[1],
              event->disc.addr.val[2], event->disc.addr.val[3], event->disc.addr.val[4],
              event->disc.addr.val[5]);
+    memcpy(wardriving_data.ble_data.ble_addr, event->disc.addr.val, 6);
+    wardriving_data.ble_data.has_addr = true;
 
     wardriving_data.ble_data.ble_rssi = event->disc.rssi;
 
@@ -1806,25 +1674,10 @@ void wifi_listen_probes_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
     format_mac_address(hdr->addr2, src_mac_str, sizeof(src_mac_str), false);
     char dest_mac_str[18];
     format_mac_address(hdr->addr1, dest_mac_str, sizeof(dest_mac_str), false);
-    int index = 24;
     char ssid[33] = {0};
-    bool ssid_found = false;
-    if (pkt->rx_ctrl.sig_len > index) {
-        const uint8_t *body = payload + index;
-        int body_len = pkt->rx_ctrl.sig_len - index;
-        for (int i = 0; i < body_len - 1; i += 2 + body[i+1]) {
-            uint8_t tag_num = body[i];
-            uint8_t tag_len = body[i+1];
-            if (tag_num == 0 && tag_len < sizeof(ssid) && i + 2 + tag_len <= body_len) {
-                memcpy(ssid, &body[i+2], tag_len);
-                ssid[tag_len] = '\0';
-                if (tag_len == 0) strcpy(ssid, "Broadcast");
-                ssid_found = true;
-                break;
-            }
-        }
-        if (!ssid_found) strcpy(ssid, "Broadcast");
-    }
+    wifi_ie_info_t ie;
+    wifi_ie_parse_mgmt(payload, pkt->rx_ctrl.sig_len, &ie);
+    if (wifi_ie_copy_ssid(&ie, ssid, sizeof(ssid)) == 0) strcpy(ssid, "Broadcast");
 
     // Build log message
     char log_msg[128];
@@ -0,0 +1,184 @@
+#include "core/comm_link.h"
+#include <string.h>
+
+enum {
+    RX_WAIT_START = 0,
+    RX_HEADER,
+    RX_PAYLOAD,
+    RX_CRC,
+};
+
+static const uint32_t crc32_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4,
+    0x4DB26158, 0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+uint32_t comm_link_crc32(uint32_t crc, const uint8_t *data, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+void comm_link_init(comm_link_t *link, uint32_t rto_ms) {
+    memset(link, 0, sizeof(*link));
+    link->rto_ms = rto_ms;
+}
+
+uint32_t comm_link_rto_for_baud(uint32_t baud) {
+    if (baud == 0) baud = 115200;
+    uint64_t bits = (uint64_t)(COMM_LINK_WINDOW + 1) * COMM_LINK_FRAME_MAX * 11;
+    return (uint32_t)(bits * 1000 / baud) + 50;
+}
+
+static size_t encode_frame(uint8_t type, uint8_t seq, const uint8_t *prefix, size_t prefix_len,
+                           const uint8_t *payload, size_t payload_len, uint8_t *out) {
+    size_t len = prefix_len + payload_len;
+    out[0] = COMM_LINK_START_BYTE;
+    out[1] = type;
+    out[2] = seq;
+    out[3] = (uint8_t)len;
+    out[4] = (uint8_t)(len >> 8);
+    if (prefix_len) memcpy(out + COMM_LINK_HDR_LEN, prefix, prefix_len);
+    if (payload_len) memcpy(out + COMM_LINK_HDR_LEN + prefix_len, payload, payload_len);
+    uint32_t crc = comm_link_crc32(0, out + 1, COMM_LINK_HDR_LEN - 1 + len);
+    uint8_t *c = out + COMM_LINK_HDR_LEN + len;
+    c[0] = (uint8_t)crc;
+    c[1] = (uint8_t)(crc >> 8);
+    c[2] = (uint8_t)(crc >> 16);
+    c[3] = (uint8_t)(crc >> 24);
+    return COMM_LINK_HDR_LEN + len + COMM_LINK_CRC_LEN;
+}
+
+bool comm_link_window_full(const comm_link_t *link) {
+    return (uint8_t)(link->tx_next - link->tx_base) >= COMM_LINK_WINDOW;
+}
+
+bool comm_link_queue(comm_link_t *link, uint8_t type, const uint8_t *prefix, size_t prefix_len,
+                     const uint8_t *payload, size_t len) {
+    if (prefix_len + len > COMM_LINK_MAX_PAYLOAD || comm_link_window_full(link)) return false;
+    uint8_t slot = link->tx_next % COMM_LINK_WINDOW;
+    link->tx_frame_len[slot] = (uint16_t)encode_frame(type, link->tx_next, prefix, prefix_len,
+                                                      payload, len, link->tx_frames[slot]);
+    link->tx_next++;
+    return true;
+}
+
+size_t comm_link_next_tx(comm_link_t *link, uint32_t now_ms, uint8_t *out) {
+    if (link->ack_pending) {
+        link->ack_pending = false;
+        return encode_frame(COMM_LINK_TYPE_ACK, link->rx_expected, NULL, 0, NULL, 0, out);
+    }
+
+    bool outstanding = link->tx_sent != link->tx_base;
+    if (outstanding && (int32_t)(now_ms - link->tx_deadline_ms) >= 0) {
+        // go back n: resend everything from the oldest unacked frame
+        link->tx_sent = link->tx_base;
+        link->tx_rewound = true;
+        link->retransmits++;
+    }
+
+    if (link->tx_sent == link->tx_next) return 0;
+
+    uint8_t slot = link->tx_sent % COMM_LINK_WINDOW;
+    size_t len = link->tx_frame_len[slot];
+    memcpy(out, link->tx_frames[slot], len);
+    link->tx_sent++;
+    link->tx_deadline_ms = now_ms + link->rto_ms;
+    link->frames_tx++;
+    return len;
+}
+
+static void handle_ack(comm_link_t *link, uint8_t next_expected, uint32_t now_ms) {
+    uint8_t acked = (uint8_t)(next_expected - link->tx_base);
+    if (acked == 0) {
+        // duplicate ack: the peer lost tx_base, rewind once instead of waiting for the rto
+        if (link->tx_sent != link->tx_base && !link->tx_rewound) {
+            link->tx_sent = link->tx_base;
+            link->tx_rewound = true;
+            link->retransmits++;
+        }
+        return;
+    }
+    if (acked > (uint8_t)(link->tx_next - link->tx_base)) return; // stale
+
+    link->tx_base = next_expected;
+    link->tx_rewound = false;
+    if ((uint8_t)(link->tx_sent - link->tx_base) > (uint8_t)(link->tx_next - link->tx_base)) {
+        link->tx_sent = link->tx_base;
+    }
+    link->tx_deadline_ms = now_ms + link->rto_ms;
+}
+
+comm_link_rx_result_t comm_link_rx_byte(comm_link_t *link, uint8_t byte, uint32_t now_ms) {
+    switch (link->rx_state) {
+    case RX_WAIT_START:
+        if (byte == COMM_LINK_START_BYTE) {
+            link->rx_frame[0] = byte;
+            link->rx_pos = 1;
+            link->rx_state = RX_HEADER;
+        }
+        return COMM_LINK_RX_NONE;
+
+    case RX_HEADER:
+        link->rx_frame[link->rx_pos++] = byte;
+        if (link->rx_pos < COMM_LINK_HDR_LEN) return COMM_LINK_RX_NONE;
+        link->rx_len = (uint16_t)(link->rx_frame[3] | (link->rx_frame[4] << 8));
+        if (link->rx_len > COMM_LINK_MAX_PAYLOAD) {
+            link->rx_state = RX_WAIT_START;
+            return COMM_LINK_RX_NONE;
+        }
+        link->rx_state = link->rx_len ? RX_PAYLOAD : RX_CRC;
+        return COMM_LINK_RX_NONE;
+
+    case RX_PAYLOAD:
+        link->rx_frame[link->rx_pos++] = byte;
+        if (link->rx_pos == COMM_LINK_HDR_LEN + link->rx_len) link->rx_state = RX_CRC;
+        return COMM_LINK_RX_NONE;
+
+    case RX_CRC:
+    default:
+        link->rx_frame[link->rx_pos++] = byte;
+        if (link->rx_pos < COMM_LINK_HDR_LEN + link->rx_len + COMM_LINK_CRC_LEN) {
+            return COMM_LINK_RX_NONE;
+        }
+        link->rx_state = RX_WAIT_START;
+        break;
+    }
+
+    const uint8_t *c = link->rx_frame + COMM_LINK_HDR_LEN + link->rx_len;
+    uint32_t want = (uint32_t)c[0] | ((uint32_t)c[1] << 8) | ((uint32_t)c[2] << 16) |
+                    ((uint32_t)c[3] << 24);
+    if (comm_link_crc32(0, link->rx_frame + 1, COMM_LINK_HDR_LEN - 1 + link->rx_len) != want) {
+        link->crc_errors++;
+        return COMM_LINK_RX_NONE;
+    }
+
+    uint8_t type = link->rx_frame[1];
+    uint8_t seq = link->rx_frame[2];
+    if (type == COMM_LINK_TYPE_ACK) {
+        handle_ack(link, seq, now_ms);
+        return COMM_LINK_RX_CONTROL;
+    }
+
+    if (seq != link->rx_expected) {
+        // duplicate or past a lost frame: repeat our position so the peer rewinds
+        link->out_of_order++;
+        link->ack_pending = true;
+        return COMM_LINK_RX_CONTROL;
+    }
+
+    link->rx_type = type;
+    link->rx_payload = link->rx_frame + COMM_LINK_HDR_LEN;
+    return COMM_LINK_RX_DATA;
+}
+
+void comm_link_rx_commit(comm_link_t *link) {
+    link->rx_expected++;
+    link->ack_pending = true;
+    link->frames_rx++;
+}
@@ -0,0 +1,124 @@
+#include "core/command_table.h"
+#include <ctype.h>
+#include <stddef.h>
+#include <string.h>
+
+#define COMMAND_TABLE_MASK (COMMAND_TABLE_SIZE - 1)
+
+static inline uint32_t command_hash(const char *name) {
+    // fnv-1a
+    uint32_t h = 2166136261u;
+    while (*name) {
+        h ^= (uint8_t)*name++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// slot holding name, or the empty slot where it would go (NULL when full)
+static Command *command_slot(const command_table_t *table, const char *name) {
+    uint32_t idx = command_hash(name) & COMMAND_TABLE_MASK;
+    for (uint32_t probe = 0; probe < COMMAND_TABLE_SIZE; probe++) {
+        const Command *slot = &table->slots[(idx + probe) & COMMAND_TABLE_MASK];
+        if (slot->name == NULL || strcmp(slot->name, name) == 0) {
+            return (Command *)slot;
+        }
+    }
+    return NULL;
+}
+
+void command_table_init(command_table_t *table) {
+    memset(table, 0, sizeof(*table));
+}
+
+int command_table_add(command_table_t *table, const char *name, CommandFunction function) {
+    Command *slot = command_slot(table, name);
+    if (slot != NULL && slot->name != NULL) {
+        return 0;
+    }
+    // keep one slot free so a miss always ends on an empty slot
+    if (slot == NULL || table->count >= COMMAND_TABLE_SIZE - 1) {
+        return -1;
+    }
+    slot->name = name;
+    slot->function = function;
+    table->count++;
+    return 1;
+}
+
+void command_table_remove(command_table_t *table, const char *name) {
+    Command *slot = command_slot(table, name);
+    if (slot == NULL || slot->name == NULL) {
+        return;
+    }
+
+    // backward-shift the rest of the probe run so lookups never stop early
+    uint32_t hole = (uint32_t)(slot - table->slots);
+    uint32_t next = hole;
+    for (;;) {
+        next = (next + 1) & COMMAND_TABLE_MASK;
+        Command *cand = &table->slots[next];
+        if (cand->name == NULL) {
+            break;
+        }
+        uint32_t home = command_hash(cand->name) & COMMAND_TABLE_MASK;
+        // leave entries whose home lies cyclically in (hole, next]
+        if (((next - home) & COMMAND_TABLE_MASK) < ((next - hole) & COMMAND_TABLE_MASK)) {
+            continue;
+        }
+        table->slots[hole] = *cand;
+        hole = next;
+    }
+    table->slots[hole].name = NULL;
+    table->slots[hole].function = NULL;
+    table->count--;
+}
+
+CommandFunction command_table_find(const command_table_t *table, const char *name) {
+    const Command *slot = command_slot(table, name);
+    return (slot && slot->name) ? slot->function : NULL;
+}
+
+int command_tokenize(char *p, char **argv) {
+    int argc = 0;
+
+    while (*p != '\0') {
+        while (isspace((unsigned char)*p)) {
+            p++;
+        }
+
+        if (*p == '\0') {
+            break;
+        }
+
+        if (*p == '"' || *p == '\'') {
+            char quote = *p++;
+            if (argv) argv[argc] = p;
+            argc++;
+
+            while (*p != '\0' && *p != quote) {
+                p++;
+            }
+
+            if (*p != quote) {
+                return -1;
+            }
+            if (argv) *p = '\0';
+            p++;
+        } else {
+            if (argv) argv[argc] = p;
+            argc++;
+
+            while (*p != '\0' && !isspace((unsigned char)*p)) {
+                p++;
+            }
+
+            if (*p != '\0') {
+                if (argv) *p = '\0';
+                p++;
+            }
+        }
+    }
+
+    return argc;
+}
@@ -71,6 +71,7 @@ void* esp_netif_get_netif_impl(esp_netif_t *esp_netif);
 #include "esp_chip_info.h"
 #include "esp_idf_version.h"
 #include "managers/chameleon_manager.h"
+#include "managers/nfc/flipper_nfc_compat.h"
 #include <stddef.h>
 #include <ctype.h>
 #include "freertos/FreeRTOS.h"
@@ -78,6 +79,7 @@ void* esp_netif_get_netif_impl(esp_netif_t *esp_netif);
 #include "esp_heap_caps.h"
 #include "esp_heap_trace.h"
 #include <dirent.h>
+#include "managers/infrared_file.h"
 #include "managers/infrared_manager.h"
 #include "core/universal_ir.h"
 #include "core/screen_mirror.h"
@@ -105,7 +107,7 @@ static const char *TAG = "Commandline";
 #endif
 #endif
 
-static Command *command_list_head = NULL;
+static command_table_t command_table;
 TaskHandle_t VisualizerHandle = NULL;
 TaskHandle_t gps_info_task_handle = NULL;
 
@@ -172,62 +174,17 @@ static void chameleon_cli_progress_cb(int current, int total, void *user) {
     }
 }
 
-void command_init() { command_list_head = NULL; }
+void command_init() { command_table_init(&command_table); }
 
 void register_command(const char *name, CommandFunction function) {
-    // Check if the command already exists
-    Command *current = command_list_head;
-    while (current != NULL) {
-        if (strcmp(current->name, name) == 0) {
-            // Command already registered
-            return;
-        }
-        current = current->next;
-    }
-
-    // Create a new command
-    Command *new_command = (Command *)malloc(sizeof(Command));
-    if (new_command == NULL) {
-        // Handle memory allocation failure
-        return;
+    if (command_table_add(&command_table, name, function) < 0) {
+        printf("Command table full, dropping \"%s\"\n", name);
     }
-    new_command->name = strdup(name);
-    new_command->function = function;
-    new_command->next = command_list_head;
-    command_list_head = new_command;
 }
 
-void unregister_command(const char *name) {
-    Command *current = command_list_head;
-    Command *previous = NULL;
+void unregister_command(const char *name) { command_table_remove(&command_table, name); }
 
-    while (current != NULL) {
-        if (strcmp(current->name, name) == 0) {
-            // Found the command to remove
-            if (previous == NULL) {
-                command_list_head = current->next;
-            } else {
-                previous->next = current->next;
-            }
-            free(current->name);
-            free(current);
-            return;
-        }
-        previous = current;
-        current = current->next;
-    }
-}
-
-CommandFunction find_command(const char *name) {
-    Command *current = command_list_head;
-    while (current != NULL) {
-        if (strcmp(current->name, name) == 0) {
-            return current->function;
-        }
-        current = current->next;
-    }
-    return NULL;
-}
+CommandFunction find_command(const char *name) { return command_table_find(&command_table, name); }
 
 void handle_unknown_command(const char *cmd) {
     glog("Unsupported command: %s\n", cmd);
@@ -3841,6 +3798,7 @@ void handle_help(int argc, char **argv) {
         glog("sd mkdir\n    Create directory.\n    Usage: sd mkdir <path>\n\n");
         glog("sd rm\n    Delete file or empty directory.\n    Usage: sd rm <index|path>\n\n");
         glog("sd tree\n    Recursive listing.\n    Usage: sd tree [path] [depth]\n\n");
+        glog("sd bus\n    Wait and hold times on an SPI bus shared with the display.\n    Usage: sd bus\n\n");
         glog("-- Pin Configuration --\n");
         glog("sd_config\n    Show current SD GPIO pin configuration.\n    Usage: sd_config\n\n");
         glog("sd_pins_mmc\n    Set GPIO pins for SDMMC mode.\n    Usage: sd_pins_mmc <clk> <cmd> <d0> <d1> <d2> <d3>\n\n");
@@ -3894,6 +3852,9 @@ void handle_help(int argc, char **argv) {
         glog("scanarp\n");
         glog("    Description: Perform ARP scan on local network to discover active hosts\n");
         glog("    Usage: scanarp\n\n");
+        glog("nfc stats\n");
+        glog("    Description: Per parser counts and parse time for MIFARE Classic dumps since boot\n");
+        glog("    Usage: nfc stats\n\n");
         glog("settings\n");
         glog("    Description: Manage NVS stored settings via command line\n");
         glog("    Usage: settings <command> [arguments]\n");
@@ -4860,6 +4821,7 @@ void handle_sd_cmd(int argc, char **argv) {
         glog("  sd mkdir <path>                  - Create directory\n");
         glog("  sd rm <idx|path>                 - Delete file or empty directory\n");
         glog("  sd tree [path] [depth]           - Recursive listing\n");
+        glog("  sd bus                           - Shared SPI bus wait statistics\n");
         return;
     }
 
@@ -4894,6 +4856,17 @@ void handle_sd_cmd(int argc, char **argv) {
         return;
     }
 
+    if (strcmp(sub, "bus") == 0) {
+        bus_arbiter_t *arb = sd_card_bus_arbiter();
+        if (!arb) {
+            glog("SD:BUS:shared=false\n");
+            return;
+        }
+        glog("SD:BUS:shared=true\n");
+        bus_arbiter_print_stats(arb);
+        return;
+    }
+
     if (strcmp(sub, "list") == 0) {
         if (!sd_cli_ensure_mounted()) {
             glog("SD:ERR:not_mounted\n");
@@ -4920,7 +4893,8 @@ void handle_sd_cmd(int argc, char **argv) {
 
         struct dirent *entry;
         while ((entry = readdir(d)) != NULL) {
-            if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+            // also hides the numbering and ir index caches
+            if (entry->d_name[0] == '.') continue;
 
             char fullpath[512];
             snprintf(fullpath, sizeof(fullpath), "%s/%s", path, entry->d_name);
@@ -5254,6 +5228,7 @@ void handle_sd_cmd(int argc, char **argv) {
             ret = rmdir(resolved);
         } else {
             ret = unlink(resolved);
+            if (ret == 0) infrared_file_index_forget(resolved);
         }
 
         if (ret == 0) {
@@ -5309,7 +5284,7 @@ void handle_sd_cmd(int argc, char **argv) {
 
             struct dirent *entry;
             while ((entry = readdir(d)) != NULL && count < 500) {
-                if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) continue;
+                if (entry->d_name[0] == '.') continue;
 
                 char full[512];
                 snprintf(full, sizeof(full), "%s/%s", cur, entry->d_name);
@@ -5630,7 +5605,8 @@ void handle_sweep_cmd(int argc, char **argv) {
                     aps[i].primary, freq, aps[i].rssi, auth, cipher, phy_modes,
                     aps[i].wps ? "Yes" : "No");
             if (gps && gps->valid) {
-                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps->latitude, gps->longitude, gps->altitude, timestamp);
+                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps_latitude_deg(gps), gps_longitude_deg(gps),
+                        gps_altitude_m(gps), timestamp);
             } else {
                 fprintf(report, ",,,%s\n", timestamp);
             }
@@ -5657,7 +5633,8 @@ void handle_sweep_cmd(int argc, char **argv) {
                     station_ap_list[i].ap_bssid[2], station_ap_list[i].ap_bssid[3],
                     station_ap_list[i].ap_bssid[4], station_ap_list[i].ap_bssid[5]);
             if (gps && gps->valid) {
-                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps->latitude, gps->longitude, gps->altitude, timestamp);
+                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps_latitude_deg(gps), gps_longitude_deg(gps),
+                        gps_altitude_m(gps), timestamp);
             } else {
                 fprintf(report, ",,,%s\n", timestamp);
             }
@@ -5686,7 +5663,8 @@ void handle_sweep_cmd(int argc, char **argv) {
             fprintf(report, ",%02X:%02X:%02X:%02X:%02X:%02X,,,,%d,,,,",
                     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5], rssi);
             if (gps && gps->valid) {
-                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps->latitude, gps->longitude, gps->altitude, timestamp);
+                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps_latitude_deg(gps), gps_longitude_deg(gps),
+                        gps_altitude_m(gps), timestamp);
             } else {
                 fprintf(report, ",,,%s\n", timestamp);
             }
@@ -5713,7 +5691,8 @@ void handle_sweep_cmd(int argc, char **argv) {
             fprintf(report, ",%02X:%02X:%02X:%02X:%02X:%02X,,,,%d,,,,",
                     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5], rssi);
             if (gps && gps->valid) {
-                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps->latitude, gps->longitude, gps->altitude, timestamp);
+                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps_latitude_deg(gps), gps_longitude_deg(gps),
+                        gps_altitude_m(gps), timestamp);
             } else {
                 fprintf(report, ",,,%s\n", timestamp);
             }
@@ -5754,7 +5733,8 @@ void handle_sweep_cmd(int argc, char **argv) {
                         dev.addr[0], dev.addr[1], dev.channel, dev.rssi);
             }
             if (gps && gps->valid) {
-                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps->latitude, gps->longitude, gps->altitude, timestamp);
+                fprintf(report, "%.6f,%.6f,%.1f,%s\n", gps_latitude_deg(gps), gps_longitude_deg(gps),
+                        gps_altitude_m(gps), timestamp);
             } else {
                 fprintf(report, ",,,%s\n", timestamp);
             }
@@ -6223,7 +6203,7 @@ void handle_comm_setpins(int argc, char **argv) {
 }
 
 static void comm_command_callback(const char* command, const char* data, void* user_data) {
-    static char full_command[128];
+    static char full_command[320]; // "peer:" + command + framed link data
     
 #ifdef CONFIG_WITH_ETHERNET
     if (strcmp(command, "stop") == 0) {
@@ -6855,6 +6835,24 @@ static bool ir_cli_is_number(const char *s) {
     return true;
 }
 
+static void ir_cli_print_unique(const char *path, const char *const *names, size_t count) {
+    size_t unique = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool seen = false;
+        for (size_t j = 0; j < i && !seen; j++) seen = strcmp(names[j], names[i]) == 0;
+        if (!seen) unique++;
+    }
+    glog("Unique buttons in %s (%zu):\n", path, unique);
+    size_t idx = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool seen = false;
+        for (size_t j = 0; j < i && !seen; j++) seen = strcmp(names[j], names[i]) == 0;
+        if (seen) continue;
+        glog("  [%d] %s\n", (int)idx, names[i]);
+        idx++;
+    }
+}
+
 static void resolve_ir_path(const char *input, char *output, size_t max_len) {
     if (!input || strlen(input) == 0) {
         snprintf(output, max_len, "/mnt/ghostesp/infrared/remotes");
@@ -6934,7 +6932,27 @@ static void ir_universal_send_task(void *arg) {
     } else {
         infrared_signal_t *signals = NULL;
         size_t count = 0;
-        if (!infrared_manager_read_list(path, &signals, &count)) {
+        infrared_file_index_t index;
+        if (infrared_file_index_open(path, &index)) {
+            // only the matching signals get parsed
+            size_t sent = 0;
+            glog("IR: universal sendall '%s' from %s (%zu signals)\n", button, path, index.count);
+            for (size_t i = 0; i < index.count && !g_ir_universal_send_cancel; ++i) {
+                infrared_signal_t sig;
+                if (strcmp(infrared_file_index_name(&index, i), button) != 0) continue;
+                if (!infrared_file_index_load(&index, i, &sig)) continue;
+                glog("IR: universal sendall %s [index %d]\n", button, (int)i);
+                bool ok = infrared_manager_transmit(&sig);
+                glog("IR: universal sendall %s -> %s\n", button, ok ? "OK" : "FAIL");
+                infrared_manager_free_signal(&sig);
+                sent++;
+                vTaskDelay(pdMS_TO_TICKS(delay_ms));
+            }
+            if (sent == 0) {
+                glog("IR: no signals named '%s' in %s\n", button, path);
+            }
+            infrared_file_index_close(&index);
+        } else if (!infrared_manager_read_list(path, &signals, &count)) {
             glog("IR: failed to read universal file %s\n", path);
         } else if (count == 0) {
             infrared_manager_free_list(signals, count);
@@ -7106,6 +7124,23 @@ static void ir_rx_learn_task(void *arg) {
     vTaskDelete(NULL);
 }
 
+void handle_nfc_cmd(int argc, char **argv) {
+    if (argc < 2 || strcmp(argv[1], "stats") != 0) {
+        glog("Usage: nfc stats\n");
+        return;
+    }
+
+    glog("NFC:parsers=%u\n", (unsigned)flipper_nfc_parser_count());
+    for (size_t i = 0; i < flipper_nfc_parser_count(); i++) {
+        FlipperNfcParserStats st;
+        if (!flipper_nfc_get_parser_stats(i, &st)) break;
+        uint32_t avg_us = st.candidates ? (uint32_t)(st.parse_us / st.candidates) : 0;
+        glog("NFC:PARSER:%s:checked=%lu:candidates=%lu:matches=%lu:avg_us=%lu\n", st.name,
+             (unsigned long)st.checked, (unsigned long)st.candidates,
+             (unsigned long)st.matches, (unsigned long)avg_us);
+    }
+}
+
 void handle_ir_cmd(int argc, char **argv) {
     if (argc < 2) {
         glog("Usage: ir <send|inline|list|show|universals|rx|dazzler>\n");
@@ -7148,24 +7183,44 @@ void handle_ir_cmd(int argc, char **argv) {
 
         infrared_signal_t *signals = NULL;
         size_t count = 0;
-        if (!infrared_manager_read_list(path, &signals, &count)) {
-            glog("IR: failed to read list from %s\n", path);
-            return;
-        }
+        infrared_signal_t single = {0};
+        infrared_signal_t *sig;
+        infrared_file_index_t index;
+        if (infrared_file_index_open(path, &index)) {
+            // parse just the one signal
+            count = index.count;
+            if (button_index < 0 || (size_t)button_index >= count) {
+                infrared_file_index_close(&index);
+                glog("IR: index out of range (0-%d)\n", (int)(count - 1));
+                return;
+            }
+            bool loaded = infrared_file_index_load(&index, (size_t)button_index, &single);
+            infrared_file_index_close(&index);
+            if (!loaded) {
+                glog("IR: failed to read signal %d from %s\n", button_index, path);
+                return;
+            }
+            sig = &single;
+        } else {
+            if (!infrared_manager_read_list(path, &signals, &count)) {
+                glog("IR: failed to read list from %s\n", path);
+                return;
+            }
 
-        if (count == 0) {
-            infrared_manager_free_list(signals, count);
-            glog("IR: no signals in %s\n", path);
-            return;
-        }
+            if (count == 0) {
+                infrared_manager_free_list(signals, count);
+                glog("IR: no signals in %s\n", path);
+                return;
+            }
 
-        if (button_index < 0 || (size_t)button_index >= count) {
-            infrared_manager_free_list(signals, count);
-            glog("IR: index out of range (0-%d)\n", (int)(count - 1));
-            return;
+            if (button_index < 0 || (size_t)button_index >= count) {
+                infrared_manager_free_list(signals, count);
+                glog("IR: index out of range (0-%d)\n", (int)(count - 1));
+                return;
+            }
+            sig = &signals[button_index];
         }
 
-        infrared_signal_t *sig = &signals[button_index];
         bool ok = infrared_manager_transmit(sig);
         glog("IR: send %s\n", ok ? "OK" : "FAIL");
         if (sig->is_raw) {
@@ -7189,7 +7244,11 @@ void handle_ir_cmd(int argc, char **argv) {
                 }
             }
         }
-        infrared_manager_free_list(signals, count);
+        if (signals) {
+            infrared_manager_free_list(signals, count);
+        } else {
+            infrared_manager_free_signal(&single);
+        }
         return;
     }
 
@@ -7212,7 +7271,7 @@ void handle_ir_cmd(int argc, char **argv) {
         struct dirent *dir;
         glog("IR files in %s:\n", path);
         while ((dir = readdir(d)) != NULL) {
-            if (dir->d_type == DT_REG) {
+            if (dir->d_type == DT_REG && dir->d_name[0] != '.') {
                  if (strstr(dir->d_name, ".ir") || strstr(dir->d_name, ".json")) {
                      int idx = (int)g_ir_cli_remote_count;
                      if (g_ir_cli_remote_count < IR_CLI_MAX_REMOTES) {
@@ -7252,41 +7311,61 @@ void handle_ir_cmd(int argc, char **argv) {
         } else {
             resolve_ir_path(arg, path, sizeof(path));
         }
+        bool is_universal_file = (strstr(path, "/infrared/universals") != NULL);
+        infrared_file_index_t index;
+        if (infrared_file_index_open(path, &index)) {
+            // listing comes from the cached index, nothing is parsed
+            if (is_universal_file) {
+                const char **names = malloc(index.count * sizeof(const char *));
+                if (!names) {
+                    infrared_file_index_close(&index);
+                    glog("IR: out of memory\n");
+                    return;
+                }
+                for (size_t i = 0; i < index.count; i++) {
+                    names[i] = infrared_file_index_name(&index, i);
+                }
+                ir_cli_print_unique(path, names, index.count);
+                free(names);
+            } else {
+                glog("Signals in %s (%zu):\n", path, index.count);
+                for (size_t i = 0; i < index.count; i++) {
+                    const infrared_file_entry_t *e = &index.entries[i];
+                    const char *proto = infrared_file_index_protocol(&index, i);
+                    infrared_signal_t sig;
+                    bool loaded = false;
+                    if (e->is_raw) {
+                        proto = "RAW";
+                    } else if (!proto && infrared_file_index_load(&index, i, &sig)) {
+                        // protocol the index has no id for
+                        proto = sig.payload.message.protocol;
+                        loaded = true;
+                    }
+                    glog("  [%d] %s (%s)", (int)i, infrared_file_index_name(&index, i),
+                         proto ? proto : "");
+                    if (!e->is_raw) {
+                        glog(" Addr: 0x%lX Cmd: 0x%lX", (unsigned long)e->address,
+                             (unsigned long)e->command);
+                    }
+                    glog("\n");
+                    if (loaded) infrared_manager_free_signal(&sig);
+                }
+            }
+            infrared_file_index_close(&index);
+            return;
+        }
         infrared_signal_t *signals = NULL;
         size_t count = 0;
         if (!infrared_manager_read_list(path, &signals, &count)) {
             glog("IR: failed to read/parse %s\n", path);
             return;
         }
-        bool is_universal_file = (strstr(path, "/infrared/universals") != NULL);
         if (is_universal_file) {
-            size_t unique = 0;
-            for (size_t i = 0; i < count; i++) {
-                const char *name = signals[i].name;
-                bool seen = false;
-                for (size_t j = 0; j < i; j++) {
-                    if (strcmp(signals[j].name, name) == 0) {
-                        seen = true;
-                        break;
-                    }
-                }
-                if (!seen) unique++;
-            }
-
-            glog("Unique buttons in %s (%zu):\n", path, unique);
-            size_t idx = 0;
-            for (size_t i = 0; i < count; i++) {
-                const char *name = signals[i].name;
-                bool seen = false;
-                for (size_t j = 0; j < i; j++) {
-                    if (strcmp(signals[j].name, name) == 0) {
-                        seen = true;
-                        break;
-                    }
-                }
-                if (seen) continue;
-                glog("  [%d] %s\n", (int)idx, name);
-                idx++;
+            const char **names = malloc((count ? count : 1) * sizeof(const char *));
+            if (names) {
+                for (size_t i = 0; i < count; i++) names[i] = signals[i].name;
+                ir_cli_print_unique(path, names, count);
+                free(names);
             }
         } else {
             glog("Signals in %s (%zu):\n", path, count);
@@ -7322,7 +7401,7 @@ void handle_ir_cmd(int argc, char **argv) {
                 struct dirent *dir;
                 int file_count = 0;
                 while ((dir = readdir(d)) != NULL) {
-                    if (dir->d_type == DT_REG) {
+                    if (dir->d_type == DT_REG && dir->d_name[0] != '.') {
                          if (strstr(dir->d_name, ".ir") || strstr(dir->d_name, ".json")) {
                              glog("  %s\n", dir->d_name);
                              file_count++;
@@ -7856,6 +7935,7 @@ void register_commands() {
     register_command("sd_pins_spi", handle_sd_pins_spi);
     register_command("sd_save_config", handle_sd_save_config);
     register_command("sd", handle_sd_cmd);
+    register_command("nfc", handle_nfc_cmd);
     register_command("scanall", handle_scanall);
     register_command("sweep", handle_sweep_cmd);
     register_command("timezone", handle_timezone_cmd);
@@ -13,6 +13,7 @@
 #include "driver/uart.h"
 #include "core/serial_manager.h"
 #include "core/uart_share.h"
+#include "core/comm_link.h"
 #include "soc/uart_pins.h"
 #include "esp_log.h"
 #include "esp_timer.h"
@@ -50,6 +51,22 @@
 #define CHIP_NAME_COPY_LEN 31      // max characters copied for name (excludes terminator)
 #define DISCOVERY_PAYLOAD_LEN (CHIP_ID_LEN + CHIP_NAME_MAX)
 #define MAX_CMD_LEN 32             // includes null terminator when placed in packet
+#define COMM_CMD_DATA_MAX 256      // command data carried by a framed link command
+
+// protocol versions exchanged in the handshake (byte after the name in
+// HANDSHAKE_REQ, first payload byte of HANDSHAKE_ACK; absent on old firmware)
+#define COMM_PROTO_LEGACY 1
+#define COMM_PROTO_FRAMED 2
+#ifdef CONFIG_ESP_COMM_FRAMED_LINK
+#define COMM_PROTO_LOCAL COMM_PROTO_FRAMED
+#else
+#define COMM_PROTO_LOCAL COMM_PROTO_LEGACY
+#endif
+#define LINK_POLL_MS 10
+#define LINK_RX_QUEUE_LEN 2
+#define LINK_RESPONSE_WAIT_MS 200
+#define LINK_STREAM_WAIT_MS 20
+#define WORKER_JOIN_TIMEOUT_MS 1000
 
 #if defined(CONFIG_IDF_TARGET_ESP32)
 #define DEFAULT_TX_PIN GPIO_NUM_17
@@ -90,13 +107,20 @@ typedef struct {
 typedef struct {
     StackType_t *stack;
     StaticTask_t *tcb;
+    volatile bool exited; // task left its loop and holds no locks
 } psram_task_resources_t;
 
 typedef struct {
     char command[33];
-    char data[COMM_PACKET_SIZE - 32];
+    char data[COMM_CMD_DATA_MAX];
 } comm_command_t;
 
+typedef struct {
+    uint8_t type;
+    uint16_t length;
+    uint8_t data[COMM_LINK_MAX_PAYLOAD];
+} comm_link_frame_t;
+
 typedef struct {
     gpio_num_t tx_pin;
     gpio_num_t rx_pin;
@@ -157,6 +181,18 @@ typedef struct {
 
     comm_stream_callback_t stream_handlers[COMM_MAX_STREAM_CHANNELS];
     void* stream_user_data[COMM_MAX_STREAM_CHANNELS];
+
+    // framed link, only allocated while connected to a peer that speaks it
+    comm_link_t* link;
+    SemaphoreHandle_t link_mutex;
+    SemaphoreHandle_t link_space;
+    QueueHandle_t link_rx_queue;
+    comm_link_frame_t* link_rx_in;  // rx task staging
+    comm_link_frame_t* link_rx_out; // protocol task staging
+
+    // set while the tx, protocol and command tasks are asked to exit
+    volatile bool workers_stop;
+    TaskHandle_t teardown_task_handle;
 } esp_comm_manager_t;
 
 static esp_comm_manager_t* s_comm_manager = NULL;
@@ -246,9 +282,18 @@ static TaskHandle_t create_task_static(psram_task_resources_t* res,
         return NULL;
     }
 
+    res->exited = false;
     return xTaskCreateStatic(task_fn, name, stack_words, arg, priority, res->stack, res->tcb);
 }
 
+// last thing a worker does: from here on it holds no locks and can be deleted
+static void worker_exit(psram_task_resources_t* res) {
+    res->exited = true;
+    for (;;) {
+        vTaskSuspend(NULL);
+    }
+}
+
 static StackType_t* alloc_task_stack(size_t words) {
 #if CONFIG_SPIRAM_ALLOW_STACK_EXTERNAL_MEMORY
     StackType_t* stack = (StackType_t*)heap_caps_malloc(words * sizeof(StackType_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
@@ -351,12 +396,212 @@ static bool send_packet(const comm_packet_t* packet) {
     return send_packet_internal(packet, wait);
 }
 
+static inline uint32_t link_now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static void* link_alloc(size_t size) {
+    void* p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!p) {
+        p = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    return p;
+}
+
+// switch to framed transport when both sides advertised it in the handshake
+static void link_start(esp_comm_manager_t* comm, uint8_t peer_version) {
+    if (!comm || comm->link || peer_version < COMM_PROTO_FRAMED || COMM_PROTO_LOCAL < COMM_PROTO_FRAMED) {
+        return;
+    }
+
+    if (!comm->link_mutex) {
+        comm->link_mutex = xSemaphoreCreateMutex();
+    }
+    if (!comm->link_space) {
+        comm->link_space = xSemaphoreCreateBinary();
+    }
+    comm_link_t* link = link_alloc(sizeof(comm_link_t));
+    comm->link_rx_in = link_alloc(sizeof(comm_link_frame_t));
+    comm->link_rx_out = link_alloc(sizeof(comm_link_frame_t));
+    comm->link_rx_queue = xQueueCreate(LINK_RX_QUEUE_LEN, sizeof(comm_link_frame_t));
+
+    if (!comm->link_mutex || !comm->link_space || !link || !comm->link_rx_in ||
+        !comm->link_rx_out || !comm->link_rx_queue) {
+        printf("Framed link unavailable, staying on legacy packets\n");
+        heap_caps_free(link);
+        heap_caps_free(comm->link_rx_in);
+        heap_caps_free(comm->link_rx_out);
+        comm->link_rx_in = NULL;
+        comm->link_rx_out = NULL;
+        if (comm->link_rx_queue) {
+            vQueueDelete(comm->link_rx_queue);
+            comm->link_rx_queue = NULL;
+        }
+        return;
+    }
+
+    comm_link_init(link, comm_link_rto_for_baud(comm->baud_rate));
+    xSemaphoreTake(comm->link_mutex, portMAX_DELAY);
+    comm->link = link;
+    xSemaphoreGive(comm->link_mutex);
+    printf("Peer supports framed link, using %d byte frames\n", COMM_LINK_MAX_PAYLOAD);
+}
+
+// callers stop the workers first (stop_workers)
+static void link_stop(esp_comm_manager_t* comm) {
+    if (!comm || !comm->link) {
+        return;
+    }
+
+    xSemaphoreTake(comm->link_mutex, portMAX_DELAY);
+    comm_link_t* link = comm->link;
+    comm->link = NULL;
+    xSemaphoreGive(comm->link_mutex);
+
+    printf("Framed link stats: tx=%lu rx=%lu retx=%lu crc_err=%lu out_of_order=%lu\n",
+           (unsigned long)link->frames_tx, (unsigned long)link->frames_rx,
+           (unsigned long)link->retransmits, (unsigned long)link->crc_errors,
+           (unsigned long)link->out_of_order);
+
+    heap_caps_free(link);
+    heap_caps_free(comm->link_rx_in);
+    heap_caps_free(comm->link_rx_out);
+    comm->link_rx_in = NULL;
+    comm->link_rx_out = NULL;
+    if (comm->link_rx_queue) {
+        vQueueDelete(comm->link_rx_queue);
+        comm->link_rx_queue = NULL;
+    }
+}
+
+// wait for a worker to leave its loop, then delete it and free its stack. a
+// worker that does not stop in time (a long remote command) is deleted with
+// link_mutex held so it cannot die inside the link.
+static void join_worker(esp_comm_manager_t* comm, TaskHandle_t* handle, psram_task_resources_t* res) {
+    if (!*handle) {
+        return;
+    }
+    TickType_t start = xTaskGetTickCount();
+    while (!res->exited && (xTaskGetTickCount() - start) < pdMS_TO_TICKS(WORKER_JOIN_TIMEOUT_MS)) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (res->exited) {
+        vTaskDelete(*handle);
+    } else {
+        printf("W: %s did not stop, deleting it\n", pcTaskGetName(*handle));
+        if (comm->link_mutex) {
+            xSemaphoreTake(comm->link_mutex, portMAX_DELAY);
+        }
+        vTaskDelete(*handle);
+        if (comm->link_mutex) {
+            xSemaphoreGive(comm->link_mutex);
+        }
+    }
+    *handle = NULL;
+    free_task_resources(res);
+}
+
+// stop the tx, protocol and command tasks and release the connection's
+// queues and link. runs in a task that may block, never in the timer task or
+// one of the workers
+static void stop_workers(esp_comm_manager_t* comm) {
+    comm->workers_stop = true;
+    join_worker(comm, &comm->protocol_task_handle, &comm->protocol_task_res);
+    join_worker(comm, &comm->command_executor_task_handle, &comm->command_task_res);
+    join_worker(comm, &comm->tx_task_handle, &comm->tx_task_res);
+
+    lock_state(comm);
+    if (comm->rx_packet_queue) {
+        vQueueDelete(comm->rx_packet_queue);
+        comm->rx_packet_queue = NULL;
+    }
+    if (comm->command_queue) {
+        vQueueDelete(comm->command_queue);
+        comm->command_queue = NULL;
+    }
+    if (comm->tx_queue) {
+        vQueueDelete(comm->tx_queue);
+        comm->tx_queue = NULL;
+    }
+    unlock_state(comm);
+    link_stop(comm);
+    comm->workers_stop = false;
+}
+
+// queue one data frame, waiting up to wait for the peer to open the window
+static bool link_send(esp_comm_manager_t* comm, uint8_t type, const uint8_t* prefix, size_t prefix_len,
+                      const uint8_t* payload, size_t len, TickType_t wait) {
+    TickType_t start = xTaskGetTickCount();
+    for (;;) {
+        bool queued = false;
+        bool active = false;
+        xSemaphoreTake(comm->link_mutex, portMAX_DELAY);
+        if (comm->link) {
+            active = true;
+            queued = comm_link_queue(comm->link, type, prefix, prefix_len, payload, len);
+        }
+        xSemaphoreGive(comm->link_mutex);
+
+        if (queued) {
+            return true;
+        }
+        if (!active || (xTaskGetTickCount() - start) >= wait) {
+            comm->tx_dropped_packets++;
+            return false;
+        }
+        xSemaphoreTake(comm->link_space, pdMS_TO_TICKS(LINK_POLL_MS));
+    }
+}
+
+// put pending acks and window frames on the wire; bounded so legacy pings still get out.
+// scratch (COMM_LINK_FRAME_MAX bytes) belongs to the tx task, the uart write runs unlocked
+static void link_service_tx(esp_comm_manager_t* comm, uint8_t* scratch) {
+    for (int i = 0; i <= COMM_LINK_WINDOW; ++i) {
+        size_t n = 0;
+        xSemaphoreTake(comm->link_mutex, portMAX_DELAY);
+        if (comm->link) {
+            n = comm_link_next_tx(comm->link, link_now_ms(), scratch);
+        }
+        xSemaphoreGive(comm->link_mutex);
+        if (n == 0) {
+            break;
+        }
+        uart_write_bytes(s_uart_num, scratch, n);
+    }
+}
+
+// rx task, link_mutex held
+static void link_rx_byte(esp_comm_manager_t* comm, uint8_t byte, TickType_t now) {
+    comm_link_t* link = comm->link;
+    comm_link_rx_result_t res = comm_link_rx_byte(link, byte, link_now_ms());
+    if (res == COMM_LINK_RX_NONE) {
+        return;
+    }
+    comm->last_rx_tick = now;
+    if (res != COMM_LINK_RX_DATA) {
+        return;
+    }
+
+    comm_link_frame_t* frame = comm->link_rx_in;
+    frame->type = link->rx_type;
+    frame->length = link->rx_len;
+    memcpy(frame->data, link->rx_payload, link->rx_len);
+    if (xQueueSend(comm->link_rx_queue, frame, 0) == pdPASS) {
+        comm_link_rx_commit(link);
+    } else {
+        // left unacked, the peer resends it once we caught up
+        comm->rx_queue_dropped_packets++;
+    }
+}
+
 static void tx_task(void* arg) {
     esp_comm_manager_t* comm = (esp_comm_manager_t*)arg;
     comm_packet_t packet;
+    uint8_t* link_scratch = NULL;
 
-    while (comm->initialized) {
-        if (xQueueReceive(comm->tx_queue, &packet, pdMS_TO_TICKS(100)) == pdPASS) {
+    while (comm->initialized && !comm->workers_stop) {
+        TickType_t wait = comm->link ? pdMS_TO_TICKS(LINK_POLL_MS) : pdMS_TO_TICKS(100);
+        if (xQueueReceive(comm->tx_queue, &packet, wait) == pdPASS) {
             uart_write_bytes(s_uart_num, (uint8_t*)&packet, PACKET_HEADER_SIZE + packet.length);
             uint8_t checksum = compute_packet_checksum(&packet, comm->use_crc);
             uart_write_bytes(s_uart_num, &checksum, 1);
@@ -372,11 +617,18 @@ static void tx_task(void* arg) {
                 }
             }
         }
+        if (comm->link) {
+            if (!link_scratch) {
+                link_scratch = link_alloc(COMM_LINK_FRAME_MAX);
+            }
+            if (link_scratch) {
+                link_service_tx(comm, link_scratch);
+            }
+        }
     }
 
-    for (;;) {
-        vTaskSuspend(NULL);
-    }
+    heap_caps_free(link_scratch);
+    worker_exit(&comm->tx_task_res);
 }
 
 static void rx_task(void* arg) {
@@ -408,9 +660,23 @@ static void rx_task(void* arg) {
                 }
             }
 
+            // the handshake runs inline below and may create the link, so
+            // only hold the link lock when one already exists
+            bool link_locked = false;
+            if (comm->link && comm->link_mutex) {
+                xSemaphoreTake(comm->link_mutex, portMAX_DELAY);
+                link_locked = true;
+            }
+
             for (int i = 0; i < len; ++i) {
                 uint8_t byte = rx_buffer[i];
 
+                if (link_locked && comm->link && comm->parse_state == PARSE_STATE_IDLE &&
+                    (byte == COMM_LINK_START_BYTE || comm_link_rx_busy(comm->link))) {
+                    link_rx_byte(comm, byte, now);
+                    continue;
+                }
+
                 switch (comm->parse_state) {
                     case PARSE_STATE_IDLE:
                         if (byte == PACKET_START_BYTE) {
@@ -505,6 +771,14 @@ static void rx_task(void* arg) {
                 }
             }
 
+            if (link_locked) {
+                bool space = comm->link && !comm_link_window_full(comm->link);
+                xSemaphoreGive(comm->link_mutex);
+                if (space) {
+                    xSemaphoreGive(comm->link_space);
+                }
+            }
+
             if (now - last_stats_log >= pdMS_TO_TICKS(5000)) {
                 size_t fifo_bytes = 0;
                 if (uart_get_buffered_data_len(s_uart_num, &fifo_bytes) != ESP_OK) {
@@ -534,9 +808,7 @@ static void rx_task(void* arg) {
         }
     }
 
-    for (;;) {
-        vTaskSuspend(NULL);
-    }
+    worker_exit(&comm->rx_task_res);
 }
 
 static void send_discovery_packet(void) {
@@ -560,9 +832,10 @@ static void send_handshake_request(const char* peer_name) {
     comm_packet_t packet = {0};
     packet.start_byte = PACKET_START_BYTE;
     packet.type = PACKET_TYPE_HANDSHAKE_REQ;
-    packet.length = MAX_CMD_LEN;
+    packet.length = MAX_CMD_LEN + 1;
 
     strncpy((char*)packet.data, peer_name, MAX_CMD_LEN);
+    packet.data[MAX_CMD_LEN] = COMM_PROTO_LOCAL; // ignored by legacy peers
 
     send_packet(&packet);
 }
@@ -573,26 +846,179 @@ static void send_handshake_ack(void) {
     comm_packet_t packet = {0};
     packet.start_byte = PACKET_START_BYTE;
     packet.type = PACKET_TYPE_HANDSHAKE_ACK;
-    packet.length = 0;
+    packet.length = 1;
+    packet.data[0] = COMM_PROTO_LOCAL; // legacy peers ignore the ack payload
 
     send_packet(&packet);
 }
 
+// protocol task only; shared by the legacy and framed receive paths
+static char s_log_buffer[128];
+
+static void queue_remote_command(esp_comm_manager_t* comm, const uint8_t* payload, size_t length) {
+    if (comm->state != COMM_STATE_CONNECTED || !comm->command_callback) {
+        return;
+    }
+    if (!comm->command_queue) {
+        comm->command_queue = xQueueCreate(4, sizeof(comm_command_t));
+        if (comm->command_queue && !comm->command_executor_task_handle) {
+            TaskHandle_t t = create_task_static(&comm->command_task_res, command_executor_task,
+                                               "comm_cmd_exec_task", 2048, comm, 5);
+            if (!t) {
+                printf("E: failed to create command executor task\n");
+                free_task_resources(&comm->command_task_res);
+            }
+            comm->command_executor_task_handle = t;
+        }
+    }
+    comm_command_t cmd_to_queue;
+    memset(&cmd_to_queue, 0, sizeof(comm_command_t));
+    size_t cmd_len = strnlen((const char*)payload, length < MAX_CMD_LEN ? length : MAX_CMD_LEN);
+    memcpy(cmd_to_queue.command, payload, cmd_len);
+    cmd_to_queue.command[cmd_len] = '\0';
+    size_t data_start = cmd_len + 1;
+    if (length > data_start) {
+        size_t data_len = strnlen((const char*)payload + data_start, length - data_start);
+        if (data_len > sizeof(cmd_to_queue.data) - 1) {
+            data_len = sizeof(cmd_to_queue.data) - 1;
+        }
+        memcpy(cmd_to_queue.data, payload + data_start, data_len);
+        cmd_to_queue.data[data_len] = '\0';
+    }
+
+    if (comm->command_queue && xQueueSend(comm->command_queue, &cmd_to_queue, pdMS_TO_TICKS(10)) != pdPASS) {
+        printf("Command queue full, dropped command: %s\n", cmd_to_queue.command);
+    }
+}
+
+static void dispatch_stream(esp_comm_manager_t* comm, const uint8_t* payload, size_t length) {
+    if (comm->state != COMM_STATE_CONNECTED) {
+        printf("STREAM packet ignored: not connected\n");
+        return;
+    }
+    if (length < 1) {
+        printf("STREAM packet ignored: empty payload\n");
+        return;
+    }
+    uint8_t channel = payload[0];
+    if (channel >= COMM_MAX_STREAM_CHANNELS) {
+        printf("STREAM packet ignored: invalid channel %d\n", channel);
+        return;
+    }
+    comm_stream_callback_t cb = comm->stream_handlers[channel];
+    if (!cb) {
+        printf("STREAM packet ignored: no handler for channel %d\n", channel);
+        return;
+    }
+    cb(channel, payload + 1, length - 1, comm->stream_user_data[channel]);
+}
+
+// append response bytes to the line assembler and print every completed line
+static void feed_response_bytes(esp_comm_manager_t* comm, const uint8_t* p, size_t rem) {
+    while (rem > 0) {
+        // If a previous gap was detected, drop bytes until newline boundary
+        if (comm->rx_drop_until_newline) {
+            size_t drop = 0;
+            bool eol_found = false;
+            for (; drop < rem; ++drop) {
+                if (p[drop] == '\n') { // include the delimiter in this chunk
+                    eol_found = true;
+                    drop++;
+                    break;
+                }
+                if (p[drop] == '\r') {
+                    if (drop + 1 < rem && p[drop + 1] == '\n') {
+                        drop += 2;
+                    } else {
+                        drop += 1;
+                    }
+                    eol_found = true;
+                    break;
+                }
+            }
+            p += drop;
+            rem -= drop;
+            if (!eol_found) {
+                // entire chunk dropped; continue to next packet
+                continue;
+            }
+            // found EOL; resume normal assembly for remaining bytes
+            comm->rx_drop_until_newline = false;
+            if (rem == 0) {
+                break;
+            }
+        }
+        size_t cap = sizeof(comm->response_assembly) - comm->response_assembly_len;
+        if (cap == 0) {
+            // force flush oldest buffered data if no newline present
+            size_t line_len = comm->response_assembly_len;
+            if (line_len > 0) {
+                if (line_len > 255) line_len = 255;
+                char line[256];
+                memcpy(line, comm->response_assembly, line_len);
+                line[line_len] = '\0';
+                printf("ESP Comm Response: %s\n", line);
+                log_response_line(line, line_len, s_log_buffer, sizeof(s_log_buffer));
+            }
+            comm->response_assembly_len = 0;
+            cap = sizeof(comm->response_assembly);
+        }
+        size_t to_copy = (rem < cap) ? rem : cap;
+        memcpy(comm->response_assembly + comm->response_assembly_len, p, to_copy);
+        comm->response_assembly_len += to_copy;
+        p += to_copy;
+        rem -= to_copy;
+
+        // flush complete lines (support both '\n' and '\r', coalescing CRLF)
+        size_t start = 0;
+        size_t i = 0;
+        while (i < comm->response_assembly_len) {
+            char c = comm->response_assembly[i];
+            if (c == '\n' || c == '\r') {
+                size_t line_len = i - start;
+                // trim preceding '\r' if the delimiter is '\n'
+                if (c == '\n' && line_len > 0 && comm->response_assembly[i - 1] == '\r') {
+                    line_len -= 1;
+                }
+                if (line_len > 255) line_len = 255;
+                char line[256];
+                memcpy(line, comm->response_assembly + start, line_len);
+                line[line_len] = '\0';
+                printf("ESP Comm Response: %s\n", line);
+                log_response_line(line, line_len, s_log_buffer, sizeof(s_log_buffer));
+                // advance start; skip optional '\n' after '\r'
+                start = i + 1;
+                if (c == '\r' && start < comm->response_assembly_len && comm->response_assembly[start] == '\n') {
+                    start++;
+                    i = start;
+                    continue;
+                }
+            }
+            i++;
+        }
+        if (start > 0) {
+            size_t tail = comm->response_assembly_len - start;
+            memmove(comm->response_assembly, comm->response_assembly + start, tail);
+            comm->response_assembly_len = tail;
+        }
+    }
+}
+
 static void handle_received_packet(esp_comm_manager_t* comm, const comm_packet_t* packet) {
     if (!comm || !packet) return;
-    static char log_buffer[128];
 
     switch(packet->type) {
         case PACKET_TYPE_DISCOVERY:
-            if (comm->state == COMM_STATE_SCANNING) {
+            // a lost connection finishes stopping its workers before a new one starts
+            if (comm->state == COMM_STATE_SCANNING && !comm->workers_stop) {
                 if (memcmp(comm->chip_id, packet->data, CHIP_ID_LEN) != 0) {
                     memcpy(comm->peer.chip_id, packet->data, CHIP_ID_LEN);
                     strncpy(comm->peer.chip_name, (char*)packet->data + CHIP_ID_LEN, CHIP_NAME_MAX);
                     comm->peer.chip_name[CHIP_NAME_MAX - 1] = '\0';
                     printf("Discovered peer: %s\n", comm->peer.chip_name);
-                    snprintf(log_buffer, sizeof(log_buffer), "I: Discovered peer: %s\n", comm->peer.chip_name);
-                    ap_manager_add_log(log_buffer);
-                    terminal_view_add_text(log_buffer);
+                    snprintf(s_log_buffer, sizeof(s_log_buffer), "I: Discovered peer: %s\n", comm->peer.chip_name);
+                    ap_manager_add_log(s_log_buffer);
+                    terminal_view_add_text(s_log_buffer);
 
                     if (strcmp(comm->chip_name, comm->peer.chip_name) > 0) {
                         printf("Peer has smaller name, I will initiate connection.\n");
@@ -605,7 +1031,8 @@ static void handle_received_packet(esp_comm_manager_t* comm, const comm_packet_t
             break;
 
         case PACKET_TYPE_HANDSHAKE_REQ:
-            if (comm->state == COMM_STATE_SCANNING || comm->state == COMM_STATE_IDLE) {
+            if ((comm->state == COMM_STATE_SCANNING || comm->state == COMM_STATE_IDLE) &&
+                !comm->workers_stop) {
                 char requested_name[CHIP_NAME_MAX];
                 strncpy(requested_name, (char*)packet->data, CHIP_NAME_MAX);
                 requested_name[CHIP_NAME_MAX - 1] = '\0';
@@ -674,6 +1101,8 @@ static void handle_received_packet(esp_comm_manager_t* comm, const comm_packet_t
                         }
                         comm->protocol_task_handle = t;
                     }
+                    link_start(comm, packet->length > MAX_CMD_LEN ? packet->data[MAX_CMD_LEN]
+                                                                  : COMM_PROTO_LEGACY);
                     unlock_state(comm);
                     printf("Handshake complete!\n");
                     ap_manager_add_log("Handshake completed!\n");
@@ -742,6 +1171,7 @@ static void handle_received_packet(esp_comm_manager_t* comm, const comm_packet_t
                     }
                     comm->protocol_task_handle = t;
                 }
+                link_start(comm, packet->length >= 1 ? packet->data[0] : COMM_PROTO_LEGACY);
                 unlock_state(comm);
                 printf("Handshake complete!\n");
                 ap_manager_add_log("Handshake completed!\n");
@@ -750,64 +1180,11 @@ static void handle_received_packet(esp_comm_manager_t* comm, const comm_packet_t
             break;
 
         case PACKET_TYPE_COMMAND:
-            if (comm->state == COMM_STATE_CONNECTED && comm->command_callback) {
-                if (!comm->command_queue) {
-                    comm->command_queue = xQueueCreate(4, sizeof(comm_command_t));
-                    if (comm->command_queue && !comm->command_executor_task_handle) {
-                        TaskHandle_t t = create_task_static(&comm->command_task_res, command_executor_task,
-                                                           "comm_cmd_exec_task", 2048, comm, 5);
-                        if (!t) {
-                            printf("E: failed to create command executor task\n");
-                            free_task_resources(&comm->command_task_res);
-                        }
-                        comm->command_executor_task_handle = t;
-                    }
-                }
-                comm_command_t cmd_to_queue;
-                memset(&cmd_to_queue, 0, sizeof(comm_command_t));
-                strncpy(cmd_to_queue.command, (char*)packet->data, MAX_CMD_LEN);
-                cmd_to_queue.command[MAX_CMD_LEN] = '\0';
-                size_t cmd_len = strlen(cmd_to_queue.command);
-                size_t data_start = cmd_len + 1;
-                if (packet->length > data_start) {
-                    size_t data_len = packet->length - data_start;
-                    if (data_len > sizeof(cmd_to_queue.data) - 1) {
-                        data_len = sizeof(cmd_to_queue.data) - 1;
-                    }
-                    strncpy(cmd_to_queue.data, (char*)packet->data + data_start, data_len);
-                    cmd_to_queue.data[data_len] = '\0';
-                }
-
-                if (comm->command_queue && xQueueSend(comm->command_queue, &cmd_to_queue, pdMS_TO_TICKS(10)) != pdPASS) {
-                    printf("Command queue full, dropped command: %s\n", cmd_to_queue.command);
-                }
-            }
+            queue_remote_command(comm, packet->data, packet->length);
             break;
 
         case PACKET_TYPE_STREAM:
-            if (comm->state != COMM_STATE_CONNECTED) {
-                printf("STREAM packet ignored: not connected\n");
-                break;
-            }
-            if (packet->length < 1) {
-                printf("STREAM packet ignored: empty payload\n");
-                break;
-            }
-            {
-                uint8_t channel = packet->data[0];
-                if (channel >= COMM_MAX_STREAM_CHANNELS) {
-                    printf("STREAM packet ignored: invalid channel %d\n", channel);
-                    break;
-                }
-                comm_stream_callback_t cb = comm->stream_handlers[channel];
-                if (!cb) {
-                    printf("STREAM packet ignored: no handler for channel %d\n", channel);
-                    break;
-                }
-                const uint8_t* payload = packet->data + 1;
-                size_t payload_len = packet->length - 1;
-                cb(channel, payload, payload_len, comm->stream_user_data[channel]);
-            }
+            dispatch_stream(comm, packet->data, packet->length);
             break;
 
         case PACKET_TYPE_PING:
@@ -864,93 +1241,7 @@ static void handle_received_packet(esp_comm_manager_t* comm, const comm_packet_t
                         comm->rx_drop_until_newline = false;
                     }
                 }
-                while (rem > 0) {
-                    // If a previous gap was detected, drop bytes until newline boundary
-                    if (comm->rx_drop_until_newline) {
-                        size_t drop = 0;
-                        bool eol_found = false;
-                        for (; drop < rem; ++drop) {
-                            if (p[drop] == '\n') { // include the delimiter in this chunk
-                                eol_found = true;
-                                drop++;
-                                break;
-                            }
-                            if (p[drop] == '\r') {
-                                if (drop + 1 < rem && p[drop + 1] == '\n') {
-                                    drop += 2;
-                                } else {
-                                    drop += 1;
-                                }
-                                eol_found = true;
-                                break;
-                            }
-                        }
-                        p += drop;
-                        rem -= drop;
-                        if (!eol_found) {
-                            // entire chunk dropped; continue to next packet
-                            continue;
-                        }
-                        // found EOL; resume normal assembly for remaining bytes
-                        comm->rx_drop_until_newline = false;
-                        if (rem == 0) {
-                            break;
-                        }
-                    }
-                    size_t cap = sizeof(comm->response_assembly) - comm->response_assembly_len;
-                    if (cap == 0) {
-                        // force flush oldest buffered data if no newline present
-                        size_t line_len = comm->response_assembly_len;
-                        if (line_len > 0) {
-                            if (line_len > 255) line_len = 255;
-                            char line[256];
-                            memcpy(line, comm->response_assembly, line_len);
-                            line[line_len] = '\0';
-                            printf("ESP Comm Response: %s\n", line);
-                            log_response_line(line, line_len, log_buffer, sizeof(log_buffer));
-                        }
-                        comm->response_assembly_len = 0;
-                        cap = sizeof(comm->response_assembly);
-                    }
-                    size_t to_copy = (rem < cap) ? rem : cap;
-                    memcpy(comm->response_assembly + comm->response_assembly_len, p, to_copy);
-                    comm->response_assembly_len += to_copy;
-                    p += to_copy;
-                    rem -= to_copy;
-
-                    // flush complete lines (support both '\n' and '\r', coalescing CRLF)
-                    size_t start = 0;
-                    size_t i = 0;
-                    while (i < comm->response_assembly_len) {
-                        char c = comm->response_assembly[i];
-                        if (c == '\n' || c == '\r') {
-                            size_t line_len = i - start;
-                            // trim preceding '\r' if the delimiter is '\n'
-                            if (c == '\n' && line_len > 0 && comm->response_assembly[i - 1] == '\r') {
-                                line_len -= 1;
-                            }
-                            if (line_len > 255) line_len = 255;
-                            char line[256];
-                            memcpy(line, comm->response_assembly + start, line_len);
-                            line[line_len] = '\0';
-                            printf("ESP Comm Response: %s\n", line);
-                            log_response_line(line, line_len, log_buffer, sizeof(log_buffer));
-                            // advance start; skip optional '\n' after '\r'
-                            start = i + 1;
-                            if (c == '\r' && start < comm->response_assembly_len && comm->response_assembly[start] == '\n') {
-                                start++;
-                                i = start;
-                                continue;
-                            }
-                        }
-                        i++;
-                    }
-                    if (start > 0) {
-                        size_t tail = comm->response_assembly_len - start;
-                        memmove(comm->response_assembly, comm->response_assembly + start, tail);
-                        comm->response_assembly_len = tail;
-                    }
-                }
+                feed_response_bytes(comm, p, rem);
             }
             break;
 
@@ -964,7 +1255,7 @@ static void command_executor_task(void* arg) {
     esp_comm_manager_t* comm = (esp_comm_manager_t*)arg;
     comm_command_t received_cmd;
 
-    while (comm->initialized) {
+    while (comm->initialized && !comm->workers_stop) {
         if (xQueueReceive(comm->command_queue, &received_cmd, pdMS_TO_TICKS(100)) == pdPASS) {
             if (comm->command_callback) {
                 // Temporarily set the remote command flag to indicate this is a remote command
@@ -977,8 +1268,26 @@ static void command_executor_task(void* arg) {
         }
     }
 
-    for (;;) {
-        vTaskSuspend(NULL);
+    worker_exit(&comm->command_task_res);
+}
+
+static void handle_link_frame(esp_comm_manager_t* comm, const comm_link_frame_t* frame) {
+    switch (frame->type) {
+        case PACKET_TYPE_COMMAND:
+            queue_remote_command(comm, frame->data, frame->length);
+            break;
+        case PACKET_TYPE_STREAM:
+            dispatch_stream(comm, frame->data, frame->length);
+            break;
+        case PACKET_TYPE_RESPONSE:
+            // delivery is reliable and in order, no seq/flags header needed
+            if (comm->state == COMM_STATE_CONNECTED) {
+                feed_response_bytes(comm, frame->data, frame->length);
+            }
+            break;
+        default:
+            printf("Unknown frame type: 0x%02x\n", frame->type);
+            break;
     }
 }
 
@@ -986,15 +1295,17 @@ static void protocol_task(void* arg) {
     esp_comm_manager_t* comm = (esp_comm_manager_t*)arg;
     comm_packet_t packet;
 
-    while(comm->initialized) {
+    while (comm->initialized && !comm->workers_stop) {
         if (xQueueReceive(comm->rx_packet_queue, &packet, pdMS_TO_TICKS(10)) == pdPASS) {
             handle_received_packet(comm, &packet);
         }
+        QueueHandle_t link_q = comm->link_rx_queue;
+        while (link_q && comm->link_rx_out && xQueueReceive(link_q, comm->link_rx_out, 0) == pdPASS) {
+            handle_link_frame(comm, comm->link_rx_out);
+        }
     }
 
-    for (;;) {
-        vTaskSuspend(NULL);
-    }
+    worker_exit(&comm->protocol_task_res);
 }
 
 static void discovery_timer_callback(TimerHandle_t xTimer) {
@@ -1200,6 +1511,19 @@ bool esp_comm_manager_send_stream(uint8_t channel, const uint8_t* data, size_t l
     size_t remaining = length;
     bool ok = true;
 
+    if (s_comm_manager->link) {
+        while (remaining > 0) {
+            size_t chunk = remaining < COMM_LINK_MAX_PAYLOAD - 1 ? remaining : COMM_LINK_MAX_PAYLOAD - 1;
+            if (!link_send(s_comm_manager, PACKET_TYPE_STREAM, &channel, 1, p, chunk,
+                           pdMS_TO_TICKS(LINK_STREAM_WAIT_MS))) {
+                return false;
+            }
+            p += chunk;
+            remaining -= chunk;
+        }
+        return true;
+    }
+
     size_t payload_cap = (PACKET_MAX_PAYLOAD > 1) ? (PACKET_MAX_PAYLOAD - 1) : 0;
     if (payload_cap == 0) {
         return false;
@@ -1294,6 +1618,11 @@ bool esp_comm_manager_start_discovery(void) {
         return false;
     }
 
+    if (s_comm_manager->teardown_task_handle) {
+        printf("Previous connection still closing\n");
+        return false;
+    }
+
     // release heavy resources during discovery
     lock_state(s_comm_manager);
     s_comm_manager->use_crc = true;
@@ -1303,34 +1632,8 @@ bool esp_comm_manager_start_discovery(void) {
         xTimerDelete(s_comm_manager->ping_timer, 0);
         s_comm_manager->ping_timer = NULL;
     }
-    if (s_comm_manager->protocol_task_handle) {
-        vTaskDelete(s_comm_manager->protocol_task_handle);
-        s_comm_manager->protocol_task_handle = NULL;
-        free_task_resources(&s_comm_manager->protocol_task_res);
-    }
-    if (s_comm_manager->command_executor_task_handle) {
-        vTaskDelete(s_comm_manager->command_executor_task_handle);
-        s_comm_manager->command_executor_task_handle = NULL;
-        free_task_resources(&s_comm_manager->command_task_res);
-    }
-    if (s_comm_manager->rx_packet_queue) {
-        vQueueDelete(s_comm_manager->rx_packet_queue);
-        s_comm_manager->rx_packet_queue = NULL;
-    }
-    if (s_comm_manager->command_queue) {
-        vQueueDelete(s_comm_manager->command_queue);
-        s_comm_manager->command_queue = NULL;
-    }
-    if (s_comm_manager->tx_task_handle) {
-        vTaskDelete(s_comm_manager->tx_task_handle);
-        s_comm_manager->tx_task_handle = NULL;
-        free_task_resources(&s_comm_manager->tx_task_res);
-    }
-    if (s_comm_manager->tx_queue) {
-        vQueueDelete(s_comm_manager->tx_queue);
-        s_comm_manager->tx_queue = NULL;
-    }
     unlock_state(s_comm_manager);
+    stop_workers(s_comm_manager);
 
     s_comm_manager->state = COMM_STATE_SCANNING;
     if (!s_comm_manager->discovery_timer) {
@@ -1401,17 +1704,28 @@ bool esp_comm_manager_send_command(const char* command, const char* data) {
     ((char*)packet.data)[cmd_len] = '\0';
     packet.length = cmd_len + 1;
 
-    if (data) {
-        size_t data_len = strlen(data);
-        size_t max_data_len = COMM_PACKET_SIZE - packet.length - 4;
-        if (data_len > max_data_len) {
-            data_len = max_data_len;
+    bool result;
+    if (s_comm_manager->link) {
+        // framed link: "command\0data", data up to what the receiver queues
+        size_t data_len = data ? strlen(data) : 0;
+        if (data_len > COMM_CMD_DATA_MAX - 1) {
+            data_len = COMM_CMD_DATA_MAX - 1;
         }
-        strncpy((char*)packet.data + packet.length, data, data_len);
-        packet.length += data_len;
+        result = link_send(s_comm_manager, PACKET_TYPE_COMMAND, packet.data, packet.length,
+                           (const uint8_t*)data, data_len, pdMS_TO_TICKS(30));
+    } else {
+        if (data) {
+            size_t data_len = strlen(data);
+            size_t max_data_len = COMM_PACKET_SIZE - packet.length - 4;
+            if (data_len > max_data_len) {
+                data_len = max_data_len;
+            }
+            strncpy((char*)packet.data + packet.length, data, data_len);
+            packet.length += data_len;
+        }
+        result = send_packet(&packet);
     }
 
-    bool result = send_packet(&packet);
     if (result) {
         printf("Sent command: %s\n", command);
         char log_msg[64];
@@ -1435,6 +1749,19 @@ bool esp_comm_manager_send_response(const uint8_t* data, size_t length) {
     size_t remaining = length;
     bool ok = true;
     bool at_line_start = true; // assume start of provided buffer begins a new line
+
+    if (s_comm_manager->link) {
+        while (remaining > 0) {
+            size_t chunk = remaining < COMM_LINK_MAX_PAYLOAD ? remaining : COMM_LINK_MAX_PAYLOAD;
+            if (!link_send(s_comm_manager, PACKET_TYPE_RESPONSE, NULL, 0, p, chunk,
+                           pdMS_TO_TICKS(LINK_RESPONSE_WAIT_MS))) {
+                return false;
+            }
+            p += chunk;
+            remaining -= chunk;
+        }
+        return true;
+    }
     while (remaining > 0) {
         comm_packet_t packet = {0};
         packet.start_byte = PACKET_START_BYTE;
@@ -1558,24 +1885,19 @@ void esp_comm_manager_deinit(void) {
         s_comm_manager->state = COMM_STATE_IDLE;
     }
 
-    if (s_comm_manager->rx_task_handle) {
-        vTaskDelete(s_comm_manager->rx_task_handle);
-        s_comm_manager->rx_task_handle = NULL;
-    }
-    if (s_comm_manager->tx_task_handle) {
-        vTaskDelete(s_comm_manager->tx_task_handle);
-        s_comm_manager->tx_task_handle = NULL;
-    }
-    if (s_comm_manager->protocol_task_handle) {
-        vTaskDelete(s_comm_manager->protocol_task_handle);
-        s_comm_manager->protocol_task_handle = NULL;
-    }
-    if (s_comm_manager->command_executor_task_handle) {
-        vTaskDelete(s_comm_manager->command_executor_task_handle);
-        s_comm_manager->command_executor_task_handle = NULL;
+    // a connection loss teardown still running owns the workers until it is done
+    while (s_comm_manager->teardown_task_handle) {
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
 
-    vTaskDelay(pdMS_TO_TICKS(50));
+    // the tasks leave their loops on initialized=false; join them rather
+    // than deleting them in the middle of holding link_mutex
+    join_worker(s_comm_manager, &s_comm_manager->rx_task_handle, &s_comm_manager->rx_task_res);
+    join_worker(s_comm_manager, &s_comm_manager->tx_task_handle, &s_comm_manager->tx_task_res);
+    join_worker(s_comm_manager, &s_comm_manager->protocol_task_handle,
+                &s_comm_manager->protocol_task_res);
+    join_worker(s_comm_manager, &s_comm_manager->command_executor_task_handle,
+                &s_comm_manager->command_task_res);
 
     if (s_comm_manager->discovery_timer) {
         xTimerDelete(s_comm_manager->discovery_timer, 0);
@@ -1593,6 +1915,14 @@ void esp_comm_manager_deinit(void) {
     free_task_resources(&s_comm_manager->protocol_task_res);
     free_task_resources(&s_comm_manager->command_task_res);
 
+    link_stop(s_comm_manager);
+    if (s_comm_manager->link_mutex) {
+        vSemaphoreDelete(s_comm_manager->link_mutex);
+    }
+    if (s_comm_manager->link_space) {
+        vSemaphoreDelete(s_comm_manager->link_space);
+    }
+
     if (s_comm_manager->rx_packet_queue) {
         vQueueDelete(s_comm_manager->rx_packet_queue);
     }
@@ -1635,10 +1965,32 @@ static void handshake_timer_callback(TimerHandle_t xTimer) {
     unlock_state(comm);
 }
 
+// runs the blocking part of a connection loss outside the timer task
+static void connection_teardown_task(void* arg) {
+    esp_comm_manager_t* comm = (esp_comm_manager_t*)arg;
+
+    stop_workers(comm);
+
+    lock_state(comm);
+    if (comm->initialized && comm->state == COMM_STATE_SCANNING) {
+        if (!comm->discovery_timer) {
+            comm->discovery_timer = xTimerCreate("discovery_timer", pdMS_TO_TICKS(DISCOVERY_INTERVAL_MS), pdTRUE, NULL, discovery_timer_callback);
+        }
+        if (comm->discovery_timer) {
+            xTimerStart(comm->discovery_timer, 0);
+        }
+    }
+    comm->teardown_task_handle = NULL;
+    unlock_state(comm);
+    vTaskDelete(NULL);
+}
+
+// called from the ping timer: the workers are stopped and joined by
+// connection_teardown_task, the timer task must not block on them
 static void handle_connection_loss(esp_comm_manager_t* comm, const char* reason) {
     if (!comm || !comm->initialized) return;
     lock_state(comm);
-    if (comm->state != COMM_STATE_CONNECTED) {
+    if (comm->state != COMM_STATE_CONNECTED || comm->teardown_task_handle) {
         unlock_state(comm);
         return;
     }
@@ -1655,41 +2007,20 @@ static void handle_connection_loss(esp_comm_manager_t* comm, const char* reason)
         comm->ping_timer = NULL;
     }
 
-    // teardown protocol resources to a lightweight scanning mode
-    if (comm->protocol_task_handle) {
-        vTaskDelete(comm->protocol_task_handle);
-        comm->protocol_task_handle = NULL;
-        free_task_resources(&comm->protocol_task_res);
-    }
-    if (comm->command_executor_task_handle) {
-        vTaskDelete(comm->command_executor_task_handle);
-        comm->command_executor_task_handle = NULL;
-        free_task_resources(&comm->command_task_res);
-    }
-    if (comm->rx_packet_queue) {
-        vQueueDelete(comm->rx_packet_queue);
-        comm->rx_packet_queue = NULL;
-    }
-    if (comm->command_queue) {
-        vQueueDelete(comm->command_queue);
-        comm->command_queue = NULL;
-    }
-    if (comm->tx_task_handle) {
-        vTaskDelete(comm->tx_task_handle);
-        comm->tx_task_handle = NULL;
-        free_task_resources(&comm->tx_task_res);
-    }
-    if (comm->tx_queue) {
-        vQueueDelete(comm->tx_queue);
-        comm->tx_queue = NULL;
-    }
-
-    // restart discovery timer
-    if (!comm->discovery_timer) {
-        comm->discovery_timer = xTimerCreate("discovery_timer", pdMS_TO_TICKS(DISCOVERY_INTERVAL_MS), pdTRUE, NULL, discovery_timer_callback);
-    }
-    if (comm->discovery_timer) {
-        xTimerStart(comm->discovery_timer, 0);
+    // no new connection until the old workers are gone
+    comm->workers_stop = true;
+    if (xTaskCreate(connection_teardown_task, "comm_teardown", 3072, comm, 6,
+                    &comm->teardown_task_handle) != pdPASS) {
+        // keep the idle workers for the next connection, they are reused
+        printf("E: failed to create teardown task\n");
+        comm->teardown_task_handle = NULL;
+        comm->workers_stop = false;
+        if (!comm->discovery_timer) {
+            comm->discovery_timer = xTimerCreate("discovery_timer", pdMS_TO_TICKS(DISCOVERY_INTERVAL_MS), pdTRUE, NULL, discovery_timer_callback);
+        }
+        if (comm->discovery_timer) {
+            xTimerStart(comm->discovery_timer, 0);
+        }
     }
     unlock_state(comm);
 }
\ No newline at end of file
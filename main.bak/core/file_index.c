@@ -0,0 +1,192 @@
+#include "core/file_index.h"
+
+#include <ctype.h>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define TAG "FileIndex"
+
+#define FILE_INDEX_CACHE_SLOTS 8
+#define FILE_INDEX_NAME ".ghost_index" // one "base ext next" line per series
+#define FILE_INDEX_PATH_MAX 128
+#define FILE_INDEX_KEY_MAX 32
+
+// next free number per directory/base/extension. numbering used to rescan the
+// whole directory for every new capture; the cached number is checked by
+// probing for the file it names instead. fatfs does not touch a directory's
+// mtime when entries are added and counting entries is the scan we want to
+// skip, so the probe is the validation: a taken number means the cache is
+// stale and we rescan.
+typedef struct {
+  char dir[FILE_INDEX_PATH_MAX];
+  char base[FILE_INDEX_KEY_MAX];
+  char ext[8];
+  int next;
+  uint32_t used; // lru stamp, 0 = free slot
+} file_index_slot_t;
+
+static file_index_slot_t s_index_cache[FILE_INDEX_CACHE_SLOTS];
+static uint32_t s_index_stamp = 0;
+static SemaphoreHandle_t s_index_mutex = NULL;
+static portMUX_TYPE s_index_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// "<base>_<digits>.<ext>" exactly; returns the number or -1
+static int file_index_parse(const char *name, const char *base, size_t base_len,
+                            const char *ext) {
+  if (strncmp(name, base, base_len) != 0 || name[base_len] != '_') return -1;
+  const char *p = name + base_len + 1;
+  if (!isdigit((unsigned char)*p)) return -1;
+  long n = 0;
+  while (isdigit((unsigned char)*p)) {
+    n = n * 10 + (*p++ - '0');
+    if (n > 0x7FFFFFFF / 10) return -1;
+  }
+  if (*p++ != '.' || strcmp(p, ext) != 0) return -1;
+  return (int)n;
+}
+
+// full scan: max existing number + 1, or -1 if the directory can't be opened
+static int file_index_scan(const char *dir_path, const char *base, const char *ext) {
+  DIR *dir = opendir(dir_path);
+  if (!dir) {
+    ESP_LOGE(TAG, "Failed to open directory %s", dir_path);
+    return -1;
+  }
+  size_t base_len = strlen(base);
+  int max_index = -1;
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != NULL) {
+    int index = file_index_parse(entry->d_name, base, base_len, ext);
+    if (index > max_index) max_index = index;
+  }
+  closedir(dir);
+  return max_index + 1;
+}
+
+static bool file_index_taken(const char *dir_path, const char *base, const char *ext, int index) {
+  char path[FILE_INDEX_PATH_MAX + FILE_INDEX_KEY_MAX + 24];
+  struct stat st;
+  snprintf(path, sizeof(path), "%s/%s_%d.%s", dir_path, base, index, ext);
+  return stat(path, &st) == 0;
+}
+
+static int file_index_load(const char *dir_path, const char *base, const char *ext) {
+  char path[FILE_INDEX_PATH_MAX + sizeof(FILE_INDEX_NAME) + 1];
+  snprintf(path, sizeof(path), "%s/%s", dir_path, FILE_INDEX_NAME);
+  FILE *f = fopen(path, "r");
+  if (!f) return -1;
+  char line[96];
+  char b[FILE_INDEX_KEY_MAX], e[8];
+  int next, found = -1;
+  while (fgets(line, sizeof(line), f)) {
+    if (sscanf(line, "%31s %7s %d", b, e, &next) == 3 && next >= 0 && strcmp(b, base) == 0 &&
+        strcmp(e, ext) == 0) {
+      found = next;
+    }
+  }
+  fclose(f);
+  return found;
+}
+
+// rewrite the hidden index with this series updated, other series kept
+static void file_index_store(const char *dir_path, const char *base, const char *ext, int next) {
+  char path[FILE_INDEX_PATH_MAX + sizeof(FILE_INDEX_NAME) + 1];
+  char tmp[sizeof(path) + 4];
+  snprintf(path, sizeof(path), "%s/%s", dir_path, FILE_INDEX_NAME);
+  snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+  FILE *out = fopen(tmp, "w");
+  if (!out) return;
+  FILE *in = fopen(path, "r");
+  if (in) {
+    char line[96];
+    char b[FILE_INDEX_KEY_MAX], e[8];
+    int n;
+    while (fgets(line, sizeof(line), in)) {
+      if (sscanf(line, "%31s %7s %d", b, e, &n) != 3) continue;
+      if (strcmp(b, base) == 0 && strcmp(e, ext) == 0) continue;
+      fprintf(out, "%s %s %d\n", b, e, n);
+    }
+    fclose(in);
+  }
+  fprintf(out, "%s %s %d\n", base, ext, next);
+  if (fclose(out) != 0) {
+    remove(tmp);
+    return;
+  }
+  remove(path); // fatfs rename won't replace an existing file
+  rename(tmp, path);
+}
+
+static file_index_slot_t *file_index_slot(const char *dir_path, const char *base,
+                                          const char *ext) {
+  file_index_slot_t *victim = &s_index_cache[0];
+  for (int i = 0; i < FILE_INDEX_CACHE_SLOTS; i++) {
+    file_index_slot_t *slot = &s_index_cache[i];
+    if (slot->used && strcmp(slot->dir, dir_path) == 0 && strcmp(slot->base, base) == 0 &&
+        strcmp(slot->ext, ext) == 0) {
+      slot->used = ++s_index_stamp;
+      return slot;
+    }
+    if (slot->used < victim->used) victim = slot;
+  }
+  snprintf(victim->dir, sizeof(victim->dir), "%s", dir_path);
+  snprintf(victim->base, sizeof(victim->base), "%s", base);
+  snprintf(victim->ext, sizeof(victim->ext), "%s", ext);
+  victim->next = -1;
+  victim->used = ++s_index_stamp;
+  return victim;
+}
+
+int file_index_next(const char *dir_path, const char *base, const char *ext) {
+  // names that don't fit the cache (or the index file format) just scan
+  if (strlen(dir_path) >= FILE_INDEX_PATH_MAX || strlen(base) >= FILE_INDEX_KEY_MAX ||
+      strlen(ext) >= 8 || strpbrk(base, " \t\n") || strpbrk(ext, " \t\n")) {
+    return file_index_scan(dir_path, base, ext);
+  }
+
+  if (!s_index_mutex) {
+    SemaphoreHandle_t m = xSemaphoreCreateMutex();
+    bool lost = false;
+    portENTER_CRITICAL(&s_index_mux);
+    if (!s_index_mutex) s_index_mutex = m;
+    else lost = true;
+    portEXIT_CRITICAL(&s_index_mux);
+    if (lost && m) vSemaphoreDelete(m);
+    if (!s_index_mutex) return file_index_scan(dir_path, base, ext);
+  }
+  xSemaphoreTake(s_index_mutex, portMAX_DELAY);
+
+  file_index_slot_t *slot = file_index_slot(dir_path, base, ext);
+  int cached = slot->next;
+  if (cached < 0) cached = file_index_load(dir_path, base, ext);
+
+  // the last handed out number is either still unused (caller never created
+  // it) or taken by that caller, in which case the one after it must be free
+  int next = -1;
+  if (cached >= 0) {
+    if (!file_index_taken(dir_path, base, ext, cached)) {
+      next = cached;
+    } else if (!file_index_taken(dir_path, base, ext, cached + 1)) {
+      next = cached + 1;
+    }
+  }
+  if (next < 0) {
+    next = file_index_scan(dir_path, base, ext);
+  }
+
+  if (next >= 0 && next != slot->next) {
+    if (next != cached) file_index_store(dir_path, base, ext, next);
+    slot->next = next;
+  } else if (next < 0) {
+    slot->used = 0; // directory missing, forget the slot
+  }
+
+  xSemaphoreGive(s_index_mutex);
+  return next;
+}
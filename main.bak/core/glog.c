@@ -2,38 +2,200 @@
 #include "core/glog.h"
 
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
+#include "freertos/task.h"
 #include <stdbool.h>
 #include "core/esp_comm_manager.h"
 #include "managers/ap_manager.h"
 
 #define GLOG_BUF_SIZE 512
-#define GLOG_DEFER_MAX 8
+#define GLOG_RING_SIZE 4096 // power of two
+#define GLOG_REC_HDR 4
+#define GLOG_WORKER_STACK 3072
+#define GLOG_TERM_WORKER_STACK 2048
 
-static SemaphoreHandle_t s_glog_mutex;
+#define GLOG_REC_DEFERRED 0x01
+
+// every line goes into one byte ring; each consumer keeps its own cursor so a
+// slow sink only ever loses its own backlog. records are a 4 byte header
+// (len lo, len hi, flags, pad) followed by the text without the nul.
+// console, terminal and web log are each drained by a worker task, so a
+// caller never waits on the uart or the display; CONFIG_GLOG_INLINE_OUTPUT
+// writes console and terminal from the calling task instead.
+enum {
+    GLOG_CUR_DEFER = 0, // output from the caller, only advanced by glog_flush_deferred
+#ifndef CONFIG_GLOG_INLINE_OUTPUT
+    GLOG_CUR_CONSOLE,
+    GLOG_CUR_TERMINAL,
+#endif
+    GLOG_CUR_WEB,
+    GLOG_CUR_COUNT
+};
+
+static portMUX_TYPE s_glog_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t s_ring[GLOG_RING_SIZE];
+static uint32_t s_head = 0;   // next write position, free running
+static uint32_t s_oldest = 0; // first record still in the ring
+static uint32_t s_cursor[GLOG_CUR_COUNT];
+static uint32_t s_dropped[GLOG_CUR_COUNT];
 static volatile int s_glog_defer = 0;
-static char s_glog_q[GLOG_DEFER_MAX][GLOG_BUF_SIZE];
-static uint8_t s_q_head = 0, s_q_tail = 0, s_q_count = 0;
+static volatile bool s_sink_enabled[GLOG_SINK_COUNT] = {true, true, true};
+static bool s_workers_started = false;
+static TaskHandle_t s_worker[GLOG_CUR_COUNT];
+
+static void ring_put(uint32_t pos, const void *src, size_t len) {
+    uint32_t idx = pos & (GLOG_RING_SIZE - 1);
+    size_t first = GLOG_RING_SIZE - idx;
+    if (first > len) first = len;
+    memcpy(s_ring + idx, src, first);
+    memcpy(s_ring, (const uint8_t *)src + first, len - first);
+}
+
+static void ring_get(uint32_t pos, void *dst, size_t len) {
+    uint32_t idx = pos & (GLOG_RING_SIZE - 1);
+    size_t first = GLOG_RING_SIZE - idx;
+    if (first > len) first = len;
+    memcpy(dst, s_ring + idx, first);
+    memcpy((uint8_t *)dst + first, s_ring, len - first);
+}
+
+static inline void ring_hdr(uint32_t pos, uint16_t *len, uint8_t *flags) {
+    uint8_t hdr[GLOG_REC_HDR];
+    ring_get(pos, hdr, sizeof(hdr));
+    *len = (uint16_t)(hdr[0] | (hdr[1] << 8));
+    *flags = hdr[2];
+}
+
+// caller holds s_glog_mux
+static void ring_make_room(uint32_t need) {
+    while (s_head + need - s_oldest > GLOG_RING_SIZE) {
+        uint16_t len;
+        uint8_t flags;
+        ring_hdr(s_oldest, &len, &flags);
+        uint32_t rec = GLOG_REC_HDR + len;
+        for (int c = 0; c < GLOG_CUR_COUNT; c++) {
+            if (s_cursor[c] == s_oldest) {
+                s_cursor[c] += rec;
+                if (c != GLOG_CUR_DEFER || (flags & GLOG_REC_DEFERRED)) s_dropped[c]++;
+            }
+        }
+        s_oldest += rec;
+    }
+}
+
+static void ring_push(const char *buf, size_t len, uint8_t flags) {
+    uint8_t hdr[GLOG_REC_HDR] = {(uint8_t)len, (uint8_t)(len >> 8), flags, 0};
+    uint32_t need = GLOG_REC_HDR + (uint32_t)len;
 
-static inline void glog_lock(void) {
-    if (!s_glog_mutex) s_glog_mutex = xSemaphoreCreateMutex();
-    if (s_glog_mutex) xSemaphoreTake(s_glog_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&s_glog_mux);
+    ring_make_room(need);
+    uint32_t start = s_head;
+    ring_put(start, hdr, sizeof(hdr));
+    ring_put(start + GLOG_REC_HDR, buf, len);
+    s_head += need;
+    // nothing waiting for the inline sinks: keep their cursor at the head
+    if (!(flags & GLOG_REC_DEFERRED) && s_cursor[GLOG_CUR_DEFER] == start) {
+        s_cursor[GLOG_CUR_DEFER] = s_head;
+    }
+    portEXIT_CRITICAL(&s_glog_mux);
 }
 
-static inline void glog_unlock(void) {
-    if (s_glog_mutex) xSemaphoreGive(s_glog_mutex);
+// copy the next record at cursor c into out, skipping records without
+// want_flags; returns false when the cursor has caught up with the head
+static bool ring_take(int c, uint8_t want_flags, char *out) {
+    bool found = false;
+    portENTER_CRITICAL(&s_glog_mux);
+    while (s_cursor[c] != s_head) {
+        uint16_t len;
+        uint8_t flags;
+        ring_hdr(s_cursor[c], &len, &flags);
+        uint32_t pos = s_cursor[c];
+        s_cursor[c] += GLOG_REC_HDR + len;
+        if ((flags & want_flags) != want_flags) continue;
+        ring_get(pos + GLOG_REC_HDR, out, len);
+        out[len] = '\0';
+        found = true;
+        break;
+    }
+    portEXIT_CRITICAL(&s_glog_mux);
+    return found;
 }
 
-static inline void glog_emit(const char *buf) {
-    printf("%s", buf);
+// what has to go out from the calling task: remote responses while the
+// command is still executing, and the inline sinks when configured
+static void glog_emit_inline(const char *buf) {
+#ifdef CONFIG_GLOG_INLINE_OUTPUT
+    if (s_sink_enabled[GLOG_SINK_CONSOLE]) {
+        printf("%s", buf);
+    }
+    if (s_sink_enabled[GLOG_SINK_TERMINAL]) {
+        terminal_view_add_text(buf);
+    }
+#endif
     if (esp_comm_manager_is_remote_command()) {
         esp_comm_manager_send_response((const uint8_t *)buf, strlen(buf));
     }
-    terminal_view_add_text(buf);
-    ap_manager_add_log(buf);
+}
+
+static void glog_worker(void *arg) {
+    int c = (int)(intptr_t)arg;
+    char out[GLOG_BUF_SIZE];
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+#ifndef CONFIG_GLOG_INLINE_OUTPUT
+        // deferred lines must not land inside a binary uart transfer
+        if (c == GLOG_CUR_CONSOLE && s_glog_defer) continue;
+#endif
+        while (ring_take(c, 0, out)) {
+            switch (c) {
+            case GLOG_CUR_WEB:
+                if (s_sink_enabled[GLOG_SINK_WEB]) ap_manager_add_log(out);
+                break;
+#ifndef CONFIG_GLOG_INLINE_OUTPUT
+            case GLOG_CUR_CONSOLE:
+                if (s_sink_enabled[GLOG_SINK_CONSOLE]) printf("%s", out);
+                break;
+            case GLOG_CUR_TERMINAL:
+                if (s_sink_enabled[GLOG_SINK_TERMINAL]) terminal_view_add_text(out);
+                break;
+#endif
+            }
+#ifndef CONFIG_GLOG_INLINE_OUTPUT
+            if (c == GLOG_CUR_CONSOLE && s_glog_defer) break;
+#endif
+        }
+    }
+}
+
+static void glog_start_workers(void) {
+    bool start = false;
+    portENTER_CRITICAL(&s_glog_mux);
+    if (!s_workers_started) {
+        s_workers_started = true;
+        start = true;
+    }
+    portEXIT_CRITICAL(&s_glog_mux);
+    if (!start) return;
+
+    xTaskCreate(glog_worker, "glog_web", GLOG_WORKER_STACK, (void *)(intptr_t)GLOG_CUR_WEB, 1,
+                &s_worker[GLOG_CUR_WEB]);
+#ifndef CONFIG_GLOG_INLINE_OUTPUT
+    xTaskCreate(glog_worker, "glog_uart", GLOG_WORKER_STACK,
+                (void *)(intptr_t)GLOG_CUR_CONSOLE, 2, &s_worker[GLOG_CUR_CONSOLE]);
+    // the terminal sink only copies into the view's own ring
+    xTaskCreate(glog_worker, "glog_term", GLOG_TERM_WORKER_STACK,
+                (void *)(intptr_t)GLOG_CUR_TERMINAL, 2, &s_worker[GLOG_CUR_TERMINAL]);
+#endif
+}
+
+static inline void glog_wake_workers(void) {
+    for (int c = GLOG_CUR_DEFER + 1; c < GLOG_CUR_COUNT; c++) {
+        if (s_worker[c]) xTaskNotifyGive(s_worker[c]);
+    }
 }
 
 void glog(const char *fmt, ...) {
@@ -65,43 +227,50 @@ void glog(const char *fmt, ...) {
         }
     }
 
-    glog_lock();
-    if (s_glog_defer) {
-        if (s_q_count == GLOG_DEFER_MAX) {
-            s_q_head = (s_q_head + 1) % GLOG_DEFER_MAX;
-            s_q_count--;
-        }
-        memcpy(s_glog_q[s_q_tail], buf, (size_t)written + 1);
-        s_q_tail = (s_q_tail + 1) % GLOG_DEFER_MAX;
-        s_q_count++;
-        glog_unlock();
-        return;
-    }
-    glog_unlock();
+    if (!s_workers_started) glog_start_workers();
 
-    glog_emit(buf);
+    bool defer = s_glog_defer;
+    ring_push(buf, (size_t)written, defer ? GLOG_REC_DEFERRED : 0);
+    glog_wake_workers();
+
+    if (!defer) {
+        glog_emit_inline(buf);
+    }
 }
 
 void glog_set_defer(int on) {
-    glog_lock();
     s_glog_defer = (on != 0);
-    glog_unlock();
+    // the console worker holds its backlog while deferred
+    if (!on) glog_wake_workers();
 }
 
 void glog_flush_deferred(void) {
-    for (;;) {
-        glog_lock();
-        if (s_q_count == 0) {
-            glog_unlock();
-            break;
-        }
-        char out[GLOG_BUF_SIZE];
-        memcpy(out, s_glog_q[s_q_head], GLOG_BUF_SIZE);
-        s_q_head = (s_q_head + 1) % GLOG_DEFER_MAX;
-        s_q_count--;
-        glog_unlock();
-        glog_emit(out);
+    char out[GLOG_BUF_SIZE];
+    while (ring_take(GLOG_CUR_DEFER, GLOG_REC_DEFERRED, out)) {
+        glog_emit_inline(out);
     }
+    glog_wake_workers();
 }
 
+void glog_set_sink_enabled(glog_sink_t sink, bool enabled) {
+    if (sink < GLOG_SINK_COUNT) s_sink_enabled[sink] = enabled;
+}
 
+uint32_t glog_sink_dropped(glog_sink_t sink) {
+    switch (sink) {
+    case GLOG_SINK_WEB:
+        return s_dropped[GLOG_CUR_WEB];
+#ifdef CONFIG_GLOG_INLINE_OUTPUT
+    case GLOG_SINK_CONSOLE:
+    case GLOG_SINK_TERMINAL:
+        return s_dropped[GLOG_CUR_DEFER];
+#else
+    case GLOG_SINK_CONSOLE:
+        return s_dropped[GLOG_CUR_CONSOLE];
+    case GLOG_SINK_TERMINAL:
+        return s_dropped[GLOG_CUR_TERMINAL];
+#endif
+    default:
+        return 0;
+    }
+}
@@ -1,10 +1,11 @@
 #include "core/ouis.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <ctype.h>
 
-extern const uint8_t ouis_json_start[] asm("_binary_ouis_json_start");
-extern const uint8_t ouis_json_end[]   asm("_binary_ouis_json_end");
+// sorted oui table generated at build time from core/ouis.json
+#include "ouis_table.h"
 
 static void normalize_prefix(const char *mac, char *out6) {
     int oi = 0;
@@ -27,45 +28,39 @@ static bool is_locally_administered(const char *mac) {
     return (first_octet & 0x02) != 0;
 }
 
-static void to_proper_caps(char *s) {
-    // properly capitalise: first letter upper, rest lower for each token split by space or hyphen
-    bool new_word = true;
-    for (size_t i = 0; s[i]; ++i) {
-        if (s[i] == ' ' || s[i] == '-' || s[i] == '_' ) { new_word = true; continue; }
-        if (new_word) { s[i] = (char)toupper((unsigned char)s[i]); new_word = false; }
-        else { s[i] = (char)tolower((unsigned char)s[i]); }
-    }
+static int hex_nibble(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    return toupper((unsigned char)c) - 'A' + 10;
+}
+
+static inline uint32_t oui_key_at(size_t i) {
+    const uint8_t *k = &oui_table_keys[i * 3];
+    return ((uint32_t)k[0] << 16) | ((uint32_t)k[1] << 8) | k[2];
 }
 
-// naive streaming scan of embedded json: {"FC3497":"espressif",...}
+// binary search over the packed 24-bit keys; names are pre-capitalised
 static bool lookup_vendor(const char *prefix6, char *out_vendor, size_t out_sz) {
-    const char *buf = (const char*)ouis_json_start;
-    const char *end = (const char*)ouis_json_end;
-    const size_t len = (size_t)(end - buf);
-    if (len == 0) return false;
-    // search for "PREFIX"
-    char keypat[16];
-    // pattern like "FC3497"
-    snprintf(keypat, sizeof(keypat), "\"%s\"", prefix6);
-    const char *p = buf;
-    while (p && p < end) {
-        const char *k = strstr(p, keypat);
-        if (!k || k >= end) break;
-        const char *colon = strchr(k + strlen(keypat), ':');
-        if (!colon || colon >= end) break;
-        const char *q1 = strchr(colon + 1, '"');
-        if (!q1 || q1 >= end) break;
-        const char *q2 = strchr(q1 + 1, '"');
-        if (!q2 || q2 >= end) break;
-        size_t vlen = (size_t)(q2 - (q1 + 1));
-        if (vlen >= out_sz) vlen = out_sz - 1;
-        memcpy(out_vendor, q1 + 1, vlen);
-        out_vendor[vlen] = '\0';
-        to_proper_caps(out_vendor);
-        return true;
-    
-        // move forward
-        p = k + 1;
+    if (out_sz == 0) return false;
+    uint32_t key = 0;
+    for (int i = 0; i < 6; ++i) {
+        key = (key << 4) | (uint32_t)hex_nibble(prefix6[i]);
+    }
+
+    size_t lo = 0;
+    size_t hi = OUI_TABLE_COUNT;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint32_t k = oui_key_at(mid);
+        if (k == key) {
+            const char *name = &oui_vendor_pool[oui_table_vendor[mid]];
+            size_t vlen = strlen(name);
+            if (vlen >= out_sz) vlen = out_sz - 1;
+            memcpy(out_vendor, name, vlen);
+            out_vendor[vlen] = '\0';
+            return true;
+        }
+        if (k < key) lo = mid + 1;
+        else hi = mid;
     }
     return false;
 }
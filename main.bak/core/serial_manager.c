@@ -31,6 +31,7 @@
 #endif
 #define BUF_SIZE (512)
 #define SERIAL_BUFFER_SIZE 512
+#define SERIAL_ARGV_INLINE 16
 
 char serial_buffer[SERIAL_BUFFER_SIZE];
 static TaskHandle_t s_serial_task_handle = NULL;
@@ -822,67 +823,45 @@ int handle_serial_command(const char *input) {
   }
   memcpy(input_copy, input, input_len);
   input_copy[input_len] = '\0';
-  char *argv[10];
-  int argc = 0;
-  char *p = input_copy;
-
-  while (*p != '\0' && argc < 10) {
-    while (isspace((unsigned char)*p)) {
-      p++;
-    }
-
-    if (*p == '\0') {
-      break;
-    }
-
-    if (*p == '"' || *p == '\'') {
-      // Handle quoted arguments
-      char quote = *p++;
-      argv[argc++] = p; // Start of the argument
-
-      while (*p != '\0' && *p != quote) {
-        p++;
-      }
-
-      if (*p == quote) {
-        *p = '\0'; // Null-terminate the argument
-        p++;
-      } else {
-        // Handle missing closing quote
-        printf("Error: Missing closing quote\n");
-        return ESP_ERR_INVALID_ARG;
-      }
-    } else {
-      // Handle unquoted arguments
-      argv[argc++] = p; // Start of the argument
-
-      while (*p != '\0' && !isspace((unsigned char)*p)) {
-        p++;
-      }
-
-      if (*p != '\0') {
-        *p = '\0'; // Null-terminate the argument
-        p++;
-      }
-    }
+  // count first so argv can hold every argument; short lines stay on the stack
+  int argc = command_tokenize(input_copy, NULL);
+  if (argc < 0) {
+    printf("Error: Missing closing quote\n");
+    return ESP_ERR_INVALID_ARG;
   }
-
   if (argc == 0) {
     return ESP_ERR_INVALID_ARG;
   }
 
+  char *argv_small[SERIAL_ARGV_INLINE + 1];
+  char **argv = argv_small;
+  if (argc > SERIAL_ARGV_INLINE) {
+    argv = malloc((size_t)(argc + 1) * sizeof(char *));
+    if (!argv) {
+      return ESP_ERR_NO_MEM;
+    }
+  }
+  command_tokenize(input_copy, argv);
+  argv[argc] = NULL;
+
+  esp_err_t ret;
   CommandFunction cmd_func = find_command(argv[0]);
   if (cmd_func != NULL) {
     // Add command to history before executing
     command_history_add(input);
     cmd_func(argc, argv);
-    return ESP_OK;
+    ret = ESP_OK;
   } else {
     // Add command to history even if unknown
     command_history_add(input);
     handle_unknown_command(argv[0]);
-    return ESP_ERR_INVALID_ARG;
+    ret = ESP_ERR_INVALID_ARG;
+  }
+
+  if (argv != argv_small) {
+    free(argv);
   }
+  return ret;
 }
 
 void simulateCommand(const char *commandString) {
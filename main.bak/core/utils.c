@@ -1,4 +1,5 @@
 #include "core/utils.h"
+#include "core/file_index.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include <esp_heap_caps.h>
@@ -88,89 +89,18 @@ int get_query_param_value(const char *query, const char *key, char *value,
 }
 
 int get_next_pcap_file_index(const char *base_name) {
-  int max_index = -1;
-
-  DIR *dir = opendir("/mnt/ghostesp/pcaps");
-  if (!dir) {
-    ESP_LOGE(TAG, "Failed to open directory /mnt/ghostesp/pcaps");
-    return -1;
-  }
-
-  struct dirent *entry;
-  while ((entry = readdir(dir)) != NULL) {
-
-    if (strncmp(entry->d_name, base_name, strlen(base_name)) == 0) {
-
-      int index;
-      if (sscanf(entry->d_name + strlen(base_name), "_%d.pcap", &index) == 1) {
-
-        if (index > max_index) {
-          max_index = index;
-        }
-      }
-    }
-  }
-
-  closedir(dir);
-  return max_index + 1;
+  return file_index_next("/mnt/ghostesp/pcaps", base_name, "pcap");
 }
 
 int get_next_csv_file_index(const char *base_name) {
-  int max_index = -1;
-
-  DIR *dir = opendir("/mnt/ghostesp/gps");
-  if (!dir) {
-    ESP_LOGE(TAG, "Failed to open directory /mnt/ghostesp/gps");
-    return -1;
-  }
-
-  struct dirent *entry;
-  while ((entry = readdir(dir)) != NULL) {
-    if (strncmp(entry->d_name, base_name, strlen(base_name)) == 0) {
-      int index;
-      if (sscanf(entry->d_name + strlen(base_name), "_%d.csv", &index) == 1) {
-        if (index > max_index) {
-          max_index = index;
-        }
-      }
-    }
-  }
-
-  closedir(dir);
-  return max_index + 1;
+  return file_index_next("/mnt/ghostesp/gps", base_name, "csv");
 }
 
 int get_next_file_index(const char *dir_path, const char *base_name,
                           const char *extension) {
-  int max_index = -1;
-
-  DIR *dir = opendir(dir_path);
-  if (!dir) {
-    ESP_LOGE(TAG, "Failed to open directory %s", dir_path);
-    // If directory doesn't exist, first file will be index 0
-    return 0; 
-  }
-
-  struct dirent *entry;
-  char format_string[64];
-  snprintf(format_string, sizeof(format_string), "%s_%%d.%s", base_name, extension);
-
-  while ((entry = readdir(dir)) != NULL) {
-    // Check if the filename starts with the base name
-    if (strncmp(entry->d_name, base_name, strlen(base_name)) == 0) {
-      int index;
-      // Try to parse the index from the filename
-      if (sscanf(entry->d_name, format_string, &index) == 1) {
-        if (index > max_index) {
-          max_index = index;
-        }
-      }
-    }
-  }
-
-  closedir(dir);
-  // Return the next index (max found + 1). If none found, max_index is -1, so returns 0.
-  return max_index + 1;
+  int next = file_index_next(dir_path, base_name, extension);
+  // If directory doesn't exist, first file will be index 0
+  return next < 0 ? 0 : next;
 }
 
 void log_heap_status(const char *tag, const char *event) {
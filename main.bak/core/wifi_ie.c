@@ -0,0 +1,217 @@
+#include "core/wifi_ie.h"
+#include <string.h>
+
+#define WIFI_MGMT_HDR_LEN 24
+#define WIFI_FCS_LEN 4
+#define WIFI_CAP_PRIVACY 0x0010
+#define WPS_ATTR_CONFIG_METHODS 0x1008
+
+static const uint8_t rsn_oui[3] = {0x00, 0x0F, 0xAC};
+static const uint8_t wfa_oui[3] = {0x00, 0x50, 0xF2};
+
+static inline uint16_t rd_le16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint16_t rd_be16(const uint8_t *p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline uint32_t suite_bit(const uint8_t *suite, const uint8_t *oui) {
+    if (suite[0] != oui[0] || suite[1] != oui[1] || suite[2] != oui[2] || suite[3] >= 32) {
+        return 0;
+    }
+    return 1u << suite[3];
+}
+
+// group/pairwise/akm/caps layout shared by rsn and the legacy wpa element.
+// p starts after the version field; truncated lists keep what was read.
+static void parse_security_suites(const uint8_t *p, size_t len, const uint8_t *oui,
+                                  uint16_t *group, uint16_t *pairwise, uint32_t *akm,
+                                  uint16_t *caps) {
+    size_t pos = 0;
+    if (pos + 4 > len) return;
+    *group |= (uint16_t)suite_bit(p + pos, oui);
+    pos += 4;
+
+    if (pos + 2 > len) return;
+    uint16_t count = rd_le16(p + pos);
+    pos += 2;
+    for (uint16_t i = 0; i < count; i++, pos += 4) {
+        if (pos + 4 > len) return;
+        *pairwise |= (uint16_t)suite_bit(p + pos, oui);
+    }
+
+    if (pos + 2 > len) return;
+    count = rd_le16(p + pos);
+    pos += 2;
+    for (uint16_t i = 0; i < count; i++, pos += 4) {
+        if (pos + 4 > len) return;
+        *akm |= suite_bit(p + pos, oui);
+    }
+
+    if (caps && pos + 2 <= len) {
+        *caps = rd_le16(p + pos);
+    }
+}
+
+static void parse_wps_attrs(const uint8_t *p, size_t len, wifi_ie_info_t *out) {
+    size_t pos = 0;
+    while (pos + 4 <= len) {
+        uint16_t attr_id = rd_be16(p + pos);
+        uint16_t attr_len = rd_be16(p + pos + 2);
+        if (attr_len > len - (pos + 4)) break;
+        if (attr_id == WPS_ATTR_CONFIG_METHODS && attr_len == 2) {
+            out->wps_config_methods = rd_be16(p + pos + 4);
+            out->flags |= WIFI_IE_F_WPS_METHODS;
+            return;
+        }
+        pos += 4 + attr_len;
+    }
+}
+
+static void parse_vendor(const uint8_t *body, uint8_t len, wifi_ie_info_t *out) {
+    if (len < 3) return;
+    uint32_t oui = ((uint32_t)body[0] << 16) | ((uint32_t)body[1] << 8) | body[2];
+
+    bool seen = false;
+    for (uint8_t i = 0; i < out->vendor_oui_count; i++) {
+        if (out->vendor_ouis[i] == oui) {
+            seen = true;
+            break;
+        }
+    }
+    if (!seen && out->vendor_oui_count < WIFI_IE_MAX_VENDOR_OUIS) {
+        out->vendor_ouis[out->vendor_oui_count++] = oui;
+    }
+
+    if (len < 4 || memcmp(body, wfa_oui, 3) != 0) return;
+    uint8_t oui_type = body[3];
+
+    if (oui_type == 0x01 && !(out->flags & WIFI_IE_F_WPA)) {
+        // wpa: oui(3) type(1) version(2) then rsn-style suites, no caps
+        out->flags |= WIFI_IE_F_WPA;
+        if (len >= 6) {
+            parse_security_suites(body + 6, len - 6, wfa_oui, &out->wpa_group,
+                                  &out->wpa_pairwise, &out->wpa_akm, NULL);
+        }
+    } else if (oui_type == 0x04 && !(out->flags & WIFI_IE_F_WPS)) {
+        out->flags |= WIFI_IE_F_WPS;
+        out->wps = body + 4;
+        out->wps_len = (uint8_t)(len - 4);
+        parse_wps_attrs(out->wps, out->wps_len, out);
+    }
+}
+
+bool wifi_ie_parse(const uint8_t *ies, size_t len, wifi_ie_info_t *out) {
+    size_t pos = 0;
+
+    while (pos + 2 <= len) {
+        uint8_t id = ies[pos];
+        uint8_t elen = ies[pos + 1];
+        if (elen > len - (pos + 2)) {
+            out->flags |= WIFI_IE_F_TRUNCATED;
+            return false;
+        }
+        const uint8_t *body = ies + pos + 2;
+
+        switch (id) {
+        case WIFI_IE_ID_SSID:
+            if (!(out->flags & WIFI_IE_F_SSID) && elen <= 32) {
+                out->ssid = body;
+                out->ssid_len = elen;
+                out->flags |= WIFI_IE_F_SSID;
+            }
+            break;
+        case WIFI_IE_ID_DS_PARAMS:
+            if (elen >= 1 && !out->ds_channel) out->ds_channel = body[0];
+            break;
+        case WIFI_IE_ID_HT_CAP:
+            out->flags |= WIFI_IE_F_HT;
+            break;
+        case WIFI_IE_ID_HT_OPER:
+            out->flags |= WIFI_IE_F_HT;
+            if (elen >= 1) out->ht_channel = body[0];
+            break;
+        case WIFI_IE_ID_VHT_CAP:
+            out->flags |= WIFI_IE_F_VHT;
+            break;
+        case WIFI_IE_ID_RSN:
+            if (!(out->flags & WIFI_IE_F_RSN)) {
+                out->flags |= WIFI_IE_F_RSN;
+                if (elen >= 2) {
+                    parse_security_suites(body + 2, elen - 2, rsn_oui, &out->rsn_group,
+                                          &out->rsn_pairwise, &out->rsn_akm, &out->rsn_caps);
+                }
+            }
+            break;
+        case WIFI_IE_ID_VENDOR:
+            parse_vendor(body, elen, out);
+            break;
+        case WIFI_IE_ID_EXTENSION:
+            if (elen >= 1 && body[0] == WIFI_IE_EXT_HE_CAP) out->flags |= WIFI_IE_F_HE;
+            break;
+        default:
+            break;
+        }
+
+        pos += 2 + (size_t)elen;
+    }
+
+    return true;
+}
+
+bool wifi_ie_parse_mgmt(const uint8_t *frame, size_t len, wifi_ie_info_t *out) {
+    memset(out, 0, sizeof(*out));
+    // sig_len counts the trailing fcs, which must not be read as an element
+    if (!frame || len < WIFI_MGMT_HDR_LEN + WIFI_FCS_LEN) return false;
+    len -= WIFI_FCS_LEN;
+    if ((frame[0] & 0x0C) != 0) return false; // not a management frame
+
+    size_t fixed;
+    size_t cap_off;
+    switch ((frame[0] & 0xF0) >> 4) {
+    case 0x0: fixed = 4; cap_off = 0; break;   // assoc req: cap, listen interval
+    case 0x1:                                  // assoc resp: cap, status, aid
+    case 0x3: fixed = 6; cap_off = 0; break;   // reassoc resp
+    case 0x2: fixed = 10; cap_off = 0; break;  // reassoc req: cap, listen, current ap
+    case 0x4: fixed = 0; cap_off = 0; break;   // probe req
+    case 0x5:                                  // probe resp
+    case 0x8: fixed = 12; cap_off = 10; break; // beacon: timestamp, interval, cap
+    default: return false;
+    }
+
+    const uint8_t *body = frame + WIFI_MGMT_HDR_LEN;
+    size_t body_len = len - WIFI_MGMT_HDR_LEN;
+    if (body_len < fixed) {
+        out->flags |= WIFI_IE_F_TRUNCATED;
+        return true;
+    }
+    if (fixed) {
+        out->capability = rd_le16(body + cap_off);
+        if (out->capability & WIFI_CAP_PRIVACY) out->flags |= WIFI_IE_F_PRIVACY;
+    }
+
+    wifi_ie_parse(body + fixed, body_len - fixed, out);
+    return true;
+}
+
+size_t wifi_ie_copy_ssid(const wifi_ie_info_t *info, char *out, size_t out_sz) {
+    if (!out || out_sz == 0) return 0;
+    size_t n = info->ssid_len;
+    if (n >= out_sz) n = out_sz - 1;
+    if (n) memcpy(out, info->ssid, n);
+    out[n] = '\0';
+    return n;
+}
+
+const char *wifi_ie_security_label(const wifi_ie_info_t *info) {
+    if (info->flags & WIFI_IE_F_RSN) {
+        if (info->rsn_akm & (WIFI_IE_AKM_SAE | WIFI_IE_AKM_FT_SAE)) return "WPA3";
+        if (info->rsn_akm & WIFI_IE_AKM_OWE) return "OWE";
+        return "WPA2";
+    }
+    if (info->flags & WIFI_IE_F_WPA) return "WPA";
+    if (info->flags & WIFI_IE_F_PRIVACY) return "WEP";
+    return "OPEN";
+}
@@ -4,6 +4,10 @@
 #define GHOST_SITE_PAYLOAD_SIZE ghost_site_html_gz_size
 #define GHOST_SITE_IS_GZ 1
 #include "managers/settings_manager.h"
+#include "managers/sd_xfer.h"
+#include "managers/log_ring.h"
+#include "managers/sd_list.h"
+#include "managers/infrared_file.h"
 #include "core/esp_comm_manager.h"
 #include "core/ouis.h"
 #include "sdkconfig.h"
@@ -12,6 +16,7 @@
 #include <ctype.h>
 #include <dirent.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <esp_event.h>
 #include <esp_http_server.h>
 #include <esp_log.h>
@@ -25,9 +30,11 @@
 #include <nvs_flash.h>
 #include <stdio.h>
 #include "mbedtls/base64.h"
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include <time.h>
 #include <sys/stat.h>
 
@@ -68,6 +75,9 @@ static esp_err_t api_settings_handler(httpd_req_t *req);
 static esp_err_t api_command_handler(httpd_req_t *req);
 static esp_err_t api_settings_get_handler(httpd_req_t *req);
 static esp_err_t api_logs_handler(httpd_req_t *req);
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+static esp_err_t api_logs_stream_handler(httpd_req_t *req);
+#endif
 static esp_err_t api_esp_comm_status_handler(httpd_req_t *req);
 static esp_err_t api_esp_comm_control_handler(httpd_req_t *req);
 static esp_err_t api_esp_comm_send_handler(httpd_req_t *req);
@@ -86,9 +96,9 @@ static esp_err_t teardown_mdns(void);
 
 #define WEBUI_AP_SUBNET_BASE_ADDR PP_HTONL(LWIP_MAKEU32(192, 168, 4, 0))
 #define WEBUI_AP_SUBNET_MASK_ADDR PP_HTONL(LWIP_MAKEU32(255, 255, 255, 0))
-#define MAX_LOG_BUFFER_SIZE (8 * 1024)  // 8KB log buffer size
-#define LOG_CHUNK_SIZE (MAX_LOG_BUFFER_SIZE / 4)  // Size to remove when buffer is full
+#define LOG_SSE_MAX_CLIENTS 2
 #define MAX_FILE_SIZE (5 * 1024 * 1024) // 5 MB
+#define MAX_PATH_LENGTH 512
 #define AP_MANAGER_BUFFER_SIZE (1024)   // 1 KB buffer size for reading chunks
 #define MIN_(a, b) ((a) < (b) ? (a) : (b))
 #define SERIAL_BUFFER_SIZE 528          // Size of serial buffer
@@ -220,10 +230,22 @@ static void parse_digest_param(const char *hdr, const char *key, char *out, size
     }
 }
 
-static char *log_buffer = NULL; // dynamically allocated at runtime
-static size_t log_buffer_index = 0;
+// log ring (managers/log_ring.c), buffer allocated at runtime; every access
+// holds log_mutex
+static log_ring_t log_ring;
 static SemaphoreHandle_t log_mutex = NULL;
 
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+typedef struct {
+    int fd; // -1 when free
+    uint32_t cursor;
+} log_sse_client_t;
+
+static log_sse_client_t log_sse_clients[LOG_SSE_MAX_CLIENTS] = {{-1, 0}, {-1, 0}};
+static volatile bool log_sse_push_queued = false;
+static void log_sse_schedule_push(void);
+#endif
+
 static httpd_handle_t server = NULL;
 static esp_netif_t *netif = NULL;
 static bool mdns_freed = false;
@@ -233,17 +255,6 @@ static httpd_uri_t uri_handlers[20];
 static int handler_count = 0;
 static bool config_loaded = false;
 
-// Checks if the AP enabled key exists in NVS. Used to decide whether to apply a default override.
-static bool settings_ap_enabled_key_exists(void) {
-    nvs_handle_t h;
-    esp_err_t err = nvs_open("storage", NVS_READONLY, &h);
-    if (err != ESP_OK) return false;
-    uint8_t val;
-    err = nvs_get_u8(h, "ap_enabled", &val);
-    nvs_close(h);
-    return (err == ESP_OK);
-}
-
 static esp_err_t scan_directory(const char *base_path, cJSON *json_array) {
     DIR *dir = opendir(base_path);
     if (!dir) {
@@ -253,6 +264,9 @@ static esp_err_t scan_directory(const char *base_path, cJSON *json_array) {
 
     struct dirent *entry;
     while ((entry = readdir(dir)) != NULL) {
+        // dot files are our own bookkeeping (.ghost_index, .gidx caches)
+        if (entry->d_name[0] == '.') continue;
+
         // Dynamically allocate memory for full_path
         size_t full_path_len = strlen(base_path) + strlen(entry->d_name) + 2; // +2 for '/' and '\0'
         char *full_path = malloc(full_path_len);
@@ -363,10 +377,192 @@ static esp_err_t api_sd_card_get_handler(httpd_req_t *req) {
     return ESP_OK;
 }
 
+static bool sd_list_query_u32(const char *query, const char *key, uint32_t *out) {
+    char val[12];
+    if (!query || httpd_query_key_value(query, key, val, sizeof(val)) != ESP_OK) return false;
+    *out = (uint32_t)strtoul(val, NULL, 10);
+    return true;
+}
+
+static esp_err_t sd_list_send_chunk(void *ctx, const char *data, size_t len) {
+    return httpd_resp_send_chunk(ctx, data, len);
+}
+
+// /api/sdcard/list?path=/mnt/dir&offset=0&limit=100&sort=name|none&order=asc|desc
+// lists one directory and streams the page as json while reading it
+static esp_err_t api_sd_card_list_handler(httpd_req_t *req) {
+    WEBUI_GUARD_OR_RETURN(req);
+
+    char *query = NULL;
+    size_t query_len = httpd_req_get_url_query_len(req) + 1;
+    if (query_len > 1) {
+        query = malloc(query_len);
+        if (!query || httpd_req_get_url_query_str(req, query, query_len) != ESP_OK) {
+            free(query);
+            query = NULL;
+        }
+    }
+
+    char dir_path[MAX_PATH_LENGTH] = "/mnt";
+    char encoded[MAX_PATH_LENGTH];
+    if (query && httpd_query_key_value(query, "path", encoded, sizeof(encoded)) == ESP_OK) {
+        url_decode(dir_path, encoded);
+    }
+    size_t dl = strlen(dir_path);
+    while (dl > 4 && dir_path[dl - 1] == '/') dir_path[--dl] = '\0';
+
+    sd_list_opts_t opts = {.limit = SD_LIST_DEFAULT_LIMIT};
+    sd_list_query_u32(query, "offset", &opts.offset);
+    sd_list_query_u32(query, "limit", &opts.limit);
+
+    char sort[8] = "name", order[8] = "asc";
+    if (query) {
+        httpd_query_key_value(query, "sort", sort, sizeof(sort));
+        httpd_query_key_value(query, "order", order, sizeof(order));
+    }
+    free(query);
+    opts.sorted = strcmp(sort, "none") != 0;
+    opts.desc = strcmp(order, "desc") == 0;
+
+    httpd_resp_set_type(req, "application/json");
+    if (strncmp(dir_path, "/mnt", 4) != 0 || (dir_path[4] && dir_path[4] != '/') ||
+        strstr(dir_path, "..")) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        return httpd_resp_sendstr(req, "{\"error\": \"Path must be inside /mnt.\"}");
+    }
+
+    esp_err_t err = sd_list_dir(dir_path, &opts, sd_list_send_chunk, req);
+    switch (err) {
+    case ESP_OK:
+        return httpd_resp_send_chunk(req, NULL, 0);
+    case ESP_ERR_NOT_FOUND:
+        httpd_resp_set_status(req, "404 Not Found");
+        return httpd_resp_sendstr(req, "{\"error\": \"Directory not found.\"}");
+    case ESP_ERR_NO_MEM:
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        return httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed.\"}");
+    case ESP_ERR_INVALID_SIZE:
+        httpd_resp_set_status(req, "500 Internal Server Error");
+        return httpd_resp_sendstr(req, "{\"error\": \"Directory too large to sort, use sort=none.\"}");
+    default:
+        ESP_LOGE(TAG, "Failed to send directory listing: %s", esp_err_to_name(err));
+        return err;
+    }
+}
+
+// a stalled peer gets this many socket timeouts in a row (recv_wait_timeout /
+// send_wait_timeout each) before the transfer is given up
+#define SD_SOCK_TIMEOUT_RETRIES 3
+
+static esp_err_t sd_send_all(httpd_req_t *req, const uint8_t *data, size_t len) {
+    int timeouts = 0;
+    while (len > 0) {
+        int n = httpd_send(req, (const char *)data, len);
+        if (n == HTTPD_SOCK_ERR_TIMEOUT && ++timeouts < SD_SOCK_TIMEOUT_RETRIES) continue;
+        if (n <= 0) return ESP_FAIL;
+        timeouts = 0;
+        data += n;
+        len -= (size_t)n;
+    }
+    return ESP_OK;
+}
+
+// stream a file with a real Content-Length so browsers show progress and can
+// resume with Range; the body is read ahead by sd_xfer while we send
+static esp_err_t sd_send_file(httpd_req_t *req, const char *file_path) {
+    int fd = open(file_path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        if (fd >= 0) close(fd);
+        ESP_LOGE(TAG, "Failed to open file: %s", file_path);
+        httpd_resp_set_status(req, "404 Not Found");
+        httpd_resp_set_type(req, "application/json");
+        return httpd_resp_sendstr(req, "{\"error\": \"File not found.\"}");
+    }
+
+    size_t size = (size_t)st.st_size;
+    size_t first = 0, last = size ? size - 1 : 0;
+    int ranged = 0;
+    char range[64];
+    if (httpd_req_get_hdr_value_str(req, "Range", range, sizeof(range)) == ESP_OK) {
+        ranged = sd_xfer_parse_range(range, size, &first, &last);
+    }
+
+    char hdr[384];
+    if (ranged < 0) {
+        close(fd);
+        int n = snprintf(hdr, sizeof(hdr),
+                         "HTTP/1.1 416 Range Not Satisfiable\r\n"
+                         "Content-Range: bytes */%u\r\n"
+                         "Content-Length: 0\r\n\r\n",
+                         (unsigned)size);
+        return sd_send_all(req, (const uint8_t *)hdr, (size_t)n);
+    }
+
+    // quotes would end the filename parameter early
+    const char *base = strrchr(file_path, '/');
+    char name[128];
+    snprintf(name, sizeof(name), "%s", base ? base + 1 : file_path);
+    for (char *c = name; *c; c++) {
+        if (*c == '"' || *c == '\\' || (unsigned char)*c < 0x20) *c = '_';
+    }
+
+    size_t length = size ? last - first + 1 : 0;
+    int n;
+    if (ranged) {
+        n = snprintf(hdr, sizeof(hdr),
+                     "HTTP/1.1 206 Partial Content\r\n"
+                     "Content-Type: application/octet-stream\r\n"
+                     "Content-Disposition: attachment; filename=\"%s\"\r\n"
+                     "Accept-Ranges: bytes\r\n"
+                     "Content-Range: bytes %u-%u/%u\r\n"
+                     "Content-Length: %u\r\n\r\n",
+                     name, (unsigned)first, (unsigned)last, (unsigned)size, (unsigned)length);
+    } else {
+        n = snprintf(hdr, sizeof(hdr),
+                     "HTTP/1.1 200 OK\r\n"
+                     "Content-Type: application/octet-stream\r\n"
+                     "Content-Disposition: attachment; filename=\"%s\"\r\n"
+                     "Accept-Ranges: bytes\r\n"
+                     "Content-Length: %u\r\n\r\n",
+                     name, (unsigned)length);
+    }
+
+    sd_xfer_t *x = length ? sd_xfer_begin_read(fd, (off_t)first, length) : NULL;
+    if (length && !x) {
+        ESP_LOGE(TAG, "No memory to stream %s", file_path);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed.\"}");
+    }
+    if (!length) close(fd);
+
+    esp_err_t ret = sd_send_all(req, (const uint8_t *)hdr, (size_t)n);
+    size_t sent = 0;
+    if (x) {
+        const uint8_t *chunk;
+        size_t chunk_len;
+        while (ret == ESP_OK && (chunk = sd_xfer_next(x, &chunk_len)) != NULL) {
+            ret = sd_send_all(req, chunk, chunk_len);
+            sd_xfer_release(x);
+            sent += chunk_len;
+        }
+        if (sd_xfer_end(x) != ESP_OK) ret = ESP_FAIL;
+    }
+
+    if (ret == ESP_OK && sent == length) {
+        ESP_LOGI(TAG, "File sent successfully: %s (%u bytes)", file_path, (unsigned)sent);
+        return ESP_OK;
+    }
+    // headers are out, the only way to signal a short body is to drop the socket
+    ESP_LOGE(TAG, "File download failed for: %s after %u of %u bytes", file_path,
+             (unsigned)sent, (unsigned)length);
+    return ESP_FAIL;
+}
+
 static esp_err_t api_sd_card_post_handler(httpd_req_t *req) {
     WEBUI_GUARD_OR_RETURN(req);
     char buf[512];
-    int received = httpd_req_recv(req, buf, sizeof(buf));
+    int received = httpd_req_recv(req, buf, sizeof(buf) - 1);
     if (received <= 0) {
         ESP_LOGE(TAG, "Failed to receive request payload.");
         httpd_resp_set_status(req, "400 Bad Request");
@@ -393,66 +589,11 @@ static esp_err_t api_sd_card_post_handler(httpd_req_t *req) {
         return ESP_FAIL;
     }
 
-    const char *file_path = path_item->valuestring;
-
-    // Open the file
-    FILE *file = fopen(file_path, "rb");
-    if (!file) {
-        ESP_LOGE(TAG, "Failed to open file: %s", file_path);
-        cJSON_Delete(json);
-        httpd_resp_set_status(req, "404 Not Found");
-        httpd_resp_sendstr(req, "{\"error\": \"File not found.\"}");
-        return ESP_FAIL;
-    }
-
-    // Set response headers for chunked transfer
-    httpd_resp_set_type(req, "application/octet-stream");
-    httpd_resp_set_hdr(req, "Content-Disposition", "attachment");
-
-    // Allocate a buffer for sending chunks
-    char *chunk_buf = malloc(AP_MANAGER_BUFFER_SIZE);
-    if (!chunk_buf) {
-        ESP_LOGE(TAG, "Failed to allocate memory for chunk buffer.");
-        fclose(file);
-        cJSON_Delete(json);
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed.\"}");
-        return ESP_FAIL;
-    }
-
-    size_t bytes_read;
-    esp_err_t ret = ESP_OK;
-    while ((bytes_read = fread(chunk_buf, 1, AP_MANAGER_BUFFER_SIZE, file)) > 0) {
-        if (httpd_resp_send_chunk(req, chunk_buf, bytes_read) != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to send file chunk.");
-            ret = ESP_FAIL;
-            break;
-        }
-    }
-
-    // Send final, zero-length chunk
-    if (ret == ESP_OK) {
-        if (httpd_resp_send_chunk(req, NULL, 0) != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to send final chunk.");
-            ret = ESP_FAIL;
-        }
-    }
-
-    fclose(file);
-    free(chunk_buf);
+    esp_err_t ret = sd_send_file(req, path_item->valuestring);
     cJSON_Delete(json);
-
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "File sent successfully: %s", file_path);
-    } else {
-        ESP_LOGE(TAG, "File download failed for: %s", file_path);
-    }
-
     return ret;
 }
 
-#define MAX_PATH_LENGTH 512
-
 esp_err_t get_query_param(httpd_req_t *req, const char *key, char *value, size_t max_len) {
     size_t query_len = httpd_req_get_url_query_len(req) + 1;
 
@@ -502,6 +643,7 @@ esp_err_t api_sd_card_delete_file_handler(httpd_req_t *req) {
             memset(&r, 0, sizeof(struct _reent));
             int res = _unlink_r(&r, filepath);
             if (res == 0) {
+                infrared_file_index_forget(filepath);
                 ESP_LOGI(TAG, "File deleted successfully");
                 httpd_resp_set_status(req, "200 OK");
                 httpd_resp_send(req, "File deleted successfully", HTTPD_RESP_USE_STRLEN);
@@ -521,7 +663,70 @@ esp_err_t api_sd_card_delete_file_handler(httpd_req_t *req) {
     return ESP_FAIL;
 }
 
-// Handler for uploading files to SD card
+// GET /api/sdcard/download?path=...: same stream, but resumable by plain links
+static esp_err_t api_sd_card_download_get_handler(httpd_req_t *req) {
+    WEBUI_GUARD_OR_RETURN(req);
+    char path[MAX_PATH_LENGTH];
+    if (get_query_param(req, "path", path, sizeof(path)) != ESP_OK || path[0] == '\0') {
+        httpd_resp_set_status(req, "400 Bad Request");
+        httpd_resp_set_type(req, "application/json");
+        return httpd_resp_sendstr(req, "{\"error\": \"Missing or invalid 'path' query parameter.\"}");
+    }
+    return sd_send_file(req, path);
+}
+
+#define SD_UPLOAD_BOUNDARY_MAX 70 // rfc 2046 limit
+#define SD_UPLOAD_DELIM_MAX (4 + SD_UPLOAD_BOUNDARY_MAX)
+#define SD_UPLOAD_HDR_MAX 1024       // part headers of the file field
+
+static const uint8_t *sd_find(const uint8_t *hay, size_t hay_len, const char *needle,
+                              size_t needle_len) {
+    if (needle_len == 0 || hay_len < needle_len) return NULL;
+    const uint8_t *end = hay + hay_len - needle_len + 1;
+    for (const uint8_t *p = hay; (p = memchr(p, needle[0], (size_t)(end - p))) != NULL; p++) {
+        if (memcmp(p, needle, needle_len) == 0) return p;
+    }
+    return NULL;
+}
+
+// pull the boundary out of "multipart/form-data; boundary=..." and build the
+// "\r\n--boundary" delimiter that ends the file part
+static size_t sd_upload_delimiter(httpd_req_t *req, char *delim) {
+    char ctype[160];
+    if (httpd_req_get_hdr_value_str(req, "Content-Type", ctype, sizeof(ctype)) != ESP_OK ||
+        strncasecmp(ctype, "multipart/form-data", 19) != 0) {
+        return 0;
+    }
+    char *b = strstr(ctype, "boundary=");
+    if (!b) return 0;
+    b += 9;
+    if (*b == '"') b++;
+    size_t len = strcspn(b, "\";");
+    if (len == 0 || len > SD_UPLOAD_BOUNDARY_MAX) return 0;
+    memcpy(delim, "\r\n--", 4);
+    memcpy(delim + 4, b, len);
+    return 4 + len;
+}
+
+// HTTPD_SOCK_ERR_TIMEOUT once the client stayed silent SD_SOCK_TIMEOUT_RETRIES times
+static int sd_upload_recv(httpd_req_t *req, uint8_t *buf, size_t len) {
+    for (int i = 0;; i++) {
+        int n = httpd_req_recv(req, (char *)buf, len);
+        if (n != HTTPD_SOCK_ERR_TIMEOUT || i + 1 >= SD_SOCK_TIMEOUT_RETRIES) return n;
+    }
+}
+
+static esp_err_t sd_upload_fail(httpd_req_t *req, const char *status, const char *msg) {
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, msg);
+    return ESP_FAIL;
+}
+
+// Handler for uploading files to SD card. multipart bodies (the web ui) and raw
+// bodies with ?name= are both streamed through sd_xfer: the socket fills one
+// buffer while the other is written, and the closing multipart delimiter is
+// cut off in-stream by holding back its length at the end of every buffer.
 static esp_err_t api_sd_card_upload_handler(httpd_req_t *req) {
     WEBUI_GUARD_OR_RETURN(req);
     ESP_LOGI(TAG, "Received file upload request.");
@@ -529,122 +734,150 @@ static esp_err_t api_sd_card_upload_handler(httpd_req_t *req) {
     // Retrieve 'path' query parameter
     char path_param[MAX_PATH_LENGTH] = {0};
     if (get_query_param(req, "path", path_param, sizeof(path_param)) != ESP_OK) {
-        httpd_resp_set_status(req, "400 Bad Request");
-        httpd_resp_set_type(req, "application/json");
-        httpd_resp_sendstr(req, "{\"error\": \"Missing or invalid 'path' query parameter.\"}");
-        return ESP_FAIL;
+        return sd_upload_fail(req, "400 Bad Request",
+                              "{\"error\": \"Missing or invalid 'path' query parameter.\"}");
     }
     ESP_LOGI(TAG, "Upload path: %s", path_param);
 
-    // Buffer for receiving data
-    char *buf = malloc(AP_MANAGER_BUFFER_SIZE + 1);
-    if (!buf) {
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed for buffer.\"}");
-        return ESP_FAIL;
-    }
-
-    char *file_path = NULL;
-    FILE *file = NULL;
-    int received;
-    int total_received = 0;
-    bool headers_parsed = false;
-    char *body_start = NULL;
-
-    while ((received = httpd_req_recv(req, buf, AP_MANAGER_BUFFER_SIZE)) > 0) {
-        buf[received] = '\0';
-        total_received += received;
-
-        if (!headers_parsed) {
-            body_start = strstr(buf, "\r\n\r\n");
-            if (body_start) {
-                headers_parsed = true;
-                body_start += 4; // Move past the separator
-
-                // Extract filename from headers
-                char *filename_start = strstr(buf, "filename=\"");
-                if (filename_start) {
-                    filename_start += strlen("filename=\"");
-                    char *filename_end = strstr(filename_start, "\"");
-                    if (filename_end) {
-                        char original_filename[128] = {0};
-                        strncpy(original_filename, filename_start, filename_end - filename_start);
-
-                        // Allocate memory for the full file path
-                        file_path = malloc(strlen(path_param) + strlen(original_filename) + 2);
-                        if (!file_path) {
-                            free(buf);
-                            httpd_resp_set_status(req, "500 Internal Server Error");
-                            httpd_resp_sendstr(req, "{\"error\": \"Memory allocation failed for file path.\"}");
-                            return ESP_FAIL;
-                        }
-                        snprintf(file_path, MAX_PATH_LENGTH + 128, "%s/%s", path_param, original_filename);
-                        
-                        ESP_LOGI(TAG, "Writing to file: %s", file_path);
-                        file = fopen(file_path, "wb");
-                        if (!file) {
-                            free(buf);
-                            free(file_path);
-                            httpd_resp_set_status(req, "500 Internal Server Error");
-                            httpd_resp_sendstr(req, "{\"error\": \"Failed to open file for writing.\"}");
-                            return ESP_FAIL;
-                        }
-                        
-                        // Write the first part of the file data
-                        size_t data_len = received - (body_start - buf);
-                        if (data_len > 0) {
-                            fwrite(body_start, 1, data_len, file);
-                        }
-                    }
-                }
+    char delim[SD_UPLOAD_DELIM_MAX];
+    size_t delim_len = sd_upload_delimiter(req, delim);
+    size_t remaining = req->content_len;
+    char filename[128] = {0};
+    uint8_t *hdr = NULL;
+    const uint8_t *pending = NULL; // body bytes read ahead of the first buffer
+    size_t pending_len = 0;
+
+    if (delim_len) {
+        hdr = malloc(SD_UPLOAD_HDR_MAX + 1);
+        if (!hdr) {
+            return sd_upload_fail(req, "500 Internal Server Error",
+                                  "{\"error\": \"Memory allocation failed for buffer.\"}");
+        }
+        size_t got = 0;
+        const uint8_t *body = NULL;
+        while (!body && got < SD_UPLOAD_HDR_MAX && remaining > 0) {
+            int n = sd_upload_recv(req, hdr + got, MIN_(SD_UPLOAD_HDR_MAX - got, remaining));
+            if (n == HTTPD_SOCK_ERR_TIMEOUT) {
+                free(hdr);
+                httpd_resp_send_408(req);
+                return ESP_FAIL;
             }
-        } else if (file) {
-            // Write subsequent chunks of file data
-            fwrite(buf, 1, received, file);
+            if (n <= 0) break;
+            got += (size_t)n;
+            remaining -= (size_t)n;
+            body = sd_find(hdr, got, "\r\n\r\n", 4);
         }
-    }
-    
-    free(buf);
-    if (file) {
-        fclose(file);
-        
-        // Post-process the file to remove the boundary
-        file = fopen(file_path, "r+b");
-        if (file) {
-            fseek(file, 0, SEEK_END);
-            long file_size = ftell(file);
-            fseek(file, 0, SEEK_SET);
-            
-            char *file_buf = malloc(file_size + 1);
-            if (file_buf) {
-                fread(file_buf, 1, file_size, file);
-                file_buf[file_size] = '\0';
-                
-                char *end_boundary = strstr(file_buf, "\r\n--");
-                if (end_boundary) {
-                    long new_size = end_boundary - file_buf;
-                    rewind(file);
-#ifdef _WIN32
-                    _chsize(_fileno(file), new_size);
-#else
-                    ftruncate(fileno(file), new_size);
-#endif
-                }
-                free(file_buf);
+        if (!body) {
+            free(hdr);
+            return sd_upload_fail(req, "400 Bad Request",
+                                  "{\"error\": \"Malformed multipart headers.\"}");
+        }
+        hdr[body - hdr] = '\0';
+        body += 4;
+        pending = body;
+        pending_len = got - (size_t)(body - hdr);
+
+        const char *fn = strstr((const char *)hdr, "filename=\"");
+        if (fn) {
+            fn += 10;
+            size_t fn_len = strcspn(fn, "\"");
+            snprintf(filename, sizeof(filename), "%.*s", (int)fn_len, fn);
+        }
+    } else if (get_query_param(req, "name", filename, sizeof(filename)) != ESP_OK) {
+        return sd_upload_fail(req, "400 Bad Request",
+                              "{\"error\": \"Raw uploads need a 'name' query parameter.\"}");
+    }
+
+    // browsers may send a full client path; only the last component is ours
+    const char *base = filename;
+    for (const char *c = filename; *c; c++) {
+        if (*c == '/' || *c == '\\') base = c + 1;
+    }
+    if (!*base || strcmp(base, ".") == 0 || strcmp(base, "..") == 0) {
+        free(hdr);
+        return sd_upload_fail(req, "400 Bad Request", "{\"error\": \"Missing file name.\"}");
+    }
+
+    char file_path[MAX_PATH_LENGTH + 128];
+    snprintf(file_path, sizeof(file_path), "%s/%s", path_param, base);
+    ESP_LOGI(TAG, "Writing to file: %s", file_path);
+
+    // the body size minus the closing "\r\n--boundary--\r\n" bounds the file
+    size_t expected = pending_len + remaining;
+    if (delim_len) expected = expected > delim_len + 4 ? expected - delim_len - 4 : 0;
+    char prealloc[4] = "1";
+    get_query_param(req, "prealloc", prealloc, sizeof(prealloc));
+    if (prealloc[0] == '0') expected = 0;
+
+    int fd = open(file_path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    sd_xfer_t *x = fd >= 0 ? sd_xfer_begin_write(fd, expected) : NULL;
+    if (!x) {
+        free(hdr);
+        return sd_upload_fail(req, "500 Internal Server Error",
+                              "{\"error\": \"Failed to open file for writing.\"}");
+    }
+
+    uint8_t carry[SD_UPLOAD_DELIM_MAX];
+    bool found = !delim_len;
+    int recv_err = 0;
+    for (;;) {
+        size_t cap;
+        uint8_t *buf = sd_xfer_get_buffer(x, &cap);
+        if (!buf) break; // writer failed, sd_xfer_finish reports it
+
+        size_t fill = pending_len;
+        if (pending_len) memcpy(buf, pending, pending_len);
+        while (fill < cap && remaining > 0) {
+            int n = sd_upload_recv(req, buf + fill, MIN_(cap - fill, remaining));
+            if (n <= 0) {
+                recv_err = n ? n : HTTPD_SOCK_ERR_FAIL;
+                break;
             }
-            fclose(file);
+            fill += (size_t)n;
+            remaining -= (size_t)n;
         }
+
+        size_t keep = 0;
+        if (delim_len) {
+            const uint8_t *d = sd_find(buf, fill, delim, delim_len);
+            if (d) {
+                found = true;
+                fill = (size_t)(d - buf);
+            } else if (remaining > 0) {
+                // the delimiter may straddle this buffer and the next one
+                keep = MIN_(delim_len - 1, fill);
+                memcpy(carry, buf + fill - keep, keep);
+            }
+        }
+        sd_xfer_commit(x, fill - keep);
+        pending = carry;
+        pending_len = keep;
+        if (found || recv_err || remaining == 0) break;
     }
-    free(file_path); // Free the allocated file_path
+    free(hdr);
 
-    if (received < 0) {
-        ESP_LOGE(TAG, "Error receiving file data.");
-        httpd_resp_set_status(req, "500 Internal Server Error");
-        httpd_resp_sendstr(req, "{\"error\": \"Failed to receive file data.\"}");
+    size_t written = 0;
+    esp_err_t err = sd_xfer_finish(x, &written);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error writing %s", file_path);
+        unlink(file_path);
+        return sd_upload_fail(req, "500 Internal Server Error",
+                              "{\"error\": \"Failed to write file data.\"}");
+    }
+    if (recv_err == HTTPD_SOCK_ERR_TIMEOUT) {
+        ESP_LOGE(TAG, "Upload timed out after %u bytes", (unsigned)written);
+        unlink(file_path);
+        httpd_resp_send_408(req);
         return ESP_FAIL;
     }
-    
-    ESP_LOGI(TAG, "File upload finished, total bytes: %d", total_received);
+    if (recv_err || !found) {
+        ESP_LOGE(TAG, "Error receiving file data.");
+        unlink(file_path);
+        return sd_upload_fail(req, "500 Internal Server Error",
+                              "{\"error\": \"Failed to receive file data.\"}");
+    }
+
+    ESP_LOGI(TAG, "File upload finished, total bytes: %u", (unsigned)written);
     httpd_resp_set_status(req, "200 OK");
     httpd_resp_set_type(req, "text/plain");
     httpd_resp_sendstr(req, "File uploaded successfully.");
@@ -660,8 +893,8 @@ esp_err_t ap_manager_init(void) {
     // default AP to OFF on first boot (when key not present in NVS)
 #if defined(CONFIG_IDF_TARGET_ESP32C5) && defined(CONFIG_BUILD_CONFIG_TEMPLATE)
     if (strcmp(CONFIG_BUILD_CONFIG_TEMPLATE, "somethingsomething") == 0) {
-        if (!settings_ap_enabled_key_exists()) {
-            G_Settings.ap_enabled = false;
+        if (!settings_ap_enabled_stored()) {
+            settings_set_ap_enabled(&G_Settings, false);
         }
     }
 #endif
@@ -679,9 +912,9 @@ esp_err_t ap_manager_init(void) {
         log_heap_status(TAG, "ap_init_disabled_pre_logbuf");
         
         // Initialize log buffer and mutex even when AP is disabled
-        ESP_LOGI(TAG, "Allocating log buffer: %d bytes", MAX_LOG_BUFFER_SIZE);
-        log_buffer = malloc(MAX_LOG_BUFFER_SIZE);
-        if(!log_buffer){
+        ESP_LOGI(TAG, "Allocating log buffer: %d bytes", LOG_RING_SIZE);
+        log_ring.buf = malloc(LOG_RING_SIZE);
+        if(!log_ring.buf){
             ESP_LOGE(TAG, "failed to alloc log buffer");
             log_heap_status(TAG, "ap_logbuf_alloc_fail");
             return ESP_ERR_NO_MEM;
@@ -691,13 +924,14 @@ esp_err_t ap_manager_init(void) {
         log_mutex = xSemaphoreCreateRecursiveMutex();
         if (!log_mutex) {
             ESP_LOGE(TAG, "Failed to create log mutex");
-            free(log_buffer);
-            log_buffer = NULL;
+            free(log_ring.buf);
+            log_ring.buf = NULL;
             return ESP_FAIL;
         }
 
-        if(log_buffer){
-            memset(log_buffer, 0, MAX_LOG_BUFFER_SIZE);
+        if(log_ring.buf){
+            memset(log_ring.buf, 0, LOG_RING_SIZE);
+            log_ring.tail = log_ring.head;
         }
         log_heap_status(TAG, "ap_init_disabled_complete");
         
@@ -850,9 +1084,9 @@ esp_err_t ap_manager_init(void) {
 
     // Initialize log buffer and mutex
     log_heap_status(TAG, "ap_init_enabled_pre_logbuf");
-    ESP_LOGI(TAG, "Allocating log buffer: %d bytes", MAX_LOG_BUFFER_SIZE);
-    log_buffer = malloc(MAX_LOG_BUFFER_SIZE);
-    if(!log_buffer){
+    ESP_LOGI(TAG, "Allocating log buffer: %d bytes", LOG_RING_SIZE);
+    log_ring.buf = malloc(LOG_RING_SIZE);
+    if(!log_ring.buf){
         ESP_LOGE(TAG, "failed to alloc log buffer");
         log_heap_status(TAG, "ap_logbuf_alloc_fail");
         return ESP_ERR_NO_MEM;
@@ -862,13 +1096,14 @@ esp_err_t ap_manager_init(void) {
     log_mutex = xSemaphoreCreateRecursiveMutex();
     if (!log_mutex) {
         ESP_LOGE(TAG, "Failed to create log mutex");
-        free(log_buffer);
-        log_buffer = NULL;
+        free(log_ring.buf);
+        log_ring.buf = NULL;
         return ESP_FAIL;
     }
 
-    if(log_buffer){
-        memset(log_buffer, 0, MAX_LOG_BUFFER_SIZE);
+    if(log_ring.buf){
+        memset(log_ring.buf, 0, LOG_RING_SIZE);
+        log_ring.tail = log_ring.head;
     }
 
     log_heap_status(TAG, "ap_init_complete");
@@ -911,9 +1146,9 @@ void ap_manager_deinit(void) {
     
     teardown_mdns();
     
-    if(log_buffer){
-        free(log_buffer);
-        log_buffer = NULL;
+    if(log_ring.buf){
+        free(log_ring.buf);
+        log_ring.buf = NULL;
     }
 
     if (log_mutex) {
@@ -937,37 +1172,84 @@ void ap_manager_add_log(const char *log_message) {
         return;
     }
     
-    // Check if we need to make space
-    if (log_buffer_index + message_length >= MAX_LOG_BUFFER_SIZE) {
-        // Find the first newline after LOG_CHUNK_SIZE
-        size_t remove_index = LOG_CHUNK_SIZE;
-        while (remove_index < log_buffer_index && log_buffer[remove_index] != '\n') {
-            remove_index++;
-        }
-        if (remove_index >= log_buffer_index) {
-            remove_index = LOG_CHUNK_SIZE; // Fallback if no newline found
-        } else {
-            remove_index++; // Include the newline
-        }
-        
-        // Move remaining content to start of buffer
-        size_t remaining = log_buffer_index - remove_index;
-        if (remaining > 0) {
-            memmove(log_buffer, log_buffer + remove_index, remaining);
-            log_buffer_index = remaining;
-        } else {
-            log_buffer_index = 0;
+    log_ring_append(&log_ring, log_message, message_length);
+    
+    xSemaphoreGiveRecursive(log_mutex);
+
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+    log_sse_schedule_push();
+#endif
+}
+
+// log_ring_read_since under the log mutex
+static size_t log_read_since(uint32_t *cursor, uint32_t end, char *out, size_t max,
+                             uint32_t *dropped) {
+    *dropped = 0;
+    if (!log_mutex || !log_ring.buf) return 0;
+    if (xSemaphoreTakeRecursive(log_mutex, pdMS_TO_TICKS(100)) != pdTRUE) return 0;
+    size_t n = log_ring_read_since(&log_ring, cursor, end, out, max, dropped);
+    xSemaphoreGiveRecursive(log_mutex);
+    return n;
+}
+
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+static void log_sse_drop_fd(int fd) {
+    for (int i = 0; i < LOG_SSE_MAX_CLIENTS; i++) {
+        if (log_sse_clients[i].fd == fd) log_sse_clients[i].fd = -1;
+    }
+}
+
+// httpd calls this when an event stream session closes
+static void log_sse_sess_free(void *ctx) {
+    log_sse_drop_fd((int)(intptr_t)ctx - 1);
+}
+
+// runs in the httpd task via httpd_queue_work
+static void log_sse_push_work(void *arg) {
+    (void)arg;
+    log_sse_push_queued = false;
+    if (!server) return;
+
+    char text[LOG_READ_CHUNK];
+    char *frame = malloc(LOG_SSE_FRAME_SIZE);
+    if (!frame) return;
+
+    bool more = false;
+    for (int i = 0; i < LOG_SSE_MAX_CLIENTS; i++) {
+        int fd = log_sse_clients[i].fd;
+        if (fd < 0) continue;
+        uint32_t dropped;
+        size_t n = log_read_since(&log_sse_clients[i].cursor, log_ring.head, text, sizeof(text),
+                                  &dropped);
+        if (n == 0 && dropped == 0) continue;
+        // resume after what made it into the frame, the rest goes next round
+        uint32_t start = log_sse_clients[i].cursor - (uint32_t)n;
+        size_t used;
+        size_t len = log_sse_format(text, n, &used, start, dropped, frame, LOG_SSE_FRAME_SIZE);
+        log_sse_clients[i].cursor = start + (uint32_t)used;
+        if (httpd_socket_send(server, fd, frame, len, 0) < 0) {
+            log_sse_clients[i].fd = -1;
+            httpd_sess_trigger_close(server, fd);
+            continue;
         }
+        if (log_sse_clients[i].cursor != log_ring.head) more = true;
     }
-    
-    // Add new message
-    if (log_buffer_index + message_length < MAX_LOG_BUFFER_SIZE) {
-        memcpy(log_buffer + log_buffer_index, log_message, message_length);
-        log_buffer_index += message_length;
+    free(frame);
+    if (more) log_sse_schedule_push();
+}
+
+static void log_sse_schedule_push(void) {
+    bool any = false;
+    for (int i = 0; i < LOG_SSE_MAX_CLIENTS; i++) {
+        if (log_sse_clients[i].fd >= 0) any = true;
+    }
+    if (!any || !server || log_sse_push_queued) return;
+    log_sse_push_queued = true;
+    if (httpd_queue_work(server, log_sse_push_work, NULL) != ESP_OK) {
+        log_sse_push_queued = false;
     }
-    
-    xSemaphoreGiveRecursive(log_mutex);
 }
+#endif
 
 esp_err_t ap_manager_start_services() {
     esp_err_t ret;
@@ -1296,40 +1578,119 @@ static esp_err_t api_command_handler(httpd_req_t *req) {
     return ESP_OK;
 }
 
-// handler for getting serial logs
+// handler for getting serial logs; /api/logs?since=N only returns what was
+// logged after cursor N, the cursor to pass next time is in X-Log-Cursor
 static esp_err_t api_logs_handler(httpd_req_t *req) {
     WEBUI_GUARD_OR_RETURN(req);
     if (!log_mutex) {
         return httpd_resp_send(req, "", 0);
     }
     
-    // Take mutex with timeout
-    if (xSemaphoreTake(log_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    uint32_t cursor = 0; // 0 is always behind the tail: the whole ring
+    char since[16];
+    size_t query_len = httpd_req_get_url_query_len(req) + 1;
+    if (query_len > 1 && query_len <= 64) {
+        char query[64];
+        if (httpd_req_get_url_query_str(req, query, query_len) == ESP_OK &&
+            httpd_query_key_value(query, "since", since, sizeof(since)) == ESP_OK) {
+            cursor = (uint32_t)strtoul(since, NULL, 10);
+        }
+    }
+    bool incremental = cursor != 0;
+    
+    // snapshot the head so a busy log cannot keep this response going
+    if (xSemaphoreTakeRecursive(log_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
         ESP_LOGW(TAG, "Failed to take log mutex for reading");
         return httpd_resp_send(req, "", 0);
     }
+    uint32_t end = log_ring.head;
+    xSemaphoreGiveRecursive(log_mutex);
+    if ((int32_t)(cursor - end) > 0) {
+        // cursor from before a reboot: start over with the whole ring
+        cursor = 0;
+        incremental = false;
+    }
     
-    // set response type as text/plain
+    char cursor_hdr[12];
+    snprintf(cursor_hdr, sizeof(cursor_hdr), "%lu", (unsigned long)end);
     httpd_resp_set_type(req, "text/plain");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
     
-    // Check if we have any logs
-    if (log_buffer_index == 0) {
-        xSemaphoreGive(log_mutex);
-        return httpd_resp_sendstr(req, "");
+    char chunk[LOG_READ_CHUNK];
+    bool first = true;
+    while ((int32_t)(end - cursor) > 0) {
+        uint32_t dropped;
+        size_t n = log_read_since(&cursor, end, chunk, sizeof(chunk), &dropped);
+        if (first) {
+            // the cursor header has to go out with the first chunk; if the
+            // ring overran the snapshot the reader resumes from the new tail
+            if ((int32_t)(cursor - end) > 0) {
+                snprintf(cursor_hdr, sizeof(cursor_hdr), "%lu", (unsigned long)cursor);
+            }
+            httpd_resp_set_hdr(req, "X-Log-Cursor", cursor_hdr);
+            if (incremental && dropped) {
+                char gap[48];
+                int g = snprintf(gap, sizeof(gap), "[... %lu bytes of log dropped ...]\n",
+                                 (unsigned long)dropped);
+                if (httpd_resp_send_chunk(req, gap, g) != ESP_OK) return ESP_FAIL;
+            }
+            first = false;
+        }
+        if (n == 0) break;
+        esp_err_t err = httpd_resp_send_chunk(req, chunk, n);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to send logs: %d", err);
+            return err;
+        }
     }
-    
-    // send the buffer contents
-    esp_err_t err = httpd_resp_send(req, log_buffer, log_buffer_index);
-    
-    xSemaphoreGive(log_mutex);
-    
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to send logs: %d", err);
-        return err;
+    if (first) httpd_resp_set_hdr(req, "X-Log-Cursor", cursor_hdr);
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+// /api/logs/stream: server-sent events, pushed from log_sse_push_work
+static esp_err_t api_logs_stream_handler(httpd_req_t *req) {
+    WEBUI_GUARD_OR_RETURN(req);
+    if (!log_mutex) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, NULL, 0);
     }
-    
+
+    int slot = -1;
+    for (int i = 0; i < LOG_SSE_MAX_CLIENTS; i++) {
+        if (log_sse_clients[i].fd < 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "too many log streams", HTTPD_RESP_USE_STRLEN);
+    }
+
+    // EventSource reconnects with the id of the last event it got
+    uint32_t cursor = log_ring.tail;
+    char last_id[16];
+    if (httpd_req_get_hdr_value_str(req, "Last-Event-ID", last_id, sizeof(last_id)) == ESP_OK) {
+        cursor = (uint32_t)strtoul(last_id, NULL, 10);
+    }
+
+    static const char hdr[] = "HTTP/1.1 200 OK\r\n"
+                              "Content-Type: text/event-stream\r\n"
+                              "Cache-Control: no-cache\r\n"
+                              "\r\n"
+                              "retry: 3000\n\n";
+    if (httpd_send(req, hdr, sizeof(hdr) - 1) < 0) return ESP_FAIL;
+
+    int fd = httpd_req_to_sockfd(req);
+    req->sess_ctx = (void *)(intptr_t)(fd + 1);
+    req->free_ctx = log_sse_sess_free;
+    log_sse_clients[slot].cursor = cursor;
+    log_sse_clients[slot].fd = fd;
+    log_sse_schedule_push();
     return ESP_OK;
 }
+#endif
 
 // Handler for /api/clear_logs (clears the log buffer)
 static esp_err_t api_clear_logs_handler(httpd_req_t *req) {
@@ -1338,14 +1699,14 @@ static esp_err_t api_clear_logs_handler(httpd_req_t *req) {
         return httpd_resp_send(req, "{\"status\":\"error\",\"message\":\"Log system not initialized\"}", -1);
     }
     
-    if (xSemaphoreTake(log_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    if (xSemaphoreTakeRecursive(log_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
         return httpd_resp_send(req, "{\"status\":\"error\",\"message\":\"Failed to acquire lock\"}", -1);
     }
     
-    log_buffer_index = 0;
-    memset(log_buffer, 0, MAX_LOG_BUFFER_SIZE);
+    // cursors keep counting so incremental readers simply see nothing new
+    log_ring.tail = log_ring.head;
     
-    xSemaphoreGive(log_mutex);
+    xSemaphoreGiveRecursive(log_mutex);
     
     httpd_resp_set_type(req, "application/json");
     return httpd_resp_sendstr(req, "{\"status\":\"success\",\"message\":\"logs_cleared\"}");
@@ -1847,11 +2208,16 @@ static esp_err_t load_server_config(void) {
     ADD_URI_HANDLER("/api/settings", HTTP_POST, api_settings_handler);
     ADD_URI_HANDLER("/api/settings", HTTP_GET, api_settings_get_handler);
     ADD_URI_HANDLER("/api/sdcard", HTTP_GET, api_sd_card_get_handler);
+    ADD_URI_HANDLER("/api/sdcard/list", HTTP_GET, api_sd_card_list_handler);
     ADD_URI_HANDLER("/api/sdcard/download", HTTP_POST, api_sd_card_post_handler);
+    ADD_URI_HANDLER("/api/sdcard/download", HTTP_GET, api_sd_card_download_get_handler);
     ADD_URI_HANDLER("/api/sdcard/upload", HTTP_POST, api_sd_card_upload_handler);
     ADD_URI_HANDLER("/api/sdcard", HTTP_DELETE, api_sd_card_delete_file_handler);
     ADD_URI_HANDLER("/api/command", HTTP_POST, api_command_handler);
     ADD_URI_HANDLER("/api/logs", HTTP_GET, api_logs_handler);
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+    ADD_URI_HANDLER("/api/logs/stream", HTTP_GET, api_logs_stream_handler);
+#endif
     ADD_URI_HANDLER("/api/clear_logs", HTTP_POST, api_clear_logs_handler);
     ADD_URI_HANDLER("/api/esp_comm/status", HTTP_GET, api_esp_comm_status_handler);
     ADD_URI_HANDLER("/api/esp_comm/control", HTTP_POST, api_esp_comm_control_handler);
@@ -1907,6 +2273,9 @@ static esp_err_t start_http_server(void) {
 }
 
 static esp_err_t stop_http_server(void) {
+#ifdef CONFIG_WEBUI_LOG_EVENTS
+    for (int i = 0; i < LOG_SSE_MAX_CLIENTS; i++) log_sse_clients[i].fd = -1;
+#endif
     if (server) {
         esp_err_t ret = httpd_stop(server);
         if (ret != ESP_OK) {
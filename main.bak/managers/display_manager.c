@@ -43,6 +43,11 @@
 #include "lvgl_touch/touch_driver.h"
 #endif
 
+#if defined(CONFIG_SD_SPI_BUS_ARBITER) && !defined(CONFIG_USE_CARDPUTER) && !defined(CONFIG_USE_TDISPLAY_S3)
+#include "lvgl_tft/disp_spi.h"
+#define DISPLAY_FLUSH_ARBITRATED 1
+#endif
+
 #ifdef CONFIG_HAS_BATTERY_ADC
 #include <esp_adc/adc_oneshot.h>
 #include <esp_adc/adc_cali.h>
@@ -271,6 +276,20 @@ static void gpio_isr_handler(void* arg) {
 }
 #endif
 
+#ifdef DISPLAY_FLUSH_ARBITRATED
+// the spi drivers queue a flush and return; the bus hold taken for it ends in
+// the spi isr once the last transaction is out
+static bus_arbiter_t *s_flush_arb;
+static bus_client_t *s_flush_bus;
+static bool s_flush_holds_bus;
+
+static void IRAM_ATTR display_flush_done_isr(void) {
+    if (__atomic_exchange_n(&s_flush_holds_bus, false, __ATOMIC_ACQ_REL)) {
+        bus_arbiter_release_from_isr(s_flush_arb, s_flush_bus);
+    }
+}
+#endif
+
 static void invert_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area,
                             lv_color_t *color_p) {
     if (settings_get_invert_colors(&G_Settings)) {
@@ -288,6 +307,26 @@ static void invert_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area,
     m5stack_lvgl_render_callback(drv, area, color_p);
 #elif defined(CONFIG_USE_TDISPLAY_S3)
     i80_display_flush_cb(drv, area, color_p);
+#elif defined(DISPLAY_FLUSH_ARBITRATED)
+    // on an spi bus shared with the sd card, flushes jump ahead of sd writes
+    bus_client_t *bus = sd_card_bus_client(BUS_CLASS_INTERACTIVE);
+    if (!bus) {
+        disp_driver_flush(drv, area, color_p);
+        return;
+    }
+    if (!s_flush_bus) {
+        s_flush_arb = sd_card_bus_arbiter();
+        s_flush_bus = bus;
+        disp_spi_set_flush_done_cb(display_flush_done_isr);
+    }
+    bus_arbiter_acquire(s_flush_arb, bus);
+    __atomic_store_n(&s_flush_holds_bus, true, __ATOMIC_RELEASE);
+    disp_driver_flush(drv, area, color_p);
+    // drivers that finish before returning (i2c panels, polled transfers)
+    // never reach the isr, so the hold is still ours to end
+    if (!drv->draw_buf->flushing && __atomic_exchange_n(&s_flush_holds_bus, false, __ATOMIC_ACQ_REL)) {
+        bus_arbiter_release(s_flush_arb, bus);
+    }
 #else
     disp_driver_flush(drv, area, color_p);
 #endif
@@ -2020,6 +2059,7 @@ void hardware_input_task(void *pvParameters) {
             ESP_LOGI("DeepSleep", "Final GPIO15 state: %d", gpio_get_level(15));
 
             // Enter deep sleep
+            settings_flush();
             esp_deep_sleep_start();
         }
         } else {
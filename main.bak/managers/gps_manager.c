@@ -117,6 +117,14 @@ void gps_manager_init(GPSManager *manager) {
     config.uart.rx_pin = 2;
 #endif
 
+    if (config.ubx.enable) {
+        if (config.uart.tx_pin != UART_PIN_NO_CHANGE) {
+            glog("GPS UBX: init on TX IO%d\n", config.uart.tx_pin);
+        } else {
+            glog("GPS UBX: no TX pin, decoding only\n");
+        }
+    }
+
     nmea_hdl = nmea_parser_init(&config);
     if (!nmea_hdl) {
         ESP_LOGE(GPS_TAG, "Failed to initialize NMEA parser");
@@ -299,10 +307,10 @@ esp_err_t gps_manager_log_wardriving_data(wardriving_data_t *data) {
                  gps_get_absolute_year(cacheddate.year), cacheddate.month, cacheddate.day);
     }
 
-    data->latitude = gps->latitude;
-    data->longitude = gps->longitude;
-    data->altitude = gps->altitude;
-    data->accuracy = gps->dop_h * 5.0;
+    data->latitude = gps_latitude_deg(gps);
+    data->longitude = gps_longitude_deg(gps);
+    data->altitude = gps_altitude_m(gps);
+    data->accuracy = gps->dop_h_e2 * 0.05;
 
     // Initialize GPS quality data to avoid uninitialized fields
     populate_gps_quality_data(data, gps);
@@ -363,6 +371,12 @@ esp_err_t gps_manager_log_wardriving_data(wardriving_data_t *data) {
     }
 
     esp_err_t ret = csv_write_data_to_buffer(data);
+    if (ret == ESP_ERR_NOT_FOUND || ret == ESP_ERR_NO_MEM) {
+        // no good fix near the capture time, or the record queue was full:
+        // the csv writer reports both counts, a log line per record would
+        // flood the console under load
+        return ret;
+    }
     if (ret != ESP_OK) {
         ESP_LOGE(GPS_TAG, "Failed to write wardriving data to CSV buffer");
         return ret;
@@ -7,6 +7,14 @@
 
 static const char* TAG = "IR_DECODER";
 
+// per-timing trace logs; compiled out unless set to 1, they cost more than the decoding itself
+#define IR_DECODER_TRACE 0
+#if IR_DECODER_TRACE
+#define IR_TRACE(...) ESP_LOGD(TAG, __VA_ARGS__)
+#else
+#define IR_TRACE(...) do {} while (0)
+#endif
+
 // Protocol specifications
 static const InfraredDecoderProtocolSpec infrared_protocol_nec_decoder = {
     .timings = {
@@ -207,6 +215,62 @@ const char* infrared_protocol_to_string(InfraredProtocol protocol) {
     }
 }
 
+static void infrared_decoder_add_entry(InfraredDecoderContext* decoder, uint32_t center,
+                                       uint32_t tolerance, uint8_t index, bool mark_only) {
+    uint32_t min = center > tolerance ? center - tolerance : 0;
+    uint32_t max = center + tolerance;
+
+    for (uint8_t i = 0; i < decoder->entry_count; i++) {
+        InfraredDecoderEntry* e = &decoder->entries[i];
+        if (e->min == min && e->max == max && e->mark_only == mark_only) {
+            e->mask |= 1u << index;
+            return;
+        }
+    }
+    if (decoder->entry_count >= sizeof(decoder->entries) / sizeof(decoder->entries[0])) return;
+
+    // keep sorted by min so the lookup can stop early
+    uint8_t pos = decoder->entry_count;
+    while (pos > 0 && decoder->entries[pos - 1].min > min) {
+        decoder->entries[pos] = decoder->entries[pos - 1];
+        pos--;
+    }
+    decoder->entries[pos] = (InfraredDecoderEntry){
+        .min = min, .max = max, .mask = 1u << index, .mark_only = mark_only};
+    decoder->entry_count++;
+}
+
+// Index every decoder by the timings that can move it out of its reset state.
+// Anything else would only be rejected (and reset) again.
+static void infrared_decoder_build_entries(InfraredDecoderContext* decoder) {
+    decoder->entry_count = 0;
+    for (uint8_t i = 0; i < decoder->decoder_count; i++) {
+        if (!decoder->decoders[i]) continue;
+        const InfraredDecoderProtocolSpec* spec = decoder->decoders[i]->protocol;
+        if (spec->timings.preamble_mark) {
+            infrared_decoder_add_entry(decoder, spec->timings.preamble_mark,
+                                       spec->timings.preamble_tolerance, i, true);
+        } else {
+            // Manchester without a leader starts on a single or double half bit of either level
+            infrared_decoder_add_entry(decoder, spec->timings.bit1_mark,
+                                       spec->timings.bit_tolerance, i, false);
+            infrared_decoder_add_entry(decoder, 2 * spec->timings.bit1_mark,
+                                       spec->timings.bit_tolerance, i, false);
+        }
+    }
+}
+
+static uint16_t infrared_decoder_entry_mask(const InfraredDecoderContext* decoder, bool level,
+                                            uint32_t timing) {
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < decoder->entry_count; i++) {
+        const InfraredDecoderEntry* e = &decoder->entries[i];
+        if (timing <= e->min) break;
+        if (timing < e->max && (level || !e->mark_only)) mask |= e->mask;
+    }
+    return mask;
+}
+
 // Allocate main decoder context
 InfraredDecoderContext* infrared_decoder_alloc(void) {
     InfraredDecoderContext* decoder = malloc(sizeof(InfraredDecoderContext));
@@ -246,6 +310,7 @@ InfraredDecoderContext* infrared_decoder_alloc(void) {
     }
     
     decoder->decoder_count = 8;
+    infrared_decoder_build_entries(decoder);
     
     ESP_LOGI(TAG, "Decoder context allocated with %d protocols", decoder->decoder_count);
     return decoder;
@@ -277,28 +342,35 @@ void infrared_decoder_reset(InfraredDecoderContext* decoder) {
             infrared_common_decoder_reset(decoder->decoders[i]);
         }
     }
+    decoder->busy_mask = 0;
 }
 
-// Main decode function - tries all protocols
+// Main decode function - feeds the decoders that are mid-frame plus the idle
+// ones whose entry window matches this timing
 InfraredDecodedMessage* infrared_decoder_decode(InfraredDecoderContext* decoder, bool level, uint32_t timing) {
     if (!decoder) return NULL;
-    
-    for (int i = 0; i < decoder->decoder_count; i++) {
+
+    uint16_t candidates = decoder->busy_mask | infrared_decoder_entry_mask(decoder, level, timing);
+
+    while (candidates) {
+        int i = __builtin_ctz(candidates);
+        candidates &= candidates - 1;
         InfraredCommonDecoder* common_decoder = decoder->decoders[i];
         if (!common_decoder || !common_decoder->protocol) continue;
         
         InfraredDecoderStatus status = common_decoder->protocol->decode(common_decoder, level, timing);
         
         if (status == InfraredDecoderStatusError) {
-            ESP_LOGD(TAG, "Protocol %d failed decode - level=%d, timing=%luµs", i, level, timing);
+            IR_TRACE("Protocol %d failed decode - level=%d, timing=%luµs", i, level, timing);
             // Reset decoder on error to prevent state corruption
             infrared_common_decoder_reset(common_decoder);
-        } else if (status == InfraredDecoderStatusOk) {
-            ESP_LOGD(TAG, "Protocol %d accepted timing - level=%d, timing=%luµs, databit_cnt=%d", i, level, timing, common_decoder->databit_cnt);
+            decoder->busy_mask &= ~(1u << i);
+            continue;
         }
+        decoder->busy_mask |= 1u << i;
         
         if (status == InfraredDecoderStatusReady) {
-            ESP_LOGD(TAG, "Protocol %d ready for interpretation, databit_cnt=%d", i, common_decoder->databit_cnt);
+            IR_TRACE("Protocol %d ready for interpretation, databit_cnt=%d", i, common_decoder->databit_cnt);
             if (common_decoder->protocol->interpret && common_decoder->protocol->interpret(common_decoder)) {
                 decoder->last_message = common_decoder->message;
                 ESP_LOGI(TAG, "Decoded %s: addr=0x%08lX cmd=0x%08lX repeat=%d (databit_cnt=%d)", 
@@ -309,8 +381,10 @@ InfraredDecodedMessage* infrared_decoder_decode(InfraredDecoderContext* decoder,
                         common_decoder->databit_cnt);
                 return &decoder->last_message;
             } else {
-                ESP_LOGD(TAG, "Protocol %d interpretation failed, databit_cnt=%d", i, common_decoder->databit_cnt);
+                IR_TRACE("Protocol %d interpretation failed, databit_cnt=%d", i, common_decoder->databit_cnt);
             }
+        } else {
+            IR_TRACE("Protocol %d accepted timing - level=%d, timing=%luµs, databit_cnt=%d", i, level, timing, common_decoder->databit_cnt);
         }
     }
     
@@ -388,14 +462,14 @@ static InfraredDecoderStatus infrared_common_decode_bits(InfraredCommonDecoder*
                 // Long low timing - check if we're ready for any protocol variant
                 for (size_t i = 0; i < 4 && decoder->protocol->databit_len[i]; ++i) {
                     if (decoder->protocol->databit_len[i] == decoder->databit_cnt) {
-                        ESP_LOGD(TAG, "min_split_time detected: timing=%luµs > %luµs, databit_cnt=%d matches variant %zu",
+                        IR_TRACE("min_split_time detected: timing=%luµs > %luµs, databit_cnt=%d matches variant %zu",
                                timing, timings->min_split_time, decoder->databit_cnt, i);
                         return InfraredDecoderStatusReady;
                     }
                 }
             } else if (decoder->protocol->databit_len[0] == decoder->databit_cnt) {
                 // Short low timing for longest protocol - signal is longer than expected
-                ESP_LOGD(TAG, "Signal longer than expected: timing=%luµs <= %luµs, databit_cnt=%d",
+                IR_TRACE("Signal longer than expected: timing=%luµs <= %luµs, databit_cnt=%d",
                        timing, timings->min_split_time, decoder->databit_cnt);
                 return InfraredDecoderStatusError;
             }
@@ -404,7 +478,7 @@ static InfraredDecoderStatus infrared_common_decode_bits(InfraredCommonDecoder*
         // Decode the current timing
         status = decoder->protocol->decode(decoder, level, timing);
         if (status == InfraredDecoderStatusError) {
-            ESP_LOGD(TAG, "Decode error at databit_cnt=%d, level=%d, timing=%luµs", 
+            IR_TRACE("Decode error at databit_cnt=%d, level=%d, timing=%luµs", 
                    decoder->databit_cnt, level, timing);
             break;
         }
@@ -413,7 +487,7 @@ static InfraredDecoderStatus infrared_common_decode_bits(InfraredCommonDecoder*
 
         // Check if largest protocol version can be decoded (for protocols without min_split_time)
         if (level && (decoder->protocol->databit_len[0] == decoder->databit_cnt) && !timings->min_split_time) {
-            ESP_LOGD(TAG, "Max bits reached without min_split_time: databit_cnt=%d", decoder->databit_cnt);
+            IR_TRACE("Max bits reached without min_split_time: databit_cnt=%d", decoder->databit_cnt);
             status = InfraredDecoderStatusReady;
             break;
         }
@@ -432,13 +506,13 @@ InfraredDecodedMessage* infrared_common_decoder_check_ready_internal(InfraredCom
     for (size_t i = 0; i < 4 && decoder->protocol->databit_len[i]; ++i) {
         if (decoder->protocol->databit_len[i] == decoder->databit_cnt) {
             found_length = true;
-            ESP_LOGD(TAG, "Found valid length: databit_cnt=%d matches variant %zu", decoder->databit_cnt, i);
+            IR_TRACE("Found valid length: databit_cnt=%d matches variant %zu", decoder->databit_cnt, i);
             break;
         }
     }
 
     if (found_length && decoder->protocol->interpret && decoder->protocol->interpret(decoder)) {
-        ESP_LOGD(TAG, "Interpretation successful for databit_cnt=%d", decoder->databit_cnt);
+        IR_TRACE("Interpretation successful for databit_cnt=%d", decoder->databit_cnt);
         decoder->databit_cnt = 0;
         message = &decoder->message;
         if (decoder->protocol->decode_repeat) {
@@ -447,7 +521,7 @@ InfraredDecodedMessage* infrared_common_decoder_check_ready_internal(InfraredCom
             decoder->state = InfraredCommonDecoderStateWaitPreamble;
         }
     } else {
-        ESP_LOGD(TAG, "Interpretation failed: found_length=%d, databit_cnt=%d", found_length, decoder->databit_cnt);
+        IR_TRACE("Interpretation failed: found_length=%d, databit_cnt=%d", found_length, decoder->databit_cnt);
     }
 
     return message;
@@ -496,7 +570,7 @@ InfraredDecodedMessage* infrared_common_decode(InfraredCommonDecoder* decoder, b
         switch (decoder->state) {
         case InfraredCommonDecoderStateWaitPreamble:
             if (infrared_check_preamble(decoder)) {
-                ESP_LOGD(TAG, "Preamble detected, switching to decode state");
+                IR_TRACE("Preamble detected, switching to decode state");
                 decoder->state = InfraredCommonDecoderStateDecode;
                 decoder->databit_cnt = 0;
                 decoder->switch_detect = false;
@@ -512,11 +586,11 @@ InfraredDecodedMessage* infrared_common_decode(InfraredCommonDecoder* decoder, b
                     continue;
                 } else if (decoder->protocol->databit_len[0] == decoder->databit_cnt) {
                     // Error: can't decode largest protocol - begin from start
-                    ESP_LOGD(TAG, "Cannot decode largest protocol variant, resetting");
+                    IR_TRACE("Cannot decode largest protocol variant, resetting");
                     decoder->state = InfraredCommonDecoderStateWaitPreamble;
                 }
             } else if (status == InfraredDecoderStatusError) {
-                ESP_LOGD(TAG, "Decode error, resetting state");
+                IR_TRACE("Decode error, resetting state");
                 infrared_common_decoder_reset_state(decoder);
                 continue;
             }
@@ -624,15 +698,15 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
     
     // Handle end-of-signal (timing=0) - check if we have a valid bit count
     if (timing == 0 && decoder->state == InfraredDecoderStateData) {
-        ESP_LOGD(TAG, "PDWM: End of signal detected, checking for valid bit count (%lu)", (unsigned long)decoder->databit_cnt);
+        IR_TRACE("PDWM: End of signal detected, checking for valid bit count (%lu)", (unsigned long)decoder->databit_cnt);
         for (int i = 0; i < 4 && decoder->protocol->databit_len[i]; i++) {
             if (decoder->protocol->databit_len[i] == decoder->databit_cnt) {
-                ESP_LOGD(TAG, "PDWM: Valid bit count (%lu) found at end of signal, ready for interpretation", 
+                IR_TRACE("PDWM: Valid bit count (%lu) found at end of signal, ready for interpretation", 
                          (unsigned long)decoder->databit_cnt);
                 return InfraredDecoderStatusReady;
             }
         }
-        ESP_LOGD(TAG, "PDWM: No valid bit count found at end of signal (%lu)", (unsigned long)decoder->databit_cnt);
+        IR_TRACE("PDWM: No valid bit count found at end of signal (%lu)", (unsigned long)decoder->databit_cnt);
         return InfraredDecoderStatusError;
     }
     
@@ -649,7 +723,7 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
             // Waiting for preamble mark
             if (level && MATCH_TIMING(timing, timings->preamble_mark, timings->preamble_tolerance)) {
                 decoder->state = InfraredDecoderStatePreambleMark;
-                ESP_LOGD(TAG, "PDWM: Preamble mark detected: %luµs", timing);
+                IR_TRACE("PDWM: Preamble mark detected: %luµs", timing);
                 return InfraredDecoderStatusOk;
             }
             return InfraredDecoderStatusError;
@@ -660,7 +734,7 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
                 decoder->state = InfraredDecoderStateData;
                 decoder->databit_cnt = 0;
                 memset(decoder->data, 0, sizeof(decoder->data));
-                ESP_LOGD(TAG, "PDWM: Preamble complete, starting data decode");
+                IR_TRACE("PDWM: Preamble complete, starting data decode");
                 return InfraredDecoderStatusOk;
             }
             decoder->state = InfraredDecoderStateIdle;
@@ -674,6 +748,23 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
             uint32_t bit0_timing = level ? timings->bit0_mark : timings->bit0_space;
             uint32_t no_info_timing = (timings->bit1_mark == timings->bit0_mark) ? timings->bit1_mark : timings->bit1_space;
             
+            // A long space ends the frame whichever timing carries the bits
+            // (like Flipper Zero); Pioneer's 32 bit frame only completes here
+            bool long_space = timings->min_split_time && !level && timing > timings->min_split_time;
+            if (long_space) {
+                IR_TRACE("PDWM: Long space detected (%luµs > %luµs), checking for valid bit count", 
+                         timing, timings->min_split_time);
+                
+                for (int i = 0; i < 4 && decoder->protocol->databit_len[i]; i++) {
+                    if (decoder->protocol->databit_len[i] == decoder->databit_cnt) {
+                        IR_TRACE("PDWM: Valid bit count (%lu) found, ready for interpretation", 
+                                 (unsigned long)decoder->databit_cnt);
+                        return InfraredDecoderStatusReady;
+                    }
+                }
+                IR_TRACE("PDWM: No valid bit count found (%lu), continuing", (unsigned long)decoder->databit_cnt);
+            }
+            
             if (analyze_timing) {
                 // This timing carries bit information - decode it
                 bool bit_value;
@@ -682,7 +773,7 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
                 } else if (MATCH_TIMING(timing, bit0_timing, timings->bit_tolerance)) {
                     bit_value = false;
                 } else {
-                    ESP_LOGD(TAG, "PDWM: Invalid %s timing: %luµs (bit1=%lu±%lu, bit0=%lu±%lu)", 
+                    IR_TRACE("PDWM: Invalid %s timing: %luµs (bit1=%lu±%lu, bit0=%lu±%lu)", 
                              level ? "mark" : "space", timing, bit1_timing, timings->bit_tolerance, 
                              bit0_timing, timings->bit_tolerance);
                     return InfraredDecoderStatusError;
@@ -699,19 +790,19 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
                     }
                     decoder->databit_cnt++;
                     
-                    ESP_LOGD(TAG, "PDWM: Bit %lu = %d (%s=%luµs, total bits: %lu)", 
+                    IR_TRACE("PDWM: Bit %lu = %d (%s=%luµs, total bits: %lu)", 
                              (unsigned long)(decoder->databit_cnt - 1), bit_value, level ? "mark" : "space", 
                              timing, (unsigned long)decoder->databit_cnt);
                     
                     // Check if we have a valid bit count for any SIRC variant
                     for (int i = 0; i < 4 && decoder->protocol->databit_len[i]; i++) {
                         if (decoder->protocol->databit_len[i] == decoder->databit_cnt) {
-                            ESP_LOGD(TAG, "PDWM: Valid bit count (%lu) reached for variant %d, checking for completion", 
+                            IR_TRACE("PDWM: Valid bit count (%lu) reached for variant %d, checking for completion", 
                                    (unsigned long)decoder->databit_cnt, i);
                             // For protocols with min_split_time, wait for the long space
                             // For others, or if this is the maximum variant, signal ready
                             if (!timings->min_split_time || i == 0) {
-                                ESP_LOGD(TAG, "PDWM: Ready for interpretation (no min_split_time or max variant)");
+                                IR_TRACE("PDWM: Ready for interpretation (no min_split_time or max variant)");
                                 return InfraredDecoderStatusReady;
                             }
                             break;
@@ -719,22 +810,9 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
                     }
                 }
             } else {
-                // This timing doesn't carry bit info - validate it and check for min_split_time
-                if (timings->min_split_time && !level && timing > timings->min_split_time) {
-                    // Long space detected - check if we have a valid bit count (like Flipper Zero)
-                    ESP_LOGD(TAG, "PDWM: Long space detected (%luµs > %luµs), checking for valid bit count", 
-                             timing, timings->min_split_time);
-                    
-                    for (int i = 0; i < 4 && decoder->protocol->databit_len[i]; i++) {
-                        if (decoder->protocol->databit_len[i] == decoder->databit_cnt) {
-                            ESP_LOGD(TAG, "PDWM: Valid bit count (%lu) found, ready for interpretation", 
-                                     (unsigned long)decoder->databit_cnt);
-                            return InfraredDecoderStatusReady;
-                        }
-                    }
-                    ESP_LOGD(TAG, "PDWM: No valid bit count found (%lu), continuing", (unsigned long)decoder->databit_cnt);
-                } else if (!MATCH_TIMING(timing, no_info_timing, timings->bit_tolerance)) {
-                    ESP_LOGD(TAG, "PDWM: Invalid %s timing: %luµs (expected %lu±%lu)", 
+                // This timing doesn't carry bit info - validate it unless it was the long space
+                if (!long_space && !MATCH_TIMING(timing, no_info_timing, timings->bit_tolerance)) {
+                    IR_TRACE("PDWM: Invalid %s timing: %luµs (expected %lu±%lu)", 
                              level ? "mark" : "space", timing, no_info_timing, timings->bit_tolerance);
                     return InfraredDecoderStatusError;
                 }
@@ -750,60 +828,62 @@ InfraredDecoderStatus infrared_common_decode_pdwm(InfraredCommonDecoder* decoder
     return InfraredDecoderStatusOk;
 }
 
-// Common Manchester decoder
+// Common Manchester decoder, as Flipper Zero's: a bit is taken at the level
+// change in its middle, as the level of its first half. Protocols with a
+// leader (RC6) match it first; start_from_space ones (RC5) start half way
+// into a first bit whose leading space is the idle line.
 InfraredDecoderStatus infrared_common_decode_manchester(InfraredCommonDecoder* decoder, bool level, uint32_t timing) {
     if (!decoder || !decoder->protocol) return InfraredDecoderStatusError;
     
     const InfraredTimings* timings = &decoder->protocol->timings;
+
+    if (timings->preamble_mark && decoder->state != InfraredDecoderStateData) {
+        if (decoder->state != InfraredDecoderStatePreambleMark) {
+            if (level && MATCH_TIMING(timing, timings->preamble_mark, timings->preamble_tolerance)) {
+                decoder->state = InfraredDecoderStatePreambleMark;
+                return InfraredDecoderStatusOk;
+            }
+            return InfraredDecoderStatusError;
+        }
+        if (!level && MATCH_TIMING(timing, timings->preamble_space, timings->preamble_tolerance)) {
+            decoder->state = InfraredDecoderStateData;
+            decoder->databit_cnt = 0;
+            decoder->switch_detect = false;
+            return InfraredDecoderStatusOk;
+        }
+        return InfraredDecoderStatusError;
+    }
+
     uint32_t bit_time = timings->bit1_mark;
     uint32_t tolerance = timings->bit_tolerance;
-    
     bool single_timing = MATCH_TIMING(timing, bit_time, tolerance);
     bool double_timing = MATCH_TIMING(timing, 2 * bit_time, tolerance);
     
     if (!single_timing && !double_timing) {
         return InfraredDecoderStatusError;
     }
-    
-    // Manchester decoding logic
-    if (single_timing) {
-        if (decoder->switch_detect) {
-            // Complete bit
-            uint8_t byte_index = decoder->databit_cnt / 8;
-            uint8_t bit_index = decoder->databit_cnt % 8;
-            
-            if (byte_index < sizeof(decoder->data)) {
-                bool bit_value = decoder->protocol->manchester_start_from_space ? !level : level;
-                if (bit_value) {
-                    decoder->data[byte_index] |= (1 << bit_index);
-                }
-                decoder->databit_cnt++;
-                decoder->switch_detect = false;
-                
-                // Check completion
-                if (decoder->databit_cnt >= decoder->protocol->databit_len[0]) {
-                    return InfraredDecoderStatusReady;
-                }
-            }
-        } else {
-            decoder->switch_detect = true;
+
+    if (decoder->protocol->manchester_start_from_space && decoder->databit_cnt == 0) {
+        decoder->switch_detect = true;   // as if in the middle of the first bit
+        accumulate_lsb(decoder, false);  // whose first half was space
+    }
+
+    if (!decoder->switch_detect) {
+        if (double_timing) return InfraredDecoderStatusError;
+        // a single timing from a bit boundary ends in the middle of the bit
+        decoder->switch_detect = true;
+    } else if (single_timing) {
+        // from the middle of a bit to its end; a double one reaches the middle of the next
+        decoder->switch_detect = false;
+    }
+
+    if (decoder->switch_detect) {
+        if (decoder->databit_cnt >= decoder->protocol->databit_len[0]) {
+            return InfraredDecoderStatusError;
         }
-    } else if (double_timing) {
-        // Double timing - complete bit immediately
-        uint8_t byte_index = decoder->databit_cnt / 8;
-        uint8_t bit_index = decoder->databit_cnt % 8;
-        
-        if (byte_index < sizeof(decoder->data)) {
-            bool bit_value = decoder->protocol->manchester_start_from_space ? level : !level;
-            if (bit_value) {
-                decoder->data[byte_index] |= (1 << bit_index);
-            }
-            decoder->databit_cnt++;
-            
-            // Check completion
-            if (decoder->databit_cnt >= decoder->protocol->databit_len[0]) {
-                return InfraredDecoderStatusReady;
-            }
+        accumulate_lsb(decoder, level);
+        if (decoder->databit_cnt == decoder->protocol->databit_len[0]) {
+            return InfraredDecoderStatusReady;
         }
     }
     
@@ -894,25 +974,25 @@ bool infrared_decoder_sirc_interpret(InfraredCommonDecoder* decoder) {
     uint8_t command = 0;
     InfraredProtocol protocol = InfraredProtocolUnknown;
     
-    ESP_LOGD(TAG, "SIRC interpreter: databit_cnt=%lu, data=0x%08lX", (unsigned long)decoder->databit_cnt, *data);
+    IR_TRACE("SIRC interpreter: databit_cnt=%lu, data=0x%08lX", (unsigned long)decoder->databit_cnt, *data);
     
     if (decoder->databit_cnt == 12) {
         address = (*data >> 7) & 0x1F;
         command = *data & 0x7F;
         protocol = InfraredProtocolSIRC;
-        ESP_LOGD(TAG, "SIRC: 12-bit variant selected");
+        IR_TRACE("SIRC: 12-bit variant selected");
     } else if (decoder->databit_cnt == 15) {
         address = (*data >> 7) & 0xFF;
         command = *data & 0x7F;
         protocol = InfraredProtocolSIRC15;
-        ESP_LOGD(TAG, "SIRC: 15-bit variant selected");
+        IR_TRACE("SIRC: 15-bit variant selected");
     } else if (decoder->databit_cnt == 20) {
         address = (*data >> 7) & 0x1FFF;
         command = *data & 0x7F;
         protocol = InfraredProtocolSIRC20;
-        ESP_LOGD(TAG, "SIRC: 20-bit variant selected");
+        IR_TRACE("SIRC: 20-bit variant selected");
     } else {
-        ESP_LOGD(TAG, "SIRC: Invalid bit count %lu", (unsigned long)decoder->databit_cnt);
+        IR_TRACE("SIRC: Invalid bit count %lu", (unsigned long)decoder->databit_cnt);
         return false;
     }
     
@@ -921,7 +1001,7 @@ bool infrared_decoder_sirc_interpret(InfraredCommonDecoder* decoder) {
     decoder->message.command = command;
     decoder->message.repeat = false;
     
-    ESP_LOGD(TAG, "SIRC interpreter result: protocol=%d, address=0x%04X, command=0x%02X", 
+    IR_TRACE("SIRC interpreter result: protocol=%d, address=0x%04X, command=0x%02X", 
              (int)protocol, address, command);
     
     return true;
@@ -933,14 +1013,14 @@ bool infrared_decoder_rc5_interpret(InfraredCommonDecoder* decoder) {
     
     // RC5 must be exactly 14 bits - reject anything else
     if (decoder->databit_cnt != 14) {
-        ESP_LOGD(TAG, "RC5: Invalid bit count %lu (expected 14)", (unsigned long)decoder->databit_cnt);
+        IR_TRACE("RC5: Invalid bit count %lu (expected 14)", (unsigned long)decoder->databit_cnt);
         return false;
     }
     
     bool result = false;
     uint32_t* data = (void*)&decoder->data[0];
     
-    ESP_LOGD(TAG, "RC5: Raw data before inversion: 0x%08lX 0x%08lX (bits=%d)", 
+    IR_TRACE("RC5: Raw data before inversion: 0x%08lX 0x%08lX (bits=%d)", 
              decoder->data[0], decoder->data[1], decoder->databit_cnt);
     
     /* Manchester (inverse):
@@ -950,7 +1030,7 @@ bool infrared_decoder_rc5_interpret(InfraredCommonDecoder* decoder) {
     decoder->data[0] = ~decoder->data[0];
     decoder->data[1] = ~decoder->data[1];
     
-    ESP_LOGD(TAG, "RC5: Raw data after inversion: 0x%08lX 0x%08lX", 
+    IR_TRACE("RC5: Raw data after inversion: 0x%08lX 0x%08lX", 
              decoder->data[0], decoder->data[1]);
     
     // MSB first
@@ -0,0 +1,90 @@
+#include "managers/infrared_edge_ring.h"
+
+#include <string.h>
+
+void infrared_edge_ring_reset(infrared_edge_ring_t *r) {
+    // only the consumer moves tail, so this is safe with the isr running
+    __atomic_store_n(&r->tail, __atomic_load_n(&r->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+size_t infrared_edge_ring_drain(infrared_edge_ring_t *r, uint32_t *out, size_t max) {
+    uint32_t tail = r->tail;
+    uint32_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+    size_t n = 0;
+    while (tail != head && n < max) {
+        out[n++] = r->ts[tail & (INFRARED_EDGE_RING_SIZE - 1)];
+        tail++;
+    }
+    __atomic_store_n(&r->tail, tail, __ATOMIC_RELEASE);
+    return n;
+}
+
+void infrared_edge_seg_init(infrared_edge_seg_t *seg, uint32_t gap_us) {
+    memset(seg, 0, sizeof(*seg));
+    seg->gap_us = gap_us;
+}
+
+void infrared_edge_seg_reset(infrared_edge_seg_t *seg) {
+    seg->active = false;
+    seg->skip = false;
+    seg->truncated = false;
+    seg->count = 0;
+}
+
+void infrared_edge_seg_resync(infrared_edge_seg_t *seg, uint32_t ts) {
+    seg->active = true;
+    seg->skip = true;
+    seg->truncated = false;
+    seg->count = 0;
+    seg->last_ts = ts;
+}
+
+bool infrared_edge_seg_expired(const infrared_edge_seg_t *seg, uint32_t now) {
+    // unsigned difference, so the 32 bit microsecond wrap is harmless
+    return seg->active && now - seg->last_ts >= seg->gap_us;
+}
+
+bool infrared_edge_seg_push(infrared_edge_seg_t *seg, uint32_t ts, bool *level, uint32_t *duration) {
+    if (!seg->active || ts - seg->last_ts >= seg->gap_us) {
+        // first edge after silence: a mark begins
+        seg->active = true;
+        seg->skip = false;
+        seg->truncated = false;
+        seg->count = 0;
+        seg->last_ts = ts;
+        seg->level = true;
+        return false;
+    }
+    uint32_t d = ts - seg->last_ts;
+    if (seg->skip) {
+        seg->last_ts = ts;
+        return false;
+    }
+    if (d == 0) {
+        // same microsecond: nothing to time, but the line still changed level
+        if (seg->count == 0) {
+            // the opening mark was a blip, the line is idle again
+            seg->active = false;
+        } else {
+            seg->level = !seg->level;
+        }
+        return false;
+    }
+
+    *level = seg->level;
+    *duration = d;
+    if (seg->count < INFRARED_EDGE_SEG_MAX) {
+        // timings[] alternates mark/space from a mark; after a blip the
+        // interval continues the previous one, so lengthen that instead
+        if ((seg->count & 1) == (seg->level ? 0u : 1u)) {
+            seg->timings[seg->count++] = d;
+        } else {
+            seg->timings[seg->count - 1] += d;
+        }
+    } else {
+        seg->truncated = true;
+    }
+    seg->last_ts = ts;
+    seg->level = !seg->level;
+    return true;
+}
@@ -0,0 +1,514 @@
+#include "managers/infrared_file.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "esp_log.h"
+
+static const char *TAG = "infrared_file";
+
+#define IR_KEY_MAX 16
+#define IR_VALUE_MAX 64
+#define IR_INDEX_MAGIC 0x58524947 // "GIRX"
+#define IR_INDEX_VERSION 1
+
+static const char *const ir_protocol_names[] = {
+    "", "NEC", "NECext", "NEC42", "NEC42ext", "Samsung32", "SIRC", "SIRC15", "SIRC20",
+    "RC5", "RC5X", "RC6", "RCA", "Pioneer", "Kaseikyo",
+};
+#define IR_PROTOCOL_COUNT (sizeof(ir_protocol_names) / sizeof(ir_protocol_names[0]))
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entry_size;
+    uint32_t src_size;
+    uint32_t src_mtime;
+    uint32_t count;
+    uint32_t names_len;
+} ir_index_header_t;
+
+typedef struct {
+    FILE *f;
+    uint32_t base; // file offset of buf[0]
+    size_t len;
+    size_t pos;
+    char buf[INFRARED_FILE_BLOCK];
+} ir_reader_t;
+
+static int ir_getc(ir_reader_t *r) {
+    if (r->pos == r->len) {
+        r->base += r->len;
+        r->len = fread(r->buf, 1, sizeof(r->buf), r->f);
+        r->pos = 0;
+        if (r->len == 0) return EOF;
+    }
+    return (unsigned char)r->buf[r->pos++];
+}
+
+static inline bool ir_eol(int c) {
+    return c == EOF || c == '\n' || c == '\r';
+}
+
+static void ir_skip_line(ir_reader_t *r) {
+    int c;
+    do {
+        c = ir_getc(r);
+    } while (!ir_eol(c));
+}
+
+// next "key:" on a line that is not blank or a comment; leaves the reader
+// right after the colon. keys that do not fit come back empty.
+static bool ir_next_key(ir_reader_t *r, char *key, uint32_t *line_off) {
+    for (;;) {
+        int c;
+        do {
+            *line_off = r->base + r->pos;
+            c = ir_getc(r);
+        } while (c != EOF && isspace(c));
+        if (c == EOF) return false;
+        if (c == '#') {
+            ir_skip_line(r);
+            continue;
+        }
+
+        size_t n = 0;
+        bool overflow = false;
+        while (!ir_eol(c) && c != ':') {
+            if (n + 1 < IR_KEY_MAX) key[n++] = (char)c;
+            else overflow = true;
+            c = ir_getc(r);
+        }
+        if (c != ':') continue; // no colon, line ignored
+        while (n > 0 && isspace((unsigned char)key[n - 1])) n--;
+        key[overflow ? 0 : n] = '\0';
+        return true;
+    }
+}
+
+static void ir_read_value(ir_reader_t *r, char *out) {
+    size_t n = 0;
+    int c;
+    do {
+        c = ir_getc(r);
+    } while (c == ' ' || c == '\t');
+    while (!ir_eol(c)) {
+        if (n + 1 < IR_VALUE_MAX) out[n++] = (char)c;
+        c = ir_getc(r);
+    }
+    while (n > 0 && isspace((unsigned char)out[n - 1])) n--;
+    out[n] = '\0';
+}
+
+// decimal timings up to the end of the line, parsed as they stream in.
+// a malformed line yields no timings rather than a half signal.
+static void ir_read_timings(ir_reader_t *r, uint32_t **out, size_t *count) {
+    uint32_t *t = NULL;
+    size_t n = 0, cap = 0;
+    bool ok = true;
+    int c = ir_getc(r);
+    for (;;) {
+        while (c == ' ' || c == '\t') c = ir_getc(r);
+        if (ir_eol(c)) break;
+        if (!isdigit(c)) {
+            ok = false;
+            break;
+        }
+        uint32_t v = 0;
+        while (isdigit(c)) {
+            v = v * 10 + (uint32_t)(c - '0');
+            c = ir_getc(r);
+        }
+        if (!ir_eol(c) && c != ' ' && c != '\t') {
+            ok = false;
+            break;
+        }
+        if (n == cap) {
+            size_t new_cap = cap ? cap * 2 : 64;
+            uint32_t *tmp = realloc(t, new_cap * sizeof(uint32_t));
+            if (!tmp) {
+                ok = false;
+                break;
+            }
+            t = tmp;
+            cap = new_cap;
+        }
+        t[n++] = v;
+    }
+    if (!ok) {
+        if (!ir_eol(c)) ir_skip_line(r);
+        ESP_LOGW(TAG, "malformed data line near offset %lu", (unsigned long)(r->base + r->pos));
+        free(t);
+        t = NULL;
+        n = 0;
+    } else if (n && n < cap) {
+        uint32_t *tmp = realloc(t, n * sizeof(uint32_t));
+        if (tmp) t = tmp;
+    }
+    *out = t;
+    *count = n;
+}
+
+// little endian hex bytes, "04 00 00 00" -> 0x4
+static uint32_t ir_parse_hex_bytes(const char *value) {
+    uint32_t v = 0;
+    const char *p = value;
+    char *end;
+    for (uint8_t shift = 0; shift < 32; shift += 8) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        if (!*p) break;
+        unsigned long b = strtoul(p, &end, 16);
+        if (end == p) break;
+        v |= (uint32_t)(b & 0xFF) << shift;
+        p = end;
+    }
+    return v;
+}
+
+// one field of a signal block; "name" starts a block and is the caller's
+static void ir_apply_field(ir_reader_t *r, const char *key, infrared_signal_t *sig) {
+    char value[IR_VALUE_MAX];
+
+    if (strcmp(key, "type") == 0) {
+        ir_read_value(r, value);
+        sig->is_raw = (strcmp(value, "raw") == 0);
+    } else if (sig->is_raw && strcmp(key, "data") == 0) {
+        free(sig->payload.raw.timings);
+        ir_read_timings(r, &sig->payload.raw.timings, &sig->payload.raw.timings_size);
+    } else if (sig->is_raw && strcmp(key, "frequency") == 0) {
+        ir_read_value(r, value);
+        sig->payload.raw.frequency = (uint32_t)strtoul(value, NULL, 10);
+    } else if (sig->is_raw && strcmp(key, "duty_cycle") == 0) {
+        ir_read_value(r, value);
+        sig->payload.raw.duty_cycle = strtof(value, NULL);
+    } else if (!sig->is_raw && strcmp(key, "protocol") == 0) {
+        ir_read_value(r, value);
+        strncpy(sig->payload.message.protocol, value, sizeof(sig->payload.message.protocol) - 1);
+        sig->payload.message.protocol[sizeof(sig->payload.message.protocol) - 1] = '\0';
+    } else if (!sig->is_raw && strcmp(key, "address") == 0) {
+        ir_read_value(r, value);
+        sig->payload.message.address = ir_parse_hex_bytes(value);
+    } else if (!sig->is_raw && strcmp(key, "command") == 0) {
+        ir_read_value(r, value);
+        sig->payload.message.command = ir_parse_hex_bytes(value);
+    } else {
+        ir_skip_line(r);
+    }
+}
+
+static void ir_start_signal(ir_reader_t *r, infrared_signal_t *sig) {
+    char value[IR_VALUE_MAX];
+    memset(sig, 0, sizeof(*sig));
+    ir_read_value(r, value);
+    strncpy(sig->name, value, sizeof(sig->name) - 1);
+    sig->name[sizeof(sig->name) - 1] = '\0';
+}
+
+static FILE *ir_open(const char *path, ir_reader_t **reader) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    // fatfs does the buffering in our block; a second stdio buffer only copies
+    setvbuf(f, NULL, _IONBF, 0);
+    ir_reader_t *r = malloc(sizeof(ir_reader_t));
+    if (!r) {
+        fclose(f);
+        return NULL;
+    }
+    r->f = f;
+    r->base = 0;
+    r->len = 0;
+    r->pos = 0;
+    *reader = r;
+    return f;
+}
+
+static void ir_close(ir_reader_t *r) {
+    fclose(r->f);
+    free(r);
+}
+
+static void ir_free_signals(infrared_signal_t *list, size_t count) {
+    for (size_t i = 0; i < count; i++) infrared_manager_free_signal(&list[i]);
+    free(list);
+}
+
+bool infrared_file_read_list(const char *path, infrared_signal_t **signals, size_t *count) {
+    ir_reader_t *r;
+    if (!ir_open(path, &r)) return false;
+
+    infrared_signal_t *list = NULL;
+    size_t list_count = 0, list_capacity = 0;
+    infrared_signal_t current;
+    bool in_block = false;
+    bool ok = true;
+    char key[IR_KEY_MAX];
+    uint32_t line_off;
+
+    for (;;) {
+        bool more = ir_next_key(r, key, &line_off);
+        bool is_name = more && strcmp(key, "name") == 0;
+        if (in_block && (is_name || !more)) {
+            if (list_count == list_capacity) {
+                size_t new_cap = list_capacity ? list_capacity * 2 : 4;
+                infrared_signal_t *tmp = realloc(list, new_cap * sizeof(infrared_signal_t));
+                if (!tmp) {
+                    infrared_manager_free_signal(&current);
+                    ok = false;
+                    break;
+                }
+                list = tmp;
+                list_capacity = new_cap;
+            }
+            list[list_count++] = current;
+            in_block = false;
+        }
+        if (!more) break;
+        if (is_name) {
+            ir_start_signal(r, &current);
+            in_block = true;
+        } else if (in_block) {
+            ir_apply_field(r, key, &current);
+        } else {
+            ir_skip_line(r);
+        }
+    }
+    ir_close(r);
+
+    if (!ok || list_count == 0) {
+        ir_free_signals(list, list_count);
+        return false;
+    }
+    *signals = list;
+    *count = list_count;
+    return true;
+}
+
+static void ir_index_cache_path(const char *path, char *out, size_t size) {
+    const char *slash = strrchr(path, '/');
+    const char *base = slash ? slash + 1 : path;
+    const char *dot = strrchr(base, '.');
+    size_t stem = (dot && dot > base) ? (size_t)(dot - base) : strlen(base);
+    snprintf(out, size, "%.*s.%.*s.gidx", (int)(base - path), path, (int)stem, base);
+}
+
+static uint8_t ir_protocol_id(const char *name) {
+    for (uint8_t i = 1; i < IR_PROTOCOL_COUNT; i++) {
+        if (strcmp(name, ir_protocol_names[i]) == 0) return i;
+    }
+    return 0;
+}
+
+static bool ir_index_load_cache(const char *cache, const struct stat *src,
+                                infrared_file_index_t *index) {
+    FILE *f = fopen(cache, "rb");
+    if (!f) return false;
+
+    ir_index_header_t h;
+    bool ok = fread(&h, sizeof(h), 1, f) == 1 && h.magic == IR_INDEX_MAGIC &&
+              h.version == IR_INDEX_VERSION && h.entry_size == sizeof(infrared_file_entry_t) &&
+              h.src_size == (uint32_t)src->st_size && h.src_mtime == (uint32_t)src->st_mtime &&
+              h.count > 0;
+    if (ok) {
+        index->entries = malloc(h.count * sizeof(infrared_file_entry_t));
+        index->names = malloc(h.names_len ? h.names_len : 1);
+        ok = index->entries && index->names &&
+             fread(index->entries, sizeof(infrared_file_entry_t), h.count, f) == h.count &&
+             fread(index->names, 1, h.names_len, f) == h.names_len;
+        index->count = h.count;
+        index->names_len = h.names_len;
+    }
+    fclose(f);
+
+    // every name has to end inside the pool
+    for (size_t i = 0; ok && i < index->count; i++) {
+        uint32_t off = index->entries[i].name_off;
+        ok = off < index->names_len && memchr(index->names + off, '\0', index->names_len - off);
+    }
+    if (!ok) {
+        free(index->entries);
+        free(index->names);
+        index->entries = NULL;
+        index->names = NULL;
+        index->count = index->names_len = 0;
+    }
+    return ok;
+}
+
+static void ir_index_save_cache(const char *cache, const struct stat *src,
+                                const infrared_file_index_t *index) {
+    char tmp[272];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", cache);
+    FILE *f = fopen(tmp, "wb");
+    if (!f) return;
+
+    ir_index_header_t h = {
+        .magic = IR_INDEX_MAGIC,
+        .version = IR_INDEX_VERSION,
+        .entry_size = sizeof(infrared_file_entry_t),
+        .src_size = (uint32_t)src->st_size,
+        .src_mtime = (uint32_t)src->st_mtime,
+        .count = (uint32_t)index->count,
+        .names_len = (uint32_t)index->names_len,
+    };
+    bool ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+              fwrite(index->entries, sizeof(infrared_file_entry_t), index->count, f) ==
+                  index->count &&
+              fwrite(index->names, 1, index->names_len, f) == index->names_len;
+    if (fclose(f) != 0) ok = false;
+    // fatfs rename does not replace an existing file
+    remove(cache);
+    if (!ok || rename(tmp, cache) != 0) {
+        remove(tmp);
+        ESP_LOGW(TAG, "could not write index %s", cache);
+    }
+}
+
+static bool ir_index_build(const char *path, infrared_file_index_t *index) {
+    ir_reader_t *r;
+    if (!ir_open(path, &r)) return false;
+
+    size_t cap = 0, names_cap = 0;
+    bool ok = true;
+    infrared_file_entry_t *cur = NULL;
+    char key[IR_KEY_MAX];
+    char value[IR_VALUE_MAX];
+    uint32_t line_off;
+
+    while (ok && ir_next_key(r, key, &line_off)) {
+        if (strcmp(key, "name") == 0) {
+            ir_read_value(r, value);
+            size_t len = strlen(value) + 1;
+            if (len > sizeof(((infrared_signal_t *)0)->name)) {
+                len = sizeof(((infrared_signal_t *)0)->name);
+                value[len - 1] = '\0';
+            }
+            if (index->count == cap) {
+                size_t new_cap = cap ? cap * 2 : 32;
+                infrared_file_entry_t *tmp =
+                    realloc(index->entries, new_cap * sizeof(infrared_file_entry_t));
+                if (!tmp) {
+                    ok = false;
+                    break;
+                }
+                index->entries = tmp;
+                cap = new_cap;
+            }
+            if (index->names_len + len > names_cap) {
+                size_t new_cap = names_cap ? names_cap * 2 : 512;
+                while (new_cap < index->names_len + len) new_cap *= 2;
+                char *tmp = realloc(index->names, new_cap);
+                if (!tmp) {
+                    ok = false;
+                    break;
+                }
+                index->names = tmp;
+                names_cap = new_cap;
+            }
+            cur = &index->entries[index->count++];
+            memset(cur, 0, sizeof(*cur));
+            cur->offset = line_off;
+            cur->name_off = (uint32_t)index->names_len;
+            memcpy(index->names + index->names_len, value, len);
+            index->names_len += len;
+        } else if (cur && strcmp(key, "type") == 0) {
+            ir_read_value(r, value);
+            cur->is_raw = (strcmp(value, "raw") == 0);
+        } else if (cur && !cur->is_raw && strcmp(key, "protocol") == 0) {
+            ir_read_value(r, value);
+            cur->protocol = ir_protocol_id(value);
+        } else if (cur && !cur->is_raw && strcmp(key, "address") == 0) {
+            ir_read_value(r, value);
+            cur->address = ir_parse_hex_bytes(value);
+        } else if (cur && !cur->is_raw && strcmp(key, "command") == 0) {
+            ir_read_value(r, value);
+            cur->command = ir_parse_hex_bytes(value);
+        } else {
+            ir_skip_line(r);
+        }
+    }
+    ir_close(r);
+    return ok && index->count > 0;
+}
+
+bool infrared_file_index_open(const char *path, infrared_file_index_t *index) {
+    memset(index, 0, sizeof(*index));
+    struct stat st;
+    if (!path || stat(path, &st) != 0 || !S_ISREG(st.st_mode)) return false;
+
+    index->path = strdup(path);
+    if (!index->path) return false;
+
+    char cache[256];
+    ir_index_cache_path(path, cache, sizeof(cache));
+    if (ir_index_load_cache(cache, &st, index)) {
+        return true;
+    }
+
+    uint32_t t0 = esp_log_timestamp();
+    if (!ir_index_build(path, index)) {
+        infrared_file_index_close(index);
+        return false;
+    }
+    ESP_LOGI(TAG, "indexed %u signals of %s in %lu ms", (unsigned)index->count, path,
+             (unsigned long)(esp_log_timestamp() - t0));
+    ir_index_save_cache(cache, &st, index);
+    return true;
+}
+
+void infrared_file_index_close(infrared_file_index_t *index) {
+    if (!index) return;
+    free(index->path);
+    free(index->entries);
+    free(index->names);
+    memset(index, 0, sizeof(*index));
+}
+
+void infrared_file_index_forget(const char *path) {
+    if (!path) return;
+    const char *dot = strrchr(path, '.');
+    if (!dot || strcasecmp(dot, ".ir") != 0) return;
+    char cache[256];
+    ir_index_cache_path(path, cache, sizeof(cache));
+    unlink(cache);
+}
+
+const char *infrared_file_index_name(const infrared_file_index_t *index, size_t i) {
+    if (!index || i >= index->count) return NULL;
+    return index->names + index->entries[i].name_off;
+}
+
+const char *infrared_file_index_protocol(const infrared_file_index_t *index, size_t i) {
+    if (!index || i >= index->count) return NULL;
+    uint8_t id = index->entries[i].protocol;
+    if (index->entries[i].is_raw || id == 0 || id >= IR_PROTOCOL_COUNT) return NULL;
+    return ir_protocol_names[id];
+}
+
+bool infrared_file_index_load(const infrared_file_index_t *index, size_t i,
+                              infrared_signal_t *signal) {
+    if (!index || !signal || i >= index->count) return false;
+    ir_reader_t *r;
+    if (!ir_open(index->path, &r)) return false;
+
+    bool ok = false;
+    char key[IR_KEY_MAX];
+    uint32_t line_off;
+    if (fseek(r->f, (long)index->entries[i].offset, SEEK_SET) == 0) {
+        r->base = index->entries[i].offset;
+        // the index points at the name line; stop at the next one
+        if (ir_next_key(r, key, &line_off) && strcmp(key, "name") == 0) {
+            ir_start_signal(r, signal);
+            while (ir_next_key(r, key, &line_off) && strcmp(key, "name") != 0) {
+                ir_apply_field(r, key, signal);
+            }
+            ok = true;
+        }
+    }
+    ir_close(r);
+    if (!ok) ESP_LOGW(TAG, "stale index entry %u in %s", (unsigned)i, index->path);
+    return ok;
+}
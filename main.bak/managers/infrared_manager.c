@@ -19,6 +19,7 @@
 #include <inttypes.h>
 #include "esp_heap_caps.h"
 #include <strings.h>
+#include "managers/infrared_file.h"
 #include "managers/infrared_timings.h"
 #include "managers/infrared_protocols.h"
 #include "soc/soc_caps.h"
@@ -385,99 +386,9 @@ static bool parse_tlv_list(const uint8_t *buf, size_t buf_len, infrared_signal_t
     return false;
 }
 
-static bool parse_ir_file(char *buf, const char *path, infrared_signal_t **signals, size_t *count) {
-
-    infrared_signal_t *list = NULL;
-    size_t list_count = 0, list_capacity = 0;
-    infrared_signal_t current;
-
-    bool in_block = false;
-    char *saveptr;
-    char *line = strtok_r(buf, "\r\n", &saveptr);
-
-    while (line) {
-        char *s = line;
-        while (*s && isspace((unsigned char)*s)) s++;
-        if (*s == '\0' || *s == '#') { line = strtok_r(NULL, "\r\n", &saveptr); continue; }
-        char *colon = strchr(s, ':');
-        if (!colon) { line = strtok_r(NULL, "\r\n", &saveptr); continue; }
-        *colon = '\0'; char *key = s; char *value = colon + 1;
-        char *end = key + strlen(key) - 1;
-        while (end > key && isspace((unsigned char)*end)) *end-- = '\0';
-        while (*value && isspace((unsigned char)*value)) value++;
-        char *v_end = value + strlen(value) - 1;
-        while (v_end > value && isspace((unsigned char)*v_end)) *v_end-- = '\0';
-        if (strcmp(key, "name") == 0) {
-            if (in_block) {
-                if (list_count == list_capacity) {
-                    size_t new_cap = list_capacity ? list_capacity * 2 : 4;
-                    infrared_signal_t *tmp = realloc(list, new_cap * sizeof(infrared_signal_t));
-                    if (!tmp) { free_signal_array(list, list_count); infrared_manager_free_signal(&current); return false; }
-
-                    list = tmp; list_capacity = new_cap;
-                }
-                list[list_count++] = current;
-            }
-            memset(&current, 0, sizeof(current)); in_block = true;
-            strncpy(current.name, value, sizeof(current.name) - 1);
-            current.name[sizeof(current.name) - 1] = '\0';
-        } else if (in_block && strcmp(key, "type") == 0) {
-            current.is_raw = (strcmp(value, "raw") == 0);
-        } else if (in_block && current.is_raw) {
-            if (strcmp(key, "frequency") == 0) {
-                current.payload.raw.frequency = (uint32_t)strtoul(value, NULL, 10);
-            } else if (strcmp(key, "duty_cycle") == 0) {
-                current.payload.raw.duty_cycle = strtof(value, NULL);
-            } else if (strcmp(key, "data") == 0) {
-                size_t data_count = 0; const char *p2 = value;
-                while (*p2) { while (*p2 && isspace((unsigned char)*p2)) p2++; if (!*p2) break; data_count++; while (*p2 && !isspace((unsigned char)*p2)) p2++; }
-                uint32_t *timings = malloc(sizeof(uint32_t) * data_count);
-                if (!timings) { free_signal_array(list, list_count); infrared_manager_free_signal(&current); return false; }
-                size_t idx2 = 0; p2 = value; char *endptr;
-
-                while (*p2) { while (*p2 && isspace((unsigned char)*p2)) p2++; if (!*p2) break; unsigned long v = strtoul(p2, &endptr, 10); timings[idx2++] = (uint32_t)v; p2 = endptr; }
-                current.payload.raw.timings = timings; current.payload.raw.timings_size = data_count;
-            }
-        } else if (in_block && !current.is_raw) {
-            if (strcmp(key, "protocol") == 0) {
-                strncpy(current.payload.message.protocol, value, sizeof(current.payload.message.protocol) - 1);
-                current.payload.message.protocol[sizeof(current.payload.message.protocol) - 1] = '\0';
-            } else if (strcmp(key, "address") == 0) {
-                uint32_t addr = 0; const char *p2 = value; char *endptr; uint8_t shift = 0;
-
-                while (*p2) { while (*p2 && isspace((unsigned char)*p2)) p2++; if (!*p2) break; unsigned long b = strtoul(p2, &endptr, 16); addr |= (uint32_t)(b & 0xFF) << shift; shift += 8; p2 = endptr; }
-                current.payload.message.address = addr;
-            } else if (strcmp(key, "command") == 0) {
-                uint32_t cmd = 0; const char *p2 = value; char *endptr; uint8_t shift = 0;
-
-                while (*p2) { while (*p2 && isspace((unsigned char)*p2)) p2++; if (!*p2) break; unsigned long b = strtoul(p2, &endptr, 16); cmd |= (uint32_t)(b & 0xFF) << shift; shift += 8; p2 = endptr; }
-                current.payload.message.command = cmd;
-            }
-        }
-        line = strtok_r(NULL, "\r\n", &saveptr);
-    }
-    if (in_block) {
-        if (list_count == list_capacity) {
-            size_t new_cap = list_capacity ? list_capacity * 2 : 4;
-            infrared_signal_t *tmp = realloc(list, new_cap * sizeof(infrared_signal_t));
-            if (!tmp) { free_signal_array(list, list_count); infrared_manager_free_signal(&current); return false; }
-            list = tmp; list_capacity = new_cap;
-        }
-        list[list_count++] = current;
-    }
-    if (list_count == 0) { free_signal_array(list, list_count); infrared_manager_free_signal(&current); return false; }
-    *signals = list; *count = list_count;
-    return true;
-}
-
 // read a JSON file containing an array of IR signal objects
 bool infrared_manager_read_list(const char *path, infrared_signal_t **signals, size_t *count) {
-    char *buf = read_file_to_buffer(path);
-    if (buf) {
-        bool ok = parse_ir_file(buf, path, signals, count);
-        free(buf);
-        if (ok) return true;
-    }
+    if (infrared_file_read_list(path, signals, count)) return true;
 
     uint8_t *binbuf = NULL; size_t binlen = 0;
     if (read_file_binary(path, &binbuf, &binlen)) {
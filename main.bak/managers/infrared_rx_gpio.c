@@ -2,7 +2,9 @@
  * @file infrared_rx_gpio.c
  * @brief GPIO interrupt-based IR receiver
  *
- * Uses GPIO interrupts and hardware timer instead of RMT RX for reliable IR reception
+ * Uses GPIO interrupts instead of RMT RX for reliable IR reception. The ISR
+ * only timestamps edges into a ring; the receiving task segments them into
+ * signals at silent gaps and decodes each timing as it arrives.
  * Based on IRremoteESP8266 library approach
  */
 
@@ -13,98 +15,38 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "managers/infrared_decoder.h"
+#include "managers/infrared_edge_ring.h"
 #include <string.h>
 
 #ifdef CONFIG_HAS_INFRARED_RX
 
 static const char *TAG = "ir_rx_gpio";
 
-#define IR_RX_BUFFER_SIZE 512  // Raw timing buffer size
-#define IR_RX_TIMEOUT_US 15000 // 15ms timeout (same as IRremote library default)
-#define IR_RX_TICK_US 2        // 2us per tick for timing precision
-
-// RX state machine
-typedef enum {
-    IR_RX_STATE_IDLE = 0,
-    IR_RX_STATE_MARK,
-    IR_RX_STATE_SPACE,
-    IR_RX_STATE_STOP
-} ir_rx_state_t;
-
-// Volatile params accessed from ISR
-typedef struct {
-    volatile ir_rx_state_t state;
-    volatile uint16_t rawbuf[IR_RX_BUFFER_SIZE];
-    volatile uint16_t rawlen;
-    volatile bool overflow;
-    volatile uint32_t last_time_us;
-    gpio_num_t pin;
-} ir_rx_params_t;
-
-static ir_rx_params_t ir_params = {0};
-static esp_timer_handle_t ir_timeout_timer = NULL;
+#define IR_RX_GAP_US 15000   // 15ms of silence ends a signal (same as IRremote library default)
+#define IR_RX_MIN_TIMINGS 5  // shorter bursts are noise
+#define IR_RX_POLL_MS 10     // upper bound on a wait, keeps cancel and timeout responsive
+#define IR_RX_DRAIN_BATCH 32
+
+static infrared_edge_ring_t ir_ring;
+static infrared_edge_seg_t ir_seg;
+static SemaphoreHandle_t ir_rx_wake = NULL; // given by the isr at the start of each batch
+static gpio_num_t ir_rx_pin;
+static volatile bool ir_rx_listening = false;
 static InfraredDecoderContext *ir_decoder = NULL;
 static volatile bool ir_rx_initialized = false;
 static volatile bool ir_rx_cancel_flag = false;
 
-// ISR for timeout - signal end of IR capture
-static void IRAM_ATTR ir_timeout_callback(void *arg) {
-    if (ir_params.rawlen > 0) {
-        ir_params.state = IR_RX_STATE_STOP;
-    }
-}
-
-// GPIO interrupt handler - captures edge timings
+// GPIO interrupt handler - timestamps the edge, the task does the rest
 static void IRAM_ATTR ir_gpio_isr_handler(void *arg) {
-    uint32_t now_us = (uint32_t)esp_timer_get_time();
+    if (!ir_rx_listening) return;
 
-    // Stop the timeout timer - we'll restart it at the end
-    if (ir_timeout_timer) {
-        esp_timer_stop(ir_timeout_timer);
-    }
-
-    uint16_t rawlen = ir_params.rawlen;
-
-    // Check for buffer overflow
-    if (rawlen >= IR_RX_BUFFER_SIZE) {
-        ir_params.overflow = true;
-        ir_params.state = IR_RX_STATE_STOP;
-        return;
-    }
-
-    // Don't capture if we're stopped
-    if (ir_params.state == IR_RX_STATE_STOP) {
-        return;
-    }
-
-    // First edge - start of signal
-    if (ir_params.state == IR_RX_STATE_IDLE) {
-        ir_params.state = IR_RX_STATE_MARK;
-        ir_params.rawbuf[rawlen] = 1;  // Mark start
-        ir_params.rawlen++;
-    } else {
-        // Calculate time since last edge in ticks (2us per tick)
-        uint32_t delta_us;
-        if (now_us >= ir_params.last_time_us) {
-            delta_us = now_us - ir_params.last_time_us;
-        } else {
-            // Handle timer wrap-around
-            delta_us = (UINT32_MAX - ir_params.last_time_us) + now_us + 1;
-        }
-
-        uint16_t ticks = (uint16_t)(delta_us / IR_RX_TICK_US);
-        if (ticks > 0 && rawlen < IR_RX_BUFFER_SIZE) {
-            ir_params.rawbuf[rawlen] = ticks;
-            ir_params.rawlen++;
-        }
-    }
-
-    ir_params.last_time_us = now_us;
-
-    // Restart timeout timer
-    if (ir_timeout_timer) {
-        esp_timer_start_once(ir_timeout_timer, IR_RX_TIMEOUT_US);
+    bool was_empty;
+    if (infrared_edge_ring_push(&ir_ring, (uint32_t)esp_timer_get_time(), &was_empty) && was_empty) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(ir_rx_wake, &woken);
+        if (woken == pdTRUE) portYIELD_FROM_ISR();
     }
 }
 
@@ -137,16 +79,9 @@ bool infrared_manager_rx_init(void) {
         return false;
     }
 
-    // Create timeout timer
-    esp_timer_create_args_t timer_args = {
-        .callback = ir_timeout_callback,
-        .arg = NULL,
-        .dispatch_method = ESP_TIMER_TASK,
-        .name = "ir_rx_timeout"
-    };
-
-    if (esp_timer_create(&timer_args, &ir_timeout_timer) != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to create timeout timer");
+    ir_rx_wake = xSemaphoreCreateBinary();
+    if (!ir_rx_wake) {
+        ESP_LOGE(TAG, "Failed to create wake semaphore");
         return false;
     }
 
@@ -154,15 +89,16 @@ bool infrared_manager_rx_init(void) {
     ir_decoder = infrared_decoder_alloc();
     if (!ir_decoder) {
         ESP_LOGE(TAG, "Failed to allocate IR decoder");
-        esp_timer_delete(ir_timeout_timer);
-        ir_timeout_timer = NULL;
+        vSemaphoreDelete(ir_rx_wake);
+        ir_rx_wake = NULL;
         return false;
     }
 
     // Initialize state
-    memset((void *)&ir_params, 0, sizeof(ir_params));
-    ir_params.pin = CONFIG_INFRARED_RX_PIN;
-    ir_params.state = IR_RX_STATE_IDLE;
+    memset(&ir_ring, 0, sizeof(ir_ring));
+    infrared_edge_seg_init(&ir_seg, IR_RX_GAP_US);
+    ir_rx_pin = CONFIG_INFRARED_RX_PIN;
+    ir_rx_listening = false;
 
     // Install ISR service (only if not already installed)
     esp_err_t isr_ret = gpio_install_isr_service(0);
@@ -171,8 +107,8 @@ bool infrared_manager_rx_init(void) {
         ESP_LOGE(TAG, "Failed to install GPIO ISR service: %d", isr_ret);
         infrared_decoder_free(ir_decoder);
         ir_decoder = NULL;
-        esp_timer_delete(ir_timeout_timer);
-        ir_timeout_timer = NULL;
+        vSemaphoreDelete(ir_rx_wake);
+        ir_rx_wake = NULL;
         return false;
     }
 
@@ -181,8 +117,8 @@ bool infrared_manager_rx_init(void) {
         ESP_LOGE(TAG, "Failed to add GPIO ISR handler");
         infrared_decoder_free(ir_decoder);
         ir_decoder = NULL;
-        esp_timer_delete(ir_timeout_timer);
-        ir_timeout_timer = NULL;
+        vSemaphoreDelete(ir_rx_wake);
+        ir_rx_wake = NULL;
         return false;
     }
 
@@ -197,13 +133,12 @@ void infrared_manager_rx_deinit(void) {
     if (!ir_rx_initialized) return;
 
     // Remove ISR handler
-    gpio_isr_handler_remove(ir_params.pin);
+    ir_rx_listening = false;
+    gpio_isr_handler_remove(ir_rx_pin);
 
-    // Delete timer
-    if (ir_timeout_timer) {
-        esp_timer_stop(ir_timeout_timer);
-        esp_timer_delete(ir_timeout_timer);
-        ir_timeout_timer = NULL;
+    if (ir_rx_wake) {
+        vSemaphoreDelete(ir_rx_wake);
+        ir_rx_wake = NULL;
     }
 
     // Free decoder
@@ -228,32 +163,91 @@ bool infrared_manager_rx_is_initialized(void) {
 
 void infrared_manager_rx_suspend(void) {
     if (ir_rx_initialized) {
-        gpio_intr_disable(ir_params.pin);
-        if (ir_timeout_timer) {
-            esp_timer_stop(ir_timeout_timer);
-        }
+        gpio_intr_disable(ir_rx_pin);
     }
 }
 
 void infrared_manager_rx_resume(void) {
     if (ir_rx_initialized) {
-        // Reset state
-        ir_params.state = IR_RX_STATE_IDLE;
-        ir_params.rawlen = 0;
-        ir_params.overflow = false;
+        // Drop whatever was cut off by the suspend
+        infrared_edge_ring_reset(&ir_ring);
+        infrared_edge_seg_reset(&ir_seg);
+        if (ir_decoder) {
+            infrared_decoder_reset(ir_decoder);
+        }
 
-        gpio_intr_enable(ir_params.pin);
+        gpio_intr_enable(ir_rx_pin);
     }
 }
 
-// Convert raw buffer to timings in microseconds
-static void convert_raw_to_timings(uint32_t *timings, size_t *count, const volatile uint16_t *rawbuf, uint16_t rawlen) {
-    *count = 0;
-    for (uint16_t i = 1; i < rawlen && i < IR_RX_BUFFER_SIZE; i++) {  // Skip first entry (mark start)
-        if (*count >= IR_RX_MAX_SYMBOLS * 2) break;
-        timings[*count] = rawbuf[i] * IR_RX_TICK_US;  // Convert ticks to microseconds
-        (*count)++;
+static void ir_rx_fill_decoded(infrared_signal_t *signal, const InfraredDecodedMessage *decoded) {
+    memset(signal, 0, sizeof(*signal));
+    signal->is_raw = false;
+
+    const char *proto_name = infrared_protocol_to_string(decoded->protocol);
+    strncpy(signal->payload.message.protocol,
+            proto_name ? proto_name : "Unknown",
+            sizeof(signal->payload.message.protocol) - 1);
+    signal->payload.message.address = decoded->address;
+    signal->payload.message.command = decoded->command;
+    snprintf(signal->name, sizeof(signal->name), "Learned_%.20s",
+             signal->payload.message.protocol);
+}
+
+// the current signal went silent without a decode: finalize the decoders
+// (some only complete on the trailing space), then fall back to the raw
+// timings. true if signal is filled.
+static bool ir_rx_finish_signal(infrared_signal_t *signal) {
+    size_t timing_count = ir_seg.count;
+    bool truncated = ir_seg.truncated;
+    uint32_t latency_us = (uint32_t)esp_timer_get_time() - ir_seg.last_ts;
+    // reset keeps timings[] intact for the raw copy below
+    infrared_edge_seg_reset(&ir_seg);
+
+    if (timing_count < IR_RX_MIN_TIMINGS) {
+        if (timing_count > 0) {
+            ESP_LOGW(TAG, "Signal too short (%d timings), ignoring", (int)timing_count);
+        }
+        infrared_decoder_reset(ir_decoder);
+        return false;
+    }
+
+    InfraredDecodedMessage *decoded = infrared_decoder_decode(ir_decoder, false, 0);
+    infrared_decoder_reset(ir_decoder);
+    if (decoded) {
+        ir_rx_fill_decoded(signal, decoded);
+        ESP_LOGI(TAG, "Decoded: %s addr=0x%lx cmd=0x%lx (%lu us after its last edge)",
+                 signal->payload.message.protocol,
+                 (unsigned long)signal->payload.message.address,
+                 (unsigned long)signal->payload.message.command,
+                 (unsigned long)latency_us);
+        return true;
     }
+
+    if (truncated) {
+        ESP_LOGW(TAG, "Signal longer than %d timings - raw copy truncated", INFRARED_EDGE_SEG_MAX);
+    }
+
+    // Fallback: store as raw signal
+    ESP_LOGI(TAG, "Storing as raw signal");
+    memset(signal, 0, sizeof(*signal));
+    signal->is_raw = true;
+    signal->payload.raw.frequency = 38000;
+    signal->payload.raw.duty_cycle = 0.33f;
+    signal->payload.raw.timings_size = timing_count;
+    signal->payload.raw.timings = malloc(timing_count * sizeof(uint32_t));
+
+    if (!signal->payload.raw.timings) {
+        ESP_LOGE(TAG, "Failed to allocate memory for raw timings");
+        return false;
+    }
+
+    memcpy(signal->payload.raw.timings, ir_seg.timings, timing_count * sizeof(uint32_t));
+    snprintf(signal->name, sizeof(signal->name), "Raw_IR");
+
+    ESP_LOGI(TAG, "Raw signal stored: %zu timings (%lu us after its last edge)", timing_count,
+             (unsigned long)latency_us);
+    return true;
 }
 
 bool infrared_manager_rx_receive(infrared_signal_t *signal, int timeout_ms) {
@@ -267,138 +261,96 @@ bool infrared_manager_rx_receive(infrared_signal_t *signal, int timeout_ms) {
         deadline_us = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
     }
 
-    // Reset state to start receiving
-    ir_params.state = IR_RX_STATE_IDLE;
-    ir_params.rawlen = 0;
-    ir_params.overflow = false;
-
-    if (ir_decoder) {
-        infrared_decoder_reset(ir_decoder);
+    // Start from an empty ring. a segmenter still skipping the tail of the
+    // last decoded signal keeps doing so, that tail is not a new signal.
+    infrared_edge_ring_reset(&ir_ring);
+    if (!ir_seg.skip) {
+        infrared_edge_seg_reset(&ir_seg);
     }
+    uint32_t dropped_seen = infrared_edge_ring_dropped(&ir_ring);
+    infrared_decoder_reset(ir_decoder);
+    xSemaphoreTake(ir_rx_wake, 0);
+    ir_rx_listening = true;
 
     ESP_LOGI(TAG, "Waiting for IR signal (timeout: %d ms)...", timeout_ms);
 
-    while (true) {
+    bool got = false;
+    while (!got) {
         // Check for cancel
         if (ir_rx_cancel_flag) {
             ir_rx_cancel_flag = false;
             ESP_LOGI(TAG, "IR RX cancelled");
-            return false;
+            break;
         }
 
         // Check timeout
-        if (deadline_us >= 0) {
-            int64_t now_us = esp_timer_get_time();
-            if (now_us >= deadline_us) {
-                ESP_LOGW(TAG, "IR RX timeout");
-                return false;
-            }
+        if (deadline_us >= 0 && esp_timer_get_time() >= deadline_us) {
+            ESP_LOGW(TAG, "IR RX timeout");
+            break;
         }
 
-        // Check if we have a complete signal
-        if (ir_params.state == IR_RX_STATE_STOP && ir_params.rawlen > 0) {
-            ESP_LOGI(TAG, "IR signal captured: %d raw entries", ir_params.rawlen);
-
-            if (ir_params.overflow) {
-                ESP_LOGW(TAG, "Buffer overflow - signal may be truncated");
-            }
-
-            // Copy raw buffer to local (ISR could overwrite)
-            uint16_t local_rawbuf[IR_RX_BUFFER_SIZE];
-            uint16_t local_rawlen = ir_params.rawlen;
-            memcpy(local_rawbuf, (void *)ir_params.rawbuf, local_rawlen * sizeof(uint16_t));
-
-            // Reset for next signal
-            ir_params.state = IR_RX_STATE_IDLE;
-            ir_params.rawlen = 0;
-            ir_params.overflow = false;
-
-            // Validate signal has minimum entries
-            if (local_rawlen < 6) {
-                ESP_LOGW(TAG, "Signal too short (%d entries), ignoring", local_rawlen);
-                continue;  // Keep listening
+        // Sleep until the isr starts a batch, or until the current signal's
+        // gap runs out
+        TickType_t wait = pdMS_TO_TICKS(IR_RX_POLL_MS);
+        if (ir_seg.active) {
+            uint32_t idle = (uint32_t)esp_timer_get_time() - ir_seg.last_ts;
+            uint32_t left_ms = idle < IR_RX_GAP_US ? (IR_RX_GAP_US - idle + 999) / 1000 : 0;
+            TickType_t left = pdMS_TO_TICKS(left_ms) + 1;
+            if (left < wait) wait = left;
+        }
+        xSemaphoreTake(ir_rx_wake, wait);
+
+        uint32_t edges[IR_RX_DRAIN_BATCH];
+        while (!got) {
+            uint32_t dropped = infrared_edge_ring_dropped(&ir_ring);
+            if (dropped != dropped_seen) {
+                // the ring filled up: what is queued ends in a signal that lost
+                // edges, so drop it all and pick up after the next silence
+                ESP_LOGW(TAG, "Edge ring overflow, %lu edges dropped so far",
+                         (unsigned long)dropped);
+                dropped_seen = dropped;
+                infrared_edge_ring_reset(&ir_ring);
+                infrared_edge_seg_resync(&ir_seg, (uint32_t)esp_timer_get_time());
+                infrared_decoder_reset(ir_decoder);
             }
 
-            // Convert to timings
-            uint32_t timings[IR_RX_MAX_SYMBOLS * 2];
-            size_t timing_count = 0;
-            convert_raw_to_timings(timings, &timing_count, local_rawbuf, local_rawlen);
-
-            ESP_LOGI(TAG, "Converted to %zu timing values", timing_count);
+            size_t n = infrared_edge_ring_drain(&ir_ring, edges, IR_RX_DRAIN_BATCH);
+            if (n == 0) break;
 
-            // Try to decode using protocol decoder
-            if (ir_decoder) {
-                infrared_decoder_reset(ir_decoder);
-                InfraredDecodedMessage *decoded = NULL;
-
-                // Feed timings to decoder (alternating mark/space)
-                bool current_level = true;  // Start with mark (IR receivers are inverted)
-                for (size_t i = 0; i < timing_count; i++) {
-                    InfraredDecodedMessage *res = infrared_decoder_decode(ir_decoder, current_level, timings[i]);
-                    if (res) {
-                        decoded = res;
-                        break;
-                    }
-                    current_level = !current_level;
+            for (size_t i = 0; i < n && !got; i++) {
+                if (infrared_edge_seg_expired(&ir_seg, edges[i])) {
+                    got = ir_rx_finish_signal(signal);
+                    if (got) break;
                 }
 
-                // Finalize decoding
-                if (!decoded) {
-                    InfraredDecodedMessage *res = infrared_decoder_decode(ir_decoder, false, 0);
-                    if (res) {
-                        decoded = res;
-                    }
-                }
+                bool level;
+                uint32_t duration;
+                if (!infrared_edge_seg_push(&ir_seg, edges[i], &level, &duration)) continue;
 
-                // If decoded successfully, return parsed signal
+                InfraredDecodedMessage *decoded = infrared_decoder_decode(ir_decoder, level, duration);
                 if (decoded) {
-                    memset(signal, 0, sizeof(*signal));
-                    signal->is_raw = false;
-
-                    const char *proto_name = infrared_protocol_to_string(decoded->protocol);
-                    strncpy(signal->payload.message.protocol,
-                            proto_name ? proto_name : "Unknown",
-                            sizeof(signal->payload.message.protocol) - 1);
-                    signal->payload.message.address = decoded->address;
-                    signal->payload.message.command = decoded->command;
-                    snprintf(signal->name, sizeof(signal->name), "Learned_%.20s",
-                             signal->payload.message.protocol);
-
-                    ESP_LOGI(TAG, "Decoded: %s addr=0x%lx cmd=0x%lx",
+                    uint32_t latency_us = (uint32_t)esp_timer_get_time() - edges[i];
+                    ir_rx_fill_decoded(signal, decoded);
+                    // repeats and trailers of this signal are not a new one
+                    infrared_edge_seg_resync(&ir_seg, edges[i]);
+                    infrared_decoder_reset(ir_decoder);
+                    ESP_LOGI(TAG, "Decoded: %s addr=0x%lx cmd=0x%lx (%lu us after its last edge)",
                              signal->payload.message.protocol,
                              (unsigned long)signal->payload.message.address,
-                             (unsigned long)signal->payload.message.command);
-
-                    return true;
+                             (unsigned long)signal->payload.message.command,
+                             (unsigned long)latency_us);
+                    got = true;
                 }
             }
-
-            // Fallback: store as raw signal
-            ESP_LOGI(TAG, "Storing as raw signal");
-            memset(signal, 0, sizeof(*signal));
-            signal->is_raw = true;
-            signal->payload.raw.frequency = 38000;
-            signal->payload.raw.duty_cycle = 0.33f;
-            signal->payload.raw.timings_size = timing_count;
-            signal->payload.raw.timings = malloc(timing_count * sizeof(uint32_t));
-
-            if (!signal->payload.raw.timings) {
-                ESP_LOGE(TAG, "Failed to allocate memory for raw timings");
-                return false;
-            }
-
-            memcpy(signal->payload.raw.timings, timings, timing_count * sizeof(uint32_t));
-            snprintf(signal->name, sizeof(signal->name), "Raw_IR");
-
-            ESP_LOGI(TAG, "Raw signal stored: %zu timings", timing_count);
-            return true;
         }
 
-        // Wait a bit before checking again
-        vTaskDelay(pdMS_TO_TICKS(10));
+        if (!got && infrared_edge_seg_expired(&ir_seg, (uint32_t)esp_timer_get_time())) {
+            got = ir_rx_finish_signal(signal);
+        }
     }
 
-    return false;
+    ir_rx_listening = false;
+    return got;
 }
 
 // Stubs for compatibility (no longer needed with GPIO approach)
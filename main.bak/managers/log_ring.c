@@ -0,0 +1,78 @@
+#include "managers/log_ring.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MIN_(a, b) ((a) < (b) ? (a) : (b))
+
+void log_ring_append(log_ring_t *ring, const char *msg, size_t len) {
+    if (len == 0) return;
+    if (len >= LOG_RING_SIZE) {
+        // keep the end of an oversized message
+        msg += len - (LOG_RING_SIZE - 1);
+        len = LOG_RING_SIZE - 1;
+    }
+
+    // drop whole lines from the tail until the message fits
+    uint32_t min_tail = ring->head + (uint32_t)len - LOG_RING_SIZE;
+    if ((int32_t)(min_tail - ring->tail) > 0) {
+        uint32_t t = min_tail;
+        while (t != ring->head && ring->buf[(t - 1) & LOG_RING_MASK] != '\n') t++;
+        ring->tail = t;
+    }
+
+    uint32_t idx = ring->head & LOG_RING_MASK;
+    size_t first = MIN_(len, (size_t)(LOG_RING_SIZE - idx));
+    memcpy(ring->buf + idx, msg, first);
+    memcpy(ring->buf, msg + first, len - first);
+    ring->head += (uint32_t)len;
+}
+
+size_t log_ring_read_since(const log_ring_t *ring, uint32_t *cursor, uint32_t end, char *out,
+                           size_t max, uint32_t *dropped) {
+    *dropped = 0;
+    uint32_t pos = *cursor;
+    if ((int32_t)(pos - ring->head) > 0) {
+        pos = ring->tail; // cursor from before a reboot
+    } else if ((int32_t)(ring->tail - pos) > 0) {
+        *dropped = ring->tail - pos;
+        pos = ring->tail;
+    }
+
+    if ((int32_t)(end - ring->head) > 0) end = ring->head;
+    size_t avail = (int32_t)(end - pos) > 0 ? (size_t)(end - pos) : 0;
+    size_t n = MIN_(avail, max);
+    if (n < avail) {
+        size_t cut = n;
+        while (cut > 0 && ring->buf[(pos + cut - 1) & LOG_RING_MASK] != '\n') cut--;
+        if (cut > 0) n = cut;
+    }
+    uint32_t idx = pos & LOG_RING_MASK;
+    size_t first = MIN_(n, (size_t)(LOG_RING_SIZE - idx));
+    memcpy(out, ring->buf + idx, first);
+    memcpy(out + first, ring->buf, n - first);
+    *cursor = pos + (uint32_t)n;
+    return n;
+}
+
+size_t log_sse_format(const char *text, size_t len, size_t *used, uint32_t start,
+                      uint32_t dropped, char *out, size_t out_len) {
+    size_t o = 0;
+    if (dropped) {
+        o += snprintf(out, out_len, "event: gap\ndata: %lu\n\n", (unsigned long)dropped);
+    }
+    size_t i = 0;
+    while (i < len) {
+        const char *nl = memchr(text + i, '\n', len - i);
+        size_t line = nl ? (size_t)(nl - (text + i)) : len - i;
+        if (o + 6 + line + 1 + LOG_SSE_ID_MAX > out_len) break;
+        memcpy(out + o, "data: ", 6);
+        memcpy(out + o + 6, text + i, line);
+        o += 6 + line;
+        out[o++] = '\n';
+        i += line + (nl ? 1 : 0);
+    }
+    *used = i;
+    o += snprintf(out + o, out_len - o, "id: %lu\n\n", (unsigned long)(start + i));
+    return o;
+}
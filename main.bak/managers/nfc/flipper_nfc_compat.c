@@ -1,4 +1,6 @@
 #include "managers/nfc/flipper_nfc_compat.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
 
 static const char* TAG = "FlipperCompat";
 
@@ -6,71 +8,170 @@ static const char* TAG = "FlipperCompat";
 // FuriString Implementation
 // --------------------------------------------------------------------------
 
+#define FURI_STRING_MIN_CAP 32
+#define FURI_STRING_ARENA_ALIGN 8
+
+typedef struct FuriStringArenaBlock {
+    struct FuriStringArenaBlock* next;
+    size_t size;
+    size_t used;
+    uint8_t mem[];
+} FuriStringArenaBlock;
+
+struct FuriStringArena {
+    FuriStringArenaBlock* blocks; // newest first, only the head is bumped
+    size_t block_size;
+    size_t used;
+};
+
+// per task, so parses on different tasks never share an arena
+static __thread FuriStringArena* s_current_arena = NULL;
+static char s_empty[1] = "";
+
+FuriStringArena* furi_string_arena_alloc(size_t block_size) {
+    FuriStringArena* arena = calloc(1, sizeof(FuriStringArena));
+    if (arena) arena->block_size = block_size ? block_size : 1024;
+    return arena;
+}
+
+void furi_string_arena_free(FuriStringArena* arena) {
+    if (!arena) return;
+    FuriStringArenaBlock* b = arena->blocks;
+    while (b) {
+        FuriStringArenaBlock* next = b->next;
+        free(b);
+        b = next;
+    }
+    free(arena);
+}
+
+FuriStringArena* furi_string_arena_set_current(FuriStringArena* arena) {
+    FuriStringArena* prev = s_current_arena;
+    s_current_arena = arena;
+    return prev;
+}
+
+size_t furi_string_arena_used(const FuriStringArena* arena) {
+    return arena ? arena->used : 0;
+}
+
+static void* arena_alloc(FuriStringArena* arena, size_t size) {
+    size = (size + FURI_STRING_ARENA_ALIGN - 1) & ~(size_t)(FURI_STRING_ARENA_ALIGN - 1);
+    FuriStringArenaBlock* b = arena->blocks;
+    if (!b || b->size - b->used < size) {
+        size_t block = size > arena->block_size ? size : arena->block_size;
+        b = malloc(sizeof(FuriStringArenaBlock) + block);
+        if (!b) return NULL;
+        b->size = block;
+        b->used = 0;
+        b->next = arena->blocks;
+        arena->blocks = b;
+    }
+    void* p = b->mem + b->used;
+    b->used += size;
+    arena->used += size;
+    return p;
+}
+
+// grow the newest arena allocation in place; true if p was it and it fits
+static bool arena_extend(FuriStringArena* arena, void* p, size_t old_size, size_t new_size) {
+    FuriStringArenaBlock* b = arena->blocks;
+    old_size = (old_size + FURI_STRING_ARENA_ALIGN - 1) & ~(size_t)(FURI_STRING_ARENA_ALIGN - 1);
+    new_size = (new_size + FURI_STRING_ARENA_ALIGN - 1) & ~(size_t)(FURI_STRING_ARENA_ALIGN - 1);
+    if (!b || (uint8_t*)p + old_size != b->mem + b->used) return false;
+    if (b->used - old_size + new_size > b->size) return false;
+    b->used += new_size - old_size;
+    arena->used += new_size - old_size;
+    return true;
+}
+
+bool furi_string_reserve(FuriString* str, size_t len) {
+    if (!str) return false;
+    if (len < str->cap) return true;
+
+    size_t new_cap = str->cap ? str->cap * 2 : FURI_STRING_MIN_CAP;
+    while (new_cap <= len) new_cap *= 2;
+
+    char* new_data;
+    if (str->arena) {
+        if (str->cap && arena_extend(str->arena, str->data, str->cap, new_cap)) {
+            str->cap = new_cap;
+            return true;
+        }
+        // the old block stays in the arena until it is freed
+        new_data = arena_alloc(str->arena, new_cap);
+        if (new_data) memcpy(new_data, str->data, str->len + 1);
+    } else {
+        new_data = realloc(str->cap ? str->data : NULL, new_cap);
+        if (new_data && !str->cap) new_data[0] = '\0';
+    }
+    if (!new_data) return false;
+    str->data = new_data;
+    str->cap = new_cap;
+    return true;
+}
+
 FuriString* furi_string_alloc(void) {
-    FuriString* s = (FuriString*)malloc(sizeof(FuriString));
+    FuriStringArena* arena = s_current_arena;
+    FuriString* s = arena ? arena_alloc(arena, sizeof(FuriString)) : malloc(sizeof(FuriString));
     if (s) {
-        s->data = strdup("");
+        s->data = s_empty;
         s->len = 0;
-        s->cap = 1;
+        s->cap = 0;
+        s->arena = arena;
     }
     return s;
 }
 
 void furi_string_free(FuriString* str) {
-    if (!str) return;
-    if (str->data) free(str->data);
+    if (!str || str->arena) return;
+    if (str->cap) free(str->data);
     free(str);
 }
 
 void furi_string_reset(FuriString* str) {
     if (!str) return;
-    if (str->data) free(str->data);
-    str->data = strdup("");
+    // keep the capacity, the string is usually refilled right away
     str->len = 0;
-    str->cap = 1;
+    if (str->cap) str->data[0] = '\0';
+}
+
+static void furi_string_cat_vprintf(FuriString* str, const char* fmt, va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+    size_t room = str->cap ? str->cap - str->len : 0;
+    int n = vsnprintf(room ? str->data + str->len : NULL, room, fmt, copy);
+    va_end(copy);
+    if (n <= 0) return;
+
+    if ((size_t)n >= room) {
+        // too short: grow once and format again
+        if (!furi_string_reserve(str, str->len + n)) {
+            if (room) str->data[str->len] = '\0';
+            return;
+        }
+        vsnprintf(str->data + str->len, str->cap - str->len, fmt, args);
+    }
+    str->len += n;
 }
 
 void furi_string_printf(FuriString* str, const char* fmt, ...) {
     if (!str) return;
-    if (str->data) free(str->data);
-    
+    furi_string_reset(str);
+
     va_list args;
     va_start(args, fmt);
-    int len = vasprintf(&str->data, fmt, args);
+    furi_string_cat_vprintf(str, fmt, args);
     va_end(args);
-
-    if (len < 0) {
-        // allocation failed
-        str->data = strdup("");
-        str->len = 0;
-        str->cap = 1;
-    } else {
-        str->len = len;
-        str->cap = len + 1;
-    }
 }
 
 void furi_string_cat_printf(FuriString* str, const char* fmt, ...) {
     if (!str) return;
-    
+
     va_list args;
     va_start(args, fmt);
-    char* append_str = NULL;
-    int append_len = vasprintf(&append_str, fmt, args);
+    furi_string_cat_vprintf(str, fmt, args);
     va_end(args);
-
-    if (append_len > 0) {
-        size_t new_len = str->len + append_len;
-        char* new_data = (char*)realloc(str->data, new_len + 1);
-        if (new_data) {
-            str->data = new_data;
-            memcpy(str->data + str->len, append_str, append_len);
-            str->len = new_len;
-            str->data[str->len] = '\0';
-            str->cap = new_len + 1;
-        }
-    }
-    if (append_str) free(append_str);
 }
 
 const char* furi_string_get_cstr(const FuriString* str) {
@@ -80,35 +181,33 @@ const char* furi_string_get_cstr(const FuriString* str) {
 void furi_string_set_str(FuriString* str, const char* cstr) {
     if(!str) return;
     if(!cstr) cstr = "";
-    if(str->data) free(str->data);
     size_t len = strlen(cstr);
-    str->data = (char*)malloc(len + 1);
-    if(!str->data) {
-        str->len = 0;
-        str->cap = 0;
-        return;
-    }
+    furi_string_reset(str);
+    if(len == 0 || !furi_string_reserve(str, len)) return;
     memcpy(str->data, cstr, len + 1);
     str->len = len;
-    str->cap = len + 1;
 }
 
 void furi_string_cat_str(FuriString* dst, const char* cstr) {
     if(!dst || !cstr) return;
     size_t add_len = strlen(cstr);
     if(add_len == 0) return;
-    size_t new_len = dst->len + add_len;
-    char* new_data = (char*)realloc(dst->data, new_len + 1);
-    if(!new_data) return;
-    memcpy(new_data + dst->len, cstr, add_len);
-    new_data[new_len] = '\0';
-    dst->data = new_data;
-    dst->len = new_len;
-    dst->cap = new_len + 1;
+    if(!furi_string_reserve(dst, dst->len + add_len)) return;
+    memcpy(dst->data + dst->len, cstr, add_len + 1);
+    dst->len += add_len;
 }
 
 void furi_string_cat(FuriString* dst, const FuriString* src) {
     if(!dst || !src) return;
+    if(dst == src) {
+        // growing would free the text being appended
+        size_t len = dst->len;
+        if(len == 0 || !furi_string_reserve(dst, len * 2)) return;
+        memcpy(dst->data + len, dst->data, len);
+        dst->len = len * 2;
+        dst->data[dst->len] = '\0';
+        return;
+    }
     furi_string_cat_str(dst, furi_string_get_cstr(src));
 }
 
@@ -122,13 +221,7 @@ FuriString* furi_string_alloc_set_str(const char* cstr) {
 
 void furi_string_push_back(FuriString* str, char c) {
     if (!str) return;
-    if (str->len + 2 > str->cap) {
-        size_t new_cap = (str->len + 2) * 2;
-        char* new_data = realloc(str->data, new_cap);
-        if (!new_data) return;
-        str->data = new_data;
-        str->cap = new_cap;
-    }
+    if (!furi_string_reserve(str, str->len + 1)) return;
     str->data[str->len++] = c;
     str->data[str->len] = '\0';
 }
@@ -168,6 +261,13 @@ void bit_lib_num_to_bytes_be(uint64_t value, size_t len, uint8_t* out) {
     }
 }
 
+void bit_lib_num_to_bytes_le(uint64_t value, size_t len, uint8_t* out) {
+    if(!out) return;
+    for(size_t i = 0; i < len; i++) {
+        out[i] = (uint8_t)((value >> (8U * i)) & 0xFFU);
+    }
+}
+
 uint64_t bit_lib_bytes_to_num_bcd(const uint8_t* bytes, size_t len, bool* is_bcd) {
     uint64_t result = 0;
     bool valid = true;
@@ -183,35 +283,167 @@ uint64_t bit_lib_bytes_to_num_bcd(const uint8_t* bytes, size_t len, bool* is_bcd
     return result;
 }
 
+// bits are numbered from the msb of data[0]. a field of up to 64 bits spans
+// at most 9 bytes: the first 8 are loaded as one big endian word and shifted
+// into place, the 9th only tops up the low bits.
+static inline uint64_t bit_lib_load_be(const uint8_t* p, size_t n) {
+    uint64_t v = 0;
+    memcpy(&v, p, n); // p[0] lands in the lowest address
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    v = __builtin_bswap64(v);
+#else
+    // already big endian, p[0] is the top byte
+#endif
+    return v;
+}
+
+uint64_t bit_lib_get_bits_64(const uint8_t* data, size_t position, uint8_t length) {
+    if (!data || length == 0 || length > 64) return 0;
+
+    const uint8_t* p = data + position / 8;
+    uint8_t shift = position % 8;
+    size_t nbytes = (shift + length + 7U) / 8U;
+
+    uint64_t word = bit_lib_load_be(p, nbytes > 8 ? 8 : nbytes) << shift;
+    if (nbytes > 8) {
+        word |= p[8] >> (8 - shift);
+    }
+    return word >> (64 - length);
+}
+
+uint32_t bit_lib_get_bits_32(const uint8_t* data, size_t position, uint8_t length) {
+    if (length > 32) return 0;
+    return (uint32_t)bit_lib_get_bits_64(data, position, length);
+}
+
+uint16_t bit_lib_get_bits_16(const uint8_t* data, size_t position, uint8_t length) {
+    if (length > 16) return 0;
+    return (uint16_t)bit_lib_get_bits_64(data, position, length);
+}
+
 uint8_t bit_lib_get_bits(const uint8_t* data, size_t position, uint8_t length) {
     if (!data || length == 0 || length > 8) return 0;
-    uint64_t result = bit_lib_get_bits_64(data, position, length);
-    return (uint8_t)result;
+    // two bytes always cover an 8 bit field
+    uint8_t shift = position % 8;
+    const uint8_t* p = data + position / 8;
+    uint16_t word = (uint16_t)(p[0] << 8);
+    if (shift + length > 8) word |= p[1];
+    return (uint8_t)((uint16_t)(word << shift) >> (16 - length));
 }
 
-uint32_t bit_lib_get_bits_32(const uint8_t* data, size_t position, uint8_t length) {
-    if (!data || length == 0 || length > 32) return 0;
-    uint64_t result = bit_lib_get_bits_64(data, position, length);
-    return (uint32_t)result;
+bool bit_lib_get_bit(const uint8_t* data, size_t position) {
+    return (data[position / 8] >> (7 - position % 8)) & 1;
 }
 
-uint64_t bit_lib_get_bits_64(const uint8_t* data, size_t position, uint8_t length) {
-    if (!data || length == 0 || length > 64) return 0;
-    
-    uint64_t result = 0;
-    size_t byte_index = position / 8;
-    uint8_t bit_offset = position % 8;
-    
-    for (uint8_t i = 0; i < length; i++) {
-        size_t current_byte = byte_index + ((bit_offset + i) / 8);
-        uint8_t current_bit = (bit_offset + i) % 8;
-        
-        if (data[current_byte] & (1 << current_bit)) {
-            result |= (1ULL << i);
+void bit_lib_set_bit(uint8_t* data, size_t position, bool bit) {
+    uint8_t mask = (uint8_t)(0x80U >> (position % 8));
+    if (bit) {
+        data[position / 8] |= mask;
+    } else {
+        data[position / 8] &= (uint8_t)~mask;
+    }
+}
+
+// write the low length bits of value, length up to 57 so the field fits one
+// 64 bit window
+static void bit_lib_put_bits(uint8_t* data, size_t position, uint64_t value, uint8_t length) {
+    uint8_t* p = data + position / 8;
+    uint8_t shift = position % 8;
+    size_t nbytes = (shift + length + 7U) / 8U;
+    uint8_t tmp[8];
+
+    uint64_t mask = ((1ULL << length) - 1) << (64 - shift - length);
+    uint64_t word = bit_lib_load_be(p, nbytes);
+    word = (word & ~mask) | ((value << (64 - shift - length)) & mask);
+    for (size_t i = 0; i < nbytes; i++) {
+        tmp[i] = (uint8_t)(word >> (56 - 8 * i));
+    }
+    memcpy(p, tmp, nbytes);
+}
+
+void bit_lib_set_bits(uint8_t* data, size_t position, uint8_t byte, uint8_t length) {
+    if (!data || length == 0 || length > 8) return;
+    bit_lib_put_bits(data, position, byte, length);
+}
+
+uint8_t bit_lib_reverse_8_fast(uint8_t byte) {
+    byte = (uint8_t)((byte & 0xF0U) >> 4 | (byte & 0x0FU) << 4);
+    byte = (uint8_t)((byte & 0xCCU) >> 2 | (byte & 0x33U) << 2);
+    byte = (uint8_t)((byte & 0xAAU) >> 1 | (byte & 0x55U) << 1);
+    return byte;
+}
+
+uint16_t bit_lib_reverse_16_fast(uint16_t data) {
+    data = (uint16_t)((data & 0xFF00U) >> 8 | (data & 0x00FFU) << 8);
+    data = (uint16_t)((data & 0xF0F0U) >> 4 | (data & 0x0F0FU) << 4);
+    data = (uint16_t)((data & 0xCCCCU) >> 2 | (data & 0x3333U) << 2);
+    data = (uint16_t)((data & 0xAAAAU) >> 1 | (data & 0x5555U) << 1);
+    return data;
+}
+
+uint32_t bit_lib_reverse_32_fast(uint32_t data) {
+    data = __builtin_bswap32(data);
+    data = (data & 0xF0F0F0F0U) >> 4 | (data & 0x0F0F0F0FU) << 4;
+    data = (data & 0xCCCCCCCCU) >> 2 | (data & 0x33333333U) << 2;
+    data = (data & 0xAAAAAAAAU) >> 1 | (data & 0x55555555U) << 1;
+    return data;
+}
+
+void bit_lib_reverse_bits(uint8_t* data, size_t position, uint8_t length) {
+    if (!data || length < 2) return;
+    if (length <= 32) {
+        uint32_t v = bit_lib_get_bits_32(data, position, length);
+        v = bit_lib_reverse_32_fast(v) >> (32 - length);
+        bit_lib_put_bits(data, position, v, length);
+        return;
+    }
+    // longer runs: swap bits pairwise from both ends
+    for (size_t i = 0, j = length - 1U; i < j; i++, j--) {
+        bool a = bit_lib_get_bit(data, position + i);
+        bool b = bit_lib_get_bit(data, position + j);
+        bit_lib_set_bit(data, position + i, b);
+        bit_lib_set_bit(data, position + j, a);
+    }
+}
+
+bool bit_lib_test_parity_32(uint32_t bits, BitLibParity parity) {
+    switch (parity) {
+    case BitLibParityEven:
+        return __builtin_parity(bits);
+    case BitLibParityOdd:
+        return !__builtin_parity(bits);
+    default:
+        return false;
+    }
+}
+
+bool bit_lib_test_parity(
+    const uint8_t* bits,
+    size_t position,
+    uint8_t length,
+    BitLibParity parity,
+    uint8_t parity_length) {
+    if (!bits || parity_length == 0 || parity_length > 32 || length % parity_length) return false;
+
+    for (uint8_t i = 0; i < length / parity_length; i++) {
+        size_t block_pos = position + (size_t)i * parity_length;
+        switch (parity) {
+        case BitLibParityEven:
+        case BitLibParityOdd:
+            if (bit_lib_test_parity_32(
+                   bit_lib_get_bits_32(bits, block_pos, parity_length), parity)) {
+                return false;
+            }
+            break;
+        case BitLibParityAlways0:
+            if (bit_lib_get_bit(bits, block_pos + parity_length - 1)) return false;
+            break;
+        case BitLibParityAlways1:
+            if (!bit_lib_get_bit(bits, block_pos + parity_length - 1)) return false;
+            break;
         }
     }
-    
-    return result;
+    return true;
 }
 
 // --------------------------------------------------------------------------
@@ -429,6 +661,13 @@ const uint8_t* mf_classic_get_uid(const MfClassicData* data, size_t* uid_len) {
     return data->uid;
 }
 
+uint64_t mf_classic_get_sector_key(const MfClassicData* data, uint8_t sector, MfClassicKeyType key_type) {
+    const MfClassicSectorTrailer* sec_tr = mf_classic_get_sector_trailer_by_sector(data, sector);
+    if (!sec_tr) return 0;
+    const MfClassicKey* key = key_type == MfClassicKeyTypeB ? &sec_tr->key_b : &sec_tr->key_a;
+    return bit_lib_bytes_to_num_be(key->data, sizeof(key->data));
+}
+
 bool mf_classic_is_card_read(const MfClassicData* data) {
     if(!data) return false;
     for(size_t i = 0; i < sizeof(data->block_read_mask); i++) {
@@ -472,34 +711,57 @@ extern const NfcSupportedCardsPlugin umarsh_plugin;
 extern const NfcSupportedCardsPlugin zolotaya_korona_plugin;
 extern const NfcSupportedCardsPlugin zolotaya_korona_online_plugin;
 
-// Registry array
-static const NfcSupportedCardsPlugin* s_plugins[] = {
-    &smartrider_plugin,
-    &aime_plugin,
-    &csc_plugin,
-    &washcity_plugin,
-    &metromoney_plugin,
-    &bip_plugin,
-    &charliecard_plugin,
-    &disney_infinity_plugin,
-    &hi_plugin,
-    &hid_plugin,
-    &hworld_plugin,
-    &kazan_plugin,
-    &microel_plugin,
-    &mizip_plugin,
-    &plantain_plugin,
-    &saflok_plugin,
-    &skylanders_plugin,
-    &social_moscow_plugin,
-    &troika_plugin,
-    &two_cities_plugin,
-    &umarsh_plugin,
-    &zolotaya_korona_plugin,
-    &zolotaya_korona_online_plugin,
-    NULL
+typedef struct {
+    const char* name;
+    const NfcSupportedCardsPlugin* plugin;
+} FlipperNfcParser;
+
+#define FLIPPER_NFC_PARSER(n) {#n, &n##_plugin}
+
+// tried in this order, first successful parse wins
+static const FlipperNfcParser s_parsers[] = {
+    FLIPPER_NFC_PARSER(smartrider),
+    FLIPPER_NFC_PARSER(aime),
+    FLIPPER_NFC_PARSER(csc),
+    FLIPPER_NFC_PARSER(washcity),
+    FLIPPER_NFC_PARSER(metromoney),
+    FLIPPER_NFC_PARSER(bip),
+    FLIPPER_NFC_PARSER(charliecard),
+    FLIPPER_NFC_PARSER(disney_infinity),
+    FLIPPER_NFC_PARSER(hi),
+    FLIPPER_NFC_PARSER(hid),
+    FLIPPER_NFC_PARSER(hworld),
+    FLIPPER_NFC_PARSER(kazan),
+    FLIPPER_NFC_PARSER(microel),
+    FLIPPER_NFC_PARSER(mizip),
+    FLIPPER_NFC_PARSER(plantain),
+    FLIPPER_NFC_PARSER(saflok),
+    FLIPPER_NFC_PARSER(skylanders),
+    FLIPPER_NFC_PARSER(social_moscow),
+    FLIPPER_NFC_PARSER(troika),
+    FLIPPER_NFC_PARSER(two_cities),
+    FLIPPER_NFC_PARSER(umarsh),
+    FLIPPER_NFC_PARSER(zolotaya_korona),
+    FLIPPER_NFC_PARSER(zolotaya_korona_online),
 };
 
+// the nfc view, chameleon and the mfc reader can all be parsing at once
+static FlipperNfcParserStats s_parser_stats[COUNT_OF(s_parsers)];
+static portMUX_TYPE s_parser_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+size_t flipper_nfc_parser_count(void) {
+    return COUNT_OF(s_parsers);
+}
+
+bool flipper_nfc_get_parser_stats(size_t index, FlipperNfcParserStats* stats) {
+    if (index >= COUNT_OF(s_parsers) || !stats) return false;
+    portENTER_CRITICAL(&s_parser_stats_mux);
+    *stats = s_parser_stats[index];
+    portEXIT_CRITICAL(&s_parser_stats_mux);
+    stats->name = s_parsers[index].name;
+    return true;
+}
+
 char* flipper_nfc_try_parse_mfclassic_from_cache(const MfClassicData* data) {
     if (!data) return NULL;
     if (data->uid_len == 0) return NULL;
@@ -509,22 +771,59 @@ char* flipper_nfc_try_parse_mfclassic_from_cache(const MfClassicData* data) {
     dev.protocol = NfcProtocolMfClassic;
     dev.data = (void*)data; // We cast away const, but pure parsers shouldn't mutate
 
-    for (int i = 0; s_plugins[i] != NULL; i++) {
-        const NfcSupportedCardsPlugin* p = s_plugins[i];
-        if (p->protocol == NfcProtocolMfClassic && p->parse) {
-            FuriString* out = furi_string_alloc();
-            if (p->parse(&dev, out)) {
-                // Success
-                const char* res = furi_string_get_cstr(out);
-                char* result_copy = NULL;
-                if (res && strlen(res) > 0) {
-                    result_copy = strdup(res);
-                }
-                furi_string_free(out);
-                return result_copy;
+    // every string the parsers build comes from one arena and goes in one
+    // free; without it (out of memory) they fall back to the heap. it is
+    // only set up once some parser gets past its quick check.
+    FuriStringArena* arena = NULL;
+    FuriStringArena* prev = NULL;
+    char* result_copy = NULL;
+
+    for (size_t i = 0; i < COUNT_OF(s_parsers); i++) {
+        const NfcSupportedCardsPlugin* p = s_parsers[i].plugin;
+        if (p->protocol != NfcProtocolMfClassic || !p->parse) continue;
+
+        bool candidate = !p->quick_check || p->quick_check(data);
+        bool parsed = false;
+        uint64_t parse_us = 0;
+        FuriString* out = NULL;
+        if (candidate) {
+            if (!arena) {
+                arena = furi_string_arena_alloc(1024);
+                prev = furi_string_arena_set_current(arena);
             }
-            furi_string_free(out);
+            out = furi_string_alloc();
+            if (out) {
+                int64_t start_us = esp_timer_get_time();
+                parsed = p->parse(&dev, out);
+                parse_us = (uint64_t)(esp_timer_get_time() - start_us);
+            }
+        }
+
+        portENTER_CRITICAL(&s_parser_stats_mux);
+        FlipperNfcParserStats* stats = &s_parser_stats[i];
+        stats->checked++;
+        if (candidate && out) {
+            stats->candidates++;
+            stats->parse_us += parse_us;
+            if (parsed) stats->matches++;
         }
+        portEXIT_CRITICAL(&s_parser_stats_mux);
+
+        if (!candidate) continue;
+        if (!out) break;
+        if (parsed) {
+            const char* res = furi_string_get_cstr(out);
+            if (res && strlen(res) > 0) {
+                result_copy = strdup(res);
+            }
+            ESP_LOGD(TAG, "parsed by %s", s_parsers[i].name);
+        }
+        furi_string_free(out);
+        if (parsed) break;
     }
-    return NULL;
+
+    if (!arena) return NULL;
+    furi_string_arena_set_current(prev);
+    furi_string_arena_free(arena);
+    return result_copy;
 }
@@ -142,12 +142,18 @@ static bool aime_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool aime_quick_check(const MfClassicData* data) {
+    return mf_classic_get_sector_key(data, 0, MfClassicKeyTypeA) == aime_key &&
+           memcmp(data->block[1].data, "SBSD", 4) == 0;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin aime_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = aime_verify,
     .read = aime_read,
     .parse = aime_parse,
+    .quick_check = aime_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
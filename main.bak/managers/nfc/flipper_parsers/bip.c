@@ -319,12 +319,19 @@ static bool bip_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool bip_quick_check(const MfClassicData* data) {
+    return data->type == MfClassicType1k &&
+           mf_classic_get_sector_key(data, 0, MfClassicKeyTypeA) == bip_1k_keys[0].a &&
+           mf_classic_get_sector_key(data, 0, MfClassicKeyTypeB) == bip_1k_keys[0].b;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin bip_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = bip_verify,
     .read = bip_read,
     .parse = bip_parse,
+    .quick_check = bip_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -1248,12 +1248,19 @@ static bool charliecard_read(Nfc* nfc, NfcDevice* device) {
     return is_read;
 }
 
+static bool charliecard_quick_check(const MfClassicData* data) {
+    return data->type == MfClassicType1k &&
+           mf_classic_get_sector_key(data, 3, MfClassicKeyTypeA) == charliecard_1k_keys[3].a &&
+           mf_classic_get_sector_key(data, 3, MfClassicKeyTypeB) == charliecard_1k_keys[3].b;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin charliecard_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = charliecard_verify,
     .read = charliecard_read,
     .parse = charliecard_parse,
+    .quick_check = charliecard_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
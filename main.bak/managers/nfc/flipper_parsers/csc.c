@@ -121,12 +121,19 @@ bool csc_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool csc_quick_check(const MfClassicData* data) {
+    if(data->type != MfClassicType1k) return false;
+    uint32_t value = bit_lib_bytes_to_num_le(data->block[4].data, 4);
+    return value != 0 && value == bit_lib_bytes_to_num_le(data->block[8].data, 4);
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin csc_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = csc_parse,
+    .quick_check = csc_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -98,12 +98,18 @@ static bool disney_infinity_parse(const NfcDevice* device, FuriString* parsed_da
     return parsed;
 }
 
+static bool disney_infinity_quick_check(const MfClassicData* data) {
+    // the key is a sha1 of the uid, leave that to parse
+    return data->uid_len >= UID_LEN;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin disney_infinity_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL, // Need UID to verify key(s)
     .read = disney_infinity_read,
     .parse = disney_infinity_parse,
+    .quick_check = disney_infinity_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -207,12 +207,18 @@ static bool hi_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool hi_quick_check(const MfClassicData* data) {
+    return data->type == MfClassicType1k &&
+           mf_classic_get_sector_key(data, 0, MfClassicKeyTypeB) == hi_1k_keys[0].b;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin hi_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hi_verify,
     .read = hi_read,
     .parse = hi_parse,
+    .quick_check = hi_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
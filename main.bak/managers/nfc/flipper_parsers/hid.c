@@ -126,12 +126,17 @@ static bool hid_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool hid_quick_check(const MfClassicData* data) {
+    return mf_classic_get_sector_key(data, 1, MfClassicKeyTypeA) == hid_key;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin hid_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hid_verify,
     .read = hid_read,
     .parse = hid_parse,
+    .quick_check = hid_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -219,12 +219,19 @@ bool hworld_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool hworld_quick_check(const MfClassicData* data) {
+    return data->type == MfClassicType1k &&
+           bit_lib_get_bits_64(data->block[ROOM_SECTOR_KEY_BLOCK].data, 0, 48) ==
+               hworld_standard_keys[ROOM_SECTOR].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin hworld_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = hworld_verify,
     .read = hworld_read,
     .parse = hworld_parse,
+    .quick_check = hworld_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
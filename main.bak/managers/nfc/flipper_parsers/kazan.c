@@ -386,12 +386,20 @@ static bool kazan_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool kazan_quick_check(const MfClassicData* data) {
+    uint64_t a = mf_classic_get_sector_key(data, 8, MfClassicKeyTypeA);
+    uint64_t b = mf_classic_get_sector_key(data, 8, MfClassicKeyTypeB);
+    return (a == kazan_1k_keys_v1[8].a || a == kazan_1k_keys_v2[8].a) &&
+           (b == kazan_1k_keys_v1[8].b || b == kazan_1k_keys_v2[8].b);
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin kazan_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = kazan_verify,
     .read = kazan_read,
     .parse = kazan_parse,
+    .quick_check = kazan_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -164,12 +164,17 @@ static bool metromoney_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool metromoney_quick_check(const MfClassicData* data) {
+    return mf_classic_get_sector_key(data, 1, MfClassicKeyTypeA) == metromoney_1k_keys[1].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin metromoney_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = metromoney_verify,
     .read = metromoney_read,
     .parse = metromoney_parse,
+    .quick_check = metromoney_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -205,6 +205,14 @@ static bool microel_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool microel_quick_check(const MfClassicData* data) {
+    if(data->uid_len != UID_LENGTH) return false;
+    uint8_t keyA[KEY_LENGTH];
+    generateKeyA(data->uid, UID_LENGTH, keyA);
+    return mf_classic_get_sector_key(data, verify_sector, MfClassicKeyTypeA) ==
+           bit_lib_bytes_to_num_be(keyA, KEY_LENGTH);
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin microel_plugin = {
     .protocol = NfcProtocolMfClassic,
@@ -212,6 +220,7 @@ const NfcSupportedCardsPlugin microel_plugin = {
         NULL, // the verification I need is based on verifying the keys generated via uid and try to authenticate not like on mizip that there is default b0 but added verify in read function
     .read = microel_read,
     .parse = microel_parse,
+    .quick_check = microel_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
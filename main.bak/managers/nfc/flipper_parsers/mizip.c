@@ -238,12 +238,20 @@ static bool mizip_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool mizip_quick_check(const MfClassicData* data) {
+    MizipCardConfig cfg = {};
+    if(!mizip_get_card_config(&cfg, data->type)) return false;
+    return mf_classic_get_sector_key(data, cfg.verify_sector, MfClassicKeyTypeB) ==
+           cfg.keys[cfg.verify_sector].b;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin mizip_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = mizip_verify,
     .read = mizip_read,
     .parse = mizip_parse,
+    .quick_check = mizip_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
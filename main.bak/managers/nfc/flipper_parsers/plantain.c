@@ -378,12 +378,20 @@ static bool plantain_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool plantain_quick_check(const MfClassicData* data) {
+    PlantainCardConfig cfg = {};
+    if(!plantain_get_card_config(&cfg, data->type)) return false;
+    return mf_classic_get_sector_key(data, cfg.data_sector, MfClassicKeyTypeA) ==
+           cfg.keys[cfg.data_sector].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin plantain_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = plantain_verify,
     .read = plantain_read,
     .parse = plantain_parse,
+    .quick_check = plantain_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -432,12 +432,19 @@ bool saflok_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool saflok_quick_check(const MfClassicData* data) {
+    return data->type == MfClassicType1k &&
+           mf_classic_get_sector_key(data, CHECK_SECTOR, MfClassicKeyTypeA) ==
+               saflok_1k_keys[CHECK_SECTOR].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin saflok_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = saflok_verify,
     .read = saflok_read,
     .parse = saflok_parse,
+    .quick_check = saflok_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
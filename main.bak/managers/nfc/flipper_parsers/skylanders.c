@@ -888,12 +888,18 @@ static bool skylanders_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool skylanders_quick_check(const MfClassicData* data) {
+    return mf_classic_get_sector_key(data, 0, MfClassicKeyTypeA) == skylanders_key &&
+           (data->block[1].data[0] | data->block[1].data[1]) != 0;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin skylanders_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = skylanders_verify,
     .read = skylanders_read,
     .parse = skylanders_parse,
+    .quick_check = skylanders_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
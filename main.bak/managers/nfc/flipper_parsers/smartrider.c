@@ -318,11 +318,17 @@ static bool smartrider_parse(const NfcDevice* device, FuriString* parsed_data) {
     return true;
 }
 
+static bool smartrider_quick_check(const MfClassicData* data) {
+    return data->type == MfClassicType1k &&
+           memcmp(mf_classic_get_sector_trailer_by_sector(data, 0)->key_a.data, STANDARD_KEYS[0], 6) == 0;
+}
+
 const NfcSupportedCardsPlugin smartrider_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = smartrider_verify,
     .read = smartrider_read,
     .parse = smartrider_parse,
+    .quick_check = smartrider_quick_check,
 };
 
 __attribute__((used)) const FlipperAppPluginDescriptor* smartrider_plugin_ep() {
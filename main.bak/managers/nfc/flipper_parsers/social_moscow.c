@@ -290,12 +290,22 @@ static bool social_moscow_parse(const NfcDevice* device, FuriString* parsed_data
     return parsed;
 }
 
+static bool social_moscow_quick_check(const MfClassicData* data) {
+    SocialMoscowCardConfig cfg = {};
+    if(!social_moscow_get_card_config(&cfg, data->type)) return false;
+    return mf_classic_get_sector_key(data, cfg.data_sector, MfClassicKeyTypeA) ==
+               cfg.keys[cfg.data_sector].a &&
+           mf_classic_get_sector_key(data, cfg.data_sector, MfClassicKeyTypeB) ==
+               cfg.keys[cfg.data_sector].b;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin social_moscow_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = social_moscow_verify,
     .read = social_moscow_read,
     .parse = social_moscow_parse,
+    .quick_check = social_moscow_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
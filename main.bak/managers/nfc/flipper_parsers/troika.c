@@ -195,12 +195,20 @@ static bool troika_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool troika_quick_check(const MfClassicData* data) {
+    TroikaCardConfig cfg = {};
+    if(!troika_get_card_config(&cfg, data->type)) return false;
+    return mf_classic_get_sector_key(data, cfg.data_sector, MfClassicKeyTypeA) ==
+           cfg.keys[cfg.data_sector].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin troika_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = troika_verify,
     .read = troika_read,
     .parse = troika_parse,
+    .quick_check = troika_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -164,12 +164,17 @@ static bool two_cities_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool two_cities_quick_check(const MfClassicData* data) {
+    return mf_classic_get_sector_key(data, 4, MfClassicKeyTypeA) == two_cities_4k_keys[4].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin two_cities_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = two_cities_verify,
     .read = two_cities_read,
     .parse = two_cities_parse,
+    .quick_check = two_cities_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -128,12 +128,20 @@ static bool umarsh_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool umarsh_quick_check(const MfClassicData* data) {
+    if(data->type != MfClassicType1k) return false;
+    const uint8_t* header = data->block[mf_classic_get_first_block_num_of_sector(8)].data;
+    return (uint32_t)(bit_lib_bytes_to_num_be(header, 4) + bit_lib_bytes_to_num_be(header + 4, 4)) ==
+           0xFFFFFFFF;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin umarsh_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = umarsh_parse,
+    .quick_check = umarsh_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
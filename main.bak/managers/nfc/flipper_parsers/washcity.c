@@ -169,12 +169,17 @@ static bool washcity_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static bool washcity_quick_check(const MfClassicData* data) {
+    return mf_classic_get_sector_key(data, 1, MfClassicKeyTypeA) == washcity_1k_keys[1].a;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin washcity_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = washcity_verify,
     .read = washcity_read,
     .parse = washcity_parse,
+    .quick_check = washcity_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
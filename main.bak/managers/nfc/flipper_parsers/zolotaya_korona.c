@@ -187,12 +187,18 @@ static bool zolotaya_korona_parse(const NfcDevice* device, FuriString* parsed_da
     return parsed;
 }
 
+static bool zolotaya_korona_quick_check(const MfClassicData* data) {
+    const uint8_t* block = data->block[mf_classic_get_first_block_num_of_sector(INFO_SECTOR_NUM)].data;
+    return memcmp(block, info_sector_signature, 16) == 0;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin zolotaya_korona_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = zolotaya_korona_parse,
+    .quick_check = zolotaya_korona_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
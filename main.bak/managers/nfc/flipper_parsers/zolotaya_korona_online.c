@@ -118,12 +118,20 @@ static bool zolotaya_korona_online_parse(const NfcDevice* device, FuriString* pa
     return parsed;
 }
 
+static bool zolotaya_korona_online_quick_check(const MfClassicData* data) {
+    const uint8_t* block =
+        data->block[mf_classic_get_first_block_num_of_sector(INFO_SECTOR_NUM)].data + 3;
+    bool is_bcd;
+    return bit_lib_bytes_to_num_bcd(block, 2, &is_bcd) == 9643 && is_bcd;
+}
+
 /* Actual implementation of app<>plugin interface */
 const NfcSupportedCardsPlugin zolotaya_korona_online_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = NULL,
     .read = NULL,
     .parse = zolotaya_korona_online_parse,
+    .quick_check = zolotaya_korona_online_quick_check,
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
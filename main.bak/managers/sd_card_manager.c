@@ -1,4 +1,5 @@
 #include "managers/sd_card_manager.h"
+#include "core/bus_arbiter.h"
 #include "core/utils.h"
 #include "driver/gpio.h"
 #include "driver/i2c.h"
@@ -61,6 +62,10 @@ static bool display_spi_suspend_for_sd(void) {
   if (!is_shared_display_sd_spi()) {
     return false;
   }
+#ifdef CONFIG_SD_SPI_BUS_ARBITER
+  /* both devices stay on the bus, the arbiter takes turns per chunk */
+  return false;
+#endif
   /* pause lvgl refresh to stop flush() while we steal the bus */
   lv_disp_t *disp = lv_disp_get_default();
   if (disp) {
@@ -99,10 +104,94 @@ static void display_spi_resume_after_sd(void) {
   s_display_spi_suspended_flag = false;
 }
 #else
+static inline bool is_shared_display_sd_spi(void) { return false; }
 static bool display_spi_suspend_for_sd(void) { return false; }
 static void display_spi_resume_after_sd(void) {}
 #endif
 
+#define SD_BUS_CHUNK 4096 /* bulk writes hand the bus over between chunks */
+
+static bus_client_t *s_bus_clients[BUS_CLASS_COUNT];
+#ifdef CONFIG_SD_SPI_BUS_ARBITER
+static bus_arbiter_t s_bus_arbiter;
+static volatile bool s_bus_arbiter_ready = false;
+static portMUX_TYPE s_bus_arbiter_init_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+bus_arbiter_t *sd_card_bus_arbiter(void) {
+#ifdef CONFIG_SD_SPI_BUS_ARBITER
+  if (s_bus_arbiter_ready) return &s_bus_arbiter;
+  if (!is_shared_display_sd_spi()) return NULL;
+  portENTER_CRITICAL(&s_bus_arbiter_init_mux);
+  if (!s_bus_arbiter_ready) {
+    bus_arbiter_init(&s_bus_arbiter);
+    s_bus_clients[BUS_CLASS_INTERACTIVE] =
+        bus_arbiter_register(&s_bus_arbiter, "display", BUS_CLASS_INTERACTIVE);
+    s_bus_clients[BUS_CLASS_BULK] = bus_arbiter_register(&s_bus_arbiter, "sd", BUS_CLASS_BULK);
+    s_bus_clients[BUS_CLASS_BACKGROUND] =
+        bus_arbiter_register(&s_bus_arbiter, "sd_stats", BUS_CLASS_BACKGROUND);
+    s_bus_arbiter_ready = true;
+  }
+  portEXIT_CRITICAL(&s_bus_arbiter_init_mux);
+  return &s_bus_arbiter;
+#else
+  return NULL;
+#endif
+}
+
+bus_client_t *sd_card_bus_client(bus_class_t cls) {
+  if (cls >= BUS_CLASS_COUNT || !sd_card_bus_arbiter()) return NULL;
+  return s_bus_clients[cls];
+}
+
+size_t sd_card_bus_fwrite(FILE *f, const void *data, size_t size) {
+  bus_arbiter_t *arb = sd_card_bus_arbiter();
+  if (!arb) return fwrite(data, 1, size, f);
+
+  bus_client_t *client = s_bus_clients[BUS_CLASS_BULK];
+  const uint8_t *p = data;
+  size_t done = 0;
+  bus_arbiter_acquire(arb, client);
+  while (done < size) {
+    size_t n = size - done < SD_BUS_CHUNK ? size - done : SD_BUS_CHUNK;
+    size_t w = fwrite(p + done, 1, n, f);
+    done += w;
+    if (w < n) break;
+    bus_arbiter_yield(arb, client);
+  }
+  bus_arbiter_release(arb, client);
+  return done;
+}
+
+void sd_card_bus_lock(void) {
+  bus_arbiter_acquire(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+}
+
+void sd_card_bus_unlock(void) {
+  bus_arbiter_release(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+}
+
+FILE *sd_card_bus_fopen(const char *path, const char *mode) {
+  sd_card_bus_lock();
+  FILE *f = fopen(path, mode);
+  sd_card_bus_unlock();
+  return f;
+}
+
+int sd_card_bus_fflush(FILE *f) {
+  sd_card_bus_lock();
+  int ret = fflush(f);
+  sd_card_bus_unlock();
+  return ret;
+}
+
+int sd_card_bus_fclose(FILE *f) {
+  sd_card_bus_lock();
+  int ret = fclose(f);
+  sd_card_bus_unlock();
+  return ret;
+}
+
 
 
 sd_card_manager_t sd_card_manager = { // Change this based on board config
@@ -138,7 +227,10 @@ static void sd_card_update_cached_stats(void) {
         return;
     }
     uint64_t total_bytes = 0, free_bytes = 0;
+    bus_client_t *bus = sd_card_bus_client(BUS_CLASS_BACKGROUND);
+    bus_arbiter_acquire(sd_card_bus_arbiter(), bus);
     esp_err_t ret = esp_vfs_fat_info("/mnt", &total_bytes, &free_bytes);
+    bus_arbiter_release(sd_card_bus_arbiter(), bus);
     if (ret == ESP_OK && total_bytes > 0) {
         uint64_t used_bytes = total_bytes - free_bytes;
         s_cached_stats.used_pct = (int)((used_bytes * 100) / total_bytes);
@@ -220,7 +312,7 @@ void list_files_recursive(const char *dirname, int level) {
 
   struct dirent *entry;
   while ((entry = readdir(dir)) != NULL) {
-    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
+    if (entry->d_name[0] == '.') {
       continue;
     }
     char path[512];
@@ -684,8 +776,11 @@ esp_err_t sd_card_mount_for_flush(bool *display_was_suspended) {
       if (display_was_suspended && *display_was_suspended) display_spi_resume_after_sd();
       return bus_ret;
     }
-    s_spi_bus_initialized = true;
-    s_spi_host_id = host_id;
+    /* a bus someone else initialized (the display) is not ours to free */
+    if (bus_ret == ESP_OK) {
+      s_spi_bus_initialized = true;
+      s_spi_host_id = host_id;
+    }
   }
 
   esp_vfs_fat_sdmmc_mount_config_t mount_config = {
@@ -785,7 +880,7 @@ esp_err_t sd_card_append_file(const char *path, const void *data, size_t size) {
     printf("Failed to open file for appending\n");
     return ESP_FAIL;
   }
-  fwrite(data, 1, size, f);
+  sd_card_bus_fwrite(f, data, size);
   fclose(f);
   printf("Data appended to file: %s\n", path);
   return ESP_OK;
@@ -802,7 +897,7 @@ esp_err_t sd_card_write_file(const char *path, const void *data, size_t size) {
     printf("Failed to open file for writing\n");
     return ESP_FAIL;
   }
-  fwrite(data, 1, size, f);
+  sd_card_bus_fwrite(f, data, size);
   fclose(f);
   printf("File written: %s\n", path);
   return ESP_OK;
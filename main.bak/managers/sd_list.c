@@ -0,0 +1,254 @@
+#include "managers/sd_list.h"
+
+#include <dirent.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include "esp_heap_caps.h"
+
+#define SD_LIST_PATH_MAX 512
+#define MIN_(a, b) ((a) < (b) ? (a) : (b))
+
+// small buffered writer so listings go out as chunks without a cJSON tree
+typedef struct {
+    sd_list_write_t write;
+    void *ctx;
+    size_t len;
+    esp_err_t err;
+    char buf[SD_LIST_CHUNK];
+} json_chunk_writer_t;
+
+static void jw_flush(json_chunk_writer_t *w) {
+    if (w->len && w->err == ESP_OK) w->err = w->write(w->ctx, w->buf, w->len);
+    w->len = 0;
+}
+
+static void jw_raw(json_chunk_writer_t *w, const char *s, size_t n) {
+    while (n && w->err == ESP_OK) {
+        if (w->len == sizeof(w->buf)) jw_flush(w);
+        size_t take = MIN_(n, sizeof(w->buf) - w->len);
+        memcpy(w->buf + w->len, s, take);
+        w->len += take;
+        s += take;
+        n -= take;
+    }
+}
+
+#define jw_lit(w, s) jw_raw(w, s, sizeof(s) - 1)
+
+static void jw_printf(json_chunk_writer_t *w, const char *fmt, ...) {
+    char tmp[96];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(tmp, sizeof(tmp), fmt, ap);
+    va_end(ap);
+    if (n > 0) jw_raw(w, tmp, MIN_((size_t)n, sizeof(tmp) - 1));
+}
+
+// quoted json string; utf-8 passes through, control chars are escaped
+static void jw_string(json_chunk_writer_t *w, const char *s) {
+    jw_lit(w, "\"");
+    const char *run = s;
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c >= 0x20 && c != '"' && c != '\\') continue;
+        jw_raw(w, run, s - run);
+        if (c == '"' || c == '\\') {
+            char esc[2] = {'\\', (char)c};
+            jw_raw(w, esc, 2);
+        } else {
+            jw_printf(w, "\\u%04x", c);
+        }
+        run = s + 1;
+    }
+    jw_raw(w, run, s - run);
+    jw_lit(w, "\"");
+}
+
+typedef struct {
+    uint32_t name_off;
+    uint8_t is_dir;
+} sd_list_entry_t;
+
+typedef struct {
+    sd_list_entry_t *entries;
+    size_t count, cap;
+    char *names;
+    size_t names_len, names_cap;
+    bool desc;
+} sd_list_t;
+
+static void *sd_list_realloc(void *ptr, size_t size) {
+    void *p = heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return p ? p : realloc(ptr, size);
+}
+
+static bool sd_list_push(sd_list_t *l, const char *name, bool is_dir) {
+    size_t nlen = strlen(name) + 1;
+    if (l->names_len + nlen + l->count * sizeof(sd_list_entry_t) > SD_LIST_SORT_MAX_BYTES) {
+        return false;
+    }
+    if (l->count == l->cap) {
+        size_t cap = l->cap ? l->cap * 2 : 64;
+        sd_list_entry_t *e = sd_list_realloc(l->entries, cap * sizeof(*e));
+        if (!e) return false;
+        l->entries = e;
+        l->cap = cap;
+    }
+    if (l->names_len + nlen > l->names_cap) {
+        size_t cap = l->names_cap ? l->names_cap * 2 : 1024;
+        while (cap < l->names_len + nlen) cap *= 2;
+        char *n = sd_list_realloc(l->names, cap);
+        if (!n) return false;
+        l->names = n;
+        l->names_cap = cap;
+    }
+    memcpy(l->names + l->names_len, name, nlen);
+    l->entries[l->count].name_off = (uint32_t)l->names_len;
+    l->entries[l->count].is_dir = is_dir;
+    l->names_len += nlen;
+    l->count++;
+    return true;
+}
+
+static sd_list_t *s_sort_list; // qsort has no context argument
+
+// folders first, then case-insensitive name
+static int sd_list_cmp(const void *a, const void *b) {
+    const sd_list_entry_t *ea = a, *eb = b;
+    if (ea->is_dir != eb->is_dir) return ea->is_dir ? -1 : 1;
+    int r = strcasecmp(s_sort_list->names + ea->name_off, s_sort_list->names + eb->name_off);
+    if (r == 0) r = strcmp(s_sort_list->names + ea->name_off, s_sort_list->names + eb->name_off);
+    return s_sort_list->desc ? -r : r;
+}
+
+// -1 unknown (needs stat), otherwise whether the entry is a directory
+static int sd_dirent_is_dir(const struct dirent *entry) {
+#ifdef DT_DIR
+    if (entry->d_type == DT_DIR) return 1;
+    if (entry->d_type == DT_REG) return 0;
+#endif
+    (void)entry;
+    return -1;
+}
+
+// skips ".", ".." and hidden files, like scan_directory in ap_manager.c
+static bool sd_entry_is_dir(const char *dir_path, const struct dirent *entry, bool *skip) {
+    *skip = entry->d_name[0] == '.';
+    if (*skip) return false;
+    int is_dir = sd_dirent_is_dir(entry);
+    if (is_dir >= 0) return is_dir;
+    char full_path[SD_LIST_PATH_MAX];
+    struct stat st;
+    snprintf(full_path, sizeof(full_path), "%s/%s", dir_path, entry->d_name);
+    if (stat(full_path, &st) != 0 || !(S_ISDIR(st.st_mode) || S_ISREG(st.st_mode))) {
+        *skip = true;
+        return false;
+    }
+    return S_ISDIR(st.st_mode);
+}
+
+static void sd_list_emit(json_chunk_writer_t *w, const char *dir_path, const char *name,
+                         bool is_dir, bool first) {
+    char full_path[SD_LIST_PATH_MAX];
+    snprintf(full_path, sizeof(full_path), "%s/%s", dir_path, name);
+    if (first) {
+        jw_lit(w, "{\"name\":");
+    } else {
+        jw_lit(w, ",{\"name\":");
+    }
+    jw_string(w, name);
+    if (is_dir) {
+        jw_lit(w, ",\"type\":\"folder\"}");
+        return;
+    }
+    // only the entries on this page pay for a stat
+    struct stat st;
+    jw_lit(w, ",\"type\":\"file\",\"path\":");
+    jw_string(w, full_path);
+    if (stat(full_path, &st) == 0) jw_printf(w, ",\"size\":%ld", (long)st.st_size);
+    jw_lit(w, "}");
+}
+
+esp_err_t sd_list_dir(const char *dir_path, const sd_list_opts_t *opts, sd_list_write_t write,
+                      void *ctx) {
+    uint32_t offset = opts->offset;
+    uint32_t limit = opts->limit;
+    if (limit == 0 || limit > SD_LIST_MAX_LIMIT) limit = SD_LIST_MAX_LIMIT;
+
+    DIR *dir = opendir(dir_path);
+    if (!dir) return ESP_ERR_NOT_FOUND;
+
+    json_chunk_writer_t *w = malloc(sizeof(*w));
+    if (!w) {
+        closedir(dir);
+        return ESP_ERR_NO_MEM;
+    }
+    w->write = write;
+    w->ctx = ctx;
+    w->len = 0;
+    w->err = ESP_OK;
+
+    sd_list_t list = {0};
+    list.desc = opts->desc;
+    uint32_t total = 0, emitted = 0;
+    struct dirent *entry;
+    bool skip;
+
+    if (opts->sorted) {
+        // sorting needs every name first; keep them in one arena, no stat
+        while ((entry = readdir(dir)) != NULL) {
+            bool is_dir = sd_entry_is_dir(dir_path, entry, &skip);
+            if (skip) continue;
+            if (!sd_list_push(&list, entry->d_name, is_dir)) {
+                closedir(dir);
+                free(list.entries);
+                free(list.names);
+                free(w);
+                return ESP_ERR_INVALID_SIZE;
+            }
+        }
+        closedir(dir);
+        s_sort_list = &list;
+        if (list.count > 1) qsort(list.entries, list.count, sizeof(list.entries[0]), sd_list_cmp);
+        s_sort_list = NULL;
+        total = (uint32_t)list.count;
+    }
+
+    jw_lit(w, "{\"path\":");
+    jw_string(w, dir_path);
+    jw_printf(w, ",\"offset\":%lu,\"limit\":%lu,\"files\":[", (unsigned long)offset,
+              (unsigned long)limit);
+
+    if (opts->sorted) {
+        for (size_t i = offset; i < list.count && emitted < limit && w->err == ESP_OK; i++) {
+            sd_list_emit(w, dir_path, list.names + list.entries[i].name_off,
+                         list.entries[i].is_dir, emitted == 0);
+            emitted++;
+        }
+        free(list.entries);
+        free(list.names);
+    } else {
+        // directory order: stream the page while counting the rest
+        while ((entry = readdir(dir)) != NULL && w->err == ESP_OK) {
+            bool is_dir = sd_entry_is_dir(dir_path, entry, &skip);
+            if (skip) continue;
+            if (total >= offset && emitted < limit) {
+                sd_list_emit(w, dir_path, entry->d_name, is_dir, emitted == 0);
+                emitted++;
+            }
+            total++;
+        }
+        closedir(dir);
+    }
+
+    jw_printf(w, "],\"total\":%lu,\"more\":%s}", (unsigned long)total,
+              offset + emitted < total ? "true" : "false");
+    jw_flush(w);
+    esp_err_t err = w->err;
+    free(w);
+    return err;
+}
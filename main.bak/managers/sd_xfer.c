@@ -0,0 +1,323 @@
+#include "managers/sd_xfer.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "managers/sd_card_manager.h"
+
+#define SD_XFER_ALIGN 64 // covers the cache line on targets with psram
+#define SD_XFER_STACK 3072
+#define SD_XFER_PRIO 5   // same as the http server task
+#define SD_XFER_END 0xFF // queue marker: no more buffers
+#define SD_XFER_BUS_CHUNK 4096 // write size between bus hand-overs on a shared spi bus
+
+static const char *TAG = "sd_xfer";
+
+struct sd_xfer {
+    uint8_t *buf[2];
+    size_t len[2];
+    size_t size;
+    uint8_t next;   // buffer the producer fills next
+    int8_t held;    // buffer the consumer holds, -1 if none
+    bool ended;     // consumer saw SD_XFER_END
+    int fd;
+    volatile bool failed;
+    volatile bool stop;
+    size_t done;    // bytes moved by the task
+    size_t remaining; // reader only
+    size_t prealloc;
+    QueueHandle_t filled;       // buffer indices for the consuming side
+    SemaphoreHandle_t free_bufs; // buffers the producing side may fill
+    SemaphoreHandle_t exited;
+};
+
+// dma capable internal ram keeps fatfs off its 512 byte bounce buffer;
+// shrink before giving up and fall back to plain heap at the smallest size
+static bool sd_xfer_alloc_buffers(sd_xfer_t *x) {
+    for (size_t size = SD_XFER_BUF_SIZE; size >= SD_XFER_MIN_BUF_SIZE; size /= 2) {
+        x->buf[0] = heap_caps_aligned_alloc(SD_XFER_ALIGN, size, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+        x->buf[1] = heap_caps_aligned_alloc(SD_XFER_ALIGN, size, MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+        if (x->buf[0] && x->buf[1]) {
+            x->size = size;
+            return true;
+        }
+        heap_caps_free(x->buf[0]);
+        heap_caps_free(x->buf[1]);
+    }
+    x->buf[0] = heap_caps_aligned_alloc(SD_XFER_ALIGN, SD_XFER_MIN_BUF_SIZE, MALLOC_CAP_8BIT);
+    x->buf[1] = heap_caps_aligned_alloc(SD_XFER_ALIGN, SD_XFER_MIN_BUF_SIZE, MALLOC_CAP_8BIT);
+    if (x->buf[0] && x->buf[1]) {
+        x->size = SD_XFER_MIN_BUF_SIZE;
+        return true;
+    }
+    heap_caps_free(x->buf[0]);
+    heap_caps_free(x->buf[1]);
+    x->buf[0] = x->buf[1] = NULL;
+    return false;
+}
+
+static void sd_xfer_free(sd_xfer_t *x) {
+    if (!x) return;
+    heap_caps_free(x->buf[0]);
+    heap_caps_free(x->buf[1]);
+    if (x->filled) vQueueDelete(x->filled);
+    if (x->free_bufs) vSemaphoreDelete(x->free_bufs);
+    if (x->exited) vSemaphoreDelete(x->exited);
+    free(x);
+}
+
+static sd_xfer_t *sd_xfer_create(int fd) {
+    sd_xfer_t *x = calloc(1, sizeof(*x));
+    if (!x) return NULL;
+    x->fd = fd;
+    x->held = -1;
+    // two buffers plus the end marker, so posting the marker never blocks
+    x->filled = xQueueCreate(3, sizeof(uint8_t));
+    x->free_bufs = xSemaphoreCreateCounting(2, 2);
+    x->exited = xSemaphoreCreateBinary();
+    if (!x->filled || !x->free_bufs || !x->exited || !sd_xfer_alloc_buffers(x)) {
+        sd_xfer_free(x);
+        return NULL;
+    }
+    return x;
+}
+
+static bool sd_xfer_write_all(int fd, const uint8_t *data, size_t len) {
+    bus_arbiter_t *arb = sd_card_bus_arbiter();
+    bus_client_t *bus = sd_card_bus_client(BUS_CLASS_BULK);
+    bool ok = true;
+    bus_arbiter_acquire(arb, bus);
+    while (len > 0) {
+        size_t want = arb && len > SD_XFER_BUS_CHUNK ? SD_XFER_BUS_CHUNK : len;
+        ssize_t n = write(fd, data, want);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            ok = false;
+            break;
+        }
+        data += n;
+        len -= (size_t)n;
+        bus_arbiter_yield(arb, bus);
+    }
+    bus_arbiter_release(arb, bus);
+    return ok;
+}
+
+static void sd_xfer_writer_task(void *arg) {
+    sd_xfer_t *x = arg;
+    uint8_t idx;
+    for (;;) {
+        xQueueReceive(x->filled, &idx, portMAX_DELAY);
+        if (idx == SD_XFER_END) break;
+        // after a failure keep recycling buffers so the producer never blocks
+        if (!x->failed) {
+            if (sd_xfer_write_all(x->fd, x->buf[idx], x->len[idx])) {
+                x->done += x->len[idx];
+            } else {
+                ESP_LOGE(TAG, "write failed after %u bytes, errno %d", (unsigned)x->done, errno);
+                x->failed = true;
+            }
+        }
+        xSemaphoreGive(x->free_bufs);
+    }
+    xSemaphoreGive(x->exited);
+    vTaskDelete(NULL);
+}
+
+sd_xfer_t *sd_xfer_begin_write(int fd, size_t prealloc) {
+    if (fd < 0) return NULL;
+    sd_xfer_t *x = sd_xfer_create(fd);
+    if (!x) {
+        close(fd);
+        return NULL;
+    }
+
+    if (prealloc > 0) {
+        // seeking past the end and writing the last byte grows the chain in
+        // one go instead of one cluster lookup per write
+        static const uint8_t zero = 0;
+        bus_arbiter_acquire(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+        if (lseek(fd, (off_t)prealloc - 1, SEEK_SET) >= 0 && write(fd, &zero, 1) == 1 &&
+            lseek(fd, 0, SEEK_SET) == 0) {
+            x->prealloc = prealloc;
+        } else {
+            ESP_LOGW(TAG, "preallocating %u bytes failed, errno %d", (unsigned)prealloc, errno);
+            lseek(fd, 0, SEEK_SET);
+            if (ftruncate(fd, 0) != 0) {
+                ESP_LOGW(TAG, "truncate after failed preallocation failed");
+            }
+        }
+        bus_arbiter_release(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+    }
+
+    if (xTaskCreate(sd_xfer_writer_task, "sd_xfer_wr", SD_XFER_STACK, x, SD_XFER_PRIO, NULL) !=
+        pdPASS) {
+        close(fd);
+        sd_xfer_free(x);
+        return NULL;
+    }
+    return x;
+}
+
+uint8_t *sd_xfer_get_buffer(sd_xfer_t *x, size_t *cap) {
+    xSemaphoreTake(x->free_bufs, portMAX_DELAY);
+    if (x->failed) {
+        xSemaphoreGive(x->free_bufs);
+        return NULL;
+    }
+    *cap = x->size;
+    return x->buf[x->next];
+}
+
+void sd_xfer_commit(sd_xfer_t *x, size_t len) {
+    uint8_t idx = x->next;
+    x->len[idx] = len;
+    xQueueSend(x->filled, &idx, portMAX_DELAY);
+    x->next ^= 1;
+}
+
+esp_err_t sd_xfer_finish(sd_xfer_t *x, size_t *written) {
+    if (!x) return ESP_ERR_INVALID_ARG;
+    uint8_t end = SD_XFER_END;
+    xQueueSend(x->filled, &end, portMAX_DELAY);
+    xSemaphoreTake(x->exited, portMAX_DELAY);
+
+    esp_err_t err = x->failed ? ESP_FAIL : ESP_OK;
+    // trimming and closing update the fat, so they are card writes too
+    bus_arbiter_acquire(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+    // drop the preallocated tail (or anything past a failed write)
+    if ((x->prealloc || x->failed) && ftruncate(x->fd, (off_t)x->done) != 0) {
+        ESP_LOGE(TAG, "truncate to %u bytes failed, errno %d", (unsigned)x->done, errno);
+        err = ESP_FAIL;
+    }
+    if (close(x->fd) != 0) err = ESP_FAIL;
+    bus_arbiter_release(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+    if (written) *written = x->done;
+    sd_xfer_free(x);
+    return err;
+}
+
+static void sd_xfer_reader_task(void *arg) {
+    sd_xfer_t *x = arg;
+    uint8_t idx = 0;
+    while (x->remaining > 0) {
+        xSemaphoreTake(x->free_bufs, portMAX_DELAY);
+        if (x->stop) break;
+        size_t want = x->remaining < x->size ? x->remaining : x->size;
+        ssize_t n;
+        bus_arbiter_acquire(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+        do {
+            n = read(x->fd, x->buf[idx], want);
+        } while (n < 0 && errno == EINTR);
+        bus_arbiter_release(sd_card_bus_arbiter(), sd_card_bus_client(BUS_CLASS_BULK));
+        if (n <= 0) {
+            // a short file is an error too: the length was promised to the client
+            ESP_LOGE(TAG, "read failed at %u bytes, errno %d", (unsigned)x->done, errno);
+            x->failed = true;
+            break;
+        }
+        x->len[idx] = (size_t)n;
+        x->remaining -= (size_t)n;
+        x->done += (size_t)n;
+        xQueueSend(x->filled, &idx, portMAX_DELAY);
+        idx ^= 1;
+    }
+    uint8_t end = SD_XFER_END;
+    xQueueSend(x->filled, &end, portMAX_DELAY);
+    xSemaphoreGive(x->exited);
+    vTaskDelete(NULL);
+}
+
+sd_xfer_t *sd_xfer_begin_read(int fd, off_t offset, size_t length) {
+    if (fd < 0) return NULL;
+    sd_xfer_t *x = sd_xfer_create(fd);
+    if (!x || lseek(fd, offset, SEEK_SET) != offset) {
+        close(fd);
+        sd_xfer_free(x);
+        return NULL;
+    }
+    x->remaining = length;
+
+    if (xTaskCreate(sd_xfer_reader_task, "sd_xfer_rd", SD_XFER_STACK, x, SD_XFER_PRIO, NULL) !=
+        pdPASS) {
+        close(fd);
+        sd_xfer_free(x);
+        return NULL;
+    }
+    return x;
+}
+
+const uint8_t *sd_xfer_next(sd_xfer_t *x, size_t *len) {
+    if (x->ended) return NULL;
+    uint8_t idx;
+    xQueueReceive(x->filled, &idx, portMAX_DELAY);
+    if (idx == SD_XFER_END) {
+        x->ended = true;
+        return NULL;
+    }
+    x->held = (int8_t)idx;
+    *len = x->len[idx];
+    return x->buf[idx];
+}
+
+void sd_xfer_release(sd_xfer_t *x) {
+    if (x->held < 0) return;
+    x->held = -1;
+    xSemaphoreGive(x->free_bufs);
+}
+
+esp_err_t sd_xfer_end(sd_xfer_t *x) {
+    if (!x) return ESP_ERR_INVALID_ARG;
+    x->stop = true;
+    sd_xfer_release(x);
+    // hand back whatever is queued until the reader posts its end marker
+    while (!x->ended) {
+        uint8_t idx;
+        xQueueReceive(x->filled, &idx, portMAX_DELAY);
+        if (idx == SD_XFER_END) {
+            x->ended = true;
+        } else {
+            xSemaphoreGive(x->free_bufs);
+        }
+    }
+    xSemaphoreTake(x->exited, portMAX_DELAY);
+
+    esp_err_t err = x->failed ? ESP_FAIL : ESP_OK;
+    close(x->fd);
+    sd_xfer_free(x);
+    return err;
+}
+
+int sd_xfer_parse_range(const char *hdr, size_t size, size_t *first, size_t *last) {
+    if (strncmp(hdr, "bytes=", 6) != 0 || strchr(hdr, ',')) return 0; // multi-range: send it all
+    const char *p = hdr + 6;
+    char *end;
+    if (*p == '-') {
+        unsigned long long n = strtoull(p + 1, &end, 10);
+        if (end == p + 1 || *end) return 0;
+        if (n == 0 || size == 0) return -1;
+        *first = n >= size ? 0 : size - (size_t)n;
+        *last = size - 1;
+        return 1;
+    }
+    unsigned long long a = strtoull(p, &end, 10);
+    if (end == p || *end != '-') return 0;
+    p = end + 1;
+    unsigned long long b = size ? size - 1 : 0;
+    if (*p) {
+        b = strtoull(p, &end, 10);
+        if (*end || b < a) return 0;
+        if (b >= size) b = size - 1;
+    }
+    if (a >= size) return -1;
+    *first = (size_t)a;
+    *last = (size_t)b;
+    return 1;
+}
@@ -1,14 +1,21 @@
 #include "managers/settings_manager.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
 #include "lvgl.h"
 #include "managers/display_manager.h"
 #include "mbedtls/base64.h"  // For base64 decoding
 #include "managers/rgb_manager.h"
 #include <esp_log.h>
+#include <esp_system.h>
+#include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <nvs.h>
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+#include "esp_rom_crc.h"
+#endif
 
 #define S_TAG "SETTINGS"
 
@@ -75,7 +82,236 @@ static const char *TAG = "SettingsManager";
 static nvs_handle_t nvsHandle;
 FSettings G_Settings;
 
+#ifndef CONFIG_SETTINGS_COMMIT_DELAY_MS
+#define CONFIG_SETTINGS_COMMIT_DELAY_MS 750
+#endif
+// keep deferring while saves keep coming, but flush no later than this after
+// the first one
+#define SETTINGS_COMMIT_MAX_WAIT_MS (2 * CONFIG_SETTINGS_COMMIT_DELAY_MS)
+
+// one entry per persisted field; save only writes fields whose dirty bit is
+// set or whose value differs from what was last written to nvs
+typedef enum {
+  FIELD_RGB_MODE,
+  FIELD_CHANNEL_DELAY,
+  FIELD_BROADCAST_SPEED,
+  FIELD_AP_SSID,
+  FIELD_AP_PASSWORD,
+  FIELD_RGB_SPEED,
+  FIELD_RGB_LED_COUNT,
+  FIELD_RTS_ENABLED,
+  FIELD_THIRD_CTRL,
+  FIELD_PORTAL_URL,
+  FIELD_PORTAL_SSID,
+  FIELD_PORTAL_PASSWORD,
+  FIELD_PORTAL_AP_SSID,
+  FIELD_PORTAL_DOMAIN,
+  FIELD_PORTAL_OFFLINE,
+  FIELD_PRINTER_IP,
+  FIELD_PRINTER_TEXT,
+  FIELD_PRINTER_FONT_SIZE,
+  FIELD_PRINTER_ALIGNMENT,
+  FIELD_FLAPPY_NAME,
+  FIELD_TIMEZONE,
+  FIELD_ACCENT_COLOR,
+  FIELD_GPS_RX_PIN,
+  FIELD_DISPLAY_TIMEOUT,
+  FIELD_STA_SSID,
+  FIELD_STA_PASSWORD,
+  FIELD_RGB_DATA_PIN,
+  FIELD_RGB_RED_PIN,
+  FIELD_RGB_GREEN_PIN,
+  FIELD_RGB_BLUE_PIN,
+  FIELD_MAX_BRIGHTNESS,
+  FIELD_MENU_THEME,
+  FIELD_INVERT_COLORS,
+  FIELD_TERMINAL_COLOR,
+  FIELD_WEB_AUTH,
+  FIELD_WEBUI_AP_ONLY,
+  FIELD_AP_ENABLED,
+  FIELD_POWER_SAVE,
+  FIELD_ESP_COMM_TX_PIN,
+  FIELD_ESP_COMM_RX_PIN,
+  FIELD_ZEBRA_MENUS,
+  FIELD_IR_EASY_MODE,
+  FIELD_NAV_BUTTONS,
+  FIELD_MENU_LAYOUT,
+  FIELD_NEOPIXEL_BRIGHTNESS,
+  FIELD_ENCODER_INVERT,
+  FIELD_SETUP_COMPLETE,
+  FIELD_WIFI_COUNTRY,
+#ifdef CONFIG_WITH_STATUS_DISPLAY
+  FIELD_IDLE_ANIM,
+  FIELD_IDLE_TIMEOUT,
+#endif
+  FIELD_COUNT
+} settings_field_id_t;
+
+typedef enum { FT_U8, FT_U16, FT_U32, FT_I32, FT_STR, FT_BLOB } settings_field_type_t;
+
+typedef struct {
+  const char *const *key; // points at the NVS_*_KEY string below
+  uint16_t offset;
+  uint16_t size;
+  uint8_t type;
+} settings_field_t;
+
+#define SETTINGS_FIELD(id, nvs_key, member, ftype)                             \
+  [id] = {&nvs_key, offsetof(FSettings, member),                               \
+          sizeof(((FSettings *)0)->member), ftype}
+
+static const settings_field_t s_fields[FIELD_COUNT] = {
+  SETTINGS_FIELD(FIELD_RGB_MODE, NVS_RGB_MODE_KEY, rgb_mode, FT_U8),
+  SETTINGS_FIELD(FIELD_CHANNEL_DELAY, NVS_CHANNEL_DELAY_KEY, channel_delay, FT_BLOB),
+  SETTINGS_FIELD(FIELD_BROADCAST_SPEED, NVS_BROADCAST_SPEED_KEY, broadcast_speed, FT_U16),
+  SETTINGS_FIELD(FIELD_AP_SSID, NVS_AP_SSID_KEY, ap_ssid, FT_STR),
+  SETTINGS_FIELD(FIELD_AP_PASSWORD, NVS_AP_PASSWORD_KEY, ap_password, FT_STR),
+  SETTINGS_FIELD(FIELD_RGB_SPEED, NVS_RGB_SPEED_KEY, rgb_speed, FT_U8),
+  SETTINGS_FIELD(FIELD_RGB_LED_COUNT, NVS_RGB_LED_COUNT_KEY, rgb_led_count, FT_U16),
+  SETTINGS_FIELD(FIELD_RTS_ENABLED, NVS_ENABLE_RTS_KEY, rts_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_THIRD_CTRL, NVS_THIRD_CTRL_KEY, third_control_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_PORTAL_URL, NVS_PORTAL_URL_KEY, portal_url, FT_STR),
+  SETTINGS_FIELD(FIELD_PORTAL_SSID, NVS_PORTAL_SSID_KEY, portal_ssid, FT_STR),
+  SETTINGS_FIELD(FIELD_PORTAL_PASSWORD, NVS_PORTAL_PASSWORD_KEY, portal_password, FT_STR),
+  SETTINGS_FIELD(FIELD_PORTAL_AP_SSID, NVS_PORTAL_AP_SSID_KEY, portal_ap_ssid, FT_STR),
+  SETTINGS_FIELD(FIELD_PORTAL_DOMAIN, NVS_PORTAL_DOMAIN_KEY, portal_domain, FT_STR),
+  SETTINGS_FIELD(FIELD_PORTAL_OFFLINE, NVS_PORTAL_OFFLINE_KEY, portal_offline_mode, FT_U8),
+  SETTINGS_FIELD(FIELD_PRINTER_IP, NVS_PRINTER_IP_KEY, printer_ip, FT_STR),
+  SETTINGS_FIELD(FIELD_PRINTER_TEXT, NVS_PRINTER_TEXT_KEY, printer_text, FT_STR),
+  SETTINGS_FIELD(FIELD_PRINTER_FONT_SIZE, NVS_PRINTER_FONT_SIZE_KEY, printer_font_size, FT_U8),
+  SETTINGS_FIELD(FIELD_PRINTER_ALIGNMENT, NVS_PRINTER_ALIGNMENT_KEY, printer_alignment, FT_U8),
+  SETTINGS_FIELD(FIELD_FLAPPY_NAME, NVS_FLAPPY_GHOST_NAME, flappy_ghost_name, FT_STR),
+  SETTINGS_FIELD(FIELD_TIMEZONE, NVS_TIMEZONE_NAME, selected_timezone, FT_STR),
+  SETTINGS_FIELD(FIELD_ACCENT_COLOR, NVS_ACCENT_COLOR, selected_hex_accent_color, FT_STR),
+  SETTINGS_FIELD(FIELD_GPS_RX_PIN, NVS_GPS_RX_PIN, gps_rx_pin, FT_U8),
+  SETTINGS_FIELD(FIELD_DISPLAY_TIMEOUT, NVS_DISPLAY_TIMEOUT_KEY, display_timeout_ms, FT_U32),
+  SETTINGS_FIELD(FIELD_STA_SSID, NVS_STA_SSID_KEY, sta_ssid, FT_STR),
+  SETTINGS_FIELD(FIELD_STA_PASSWORD, NVS_STA_PASSWORD_KEY, sta_password, FT_STR),
+  SETTINGS_FIELD(FIELD_RGB_DATA_PIN, NVS_RGB_DATA_PIN_KEY, rgb_data_pin, FT_I32),
+  SETTINGS_FIELD(FIELD_RGB_RED_PIN, NVS_RGB_RED_PIN_KEY, rgb_red_pin, FT_I32),
+  SETTINGS_FIELD(FIELD_RGB_GREEN_PIN, NVS_RGB_GREEN_PIN_KEY, rgb_green_pin, FT_I32),
+  SETTINGS_FIELD(FIELD_RGB_BLUE_PIN, NVS_RGB_BLUE_PIN_KEY, rgb_blue_pin, FT_I32),
+  SETTINGS_FIELD(FIELD_MAX_BRIGHTNESS, NVS_MAX_SCREEN_BRIGHTNESS_KEY, max_screen_brightness, FT_U8),
+  SETTINGS_FIELD(FIELD_MENU_THEME, NVS_MENU_THEME_KEY, menu_theme, FT_U8),
+  SETTINGS_FIELD(FIELD_INVERT_COLORS, NVS_INVERT_COLORS_KEY, invert_colors, FT_U8),
+  SETTINGS_FIELD(FIELD_TERMINAL_COLOR, NVS_TERMINAL_TEXT_COLOR_KEY, terminal_text_color, FT_U32),
+  SETTINGS_FIELD(FIELD_WEB_AUTH, NVS_WEB_AUTH_KEY, web_auth_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_WEBUI_AP_ONLY, NVS_WEBUI_AP_ONLY_KEY, webui_restrict_to_ap, FT_U8),
+  SETTINGS_FIELD(FIELD_AP_ENABLED, NVS_AP_ENABLED_KEY, ap_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_POWER_SAVE, NVS_POWER_SAVE_KEY, power_save_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_ESP_COMM_TX_PIN, NVS_ESP_COMM_TX_PIN_KEY, esp_comm_tx_pin, FT_I32),
+  SETTINGS_FIELD(FIELD_ESP_COMM_RX_PIN, NVS_ESP_COMM_RX_PIN_KEY, esp_comm_rx_pin, FT_I32),
+  SETTINGS_FIELD(FIELD_ZEBRA_MENUS, NVS_ZEBRA_MENUS_KEY, zebra_menus_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_IR_EASY_MODE, NVS_INFRARED_EASY_MODE_KEY, infrared_easy_mode, FT_U8),
+  SETTINGS_FIELD(FIELD_NAV_BUTTONS, NVS_NAV_BUTTONS_KEY, nav_buttons_enabled, FT_U8),
+  SETTINGS_FIELD(FIELD_MENU_LAYOUT, NVS_MENU_LAYOUT_KEY, menu_layout, FT_U8),
+  SETTINGS_FIELD(FIELD_NEOPIXEL_BRIGHTNESS, NVS_NEOPIXEL_MAX_BRIGHTNESS_KEY, neopixel_max_brightness, FT_U8),
+  SETTINGS_FIELD(FIELD_ENCODER_INVERT, NVS_ENCODER_INVERT_KEY, encoder_invert_direction, FT_U8),
+  SETTINGS_FIELD(FIELD_SETUP_COMPLETE, NVS_SETUP_COMPLETE_KEY, setup_complete, FT_U8),
+  SETTINGS_FIELD(FIELD_WIFI_COUNTRY, NVS_WIFI_COUNTRY_KEY, wifi_country, FT_U8),
+#ifdef CONFIG_WITH_STATUS_DISPLAY
+  SETTINGS_FIELD(FIELD_IDLE_ANIM, NVS_STATUS_IDLE_ANIM_KEY, status_idle_animation, FT_U8),
+  SETTINGS_FIELD(FIELD_IDLE_TIMEOUT, NVS_STATUS_IDLE_TIMEOUT_KEY, status_idle_timeout_ms, FT_U32),
+#endif
+};
+
+_Static_assert(FIELD_COUNT <= 64, "settings dirty mask is 64 bits");
+
+static FSettings s_persisted;  // what nvs holds right now
+static uint64_t s_dirty;       // fields touched by setters since the last flush
+static bool s_pending;         // a save is waiting for the commit task
+static SemaphoreHandle_t s_save_mutex;  // G_Settings contents: setters, save, flush snapshot
+static SemaphoreHandle_t s_flush_mutex; // one flush at a time, held across the nvs writes
+static TaskHandle_t s_commit_task;
+static portMUX_TYPE s_dirty_mux = portMUX_INITIALIZER_UNLOCKED;
+
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+#define SETTINGS_BLOB_KEY "settings_blob"
+#define SETTINGS_BLOB_MAGIC 0x47534554 // "GSET"
+#define SETTINGS_BLOB_VERSION 1        // bump whenever FSettings changes
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t crc; // over data
+  FSettings data;
+} settings_blob_t;
+
+// per-key entries left from before the blob layout, erased after the next
+// blob write so a later bad blob can never resurrect them
+static bool s_erase_keys;
+#endif
+
+// setters and settings_save hold this only while they copy values in
+static inline void settings_lock(void) {
+  if (s_save_mutex) xSemaphoreTake(s_save_mutex, portMAX_DELAY);
+}
+
+static inline void settings_unlock(void) {
+  if (s_save_mutex) xSemaphoreGive(s_save_mutex);
+}
+
+static inline void settings_mark_dirty(settings_field_id_t id) {
+  portENTER_CRITICAL(&s_dirty_mux);
+  s_dirty |= 1ULL << id;
+  portEXIT_CRITICAL(&s_dirty_mux);
+}
+
+static void settings_commit_task(void *arg);
+static void settings_shutdown_flush(void);
+
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+// ESP_ERR_NVS_NOT_FOUND when there is no blob yet, another error when there
+// is one that can't be used
+static esp_err_t settings_load_blob(FSettings *settings) {
+  settings_blob_t *blob = malloc(sizeof(*blob));
+  if (!blob) return ESP_ERR_NO_MEM;
+  size_t len = sizeof(*blob);
+  esp_err_t err = nvs_get_blob(nvsHandle, SETTINGS_BLOB_KEY, blob, &len);
+  if (err == ESP_ERR_NVS_INVALID_LENGTH) err = ESP_ERR_INVALID_SIZE;
+  if (err == ESP_OK) {
+    if (len != sizeof(*blob) || blob->magic != SETTINGS_BLOB_MAGIC ||
+        blob->size != sizeof(FSettings)) {
+      err = ESP_ERR_INVALID_SIZE;
+    } else if (blob->version != SETTINGS_BLOB_VERSION) {
+      err = ESP_ERR_INVALID_VERSION;
+    } else if (blob->crc != esp_rom_crc32_le(0, (const uint8_t *)&blob->data, sizeof(FSettings))) {
+      err = ESP_ERR_INVALID_CRC;
+    }
+  }
+  if (err == ESP_OK) memcpy(settings, &blob->data, sizeof(FSettings));
+  free(blob);
+  return err;
+}
+
+static esp_err_t settings_write_blob(const FSettings *settings) {
+  settings_blob_t *blob = malloc(sizeof(*blob));
+  if (!blob) return ESP_ERR_NO_MEM;
+  memset(blob, 0, sizeof(*blob));
+  blob->magic = SETTINGS_BLOB_MAGIC;
+  blob->version = SETTINGS_BLOB_VERSION;
+  blob->size = sizeof(FSettings);
+  memcpy(&blob->data, settings, sizeof(FSettings));
+  blob->crc = esp_rom_crc32_le(0, (const uint8_t *)&blob->data, sizeof(FSettings));
+  esp_err_t err = nvs_set_blob(nvsHandle, SETTINGS_BLOB_KEY, blob, sizeof(*blob));
+  free(blob);
+  return err;
+}
+
+static void settings_erase_keys(void) {
+  for (int i = 0; i < FIELD_COUNT; i++) {
+    esp_err_t err = nvs_erase_key(nvsHandle, *s_fields[i].key);
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+      ESP_LOGW(S_TAG, "Failed to erase %s: %s", *s_fields[i].key, esp_err_to_name(err));
+    }
+  }
+}
+#endif
+
 void settings_init(FSettings *settings) {
+  if (!s_save_mutex) s_save_mutex = xSemaphoreCreateMutex();
+  if (!s_flush_mutex) s_flush_mutex = xSemaphoreCreateMutex();
   settings_set_defaults(settings);
   esp_err_t err = nvs_flash_init();
 
@@ -105,10 +341,25 @@ void settings_init(FSettings *settings) {
     settings_print_nvs_stats();
   } else {
     printf("Failed to open NVS handle: %s\n", esp_err_to_name(err));
+    return;
+  }
+
+#if CONFIG_SETTINGS_COMMIT_DELAY_MS > 0
+  if (!s_commit_task &&
+      xTaskCreate(settings_commit_task, "settings_commit", 3072, NULL, 2, &s_commit_task) != pdPASS) {
+    ESP_LOGW(S_TAG, "No commit task, saving synchronously");
+    s_commit_task = NULL;
   }
+#endif
+  // esp_restart runs shutdown handlers, so a pending save still lands
+  esp_register_shutdown_handler(settings_shutdown_flush);
+  if (s_dirty) settings_flush();
 }
 
-void settings_deinit(void) { nvs_close(nvsHandle); }
+void settings_deinit(void) {
+  settings_flush();
+  nvs_close(nvsHandle);
+}
 
 void settings_set_defaults(FSettings *settings) {
   settings->rgb_mode = RGB_MODE_NORMAL;
@@ -175,7 +426,7 @@ void settings_set_defaults(FSettings *settings) {
 #endif
 }
 
-void settings_load(FSettings *settings) {
+static void settings_load_keys(FSettings *settings) {
   esp_err_t err;
   uint8_t value_u8;
   uint16_t value_u16;
@@ -545,6 +796,41 @@ void settings_load(FSettings *settings) {
 #endif
 }
 
+void settings_load(FSettings *settings) {
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+  esp_err_t err = settings_load_blob(settings);
+  if (err == ESP_ERR_NVS_NOT_FOUND) {
+    // first boot with the blob layout: migrate the per-key values
+    settings_load_keys(settings);
+  } else if (err != ESP_OK) {
+    // the per-key values stopped tracking changes when the blob was first
+    // written, so they would bring back old settings
+    ESP_LOGW(S_TAG, "Settings blob unusable (%s), using defaults", esp_err_to_name(err));
+    settings_set_defaults(settings);
+  }
+#else
+  settings_load_keys(settings);
+#endif
+  memcpy(&s_persisted, settings, sizeof(FSettings));
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+  // no valid blob: write one on the next flush and drop the per-key entries
+  if (err != ESP_OK) {
+    s_erase_keys = true;
+    settings_mark_dirty(FIELD_RGB_MODE);
+  }
+#endif
+}
+
+bool settings_ap_enabled_stored(void) {
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+  // once migrated every field lives in the blob
+  size_t len = 0;
+  if (nvs_get_blob(nvsHandle, SETTINGS_BLOB_KEY, NULL, &len) == ESP_OK) return true;
+#endif
+  uint8_t value;
+  return nvs_get_u8(nvsHandle, NVS_AP_ENABLED_KEY, &value) == ESP_OK;
+}
+
 static void update_rainbow_effect(const FSettings *settings) {
 #ifndef CONFIG_WITH_SCREEN
   return;
@@ -566,202 +852,146 @@ static void update_rainbow_effect(const FSettings *settings) {
 }
 
 
-void settings_save(const FSettings *settings) {
-  ESP_LOGI(TAG, "Starting settings save process");
-  ESP_LOGI(TAG, "Current display timeout: %lu ms",
-           settings->display_timeout_ms);
-  ESP_LOGI(TAG, "Current timezone: %s", settings->selected_timezone);
-
-  esp_err_t err;
-
-  // Save RGB Mode
-  err = nvs_set_u8(nvsHandle, NVS_RGB_MODE_KEY, (uint8_t)settings->rgb_mode);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB Mode\n");
-  }
-
-  // Save Channel Delay
-  err = nvs_set_blob(nvsHandle, NVS_CHANNEL_DELAY_KEY, &settings->channel_delay,
-                     sizeof(settings->channel_delay));
-  if (err != ESP_OK) {
-    printf("Failed to save Channel Delay\n");
-  }
-
-  // Save Broadcast Speed
-  err = nvs_set_u16(nvsHandle, NVS_BROADCAST_SPEED_KEY,
-                    settings->broadcast_speed);
-  if (err != ESP_OK) {
-    printf("Failed to save Broadcast Speed\n");
-  }
-
-  // Save AP SSID
-  err = nvs_set_str(nvsHandle, NVS_AP_SSID_KEY, settings->ap_ssid);
-  if (err != ESP_OK) {
-    printf("Failed to save AP SSID\n");
-  }
-
-  // Save AP Password
-  err = nvs_set_str(nvsHandle, NVS_AP_PASSWORD_KEY, settings->ap_password);
-  if (err != ESP_OK) {
-    printf("Failed to save AP Password\n");
-  }
-
-  // Save RGB Speed
-  err = nvs_set_u8(nvsHandle, NVS_RGB_SPEED_KEY, settings->rgb_speed);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB Speed\n");
-  }
-
-  // Save RGB LED Count
-  err = nvs_set_u16(nvsHandle, NVS_RGB_LED_COUNT_KEY, settings->rgb_led_count);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB LED count\n");
-  }
-
-  // Save RTS Enabled
-  err = nvs_set_u8(nvsHandle, NVS_ENABLE_RTS_KEY, settings->rts_enabled);
-  if (err != ESP_OK) {
-    printf("Failed to save RTS Enabled\n");
-  }
-
-  // Save Third Control Enabled
-  err = nvs_set_u8(nvsHandle, NVS_THIRD_CTRL_KEY, settings->third_control_enabled);
-  if (err != ESP_OK) {
-    printf("Failed to save Third Control Enabled\n");
-  }
-
-  // Save Evil Portal settings
-  err = nvs_set_str(nvsHandle, NVS_PORTAL_URL_KEY, settings->portal_url);
-  if (err != ESP_OK) {
-    printf("Failed to save Portal URL\n");
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_PORTAL_SSID_KEY, settings->portal_ssid);
-  if (err != ESP_OK) {
-    printf("Failed to save Portal SSID\n");
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_PORTAL_PASSWORD_KEY,
-                    settings->portal_password);
-  if (err != ESP_OK) {
-    printf("Failed to save Portal Password\n");
-  }
-
-  err =
-      nvs_set_str(nvsHandle, NVS_PORTAL_AP_SSID_KEY, settings->portal_ap_ssid);
-  if (err != ESP_OK) {
-    printf("Failed to save Portal AP SSID\n");
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_PORTAL_DOMAIN_KEY, settings->portal_domain);
-  if (err != ESP_OK) {
-    printf("Failed to save Portal Domain\n");
-  }
-
-  err = nvs_set_u8(nvsHandle, NVS_PORTAL_OFFLINE_KEY,
-                   settings->portal_offline_mode);
-  if (err != ESP_OK) {
-    printf("Failed to save Portal Offline Mode\n");
-  }
-
-  // Save Power Printer settings
-  err = nvs_set_str(nvsHandle, NVS_PRINTER_IP_KEY, settings->printer_ip);
-  if (err != ESP_OK) {
-    printf("Failed to save Printer IP\n");
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_PRINTER_TEXT_KEY, settings->printer_text);
-  if (err != ESP_OK) {
-    printf("Failed to save Printer Text\n");
-  }
-
-  err = nvs_set_u8(nvsHandle, NVS_PRINTER_FONT_SIZE_KEY,
-                   settings->printer_font_size);
-  if (err != ESP_OK) {
-    printf("Failed to save Printer Font Size\n");
-  }
-
-  err = nvs_set_u8(nvsHandle, NVS_PRINTER_ALIGNMENT_KEY,
-                   (uint8_t)settings->printer_alignment);
-  if (err != ESP_OK) {
-    printf("Failed to save Printer Alignment\n");
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_FLAPPY_GHOST_NAME,
-                    settings->flappy_ghost_name);
-  if (err != ESP_OK) {
-    printf("Failed to save Flappy Ghost Name\n");
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_TIMEZONE_NAME, settings->selected_timezone);
-  if (err != ESP_OK) {
-    printf("Failed to Save Timezone String %s\n", esp_err_to_name(err));
-  }
-
-  err = nvs_set_str(nvsHandle, NVS_ACCENT_COLOR,
-                    settings->selected_hex_accent_color);
-  if (err != ESP_OK) {
-    printf("Failed to Save Hex Accent Color %s", esp_err_to_name(err));
-  }
-
-  err = nvs_set_u8(nvsHandle, NVS_GPS_RX_PIN, (uint8_t)settings->gps_rx_pin);
-  if (err != ESP_OK) {
-    printf("Failed to save Printer Alignment\n");
-  }
-
-  err = nvs_set_u32(nvsHandle, NVS_DISPLAY_TIMEOUT_KEY,
-                    settings->display_timeout_ms);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Failed to save Display Timeout");
+static uint32_t field_uint(const FSettings *settings, const settings_field_t *f) {
+  const uint8_t *p = (const uint8_t *)settings + f->offset;
+  uint8_t v8;
+  uint16_t v16;
+  uint32_t v32;
+  switch (f->size) {
+  case 1:
+    memcpy(&v8, p, 1);
+    return v8;
+  case 2:
+    memcpy(&v16, p, 2);
+    return v16;
+  default:
+    memcpy(&v32, p, 4);
+    return v32;
+  }
+}
+
+static bool field_changed(const FSettings *a, const FSettings *b, const settings_field_t *f) {
+  const char *pa = (const char *)a + f->offset;
+  const char *pb = (const char *)b + f->offset;
+  if (f->type == FT_STR) return strncmp(pa, pb, f->size) != 0;
+  return memcmp(pa, pb, f->size) != 0;
+}
+
+static esp_err_t field_write(const FSettings *settings, const settings_field_t *f) {
+  const char *key = *f->key;
+  const uint8_t *p = (const uint8_t *)settings + f->offset;
+  switch (f->type) {
+  case FT_U8:
+    return nvs_set_u8(nvsHandle, key, (uint8_t)field_uint(settings, f));
+  case FT_U16:
+    return nvs_set_u16(nvsHandle, key, (uint16_t)field_uint(settings, f));
+  case FT_U32:
+    return nvs_set_u32(nvsHandle, key, field_uint(settings, f));
+  case FT_I32:
+    return nvs_set_i32(nvsHandle, key, (int32_t)field_uint(settings, f));
+  case FT_STR: {
+    char tmp[260];
+    size_t n = f->size < sizeof(tmp) ? f->size : sizeof(tmp);
+    memcpy(tmp, p, n);
+    tmp[n - 1] = '\0';
+    return nvs_set_str(nvsHandle, key, tmp);
+  }
+  case FT_BLOB:
+  default:
+    return nvs_set_blob(nvsHandle, key, p, f->size);
+  }
+}
+
+
+// write every field that changed since the last flush and commit once
+void settings_flush(void) {
+  static FSettings snapshot; // only used under s_flush_mutex
+
+  if (s_flush_mutex && xSemaphoreTake(s_flush_mutex, pdMS_TO_TICKS(1000)) != pdTRUE) {
+    ESP_LOGE(S_TAG, "Settings flush timed out waiting for lock");
+    return;
+  }
+
+  // copy out under the lock the setters take, then write without holding it
+  settings_lock();
+  memcpy(&snapshot, &G_Settings, sizeof(FSettings));
+  portENTER_CRITICAL(&s_dirty_mux);
+  uint64_t dirty = s_dirty;
+  s_dirty = 0;
+  s_pending = false;
+  portEXIT_CRITICAL(&s_dirty_mux);
+  settings_unlock();
+
+  for (int i = 0; i < FIELD_COUNT; i++) {
+    if (field_changed(&snapshot, &s_persisted, &s_fields[i])) dirty |= 1ULL << i;
+  }
+
+  if (dirty) {
+    int written = 0;
+    esp_err_t err = ESP_OK;
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+    err = settings_write_blob(&snapshot);
+    if (err == ESP_OK) {
+      memcpy(&s_persisted, &snapshot, sizeof(FSettings));
+      written = 1;
+      if (s_erase_keys) {
+        settings_erase_keys();
+        s_erase_keys = false;
+      }
+    } else {
+      ESP_LOGE(S_TAG, "Failed to save settings blob: %s", esp_err_to_name(err));
+    }
+#else
+    for (int i = 0; i < FIELD_COUNT; i++) {
+      if (!(dirty & (1ULL << i))) continue;
+      const settings_field_t *f = &s_fields[i];
+      err = field_write(&snapshot, f);
+      if (err != ESP_OK) {
+        ESP_LOGE(S_TAG, "Failed to save %s: %s", *f->key, esp_err_to_name(err));
+        continue;
+      }
+      memcpy((uint8_t *)&s_persisted + f->offset, (const uint8_t *)&snapshot + f->offset,
+             f->size);
+      written++;
+    }
+#endif
+    err = nvs_commit(nvsHandle);
+    if (err != ESP_OK) {
+      ESP_LOGE(S_TAG, "Failed to commit settings: %s", esp_err_to_name(err));
+    } else {
+      ESP_LOGI(TAG, "Settings saved to NVS (%d writes)", written);
+    }
   }
 
-  // Save Station SSID
-  err = nvs_set_str(nvsHandle, NVS_STA_SSID_KEY, settings->sta_ssid);
-  if (err != ESP_OK) {
-    printf("Failed to save STA SSID\n");
-  }
+  if (s_flush_mutex) xSemaphoreGive(s_flush_mutex);
+}
 
-  // Save Station Password
-  err = nvs_set_str(nvsHandle, NVS_STA_PASSWORD_KEY, settings->sta_password);
-  if (err != ESP_OK) {
-    printf("Failed to save STA Password\n");
+static void settings_commit_task(void *arg) {
+  (void)arg;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    // coalesce a burst of saves (sliders, wizards) into one flush
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(SETTINGS_COMMIT_MAX_WAIT_MS);
+    for (;;) {
+      TickType_t left = deadline - xTaskGetTickCount();
+      if ((int32_t)left <= 0) break;
+      TickType_t wait = pdMS_TO_TICKS(CONFIG_SETTINGS_COMMIT_DELAY_MS);
+      if (ulTaskNotifyTake(pdTRUE, wait < left ? wait : left) == 0) break;
+    }
+    settings_flush();
   }
+}
 
-  err = nvs_set_i32(nvsHandle, NVS_RGB_DATA_PIN_KEY, settings->rgb_data_pin);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB data pin\n");
-  }
-  err = nvs_set_i32(nvsHandle, NVS_RGB_RED_PIN_KEY, settings->rgb_red_pin);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB red pin\n");
-  }
-  err = nvs_set_i32(nvsHandle, NVS_RGB_GREEN_PIN_KEY, settings->rgb_green_pin);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB green pin\n");
-  }
-  err = nvs_set_i32(nvsHandle, NVS_RGB_BLUE_PIN_KEY, settings->rgb_blue_pin);
-  if (err != ESP_OK) {
-    printf("Failed to save RGB blue pin\n");
-  }
-  // Save Max Screen Brightness
-  err = nvs_set_u8(nvsHandle, NVS_MAX_SCREEN_BRIGHTNESS_KEY, settings->max_screen_brightness);
-  if (err != ESP_OK) {
-    printf("Failed to save key '%s' (value=%u): %s (%d)\n",
-           NVS_MAX_SCREEN_BRIGHTNESS_KEY,
-           settings->max_screen_brightness,
-           esp_err_to_name(err), err);
-  }
+static void settings_shutdown_flush(void) {
+  if (s_pending || s_dirty) settings_flush();
+}
 
+void settings_save(const FSettings *settings) {
+  ESP_LOGI(TAG, "Starting settings save process");
+  ESP_LOGI(TAG, "Current display timeout: %lu ms",
+           settings->display_timeout_ms);
+  ESP_LOGI(TAG, "Current timezone: %s", settings->selected_timezone);
 
-  // Save Max Screen Brightness
-  err = nvs_set_u8(nvsHandle, NVS_MAX_SCREEN_BRIGHTNESS_KEY, settings->max_screen_brightness);
-  if (err != ESP_OK) {
-    printf("Failed to save key '%s' (value=%u): %s (%d)\n",
-           NVS_MAX_SCREEN_BRIGHTNESS_KEY,
-           settings->max_screen_brightness,
-           esp_err_to_name(err), err);
-  }
-  
   // Clean up any existing rainbow task before starting a new one
   if (rgb_effect_task_handle != NULL) {
       // Signal the rainbow task to exit gracefully instead of forceful deletion
@@ -806,97 +1036,40 @@ void settings_save(const FSettings *settings) {
 
   update_rainbow_effect(settings);
 
-  // Commit all changes
-  err = nvs_commit(nvsHandle);
-  if (err != ESP_OK) {
-    printf("Failed to commit NVS changes\n");
-  } else {
-    printf("Settings saved to NVS.\n");
-  }
-
   // Apply timezone change immediately
   ESP_LOGI(TAG, "Applying timezone change: %s", settings->selected_timezone);
   setenv("TZ", settings->selected_timezone, 1);
   tzset();
 
   // Update global settings immediately
-  ESP_LOGI(TAG, "Updating global settings");
-  ESP_LOGI(TAG, "Old display timeout: %lu ms", G_Settings.display_timeout_ms);
-  memcpy(&G_Settings, settings, sizeof(FSettings));
-  ESP_LOGI(TAG, "New display timeout: %lu ms", G_Settings.display_timeout_ms);
+  if (settings != &G_Settings) {
+    settings_lock();
+    memcpy(&G_Settings, settings, sizeof(FSettings));
+    settings_unlock();
+  }
 
-  err = nvs_commit(nvsHandle);
-  if (err != ESP_OK) {
-    ESP_LOGE(TAG, "Failed to commit NVS changes: %s", esp_err_to_name(err));
+  // nvs writes happen in the commit task once the burst settles
+  if (s_commit_task) {
+    s_pending = true;
+    xTaskNotifyGive(s_commit_task);
   } else {
-    ESP_LOGI(TAG, "Settings saved to NVS successfully");
-  }
-
-  err = nvs_set_u8(nvsHandle, NVS_MENU_THEME_KEY, settings->menu_theme);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save menu_theme: %s", esp_err_to_name(err));
-  err = nvs_set_u8(nvsHandle, NVS_INVERT_COLORS_KEY, settings->invert_colors);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save invert_colors: %s", esp_err_to_name(err));
-  err = nvs_set_u32(nvsHandle, NVS_TERMINAL_TEXT_COLOR_KEY, settings->terminal_text_color);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save terminal_text_color: %s", esp_err_to_name(err));
-  err = nvs_set_u8(nvsHandle, NVS_WEB_AUTH_KEY, settings->web_auth_enabled);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save web_auth_enabled: %s", esp_err_to_name(err));
-  err = nvs_set_u8(nvsHandle, NVS_WEBUI_AP_ONLY_KEY, settings->webui_restrict_to_ap);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save webui_restrict_to_ap: %s", esp_err_to_name(err));
-  err = nvs_set_u8(nvsHandle, NVS_AP_ENABLED_KEY, settings->ap_enabled);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save ap_enabled: %s", esp_err_to_name(err));
-  err = nvs_set_u8(nvsHandle, NVS_POWER_SAVE_KEY, settings->power_save_enabled);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save power_save_enabled: %s", esp_err_to_name(err));
-  
-  err = nvs_set_i32(nvsHandle, NVS_ESP_COMM_TX_PIN_KEY, settings->esp_comm_tx_pin);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save esp_comm_tx_pin: %s", esp_err_to_name(err));
-  
-  err = nvs_set_i32(nvsHandle, NVS_ESP_COMM_RX_PIN_KEY, settings->esp_comm_rx_pin);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save esp_comm_rx_pin: %s", esp_err_to_name(err));
-  
-
-  err = nvs_set_u8(nvsHandle, NVS_ZEBRA_MENUS_KEY, settings->zebra_menus_enabled);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save zebra_menus_enabled: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_INFRARED_EASY_MODE_KEY, settings->infrared_easy_mode);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save infrared_easy_mode: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_NAV_BUTTONS_KEY, settings->nav_buttons_enabled);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save nav_buttons_enabled: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_MENU_LAYOUT_KEY, settings->menu_layout);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save menu_layout: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_NEOPIXEL_MAX_BRIGHTNESS_KEY, settings->neopixel_max_brightness);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save neopixel_max_brightness: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_ENCODER_INVERT_KEY, settings->encoder_invert_direction);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save encoder_invert_direction: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_SETUP_COMPLETE_KEY, settings->setup_complete);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save setup_complete: %s", esp_err_to_name(err));
-
-  err = nvs_set_u8(nvsHandle, NVS_WIFI_COUNTRY_KEY, settings->wifi_country);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save wifi_country: %s", esp_err_to_name(err));
-
-#ifdef CONFIG_WITH_STATUS_DISPLAY
-  err = nvs_set_u8(nvsHandle, NVS_STATUS_IDLE_ANIM_KEY, (uint8_t)settings->status_idle_animation);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save status_idle_animation: %s", esp_err_to_name(err));
-  err = nvs_set_u32(nvsHandle, NVS_STATUS_IDLE_TIMEOUT_KEY, settings->status_idle_timeout_ms);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to save status_idle_timeout_ms: %s", esp_err_to_name(err));
-#endif
-
-  err = nvs_commit(nvsHandle);
-  if (err != ESP_OK) ESP_LOGE(S_TAG, "Failed to commit settings: %s", esp_err_to_name(err));
-
+    settings_flush();
+  }
 }
 
 // Core Settings Getters and Setters
 void settings_set_rgb_mode(FSettings *settings, RGBMode mode) {
+  settings_lock();
   settings->rgb_mode = mode;
+  settings_mark_dirty(FIELD_RGB_MODE);
+  settings_unlock();
 }
 
 void settings_set_rts_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->rts_enabled = enabled;
+  settings_mark_dirty(FIELD_RTS_ENABLED);
+  settings_unlock();
 }
 
 bool settings_get_rts_enabled(const FSettings *settings) {
@@ -908,7 +1081,10 @@ RGBMode settings_get_rgb_mode(const FSettings *settings) {
 }
 
 void settings_set_channel_delay(FSettings *settings, float delay_ms) {
+  settings_lock();
   settings->channel_delay = delay_ms;
+  settings_mark_dirty(FIELD_CHANNEL_DELAY);
+  settings_unlock();
 }
 
 float settings_get_channel_delay(const FSettings *settings) {
@@ -916,7 +1092,10 @@ float settings_get_channel_delay(const FSettings *settings) {
 }
 
 void settings_set_broadcast_speed(FSettings *settings, uint16_t speed) {
+  settings_lock();
   settings->broadcast_speed = speed;
+  settings_mark_dirty(FIELD_BROADCAST_SPEED);
+  settings_unlock();
 }
 
 uint16_t settings_get_broadcast_speed(const FSettings *settings) {
@@ -924,9 +1103,12 @@ uint16_t settings_get_broadcast_speed(const FSettings *settings) {
 }
 
 void settings_set_flappy_ghost_name(FSettings *settings, const char *Name) {
+  settings_lock();
   strncpy(settings->flappy_ghost_name, Name,
           sizeof(settings->flappy_ghost_name) - 1);
   settings->flappy_ghost_name[sizeof(settings->flappy_ghost_name) - 1] = '\0';
+  settings_mark_dirty(FIELD_FLAPPY_NAME);
+  settings_unlock();
 }
 
 const char *settings_get_flappy_ghost_name(const FSettings *settings) {
@@ -934,9 +1116,12 @@ const char *settings_get_flappy_ghost_name(const FSettings *settings) {
 }
 
 void settings_set_timezone_str(FSettings *settings, const char *Name) {
+  settings_lock();
   strncpy(settings->selected_timezone, Name,
           sizeof(settings->selected_timezone) - 1);
   settings->selected_timezone[sizeof(settings->selected_timezone) - 1] = '\0';
+  settings_mark_dirty(FIELD_TIMEZONE);
+  settings_unlock();
 }
 
 const char *settings_get_timezone_str(const FSettings *settings) {
@@ -944,11 +1129,14 @@ const char *settings_get_timezone_str(const FSettings *settings) {
 }
 
 void settings_set_accent_color_str(FSettings *settings, const char *Name) {
+  settings_lock();
   strncpy(settings->selected_hex_accent_color, Name,
           sizeof(settings->selected_hex_accent_color) - 1);
   settings
       ->selected_hex_accent_color[sizeof(settings->selected_hex_accent_color) -
                                   1] = '\0';
+  settings_mark_dirty(FIELD_ACCENT_COLOR);
+  settings_unlock();
 }
 
 const char *settings_get_accent_color_str(const FSettings *settings) {
@@ -956,8 +1144,11 @@ const char *settings_get_accent_color_str(const FSettings *settings) {
 }
 
 void settings_set_ap_ssid(FSettings *settings, const char *ssid) {
+  settings_lock();
   strncpy(settings->ap_ssid, ssid, sizeof(settings->ap_ssid) - 1);
   settings->ap_ssid[sizeof(settings->ap_ssid) - 1] = '\0';
+  settings_mark_dirty(FIELD_AP_SSID);
+  settings_unlock();
 }
 
 const char *settings_get_ap_ssid(const FSettings *settings) {
@@ -965,8 +1156,11 @@ const char *settings_get_ap_ssid(const FSettings *settings) {
 }
 
 void settings_set_ap_password(FSettings *settings, const char *password) {
+  settings_lock();
   strncpy(settings->ap_password, password, sizeof(settings->ap_password) - 1);
   settings->ap_password[sizeof(settings->ap_password) - 1] = '\0';
+  settings_mark_dirty(FIELD_AP_PASSWORD);
+  settings_unlock();
 }
 
 const char *settings_get_ap_password(const FSettings *settings) {
@@ -974,7 +1168,10 @@ const char *settings_get_ap_password(const FSettings *settings) {
 }
 
 void settings_set_gps_rx_pin(FSettings *settings, uint8_t RxPin) {
+  settings_lock();
   settings->gps_rx_pin = RxPin;
+  settings_mark_dirty(FIELD_GPS_RX_PIN);
+  settings_unlock();
 }
 
 uint8_t settings_get_gps_rx_pin(const FSettings *settings) {
@@ -982,7 +1179,10 @@ uint8_t settings_get_gps_rx_pin(const FSettings *settings) {
 }
 
 void settings_set_rgb_speed(FSettings *settings, uint8_t speed) {
+  settings_lock();
   settings->rgb_speed = speed;
+  settings_mark_dirty(FIELD_RGB_SPEED);
+  settings_unlock();
 }
 
 uint8_t settings_get_rgb_speed(const FSettings *settings) {
@@ -991,8 +1191,11 @@ uint8_t settings_get_rgb_speed(const FSettings *settings) {
 
 // Evil Portal Getters and Setters
 void settings_set_portal_url(FSettings *settings, const char *url) {
+  settings_lock();
   strncpy(settings->portal_url, url, sizeof(settings->portal_url) - 1);
   settings->portal_url[sizeof(settings->portal_url) - 1] = '\0';
+  settings_mark_dirty(FIELD_PORTAL_URL);
+  settings_unlock();
 }
 
 const char *settings_get_portal_url(const FSettings *settings) {
@@ -1000,8 +1203,11 @@ const char *settings_get_portal_url(const FSettings *settings) {
 }
 
 void settings_set_portal_ssid(FSettings *settings, const char *ssid) {
+  settings_lock();
   strncpy(settings->portal_ssid, ssid, sizeof(settings->portal_ssid) - 1);
   settings->portal_ssid[sizeof(settings->portal_ssid) - 1] = '\0';
+  settings_mark_dirty(FIELD_PORTAL_SSID);
+  settings_unlock();
 }
 
 const char *settings_get_portal_ssid(const FSettings *settings) {
@@ -1009,9 +1215,12 @@ const char *settings_get_portal_ssid(const FSettings *settings) {
 }
 
 void settings_set_portal_password(FSettings *settings, const char *password) {
+  settings_lock();
   strncpy(settings->portal_password, password,
           sizeof(settings->portal_password) - 1);
   settings->portal_password[sizeof(settings->portal_password) - 1] = '\0';
+  settings_mark_dirty(FIELD_PORTAL_PASSWORD);
+  settings_unlock();
 }
 
 const char *settings_get_portal_password(const FSettings *settings) {
@@ -1019,9 +1228,12 @@ const char *settings_get_portal_password(const FSettings *settings) {
 }
 
 void settings_set_portal_ap_ssid(FSettings *settings, const char *ap_ssid) {
+  settings_lock();
   strncpy(settings->portal_ap_ssid, ap_ssid,
           sizeof(settings->portal_ap_ssid) - 1);
   settings->portal_ap_ssid[sizeof(settings->portal_ap_ssid) - 1] = '\0';
+  settings_mark_dirty(FIELD_PORTAL_AP_SSID);
+  settings_unlock();
 }
 
 const char *settings_get_portal_ap_ssid(const FSettings *settings) {
@@ -1029,8 +1241,11 @@ const char *settings_get_portal_ap_ssid(const FSettings *settings) {
 }
 
 void settings_set_portal_domain(FSettings *settings, const char *domain) {
+  settings_lock();
   strncpy(settings->portal_domain, domain, sizeof(settings->portal_domain) - 1);
   settings->portal_domain[sizeof(settings->portal_domain) - 1] = '\0';
+  settings_mark_dirty(FIELD_PORTAL_DOMAIN);
+  settings_unlock();
 }
 
 const char *settings_get_portal_domain(const FSettings *settings) {
@@ -1038,7 +1253,10 @@ const char *settings_get_portal_domain(const FSettings *settings) {
 }
 
 void settings_set_portal_offline_mode(FSettings *settings, bool offline_mode) {
+  settings_lock();
   settings->portal_offline_mode = offline_mode;
+  settings_mark_dirty(FIELD_PORTAL_OFFLINE);
+  settings_unlock();
 }
 
 bool settings_get_portal_offline_mode(const FSettings *settings) {
@@ -1047,8 +1265,11 @@ bool settings_get_portal_offline_mode(const FSettings *settings) {
 
 // Power Printer Getters and Setters
 void settings_set_printer_ip(FSettings *settings, const char *ip) {
+  settings_lock();
   strncpy(settings->printer_ip, ip, sizeof(settings->printer_ip) - 1);
   settings->printer_ip[sizeof(settings->printer_ip) - 1] = '\0';
+  settings_mark_dirty(FIELD_PRINTER_IP);
+  settings_unlock();
 }
 
 const char *settings_get_printer_ip(const FSettings *settings) {
@@ -1056,8 +1277,11 @@ const char *settings_get_printer_ip(const FSettings *settings) {
 }
 
 void settings_set_printer_text(FSettings *settings, const char *text) {
+  settings_lock();
   strncpy(settings->printer_text, text, sizeof(settings->printer_text) - 1);
   settings->printer_text[sizeof(settings->printer_text) - 1] = '\0';
+  settings_mark_dirty(FIELD_PRINTER_TEXT);
+  settings_unlock();
 }
 
 const char *settings_get_printer_text(const FSettings *settings) {
@@ -1065,7 +1289,10 @@ const char *settings_get_printer_text(const FSettings *settings) {
 }
 
 void settings_set_printer_font_size(FSettings *settings, uint8_t font_size) {
+  settings_lock();
   settings->printer_font_size = font_size;
+  settings_mark_dirty(FIELD_PRINTER_FONT_SIZE);
+  settings_unlock();
 }
 
 uint8_t settings_get_printer_font_size(const FSettings *settings) {
@@ -1074,7 +1301,10 @@ uint8_t settings_get_printer_font_size(const FSettings *settings) {
 
 void settings_set_printer_alignment(FSettings *settings,
                                     PrinterAlignment alignment) {
+  settings_lock();
   settings->printer_alignment = alignment;
+  settings_mark_dirty(FIELD_PRINTER_ALIGNMENT);
+  settings_unlock();
 }
 
 PrinterAlignment settings_get_printer_alignment(const FSettings *settings) {
@@ -1082,6 +1312,7 @@ PrinterAlignment settings_get_printer_alignment(const FSettings *settings) {
 }
 
 void settings_set_display_timeout(FSettings *settings, uint32_t timeout_ms) {
+  settings_lock();
   ESP_LOGI(TAG, "Setting display timeout from %lu to %lu ms",
            settings->display_timeout_ms, timeout_ms);
   if (timeout_ms == 0) { // "Never" option
@@ -1089,6 +1320,8 @@ void settings_set_display_timeout(FSettings *settings, uint32_t timeout_ms) {
   } else {
       settings->display_timeout_ms = timeout_ms;
   }
+  settings_mark_dirty(FIELD_DISPLAY_TIMEOUT);
+  settings_unlock();
 }
 
 uint32_t settings_get_display_timeout(const FSettings *settings) {
@@ -1097,8 +1330,11 @@ uint32_t settings_get_display_timeout(const FSettings *settings) {
 
 // Station Mode Credentials Implementation
 void settings_set_sta_ssid(FSettings *settings, const char *ssid) {
+  settings_lock();
   strncpy(settings->sta_ssid, ssid, sizeof(settings->sta_ssid) - 1);
   settings->sta_ssid[sizeof(settings->sta_ssid) - 1] = '\0';
+  settings_mark_dirty(FIELD_STA_SSID);
+  settings_unlock();
 }
 
 const char *settings_get_sta_ssid(const FSettings *settings) {
@@ -1106,8 +1342,11 @@ const char *settings_get_sta_ssid(const FSettings *settings) {
 }
 
 void settings_set_sta_password(FSettings *settings, const char *password) {
+  settings_lock();
   strncpy(settings->sta_password, password, sizeof(settings->sta_password) - 1);
   settings->sta_password[sizeof(settings->sta_password) - 1] = '\0';
+  settings_mark_dirty(FIELD_STA_PASSWORD);
+  settings_unlock();
 }
 
 const char *settings_get_sta_password(const FSettings *settings) {
@@ -1115,7 +1354,10 @@ const char *settings_get_sta_password(const FSettings *settings) {
 }
 
 void settings_set_rgb_data_pin(FSettings *settings, int32_t pin) {
+  settings_lock();
   settings->rgb_data_pin = pin;
+  settings_mark_dirty(FIELD_RGB_DATA_PIN);
+  settings_unlock();
 }
 
 int32_t settings_get_rgb_data_pin(const FSettings *settings) {
@@ -1123,9 +1365,14 @@ int32_t settings_get_rgb_data_pin(const FSettings *settings) {
 }
 
 void settings_set_rgb_separate_pins(FSettings *settings, int32_t red, int32_t green, int32_t blue) {
+  settings_lock();
   settings->rgb_red_pin = red;
   settings->rgb_green_pin = green;
   settings->rgb_blue_pin = blue;
+  settings_mark_dirty(FIELD_RGB_RED_PIN);
+  settings_mark_dirty(FIELD_RGB_GREEN_PIN);
+  settings_mark_dirty(FIELD_RGB_BLUE_PIN);
+  settings_unlock();
 }
 
 void settings_get_rgb_separate_pins(const FSettings *settings, int32_t *red, int32_t *green, int32_t *blue) {
@@ -1135,7 +1382,10 @@ void settings_get_rgb_separate_pins(const FSettings *settings, int32_t *red, int
 }
 
 void settings_set_rgb_led_count(FSettings *settings, uint16_t count) {
+  settings_lock();
   settings->rgb_led_count = count;
+  settings_mark_dirty(FIELD_RGB_LED_COUNT);
+  settings_unlock();
 }
 
 uint16_t settings_get_rgb_led_count(const FSettings *settings) {
@@ -1143,7 +1393,10 @@ uint16_t settings_get_rgb_led_count(const FSettings *settings) {
 }
 
 void settings_set_thirds_control_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->third_control_enabled = enabled;
+  settings_mark_dirty(FIELD_THIRD_CTRL);
+  settings_unlock();
 }
 
 bool settings_get_thirds_control_enabled(const FSettings *settings) {
@@ -1151,7 +1404,10 @@ bool settings_get_thirds_control_enabled(const FSettings *settings) {
 }
 
 void settings_set_menu_theme(FSettings *settings, uint8_t theme) {
+  settings_lock();
   settings->menu_theme = theme;
+  settings_mark_dirty(FIELD_MENU_THEME);
+  settings_unlock();
 }
 
 uint8_t settings_get_menu_theme(const FSettings *settings) {
@@ -1159,7 +1415,10 @@ uint8_t settings_get_menu_theme(const FSettings *settings) {
 }
 
 void settings_set_terminal_text_color(FSettings *settings, uint32_t color) {
+  settings_lock();
   settings->terminal_text_color = color;
+  settings_mark_dirty(FIELD_TERMINAL_COLOR);
+  settings_unlock();
 }
 
 uint32_t settings_get_terminal_text_color(const FSettings *settings) {
@@ -1167,7 +1426,10 @@ uint32_t settings_get_terminal_text_color(const FSettings *settings) {
 }
 
 void settings_set_invert_colors(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->invert_colors = enabled;
+  settings_mark_dirty(FIELD_INVERT_COLORS);
+  settings_unlock();
 }
 
 bool settings_get_invert_colors(const FSettings *settings) {
@@ -1175,7 +1437,10 @@ bool settings_get_invert_colors(const FSettings *settings) {
 }
 
 void settings_set_web_auth_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->web_auth_enabled = enabled;
+  settings_mark_dirty(FIELD_WEB_AUTH);
+  settings_unlock();
 }
 
 bool settings_get_web_auth_enabled(const FSettings *settings) {
@@ -1183,7 +1448,10 @@ bool settings_get_web_auth_enabled(const FSettings *settings) {
 }
 
 void settings_set_webui_restrict_to_ap(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->webui_restrict_to_ap = enabled;
+  settings_mark_dirty(FIELD_WEBUI_AP_ONLY);
+  settings_unlock();
 }
 
 bool settings_get_webui_restrict_to_ap(const FSettings *settings) {
@@ -1191,7 +1459,10 @@ bool settings_get_webui_restrict_to_ap(const FSettings *settings) {
 }
 
 void settings_set_ap_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->ap_enabled = enabled;
+  settings_mark_dirty(FIELD_AP_ENABLED);
+  settings_unlock();
 }
 
 bool settings_get_ap_enabled(const FSettings *settings) {
@@ -1199,7 +1470,10 @@ bool settings_get_ap_enabled(const FSettings *settings) {
 }
 
 void settings_set_power_save_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->power_save_enabled = enabled;
+  settings_mark_dirty(FIELD_POWER_SAVE);
+  settings_unlock();
 }
 
 bool settings_get_power_save_enabled(const FSettings *settings) {
@@ -1207,8 +1481,12 @@ bool settings_get_power_save_enabled(const FSettings *settings) {
 }
 
 void settings_set_esp_comm_pins(FSettings *settings, int32_t tx_pin, int32_t rx_pin) {
+  settings_lock();
   settings->esp_comm_tx_pin = tx_pin;
   settings->esp_comm_rx_pin = rx_pin;
+  settings_mark_dirty(FIELD_ESP_COMM_TX_PIN);
+  settings_mark_dirty(FIELD_ESP_COMM_RX_PIN);
+  settings_unlock();
 }
 
 void settings_get_esp_comm_pins(const FSettings *settings, int32_t *tx_pin, int32_t *rx_pin) {
@@ -1218,8 +1496,11 @@ void settings_get_esp_comm_pins(const FSettings *settings, int32_t *tx_pin, int3
 
 
 void settings_set_max_screen_brightness(FSettings *settings, uint8_t value) {
+  settings_lock();
     if (value > 100) value = 100;
     settings->max_screen_brightness = value;
+    settings_mark_dirty(FIELD_MAX_BRIGHTNESS);
+  settings_unlock();
 }
 uint8_t settings_get_max_screen_brightness(const FSettings *settings) {
     return settings->max_screen_brightness;
@@ -1228,7 +1509,10 @@ uint8_t settings_get_max_screen_brightness(const FSettings *settings) {
 
 // Infrared Settings Getters and Setters
 void settings_set_infrared_easy_mode(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->infrared_easy_mode = enabled;
+  settings_mark_dirty(FIELD_IR_EASY_MODE);
+  settings_unlock();
 }
 
 bool settings_get_infrared_easy_mode(const FSettings *settings) {
@@ -1314,7 +1598,10 @@ void settings_print_namespace_stats(const char *namespace_name) {
 }
 
 void settings_set_zebra_menus_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
     settings->zebra_menus_enabled = enabled;
+    settings_mark_dirty(FIELD_ZEBRA_MENUS);
+  settings_unlock();
 }
 
 bool settings_get_zebra_menus_enabled(const FSettings *settings) {
@@ -1322,7 +1609,10 @@ bool settings_get_zebra_menus_enabled(const FSettings *settings) {
 }
 
 void settings_set_nav_buttons_enabled(FSettings *settings, bool enabled) {
+  settings_lock();
     settings->nav_buttons_enabled = enabled;
+    settings_mark_dirty(FIELD_NAV_BUTTONS);
+  settings_unlock();
 }
 
 bool settings_get_nav_buttons_enabled(const FSettings *settings) {
@@ -1331,7 +1621,10 @@ bool settings_get_nav_buttons_enabled(const FSettings *settings) {
 
 // Menu layout settings
 void settings_set_menu_layout(FSettings *settings, uint8_t layout) {
+  settings_lock();
     settings->menu_layout = layout;
+    settings_mark_dirty(FIELD_MENU_LAYOUT);
+  settings_unlock();
 }
 
 uint8_t settings_get_menu_layout(const FSettings *settings) {
@@ -1340,8 +1633,11 @@ uint8_t settings_get_menu_layout(const FSettings *settings) {
 
 // Neopixel brightness settings
 void settings_set_neopixel_max_brightness(FSettings *settings, uint8_t brightness) {
+  settings_lock();
     if (brightness > 100) brightness = 100;
     settings->neopixel_max_brightness = brightness;
+    settings_mark_dirty(FIELD_NEOPIXEL_BRIGHTNESS);
+  settings_unlock();
 }
 
 uint8_t settings_get_neopixel_max_brightness(const FSettings *settings) {
@@ -1349,7 +1645,10 @@ uint8_t settings_get_neopixel_max_brightness(const FSettings *settings) {
 }
 
 void settings_set_encoder_invert_direction(FSettings *settings, bool enabled) {
+  settings_lock();
   settings->encoder_invert_direction = enabled;
+  settings_mark_dirty(FIELD_ENCODER_INVERT);
+  settings_unlock();
 }
 
 bool settings_get_encoder_invert_direction(const FSettings *settings) {
@@ -1357,7 +1656,10 @@ bool settings_get_encoder_invert_direction(const FSettings *settings) {
 }
 
 void settings_set_setup_complete(FSettings *settings, bool complete) {
+  settings_lock();
   settings->setup_complete = complete;
+  settings_mark_dirty(FIELD_SETUP_COMPLETE);
+  settings_unlock();
 }
 
 bool settings_get_setup_complete(const FSettings *settings) {
@@ -1365,7 +1667,10 @@ bool settings_get_setup_complete(const FSettings *settings) {
 }
 
 void settings_set_wifi_country(FSettings *settings, uint8_t country) {
+  settings_lock();
   settings->wifi_country = country;
+  settings_mark_dirty(FIELD_WIFI_COUNTRY);
+  settings_unlock();
 }
 
 uint8_t settings_get_wifi_country(const FSettings *settings) {
@@ -1374,7 +1679,10 @@ uint8_t settings_get_wifi_country(const FSettings *settings) {
 
 #ifdef CONFIG_WITH_STATUS_DISPLAY
 void settings_set_status_idle_animation(FSettings *settings, IdleAnimation anim) {
+  settings_lock();
   settings->status_idle_animation = anim;
+  settings_mark_dirty(FIELD_IDLE_ANIM);
+  settings_unlock();
 }
 
 IdleAnimation settings_get_status_idle_animation(const FSettings *settings) {
@@ -1382,7 +1690,10 @@ IdleAnimation settings_get_status_idle_animation(const FSettings *settings) {
 }
 
 void settings_set_status_idle_timeout_ms(FSettings *settings, uint32_t timeout_ms) {
+  settings_lock();
   settings->status_idle_timeout_ms = timeout_ms;
+  settings_mark_dirty(FIELD_IDLE_TIMEOUT);
+  settings_unlock();
 }
 
 uint32_t settings_get_status_idle_timeout_ms(const FSettings *settings) {
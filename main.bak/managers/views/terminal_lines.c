@@ -0,0 +1,147 @@
+#include "managers/views/terminal_lines.h"
+
+#include <string.h>
+
+const char *term_lines_text(const term_lines_t *t, uint16_t i, int col) {
+  const term_line_t *l = term_lines_at(t, i);
+  const char *txt = t->arena + l->off;
+  if (col == TERM_COL_DUALCOMM) txt += l->disp;
+  return txt[0] ? txt : " ";
+}
+
+void term_lines_clear(term_lines_t *t) {
+  t->head = 0;
+  t->count = 0;
+  t->laid_out = 0;
+  t->arena_head = 0;
+  t->arena_tail = 0;
+}
+
+static void drop_oldest_line(term_lines_t *t) {
+  if (t->count == 0) return;
+  t->head = (t->head + 1) % TERM_MAX_LINES;
+  t->count--;
+  if (t->laid_out) t->laid_out--;
+  if (t->count == 0) {
+    t->arena_tail = t->arena_head;
+  } else {
+    // lines are in arena order, so the next one starts at most one lap ahead
+    t->arena_tail += (term_lines_at(t, 0)->off - t->arena_tail) & TERM_TEXT_MASK;
+  }
+}
+
+void term_lines_append(term_lines_t *t, const char *line, size_t len) {
+  if (!t->arena || !t->lines) return;
+  if (len > TERM_MAX_LINE_LEN) len = TERM_MAX_LINE_LEN;
+  uint32_t need = (uint32_t)len + 1;
+
+  if (t->count >= TERM_MAX_LINES) {
+    drop_oldest_line(t);
+  }
+
+  uint32_t pos = t->arena_head;
+  uint32_t idx = pos & TERM_TEXT_MASK;
+  if (idx + need > TERM_TEXT_BYTES) {
+    pos += TERM_TEXT_BYTES - idx; // skip the tail gap, keep the text contiguous
+  }
+  while (t->count > 0 && pos + need - t->arena_tail > TERM_TEXT_BYTES) {
+    drop_oldest_line(t);
+  }
+  if (t->count == 0) t->arena_tail = pos;
+
+  char *text = t->arena + (pos & TERM_TEXT_MASK);
+  memcpy(text, line, len);
+  text[len] = '\0';
+  t->arena_head = pos + need;
+
+  // classify once here instead of on every redraw
+  term_line_t *l = term_lines_at(t, t->count);
+  l->off = (uint16_t)(pos & TERM_TEXT_MASK);
+  l->len = (uint16_t)len;
+  l->pxh = 0; // laid out lazily
+  l->flags = 0;
+  l->disp = 0;
+  if (terminal_is_dualcomm_line(text)) {
+    size_t disp = (size_t)(terminal_dualcomm_display_text(text) - text);
+    l->flags |= TERM_LINE_DUALCOMM;
+    l->disp = disp > UINT8_MAX ? 0 : (uint8_t)disp;
+  }
+  t->count++;
+}
+
+void term_lines_invalidate(term_lines_t *t) {
+  t->laid_out = 0;
+}
+
+void term_lines_layout(term_lines_t *t, term_measure_t measure, void *ctx) {
+  // only lines appended since the last pass need measuring
+  for (uint16_t i = t->laid_out; i < t->count; i++) {
+    term_line_t *l = term_lines_at(t, i);
+    l->pxh = measure(ctx, l->len ? t->arena + l->off : " ");
+    if (i == 0) {
+      l->top = 0;
+      l->top_dc = 0;
+    } else {
+      const term_line_t *p = term_lines_at(t, i - 1);
+      l->top = p->top + p->pxh;
+      l->top_dc = p->top_dc + ((p->flags & TERM_LINE_DUALCOMM) ? p->pxh : 0);
+    }
+  }
+  t->laid_out = t->count;
+}
+
+int32_t term_lines_height(const term_lines_t *t, bool split) {
+  if (!t->laid_out) return 0;
+  const term_line_t *f = term_lines_at(t, 0);
+  const term_line_t *l = term_lines_at(t, t->laid_out - 1);
+  uint32_t all = l->top + l->pxh - f->top;
+  uint32_t dc = l->top_dc + ((l->flags & TERM_LINE_DUALCOMM) ? l->pxh : 0) - f->top_dc;
+  if (!split) return (int32_t)all;
+  return (int32_t)((all - dc) > dc ? (all - dc) : dc);
+}
+
+int32_t term_lines_y(const term_lines_t *t, uint16_t i, int col) {
+  const term_line_t *f = term_lines_at(t, 0);
+  const term_line_t *l = term_lines_at(t, i);
+  uint32_t all = l->top - f->top;
+  uint32_t dc = l->top_dc - f->top_dc;
+  if (col == TERM_COL_ALL) return (int32_t)all;
+  return (int32_t)(col == TERM_COL_DUALCOMM ? dc : all - dc);
+}
+
+uint16_t term_lines_first_visible(const term_lines_t *t, int col, int32_t y) {
+  uint16_t lo = 0, hi = t->laid_out;
+  while (lo < hi) {
+    uint16_t mid = lo + (hi - lo) / 2;
+    const term_line_t *l = term_lines_at(t, mid);
+    int32_t bottom = term_lines_y(t, mid, col) + (term_line_in_column(l, col) ? l->pxh : 0);
+    if (bottom < y) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+bool terminal_is_dualcomm_line(const char *text) {
+  if (!text) return false;
+  if (strstr(text, "RX: ") != NULL) return true;
+  if (strstr(text, "I: Discovered peer:") != NULL) return true;
+  if (strstr(text, "Peer has smaller name") != NULL) return true;
+  if (strstr(text, "I: Connecting to peer:") != NULL) return true;
+  if (strstr(text, "I: Sent command:") != NULL) return true;
+  if (strstr(text, "Handshake completed!") != NULL) return true;
+  if (strstr(text, "W: Handshake timeout") != NULL) return true;
+  if (strstr(text, "W: Connection lost, restarting discovery") != NULL) return true;
+  if (strstr(text, "ESP Comm Response: ") != NULL) return true;
+  return false;
+}
+
+const char *terminal_dualcomm_display_text(const char *text) {
+  if (!text) return "";
+  // trim leading spaces
+  while (*text == ' ' || *text == '\t') text++;
+  if (strncmp(text, "RX: ", 4) == 0) return text + 4;
+  if (strncmp(text, "I: ", 3) == 0) return text + 3;
+  if (strncmp(text, "W: ", 3) == 0) return text + 3;
+  if (strncmp(text, "ESP Comm Response: ", 19) == 0) return text + 19;
+  return text;
+}
@@ -6,6 +6,7 @@
 #include "freertos/portmacro.h"
 #include "managers/views/main_menu_screen.h"
 #include "managers/views/keyboard_screen.h"
+#include "managers/views/terminal_lines.h"
 #include "managers/wifi_manager.h"
 #include "managers/display_manager.h"
 #include "gui/screen_layout.h"
@@ -110,19 +111,8 @@ static size_t last_displayed_wcount = 0;
 
 // Virtualized terminal canvas and line storage
 static lv_obj_t *terminal_canvas = NULL;
-// Reasonable caps to keep memory and draw bounded
-#define MAX_TERMINAL_LINES 400
-#define MAX_TERMINAL_TEXT_BYTES (MAX_TEXT_LENGTH * 2)
-
-typedef struct {
-  char *text;
-  uint16_t pxh; // cached pixel height at last layout width
-} TermLine;
-
-static TermLine term_lines[MAX_TERMINAL_LINES];
-static uint16_t term_line_head = 0;   // index of oldest
-static uint16_t term_line_count = 0;  // number of valid lines
-static size_t term_text_bytes = 0;    // total bytes across stored lines
+// scrollback text and its y index, see terminal_lines.h
+static term_lines_t term_lines;
 
 static char *build_line_buf = NULL;   // partial line builder
 static size_t build_len = 0;
@@ -145,7 +135,7 @@ static void *terminal_alloc_buffer(size_t size) {
 }
 
 static bool ensure_terminal_buffers(void) {
-  if (term_ring && terminal_incoming_buf) {
+  if (term_ring && terminal_incoming_buf && term_lines.arena && term_lines.lines) {
     return true;
   }
 
@@ -167,6 +157,22 @@ static bool ensure_terminal_buffers(void) {
     terminal_incoming_buf[0] = '\0';
   }
 
+  if (!term_lines.arena) {
+    term_lines.arena = terminal_alloc_buffer(TERM_TEXT_BYTES);
+    if (!term_lines.arena) {
+      ESP_LOGE(TAG, "Failed to allocate terminal text arena");
+      return false;
+    }
+  }
+
+  if (!term_lines.lines) {
+    term_lines.lines = terminal_alloc_buffer(TERM_MAX_LINES * sizeof(term_line_t));
+    if (!term_lines.lines) {
+      ESP_LOGE(TAG, "Failed to allocate terminal line index");
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -265,52 +271,7 @@ static void scroll_to_bottom_if_needed(bool was_near_bottom) {
 // ========== Virtualized terminal helpers ==========
 
 static void clear_lines(void) {
-  for (uint16_t i = 0; i < term_line_count; i++) {
-    uint16_t idx = (term_line_head + i) % MAX_TERMINAL_LINES;
-    if (term_lines[idx].text) {
-      free(term_lines[idx].text);
-      term_lines[idx].text = NULL;
-    }
-    term_lines[idx].pxh = 0;
-  }
-  term_line_head = 0;
-  term_line_count = 0;
-  term_text_bytes = 0;
-}
-
-static void drop_oldest_line(void) {
-  if (term_line_count == 0) return;
-  uint16_t idx = term_line_head;
-  if (term_lines[idx].text) {
-    term_text_bytes -= strlen(term_lines[idx].text);
-    free(term_lines[idx].text);
-  }
-  term_lines[idx].text = NULL;
-  term_lines[idx].pxh = 0;
-  term_line_head = (term_line_head + 1) % MAX_TERMINAL_LINES;
-  term_line_count--;
-}
-
-static void append_line(const char *line, size_t len) {
-  // allocate and copy
-  char *copy = (char *)malloc(len + 1);
-  if (!copy) return;
-  memcpy(copy, line, len);
-  copy[len] = '\0';
-
-  // ensure capacity by dropping oldest
-  if (term_line_count >= MAX_TERMINAL_LINES) {
-    drop_oldest_line();
-  }
-  while (term_text_bytes + len > MAX_TERMINAL_TEXT_BYTES && term_line_count > 0) {
-    drop_oldest_line();
-  }
-
-  uint16_t idx = (term_line_head + term_line_count) % MAX_TERMINAL_LINES;
-  term_lines[idx].text = copy;
-  term_lines[idx].pxh = 0; // recalc lazily
-  term_line_count++;
-  term_text_bytes += len;
+  term_lines_clear(&term_lines);
 }
 
 static void build_reserve(size_t need) {
@@ -337,7 +298,7 @@ static void terminal_push_incoming(const char *data, size_t len) {
       build_len += chunk;
       // trim trailing CR
       if (build_len && build_line_buf[build_len - 1] == '\r') build_len--;
-      append_line(build_line_buf, build_len);
+      term_lines_append(&term_lines, build_line_buf, build_len);
       build_len = 0;
       p = nl + 1;
       rem = data + len - p;
@@ -351,8 +312,21 @@ static void terminal_push_incoming(const char *data, size_t len) {
   }
 }
 
-static bool terminal_is_dualcomm_line(const char *text);
-static const char *terminal_dualcomm_display_text(const char *text);
+typedef struct {
+  const lv_font_t *font;
+  lv_coord_t letter_space;
+  lv_coord_t line_space;
+  lv_coord_t width;
+} term_measure_ctx_t;
+
+static uint16_t term_measure_line(void *ctx, const char *text) {
+  const term_measure_ctx_t *m = ctx;
+  lv_point_t sz;
+  lv_txt_get_size(&sz, text, m->font, m->letter_space, m->line_space, m->width,
+                  LV_TEXT_FLAG_NONE);
+  if (sz.y <= 0) sz.y = lv_font_get_line_height(m->font);
+  return (uint16_t)sz.y;
+}
 
 static void recalc_layout_if_needed(void) {
   if (!terminal_canvas || !lv_obj_is_valid(terminal_canvas)) return;
@@ -365,30 +339,19 @@ static void recalc_layout_if_needed(void) {
 
   if (col_w != cached_layout_width) {
     // width changed, invalidate cached heights
-    for (uint16_t i = 0; i < term_line_count; i++) {
-      uint16_t idx = (term_line_head + i) % MAX_TERMINAL_LINES;
-      term_lines[idx].pxh = 0;
-    }
+    term_lines_invalidate(&term_lines);
     cached_layout_width = col_w;
   }
 
-  const lv_font_t *font = lv_obj_get_style_text_font(terminal_canvas, 0);
-  lv_coord_t letter_space = lv_obj_get_style_text_letter_space(terminal_canvas, 0);
-  lv_coord_t line_space = lv_obj_get_style_text_line_space(terminal_canvas, 0);
-
-  lv_coord_t total = 0;
-  for (uint16_t i = 0; i < term_line_count; i++) {
-    uint16_t idx = (term_line_head + i) % MAX_TERMINAL_LINES;
-    TermLine *L = &term_lines[idx];
-    if (L->pxh == 0) {
-      lv_point_t sz;
-      const char *txt = (L->text && L->text[0]) ? L->text : " ";
-      lv_txt_get_size(&sz, txt, font, letter_space, line_space, col_w, LV_TEXT_FLAG_NONE);
-      if (sz.y <= 0) sz.y = lv_font_get_line_height(font);
-      L->pxh = (uint16_t)sz.y;
-    }
-    total += L->pxh;
-  }
+  term_measure_ctx_t m = {
+      .font = lv_obj_get_style_text_font(terminal_canvas, 0),
+      .letter_space = lv_obj_get_style_text_letter_space(terminal_canvas, 0),
+      .line_space = lv_obj_get_style_text_line_space(terminal_canvas, 0),
+      .width = col_w,
+  };
+  term_lines_layout(&term_lines, term_measure_line, &m);
+
+  lv_coord_t total = (lv_coord_t)term_lines_height(&term_lines, split);
   if (total <= 0) total = 1;
   cached_total_height = total;
   lv_obj_set_height(terminal_canvas, total);
@@ -401,6 +364,25 @@ static void terminal_canvas_size_event(lv_event_t *e) {
   if (terminal_canvas) lv_obj_invalidate(terminal_canvas);
 }
 
+static void term_draw_column(lv_draw_ctx_t *draw_ctx, lv_draw_label_dsc_t *dsc,
+                             const lv_area_t *obj_coords, int col, lv_coord_t x1, lv_coord_t x2,
+                             lv_coord_t local_top, lv_coord_t local_bottom) {
+  for (uint16_t i = term_lines_first_visible(&term_lines, col, local_top);
+       i < term_lines.laid_out; i++) {
+    const term_line_t *L = term_lines_at(&term_lines, i);
+    if (!term_line_in_column(L, col)) continue;
+    lv_coord_t y = (lv_coord_t)term_lines_y(&term_lines, i, col);
+    if (y > local_bottom) break;
+    const char *txt = term_lines_text(&term_lines, i, col);
+    lv_area_t a;
+    a.x1 = x1;
+    a.y1 = obj_coords->y1 + y;
+    a.x2 = x2;
+    a.y2 = a.y1 + L->pxh - 1;
+    lv_draw_label(draw_ctx, dsc, &a, txt, NULL);
+  }
+}
+
 static void terminal_canvas_draw_event(lv_event_t *e) {
   lv_obj_t *obj = lv_event_get_target(e);
   if (!obj || obj != terminal_canvas) return;
@@ -429,67 +411,14 @@ static void terminal_canvas_draw_event(lv_event_t *e) {
   lv_coord_t local_bottom = clip->y2 - obj_coords.y1;
 
   if (!split) {
-    // Single-column mode: draw all lines sequentially as before
-    lv_coord_t y = 0;
-    for (uint16_t i = 0; i < term_line_count; i++) {
-      uint16_t idx = (term_line_head + i) % MAX_TERMINAL_LINES;
-      TermLine *L = &term_lines[idx];
-      lv_coord_t h = L->pxh;
-      if ((y + h) < local_top) { y += h; continue; }
-      if (y > local_bottom) break;
-      const char *txt = (L->text && L->text[0]) ? L->text : " ";
-      lv_area_t a;
-      a.x1 = obj_coords.x1;
-      a.y1 = obj_coords.y1 + y;
-      a.x2 = a.x1 + col_w - 1;
-      a.y2 = a.y1 + h - 1;
-      lv_draw_label(draw_ctx, &dsc, &a, txt, NULL);
-      y += h;
-    }
+    term_draw_column(draw_ctx, &dsc, &obj_coords, TERM_COL_ALL, obj_coords.x1,
+                     obj_coords.x1 + col_w - 1, local_top, local_bottom);
   } else {
-    // Split view: compact each column independently
-    // Left column: non-Dual-Comm logs
-    lv_coord_t y_left = 0;
-    for (uint16_t i = 0; i < term_line_count; i++) {
-      uint16_t idx = (term_line_head + i) % MAX_TERMINAL_LINES;
-      TermLine *L = &term_lines[idx];
-      lv_coord_t h = L->pxh;
-      const char *txt = (L->text && L->text[0]) ? L->text : " ";
-      if (terminal_is_dualcomm_line(txt)) {
-        continue; // skip Dual Comm lines in left column
-      }
-      if ((y_left + h) < local_top) { y_left += h; continue; }
-      if (y_left > local_bottom) break;
-      lv_area_t a;
-      a.x1 = obj_coords.x1;
-      a.y1 = obj_coords.y1 + y_left;
-      a.x2 = a.x1 + col_w - 1;
-      a.y2 = a.y1 + h - 1;
-      lv_draw_label(draw_ctx, &dsc, &a, txt, NULL);
-      y_left += h;
-    }
-
-    // Right column: Dual-Comm-only view
-    lv_coord_t y_right = 0;
-    for (uint16_t i = 0; i < term_line_count; i++) {
-      uint16_t idx = (term_line_head + i) % MAX_TERMINAL_LINES;
-      TermLine *L = &term_lines[idx];
-      lv_coord_t h = L->pxh;
-      const char *txt = (L->text && L->text[0]) ? L->text : " ";
-      if (!terminal_is_dualcomm_line(txt)) {
-        continue; // skip non-Dual lines in right column
-      }
-      if ((y_right + h) < local_top) { y_right += h; continue; }
-      if (y_right > local_bottom) break;
-      const char *s = terminal_dualcomm_display_text(txt);
-      lv_area_t b;
-      b.x1 = obj_coords.x1 + col_w;
-      b.y1 = obj_coords.y1 + y_right;
-      b.x2 = obj_coords.x1 + w - 1;
-      b.y2 = b.y1 + h - 1;
-      lv_draw_label(draw_ctx, &dsc, &b, s, NULL);
-      y_right += h;
-    }
+    // Left column: non-Dual-Comm logs, right column: Dual-Comm-only view
+    term_draw_column(draw_ctx, &dsc, &obj_coords, TERM_COL_LOCAL, obj_coords.x1,
+                     obj_coords.x1 + col_w - 1, local_top, local_bottom);
+    term_draw_column(draw_ctx, &dsc, &obj_coords, TERM_COL_DUALCOMM, obj_coords.x1 + col_w,
+                     obj_coords.x1 + w - 1, local_top, local_bottom);
   }
 }
 
@@ -881,31 +810,6 @@ void terminal_view_destroy(void) {
     lvgl_timer_del_safe(&terminal_cleanup_retry_timer);
 }
 
-static bool terminal_is_dualcomm_line(const char *text) {
-  if (!text) return false;
-  if (strstr(text, "RX: ") != NULL) return true;
-  if (strstr(text, "I: Discovered peer:") != NULL) return true;
-  if (strstr(text, "Peer has smaller name") != NULL) return true;
-  if (strstr(text, "I: Connecting to peer:") != NULL) return true;
-  if (strstr(text, "I: Sent command:") != NULL) return true;
-  if (strstr(text, "Handshake completed!") != NULL) return true;
-  if (strstr(text, "W: Handshake timeout") != NULL) return true;
-  if (strstr(text, "W: Connection lost, restarting discovery") != NULL) return true;
-  if (strstr(text, "ESP Comm Response: ") != NULL) return true;
-  return false;
-}
-
-static const char *terminal_dualcomm_display_text(const char *text) {
-  if (!text) return "";
-  // trim leading spaces
-  while (*text == ' ' || *text == '\t') text++;
-  if (strncmp(text, "RX: ", 4) == 0) return text + 4;
-  if (strncmp(text, "I: ", 3) == 0) return text + 3;
-  if (strncmp(text, "W: ", 3) == 0) return text + 3;
-  if (strncmp(text, "ESP Comm Response: ", 20) == 0) return text + 20;
-  return text;
-}
-
 void terminal_view_add_text(const char *text) {
   if (!text || is_stopping || text[0] == '\0') {
       return;
@@ -3,6 +3,7 @@
 #include "managers/wifi_manager.h"
 #include "core/callbacks.h"  // For callback function declarations
 #include "core/ouis.h"       // For OUI vendor lookup
+#include "core/wifi_ie.h"    // For management frame IE parsing
 #include "vendor/pcap.h"     // For pcap_is_wireshark_mode()
 #include "esp_crt_bundle.h"
 #include "esp_event.h"
@@ -559,186 +560,6 @@ static void generate_random_mac(uint8_t *mac) {
     mac[0] |= 0x02; // Locally administered MAC address (set the second least significant bit)
 }
 
-static bool station_exists(const uint8_t *station_mac, const uint8_t *ap_bssid) {
-    for (int i = 0; i < station_count; i++) {
-        if (memcmp(station_ap_list[i].station_mac, station_mac, 6) == 0 &&
-            memcmp(station_ap_list[i].ap_bssid, ap_bssid, 6) == 0) {
-            return true;
-        }
-    }
-    return false;
-}
-
-static void add_station_ap_pair(const uint8_t *station_mac, const uint8_t *ap_bssid) {
-    if (station_count < MAX_STATIONS) {
-        // Copy MAC addresses to the list
-        memcpy(station_ap_list[station_count].station_mac, station_mac, 6);
-        memcpy(station_ap_list[station_count].ap_bssid, ap_bssid, 6);
-        station_count++;
-
-        // Print formatted MAC addresses
-
-    } else {
-        glog("Station list full\nCan't add more stations.\n");
-    }
-}
-
-// helper macro to check for broadcast/multicast addresses
-#define IS_BROADCAST_OR_MULTICAST(addr) (((addr)[0] & 0x01) || (memcmp((addr), "\xff\xff\xff\xff\xff\xff", 6) == 0))
-
-// Function to check if a station MAC already exists in the list
-static bool station_mac_exists(const uint8_t *station_mac) {
-    for (int i = 0; i < station_count; i++) {
-        if (memcmp(station_ap_list[i].station_mac, station_mac, 6) == 0) {
-            return true; // Station MAC found
-        }
-    }
-    return false; // Station MAC not found
-}
-
-// Helper function to reverse MAC address byte order for comparison
-static void reverse_mac(const uint8_t *src, uint8_t *dst) {
-    for (int i = 0; i < 6; i++) {
-        dst[i] = src[5 - i];
-    }
-}
-
-void wifi_stations_sniffer_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
-    // Focus on Management frames like the example, can be changed back to WIFI_PKT_DATA if needed
-    if (type != WIFI_PKT_MGMT) {
-        // printf("DEBUG: Dropped non-MGMT packet\n"); 
-        return;
-    }
-
-    // Check if we have scanned APs to compare against
-    if (scanned_aps == NULL || ap_count == 0) {
-        // This case should be handled by wifi_manager_start_station_scan now
-        printf("ERROR: No scanned APs in callback!\n");
-        return;
-    }
-
-    const wifi_promiscuous_pkt_t *packet = (wifi_promiscuous_pkt_t *)buf;
-    const wifi_ieee80211_packet_t *ipkt = (wifi_ieee80211_packet_t *)packet->payload;
-    const wifi_ieee80211_hdr_t *hdr = &ipkt->hdr;
-
-    // --- DEBUG: Print raw addresses from MGMT frame ---
-    // printf("DEBUG MGMT Frame: Addr1=%02X:%02X:%02X:%02X:%02X:%02X, Addr2=%02X:%02X:%02X:%02X:%02X:%02X, Addr3=%02X:%02X:%02X:%02X:%02X:%02X\n",
-    //        hdr->addr1[0], hdr->addr1[1], hdr->addr1[2], hdr->addr1[3], hdr->addr1[4], hdr->addr1[5],
-    //        hdr->addr2[0], hdr->addr2[1], hdr->addr2[2], hdr->addr2[3], hdr->addr2[4], hdr->addr2[5],
-    //        hdr->addr3[0], hdr->addr3[1], hdr->addr3[2], hdr->addr3[3], hdr->addr3[4], hdr->addr3[5]);
-
-    // --- DEBUG: Print first known AP BSSID ---
-    // if (ap_count > 0 && scanned_aps != NULL) {
-    //      printf("DEBUG Known AP[0]: BSSID=%02X:%02X:%02X:%02X:%02X:%02X\n",
-    //             scanned_aps[0].bssid[0], scanned_aps[0].bssid[1],
-    //             scanned_aps[0].bssid[2], scanned_aps[0].bssid[3],
-    //             scanned_aps[0].bssid[4], scanned_aps[0].bssid[5]);
-    // }
-    // ----------------------------------------
-
-    const uint8_t *station_mac = NULL;
-    const uint8_t *ap_bssid = NULL;
-    int matched_ap_index = -1;
-
-    // Iterate through known APs (from last scan)
-    for (int i = 0; i < ap_count; i++) {
-        uint8_t *bssid = scanned_aps[i].bssid;
-        // Case 1: addr1 == AP BSSID, station likely in addr2
-        if (memcmp(hdr->addr1, bssid, 6) == 0 && memcmp(hdr->addr2, bssid, 6) != 0) {
-            ap_bssid = bssid;
-            station_mac = hdr->addr2;
-            matched_ap_index = i;
-            break;
-        }
-        // Case 2: addr2 == AP BSSID, station likely in addr1
-        if (memcmp(hdr->addr2, bssid, 6) == 0 && memcmp(hdr->addr1, bssid, 6) != 0) {
-            ap_bssid = bssid;
-            station_mac = hdr->addr1;
-            matched_ap_index = i;
-            break;
-        }
-        // Case 3: addr3 == AP BSSID, station could be in addr1 or addr2
-        if (memcmp(hdr->addr3, bssid, 6) == 0) {
-            // prefer addr2 (source fields)
-            if (memcmp(hdr->addr2, bssid, 6) != 0 && !IS_BROADCAST_OR_MULTICAST(hdr->addr2)) {
-                ap_bssid = bssid;
-                station_mac = hdr->addr2;
-                matched_ap_index = i;
-                break;
-            }
-            if (memcmp(hdr->addr1, bssid, 6) != 0 && !IS_BROADCAST_OR_MULTICAST(hdr->addr1)) {
-                ap_bssid = bssid;
-                station_mac = hdr->addr1;
-                matched_ap_index = i;
-                break;
-            }
-        }
-    }
-    // If no known AP BSSID found, ignore
-    if (matched_ap_index == -1) {
-       // printf("DEBUG: Dropped packet - No known AP BSSID found in addresses.\n");
-        return;
-    }
-
-    // Ensure we are capturing a station, not an AP or broadcast
-    if (memcmp(station_mac, ap_bssid, 6) == 0 || IS_BROADCAST_OR_MULTICAST(station_mac)) {
-       // printf("DEBUG: Dropped packet - Station MAC is broadcast/multicast or same as AP.\n");
-        return;
-    }
-
-    // Ignore broadcast MAC address for the station
-   // if (IS_BROADCAST_OR_MULTICAST(station_mac)) {
-   //     printf("DEBUG: Dropped packet - Station MAC is broadcast/multicast.\n"); // Uncomment for verbose debug
-   //     return;
-   // }
-
-    // Check if this station MAC has already been seen/logged
-    if (!station_mac_exists(station_mac)) {
-         // Get the SSID of the matched AP
-        char ssid_str[33];
-        memcpy(ssid_str, scanned_aps[matched_ap_index].ssid, 32);
-        ssid_str[32] = '\0';
-        if (strlen(ssid_str) == 0) {
-             strcpy(ssid_str, "(Hidden)");
-        }
-
-        char station_mac_str[18];
-        snprintf(station_mac_str, sizeof(station_mac_str),
-                 "%02X:%02X:%02X:%02X:%02X:%02X",
-                 station_mac[0], station_mac[1], station_mac[2],
-                 station_mac[3], station_mac[4], station_mac[5]);
-
-        char ap_mac_str[18];
-        snprintf(ap_mac_str, sizeof(ap_mac_str),
-                 "%02X:%02X:%02X:%02X:%02X:%02X",
-                 ap_bssid[0], ap_bssid[1], ap_bssid[2],
-                 ap_bssid[3], ap_bssid[4], ap_bssid[5]);
-
-        char station_vendor[64] = "Unknown";
-        (void)ouis_lookup_vendor(station_mac_str, station_vendor, sizeof(station_vendor));
-
-        char ap_vendor[64] = "Unknown";
-        (void)ouis_lookup_vendor(ap_mac_str, ap_vendor, sizeof(ap_vendor));
-
-        glog("New Station:\n"
-             "     STA: %s\n"
-             "     STA Vendor: %s\n"
-             "     Associated AP: %s\n"
-             "     AP BSSID: %s\n"
-             "     AP Vendor: %s\n",
-             station_mac_str,
-             station_vendor,
-             ssid_str,
-             ap_mac_str,
-             ap_vendor);
-
-        // Add the station and the *specific AP BSSID* it was seen with to the list
-        add_station_ap_pair(station_mac, ap_bssid);
-    } else {
-       // printf("DEBUG: Filtered packet - Station MAC already seen.\n");
-    }
-}
-
 esp_err_t stream_data_to_client(httpd_req_t *req, const char *url, const char *content_type) {
     httpd_resp_set_hdr(req, "Connection", "close");
 
@@ -4078,19 +3899,11 @@ static void live_ap_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
 
     if (bssid_already_listed(bssid)) return;
 
-    int idx = 36;
+    wifi_ie_info_t ie;
+    if (!wifi_ie_parse_mgmt(payload, pkt->rx_ctrl.sig_len, &ie)) return;
+
     char ssid[33] = {0};
-    while (idx + 1 < pkt->rx_ctrl.sig_len) {
-        uint8_t id = payload[idx];
-        uint8_t ie_len = payload[idx + 1];
-        if (idx + 2 + ie_len > pkt->rx_ctrl.sig_len) break;
-        if (id == 0 && ie_len <= 32) {
-            memcpy(ssid, &payload[idx + 2], ie_len);
-            ssid[ie_len] = '\0';
-            break;
-        }
-        idx += 2 + ie_len;
-    }
+    wifi_ie_copy_ssid(&ie, ssid, sizeof(ssid));
 
     if (ssid[0] == '\0') {
         strncpy(ssid, "<hidden>", sizeof(ssid));
@@ -4099,57 +3912,10 @@ static void live_ap_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
     char sanitized[33];
     sanitize_ssid_and_check_hidden((uint8_t *)ssid, sanitized, sizeof(sanitized));
 
-    // derive security from IEs
-    bool has_wpa = false;
-    bool has_wpa2 = false;
-    bool has_wpa3 = false;
-    // capability info privacy bit for WEP detection
-    if (pkt->rx_ctrl.sig_len >= 36) {
-        uint16_t cap = (uint16_t)payload[34] | ((uint16_t)payload[35] << 8);
-        // iterate IEs to find RSN/WPA
-        int ie = 36;
-        while (ie + 1 < pkt->rx_ctrl.sig_len) {
-            uint8_t eid = payload[ie];
-            uint8_t elen = payload[ie + 1];
-            if (ie + 2 + elen > pkt->rx_ctrl.sig_len) break;
-            if (eid == 48 /* RSN */ && elen >= 2) {
-                int off = ie + 2;
-                if (off + 2 <= ie + 2 + elen) {
-                    off += 2; // version
-                }
-                if (off + 4 <= ie + 2 + elen) {
-                    off += 4; // group cipher suite
-                }
-                if (off + 2 <= ie + 2 + elen) {
-                    uint16_t pairwise_count = payload[off] | (payload[off + 1] << 8);
-                    off += 2 + 4 * pairwise_count;
-                }
-                if (off + 2 <= ie + 2 + elen) {
-                    uint16_t akm_count = payload[off] | (payload[off + 1] << 8);
-                    off += 2;
-                    for (uint16_t a = 0; a < akm_count; a++) {
-                        if (off + 4 > ie + 2 + elen) break;
-                        // OUI 00:0F:AC
-                        uint8_t oui0 = payload[off + 0];
-                        uint8_t oui1 = payload[off + 1];
-                        uint8_t oui2 = payload[off + 2];
-                        uint8_t type = payload[off + 3];
-                        if (oui0 == 0x00 && oui1 == 0x0F && oui2 == 0xAC) {
-                            if (type == 2) has_wpa2 = true;      // PSK
-                            if (type == 8) has_wpa3 = true;      // SAE
-                        }
-                        off += 4;
-                    }
-                }
-            } else if (eid == 221 /* Vendor */ && elen >= 4) {
-                // WPA (00:50:F2, type 1)
-                if (payload[ie + 2] == 0x00 && payload[ie + 3] == 0x50 && payload[ie + 4] == 0xF2 && payload[ie + 5] == 0x01) {
-                    has_wpa = true;
-                }
-            }
-            ie += 2 + elen;
-        }
-    }
+    // derive security from the parsed RSN/WPA elements
+    bool has_wpa = (ie.flags & WIFI_IE_F_WPA) != 0;
+    bool has_wpa2 = (ie.rsn_akm & WIFI_IE_AKM_PSK) != 0;
+    bool has_wpa3 = (ie.rsn_akm & WIFI_IE_AKM_SAE) != 0;
 
     if (scanned_aps == NULL) {
         scanned_aps = calloc(MAX_SCANNED_APS, sizeof(wifi_ap_record_t));
@@ -4167,11 +3933,8 @@ static void live_ap_scan_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
         else if (has_wpa3) rec->authmode = WIFI_AUTH_WPA3_PSK;
         else if (has_wpa2) rec->authmode = WIFI_AUTH_WPA2_PSK;
         else if (has_wpa) rec->authmode = WIFI_AUTH_WPA_PSK;
-        else {
-            // check WEP via privacy bit
-            uint16_t cap = (uint16_t)payload[34] | ((uint16_t)payload[35] << 8);
-            if (cap & 0x0010) rec->authmode = WIFI_AUTH_WEP; else rec->authmode = WIFI_AUTH_OPEN;
-        }
+        else if (ie.flags & WIFI_IE_F_PRIVACY) rec->authmode = WIFI_AUTH_WEP;
+        else rec->authmode = WIFI_AUTH_OPEN;
     }
 
     uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
@@ -0,0 +1,189 @@
+// Station sniffer used by "scansta": pairs the stations heard in management
+// frames with the access points from the last scan. Kept apart from
+// wifi_manager.c so the host replay harness (test/host) can build it.
+
+#include "core/glog.h"
+#include "core/ouis.h"
+#include "managers/wifi_manager.h"
+#include <stdio.h>
+#include <string.h>
+
+static bool station_exists(const uint8_t *station_mac, const uint8_t *ap_bssid) {
+    for (int i = 0; i < station_count; i++) {
+        if (memcmp(station_ap_list[i].station_mac, station_mac, 6) == 0 &&
+            memcmp(station_ap_list[i].ap_bssid, ap_bssid, 6) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void add_station_ap_pair(const uint8_t *station_mac, const uint8_t *ap_bssid) {
+    if (station_count < MAX_STATIONS) {
+        // Copy MAC addresses to the list
+        memcpy(station_ap_list[station_count].station_mac, station_mac, 6);
+        memcpy(station_ap_list[station_count].ap_bssid, ap_bssid, 6);
+        station_count++;
+
+        // Print formatted MAC addresses
+
+    } else {
+        glog("Station list full\nCan't add more stations.\n");
+    }
+}
+
+// helper macro to check for broadcast/multicast addresses
+#define IS_BROADCAST_OR_MULTICAST(addr) (((addr)[0] & 0x01) || (memcmp((addr), "\xff\xff\xff\xff\xff\xff", 6) == 0))
+
+// Function to check if a station MAC already exists in the list
+static bool station_mac_exists(const uint8_t *station_mac) {
+    for (int i = 0; i < station_count; i++) {
+        if (memcmp(station_ap_list[i].station_mac, station_mac, 6) == 0) {
+            return true; // Station MAC found
+        }
+    }
+    return false; // Station MAC not found
+}
+
+// Helper function to reverse MAC address byte order for comparison
+static void reverse_mac(const uint8_t *src, uint8_t *dst) {
+    for (int i = 0; i < 6; i++) {
+        dst[i] = src[5 - i];
+    }
+}
+
+void wifi_stations_sniffer_callback(void *buf, wifi_promiscuous_pkt_type_t type) {
+    // Focus on Management frames like the example, can be changed back to WIFI_PKT_DATA if needed
+    if (type != WIFI_PKT_MGMT) {
+        // printf("DEBUG: Dropped non-MGMT packet\n"); 
+        return;
+    }
+
+    // Check if we have scanned APs to compare against
+    if (scanned_aps == NULL || ap_count == 0) {
+        // This case should be handled by wifi_manager_start_station_scan now
+        printf("ERROR: No scanned APs in callback!\n");
+        return;
+    }
+
+    const wifi_promiscuous_pkt_t *packet = (wifi_promiscuous_pkt_t *)buf;
+    const wifi_ieee80211_packet_t *ipkt = (wifi_ieee80211_packet_t *)packet->payload;
+    const wifi_ieee80211_hdr_t *hdr = &ipkt->hdr;
+
+    // --- DEBUG: Print raw addresses from MGMT frame ---
+    // printf("DEBUG MGMT Frame: Addr1=%02X:%02X:%02X:%02X:%02X:%02X, Addr2=%02X:%02X:%02X:%02X:%02X:%02X, Addr3=%02X:%02X:%02X:%02X:%02X:%02X\n",
+    //        hdr->addr1[0], hdr->addr1[1], hdr->addr1[2], hdr->addr1[3], hdr->addr1[4], hdr->addr1[5],
+    //        hdr->addr2[0], hdr->addr2[1], hdr->addr2[2], hdr->addr2[3], hdr->addr2[4], hdr->addr2[5],
+    //        hdr->addr3[0], hdr->addr3[1], hdr->addr3[2], hdr->addr3[3], hdr->addr3[4], hdr->addr3[5]);
+
+    // --- DEBUG: Print first known AP BSSID ---
+    // if (ap_count > 0 && scanned_aps != NULL) {
+    //      printf("DEBUG Known AP[0]: BSSID=%02X:%02X:%02X:%02X:%02X:%02X\n",
+    //             scanned_aps[0].bssid[0], scanned_aps[0].bssid[1],
+    //             scanned_aps[0].bssid[2], scanned_aps[0].bssid[3],
+    //             scanned_aps[0].bssid[4], scanned_aps[0].bssid[5]);
+    // }
+    // ----------------------------------------
+
+    const uint8_t *station_mac = NULL;
+    const uint8_t *ap_bssid = NULL;
+    int matched_ap_index = -1;
+
+    // Iterate through known APs (from last scan)
+    for (int i = 0; i < ap_count; i++) {
+        uint8_t *bssid = scanned_aps[i].bssid;
+        // Case 1: addr1 == AP BSSID, station likely in addr2
+        if (memcmp(hdr->addr1, bssid, 6) == 0 && memcmp(hdr->addr2, bssid, 6) != 0) {
+            ap_bssid = bssid;
+            station_mac = hdr->addr2;
+            matched_ap_index = i;
+            break;
+        }
+        // Case 2: addr2 == AP BSSID, station likely in addr1
+        if (memcmp(hdr->addr2, bssid, 6) == 0 && memcmp(hdr->addr1, bssid, 6) != 0) {
+            ap_bssid = bssid;
+            station_mac = hdr->addr1;
+            matched_ap_index = i;
+            break;
+        }
+        // Case 3: addr3 == AP BSSID, station could be in addr1 or addr2
+        if (memcmp(hdr->addr3, bssid, 6) == 0) {
+            // prefer addr2 (source fields)
+            if (memcmp(hdr->addr2, bssid, 6) != 0 && !IS_BROADCAST_OR_MULTICAST(hdr->addr2)) {
+                ap_bssid = bssid;
+                station_mac = hdr->addr2;
+                matched_ap_index = i;
+                break;
+            }
+            if (memcmp(hdr->addr1, bssid, 6) != 0 && !IS_BROADCAST_OR_MULTICAST(hdr->addr1)) {
+                ap_bssid = bssid;
+                station_mac = hdr->addr1;
+                matched_ap_index = i;
+                break;
+            }
+        }
+    }
+    // If no known AP BSSID found, ignore
+    if (matched_ap_index == -1) {
+       // printf("DEBUG: Dropped packet - No known AP BSSID found in addresses.\n");
+        return;
+    }
+
+    // Ensure we are capturing a station, not an AP or broadcast
+    if (memcmp(station_mac, ap_bssid, 6) == 0 || IS_BROADCAST_OR_MULTICAST(station_mac)) {
+       // printf("DEBUG: Dropped packet - Station MAC is broadcast/multicast or same as AP.\n");
+        return;
+    }
+
+    // Ignore broadcast MAC address for the station
+   // if (IS_BROADCAST_OR_MULTICAST(station_mac)) {
+   //     printf("DEBUG: Dropped packet - Station MAC is broadcast/multicast.\n"); // Uncomment for verbose debug
+   //     return;
+   // }
+
+    // Check if this station MAC has already been seen/logged
+    if (!station_mac_exists(station_mac)) {
+         // Get the SSID of the matched AP
+        char ssid_str[33];
+        memcpy(ssid_str, scanned_aps[matched_ap_index].ssid, 32);
+        ssid_str[32] = '\0';
+        if (strlen(ssid_str) == 0) {
+             strcpy(ssid_str, "(Hidden)");
+        }
+
+        char station_mac_str[18];
+        snprintf(station_mac_str, sizeof(station_mac_str),
+                 "%02X:%02X:%02X:%02X:%02X:%02X",
+                 station_mac[0], station_mac[1], station_mac[2],
+                 station_mac[3], station_mac[4], station_mac[5]);
+
+        char ap_mac_str[18];
+        snprintf(ap_mac_str, sizeof(ap_mac_str),
+                 "%02X:%02X:%02X:%02X:%02X:%02X",
+                 ap_bssid[0], ap_bssid[1], ap_bssid[2],
+                 ap_bssid[3], ap_bssid[4], ap_bssid[5]);
+
+        char station_vendor[64] = "Unknown";
+        (void)ouis_lookup_vendor(station_mac_str, station_vendor, sizeof(station_vendor));
+
+        char ap_vendor[64] = "Unknown";
+        (void)ouis_lookup_vendor(ap_mac_str, ap_vendor, sizeof(ap_vendor));
+
+        glog("New Station:\n"
+             "     STA: %s\n"
+             "     STA Vendor: %s\n"
+             "     Associated AP: %s\n"
+             "     AP BSSID: %s\n"
+             "     AP Vendor: %s\n",
+             station_mac_str,
+             station_vendor,
+             ssid_str,
+             ap_mac_str,
+             ap_vendor);
+
+        // Add the station and the *specific AP BSSID* it was seen with to the list
+        add_station_ap_pair(station_mac, ap_bssid);
+    } else {
+       // printf("DEBUG: Filtered packet - Station MAC already seen.\n");
+    }
+}
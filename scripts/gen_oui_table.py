@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+r"""Compile main.bak/core/ouis.json into a sorted binary OUI table.
+
+Emits a C header with three arrays:
+  oui_table_keys    packed 24-bit OUIs, 3 bytes each, ascending
+  oui_table_vendor  offset of each OUI's vendor string in the pool
+  oui_vendor_pool   deduplicated, nul separated vendor names
+
+Vendor names are stored already capitalised the way ouis.c used to do at
+lookup time (first letter of each word upper, rest lower).
+
+json.load decodes \uXXXX escapes, while the old strstr lookup returned them
+verbatim (e.g. "Intel \u2013 Ge Care..."). The decoded names are folded to
+ascii so the display fonts can draw them: accents are dropped and dashes
+become '-'. Three vendors are affected:
+  001D40  Intel - Ge Care Innovations Llc
+  906DC8  Dlg Automacao Industrial Ltda
+  C08B6F  S I Sistemas Inteligentes Eletronicos Ltda
+"""
+import argparse
+import json
+import sys
+import unicodedata
+
+ASCII_FOLD = {'\u2010': '-', '\u2011': '-', '\u2012': '-', '\u2013': '-', '\u2014': '-',
+              '\u2018': "'", '\u2019': "'", '\u201c': '"', '\u201d': '"'}
+
+
+def ascii_fold(name):
+    out = []
+    for c in unicodedata.normalize('NFKD', name):
+        if ord(c) < 0x80:
+            out.append(c)
+        elif c in ASCII_FOLD:
+            out.append(ASCII_FOLD[c])
+        elif not unicodedata.combining(c):
+            out.append('?')
+    return ''.join(out)
+
+
+def proper_caps(name):
+    out = bytearray()
+    new_word = True
+    for c in ascii_fold(name):
+        if c in ' -_':
+            new_word = True
+            out.append(ord(c))
+            continue
+        out.append(ord(c.upper() if new_word else c.lower()))
+        new_word = False
+    return bytes(out)
+
+
+def c_string_literal(data):
+    parts = []
+    for b in data:
+        if b == 0x22 or b == 0x5C:
+            parts.append('\\' + chr(b))
+        elif 0x20 <= b < 0x7F and b != 0x3F:
+            parts.append(chr(b))
+        else:
+            parts.append('\\%03o' % b)
+    return ''.join(parts)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('input', help='ouis.json')
+    ap.add_argument('output', help='generated header')
+    args = ap.parse_args()
+
+    with open(args.input, 'r', encoding='utf-8') as f:
+        table = json.load(f)
+
+    entries = []
+    for key, vendor in table.items():
+        key = key.strip().upper()
+        if len(key) != 6:
+            sys.exit('bad oui key: %r' % key)
+        entries.append((int(key, 16), proper_caps(vendor)))
+    entries.sort(key=lambda e: e[0])
+
+    pool = bytearray()
+    offsets = {}
+    vendor_idx = []
+    for _, name in entries:
+        if name not in offsets:
+            offsets[name] = len(pool)
+            pool += name + b'\0'
+        vendor_idx.append(offsets[name])
+    if len(pool) > 0xFFFF:
+        sys.exit('vendor pool exceeds 64KB, widen oui_table_vendor')
+
+    lines = []
+    lines.append('// generated by scripts/gen_oui_table.py from core/ouis.json, do not edit')
+    lines.append('#pragma once')
+    lines.append('#include <stdint.h>')
+    lines.append('')
+    lines.append('#define OUI_TABLE_COUNT %d' % len(entries))
+    lines.append('')
+    lines.append('static const uint8_t oui_table_keys[OUI_TABLE_COUNT * 3] = {')
+    for i in range(0, len(entries), 8):
+        row = entries[i:i + 8]
+        lines.append('    ' + ' '.join('0x%02X,0x%02X,0x%02X,' % ((k >> 16) & 0xFF, (k >> 8) & 0xFF, k & 0xFF)
+                                         for k, _ in row))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const uint16_t oui_table_vendor[OUI_TABLE_COUNT] = {')
+    for i in range(0, len(vendor_idx), 12):
+        lines.append('    ' + ' '.join('%d,' % v for v in vendor_idx[i:i + 12]))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const char oui_vendor_pool[] =')
+    start = 0
+    while start < len(pool):
+        end = pool.index(0, start) + 1
+        lines.append('    "%s"' % c_string_literal(pool[start:end]))
+        start = end
+    lines.append('    ;')
+    lines.append('')
+
+    with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,89 @@
+// bit_lib field extraction word-wise against the bit loop it replaced
+// (bit_lib_ref.h) and a bit by bit loop in flipper's order, over random
+// positions and lengths in a 32 byte buffer; then set_bits, reverse and
+// parity against their loop references. ns per call.
+// not a ctest, run it by hand: ./bench_bit_lib [calls]
+
+#include "managers/nfc/flipper_nfc_compat.h"
+#include "bit_lib_ref.h"
+#include "host_test.h"
+
+// the disney infinity parser needs mbedtls; registered as an empty plugin
+const NfcSupportedCardsPlugin disney_infinity_plugin = {0};
+
+int64_t esp_timer_get_time(void) {
+    return host_now_ns() / 1000;
+}
+
+static uint32_t s_rand = 0x2545f491;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+#define FIELDS 4096
+
+static uint8_t s_data[32];
+static uint16_t s_pos[FIELDS];
+static uint8_t s_len[FIELDS];
+static volatile uint64_t s_sink;
+
+// positions and lengths up to max, all inside s_data
+static void pick_fields(uint8_t max) {
+    for (size_t i = 0; i < FIELDS; i++) {
+        s_len[i] = (uint8_t)(1 + rnd(max));
+        s_pos[i] = (uint16_t)rnd(8 * sizeof(s_data) - s_len[i] + 1);
+    }
+}
+
+#define TIME(label, calls, expr)                                               \
+    do {                                                                       \
+        uint64_t sum = 0;                                                      \
+        int64_t t0 = host_now_ns();                                            \
+        for (long c = 0; c < (calls); c++) {                                   \
+            size_t i = (size_t)c % FIELDS;                                     \
+            (void)i;                                                           \
+            sum += (expr);                                                     \
+        }                                                                      \
+        double ns = (double)(host_now_ns() - t0) / (calls);                    \
+        s_sink = sum;                                                          \
+        printf("  %-28s %8.2f ns\n", label, ns);                               \
+    } while (0)
+
+int main(int argc, char **argv) {
+    long calls = argc > 1 ? atol(argv[1]) : 20000000;
+    for (size_t i = 0; i < sizeof(s_data); i++) s_data[i] = (uint8_t)rnd(256);
+    printf("%ld calls each\n", calls);
+
+    printf("fields of 1..64 bits\n");
+    pick_fields(64);
+    TIME("old lsb first loop", calls, ref_old_get_bits_64(s_data, s_pos[i], s_len[i]));
+    TIME("msb first loop", calls, ref_get_bits(s_data, s_pos[i], s_len[i]));
+    TIME("bit_lib_get_bits_64", calls, bit_lib_get_bits_64(s_data, s_pos[i], s_len[i]));
+
+    printf("fields of 1..32 bits\n");
+    pick_fields(32);
+    TIME("old lsb first loop", calls, ref_old_get_bits_64(s_data, s_pos[i], s_len[i]));
+    TIME("bit_lib_get_bits_32", calls, bit_lib_get_bits_32(s_data, s_pos[i], s_len[i]));
+
+    printf("fields of 1..8 bits\n");
+    pick_fields(8);
+    TIME("old lsb first loop", calls, ref_old_get_bits_64(s_data, s_pos[i], s_len[i]));
+    TIME("bit_lib_get_bits", calls, bit_lib_get_bits(s_data, s_pos[i], s_len[i]));
+    TIME("ref_set_bits loop", calls,
+         (ref_set_bits(s_data, s_pos[i], (uint8_t)i, s_len[i]), s_data[i % sizeof(s_data)]));
+    TIME("bit_lib_set_bits", calls,
+         (bit_lib_set_bits(s_data, s_pos[i], (uint8_t)i, s_len[i]), s_data[i % sizeof(s_data)]));
+
+    printf("words\n");
+    TIME("reverse loop, 32 bits", calls, ref_reverse((uint32_t)c * 0x9E3779B1u, 32));
+    TIME("bit_lib_reverse_32_fast", calls, bit_lib_reverse_32_fast((uint32_t)c * 0x9E3779B1u));
+    TIME("bit_lib_test_parity_32", calls,
+         bit_lib_test_parity_32((uint32_t)c * 0x9E3779B1u, BitLibParityOdd));
+    TIME("bit_lib_test_parity, 26 bit", calls,
+         bit_lib_test_parity(s_data, s_pos[i] % 128, 26, BitLibParityEven, 13));
+    return 0;
+}
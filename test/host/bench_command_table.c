@@ -0,0 +1,66 @@
+// command lookup against the linked list it replaced, for every name
+// commandline.c registers: registration cost, heap held after boot and ns
+// per lookup, plus tokenize + lookup for a typical line. not a ctest, run it
+// by hand: ./bench_command_table [rounds]
+
+#include "core/command_table.h"
+#include "commands_ref.h"
+#include "host_test.h"
+#include <malloc.h>
+
+static void cmd_nop(int argc, char **argv) {
+}
+
+int main(int argc, char **argv) {
+    if (!ref_load_names()) return 1;
+    long rounds = argc > 1 ? atol(argv[1]) : 20000;
+    int n = ref_name_count;
+
+    static command_table_t table;
+    int64_t t0 = host_now_ns();
+    command_table_init(&table);
+    for (int i = 0; i < n; i++) command_table_add(&table, ref_names[i], cmd_nop);
+    int64_t table_reg_ns = host_now_ns() - t0;
+
+    t0 = host_now_ns();
+    for (int i = 0; i < n; i++) ref_register_command(ref_names[i], cmd_nop);
+    int64_t list_reg_ns = host_now_ns() - t0;
+
+    // the esp-idf heap adds its own header per block, usable size is the
+    // closest host stand-in
+    size_t list_heap = 0;
+    for (RefCommand *c = ref_list_head; c; c = c->next) {
+        list_heap += malloc_usable_size(c) + malloc_usable_size(c->name);
+    }
+    printf("%d commands: table %zu bytes static, 0 heap; list %zu bytes heap in %d blocks\n", n,
+           sizeof(table), list_heap, 2 * n);
+    printf("registration: table %.0f ns, list %.0f ns\n", (double)table_reg_ns,
+           (double)list_reg_ns);
+
+    volatile uintptr_t sink = 0;
+    t0 = host_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++) sink += (uintptr_t)command_table_find(&table, ref_names[i]);
+    }
+    double table_ns = (double)(host_now_ns() - t0) / ((double)rounds * n);
+    t0 = host_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (int i = 0; i < n; i++) sink += (uintptr_t)ref_find_command(ref_names[i]);
+    }
+    double list_ns = (double)(host_now_ns() - t0) / ((double)rounds * n);
+    printf("lookup: table %.1f ns, list %.1f ns\n", table_ns, list_ns);
+
+    static const char line[] = "connect \"My Network\" 'pass word' -b aa:bb:cc:dd:ee:ff";
+    char buf[sizeof(line)];
+    char *args[16];
+    t0 = host_now_ns();
+    for (long r = 0; r < rounds * 10; r++) {
+        memcpy(buf, line, sizeof(line));
+        int count = command_tokenize(buf, NULL);
+        command_tokenize(buf, args);
+        args[count] = NULL;
+        sink += (uintptr_t)command_table_find(&table, args[0]);
+    }
+    printf("tokenize + lookup: %.1f ns/line\n", (double)(host_now_ns() - t0) / ((double)rounds * 10));
+    return 0;
+}
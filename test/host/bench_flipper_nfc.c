@@ -0,0 +1,172 @@
+// flipper nfc parsers over the saved mifare classic dumps in data/nfc/: every
+// parser's parse on every dump, its quick check skipped, once with strings on
+// the heap and once in a per-parse arena the way the dispatcher runs them, then
+// per dump the dispatcher as it was before the registry (nfc_dispatch_ref.h)
+// against the registry. time is per parse; allocations are malloc
+// calls per parse and peak live bytes, counted by wrapping malloc, its friends
+// and strdup at link time. smartrider logs every dump it turns down to stderr.
+// not a ctest, run it by hand: ./bench_flipper_nfc [rounds] 2>/dev/null
+
+#include "managers/nfc/flipper_nfc_compat.h"
+#include "nfc_dispatch_ref.h"
+#include "nfc_dump.h"
+#include "host_test.h"
+#include <malloc.h>
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+char *__real_strdup(const char *s);
+
+static size_t s_live, s_peak, s_allocs;
+
+static void *counted(void *p) {
+    if (p) {
+        s_allocs++;
+        s_live += malloc_usable_size(p);
+        if (s_live > s_peak) s_peak = s_live;
+    }
+    return p;
+}
+
+void *__wrap_malloc(size_t size) {
+    return counted(__real_malloc(size));
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    return counted(__real_calloc(n, size));
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    if (ptr) s_live -= malloc_usable_size(ptr);
+    void *p = __real_realloc(ptr, size);
+    // a failed realloc leaves the old block in place
+    return counted(p ? p : (size ? ptr : NULL));
+}
+
+// libc allocates this one itself, past the malloc wrap
+char *__wrap_strdup(const char *s) {
+    return counted(__real_strdup(s));
+}
+
+void __wrap_free(void *ptr) {
+    if (ptr) s_live -= malloc_usable_size(ptr);
+    __real_free(ptr);
+}
+
+// the disney infinity parser needs mbedtls; registered as an empty plugin
+const NfcSupportedCardsPlugin disney_infinity_plugin = {0};
+
+int64_t esp_timer_get_time(void) {
+    return host_now_ns() / 1000;
+}
+
+typedef struct {
+    double us;
+    double allocs;
+    size_t peak;
+    int matches;
+} cost_t;
+
+// one parse the way the dispatcher does it, minus the quick check
+static bool parse_once(const NfcSupportedCardsPlugin *p, const NfcDevice *dev, bool in_arena) {
+    FuriStringArena *arena = NULL, *prev = NULL;
+    if (in_arena) {
+        arena = furi_string_arena_alloc(1024);
+        prev = furi_string_arena_set_current(arena);
+    }
+    FuriString *out = furi_string_alloc();
+    bool parsed = p->parse(dev, out);
+    furi_string_free(out);
+    if (in_arena) {
+        furi_string_arena_set_current(prev);
+        furi_string_arena_free(arena);
+    }
+    return parsed;
+}
+
+static cost_t bench_parser(const NfcSupportedCardsPlugin *p, const nfc_dump_t *dumps, size_t n,
+                           long rounds, bool in_arena) {
+    cost_t c = {0};
+    size_t base = s_live;
+    s_peak = s_live;
+    s_allocs = 0;
+    int64_t t0 = host_now_ns();
+    for (size_t d = 0; d < n; d++) {
+        NfcDevice dev = {NfcProtocolMfClassic, (void *)&dumps[d].data};
+        for (long r = 0; r < rounds; r++) {
+            if (parse_once(p, &dev, in_arena) && r == 0) c.matches++;
+        }
+    }
+    double parses = (double)n * rounds;
+    c.us = (double)(host_now_ns() - t0) / 1e3 / parses;
+    c.allocs = s_allocs / parses;
+    c.peak = s_peak - base;
+    return c;
+}
+
+// rounds runs of one dispatcher on one dump; the output of the last one
+static cost_t bench_dispatch(bool registry, const MfClassicData *data, long rounds, char **out) {
+    size_t base = s_live;
+    s_peak = s_live;
+    s_allocs = 0;
+    int64_t t0 = host_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        free(*out);
+        *out = registry ? flipper_nfc_try_parse_mfclassic_from_cache(data)
+                        : ref_try_parse_sequential(data, NULL);
+    }
+    cost_t c = {0};
+    c.us = (double)(host_now_ns() - t0) / 1e3 / rounds;
+    c.allocs = (double)s_allocs / rounds;
+    c.peak = s_peak - base;
+    return c;
+}
+
+int main(int argc, char **argv) {
+    long rounds = argc > 1 ? atol(argv[1]) : 200;
+
+    static nfc_dump_t dumps[NFC_DUMP_MAX];
+    size_t n = nfc_load_dumps(host_data_path("nfc"), dumps, NFC_DUMP_MAX);
+    if (!n) {
+        fprintf(stderr, "no dumps in %s\n", host_data_path("nfc"));
+        return 1;
+    }
+    printf("%zu dumps, %ld rounds, every parser on every dump\n", n, rounds);
+    printf("  %-24s %7s  %9s %7s %7s  %9s %7s %7s\n", "parser", "matches", "heap us", "allocs",
+           "peak", "arena us", "allocs", "peak");
+    for (size_t i = 0; i < COUNT_OF(ref_parsers); i++) {
+        if (!ref_parsers[i].plugin->parse) continue;
+        cost_t heap = bench_parser(ref_parsers[i].plugin, dumps, n, rounds, false);
+        cost_t arena = bench_parser(ref_parsers[i].plugin, dumps, n, rounds, true);
+        printf("  %-24s %7d  %9.3f %7.1f %7zu  %9.3f %7.1f %7zu\n", ref_parsers[i].name,
+               heap.matches, heap.us, heap.allocs, heap.peak, arena.us, arena.allocs, arena.peak);
+    }
+
+    // the old dispatcher parses every card with every parser; the registry
+    // skips those whose quick check turns the card down
+    printf("per dump, sequential (before the registry) against the registry\n");
+    printf("  %-22s %-22s %9s %6s  %9s %6s %7s\n", "dump", "parsed by", "seq us", "allocs",
+           "reg us", "allocs", "peak");
+    double seq_total = 0, reg_total = 0;
+    int differ = 0;
+    for (size_t d = 0; d < n; d++) {
+        const char *by;
+        char *seq_out = NULL, *reg_out = NULL;
+        free(ref_try_parse_sequential(&dumps[d].data, &by));
+        cost_t seq = bench_dispatch(false, &dumps[d].data, rounds, &seq_out);
+        cost_t reg = bench_dispatch(true, &dumps[d].data, rounds, &reg_out);
+        bool same = (!seq_out && !reg_out) || (seq_out && reg_out && !strcmp(seq_out, reg_out));
+        differ += !same;
+        seq_total += seq.us;
+        reg_total += reg.us;
+        printf("  %-22s %-22s %9.3f %6.1f  %9.3f %6.1f %7zu%s\n", dumps[d].name, by, seq.us,
+               seq.allocs, reg.us, reg.allocs, reg.peak, same ? "" : "  <- output differs");
+        free(seq_out);
+        free(reg_out);
+    }
+    printf("  %-45s %9.3f %6s  %9.3f\n", "all dumps", seq_total, "", reg_total);
+    if (differ) printf("%d dumps parsed differently by the registry\n", differ);
+    return 0;
+}
@@ -0,0 +1,61 @@
+// ns per glog call with the sinks stubbed out, from one thread and from
+// several at once, next to the bare vsnprintf every call pays for. not a
+// ctest, run it by hand: ./bench_glog [calls]
+
+#include "core/glog.h"
+#include "host_test.h"
+#include <pthread.h>
+#include <stdarg.h>
+
+void terminal_view_add_text(const char *text) {
+}
+
+void ap_manager_add_log(const char *text) {
+}
+
+bool esp_comm_manager_is_remote_command(void) {
+    return false;
+}
+
+bool esp_comm_manager_send_response(const uint8_t *data, size_t length) {
+    return true;
+}
+
+static long s_calls;
+
+static void format_only(const char *fmt, ...) {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    __asm__ volatile("" : : "r"(buf) : "memory");
+}
+
+static void *producer(void *arg) {
+    for (long i = 0; i < s_calls; i++) glog("scan %ld: %s ch %d rssi %d", i, "HomeNet", 6, -61);
+    return NULL;
+}
+
+static double run(int threads) {
+    pthread_t t[16];
+    int64_t t0 = host_now_ns();
+    for (int i = 0; i < threads; i++) pthread_create(&t[i], NULL, producer, NULL);
+    for (int i = 0; i < threads; i++) pthread_join(t[i], NULL);
+    return (double)(host_now_ns() - t0) / s_calls;
+}
+
+int main(int argc, char **argv) {
+    s_calls = argc > 1 ? atol(argv[1]) : 1000000;
+    glog_set_sink_enabled(GLOG_SINK_CONSOLE, false);
+
+    int64_t t0 = host_now_ns();
+    for (long i = 0; i < s_calls; i++) format_only("scan %ld: %s ch %d rssi %d", i, "HomeNet", 6, -61);
+    printf("vsnprintf only: %.1f ns/call\n", (double)(host_now_ns() - t0) / s_calls);
+
+    for (int threads = 1; threads <= 4; threads *= 2) {
+        printf("glog, %d thread(s): %.1f ns/call per thread, web log dropped %u so far\n", threads,
+               run(threads), glog_sink_dropped(GLOG_SINK_WEB));
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+// fix latency, NMEA against UBX: one fix a second on a modelled uart, the
+// first fix block of data/nmea.txt (GGA GSA GSV RMC GLL VTG) against the first
+// NAV-PVT frame of data/ubx.txt. bytes come in at line rate and the driver
+// hands them over the way the esp-idf uart does, every 120 bytes (rx fifo
+// full) and 10 character times after a burst ends (rx timeout). reports
+// the time from the first byte of the fix on the wire to GPS_UPDATE, the
+// error of the send time the parser dates the fix with (a fix that only
+// arrives with the rx timeout is dated that much late), and host cpu per fix.
+// MicroNMEA.c is built in (MICRONMEA_C) against nmea_stubs.c.
+// not a ctest, run it by hand: ./bench_gps_fix_latency [fixes]
+
+#include MICRONMEA_C
+#include "host_gps_uart.h"
+#include "host_test.h"
+
+#define RX_FIFO_FULL 120
+#define RX_TIMEOUT_CHARS 10
+
+static size_t load_nmea_epoch(uint8_t *out, size_t cap) {
+    FILE *f = fopen(host_data_path("nmea.txt"), "r");
+    if (!f) return 0;
+    char line[512];
+    size_t len = 0;
+    bool in_block = false;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (line[0] != '$') {
+            if (in_block) break;
+            in_block = strncmp(line, "fix", 3) == 0;
+            continue;
+        }
+        // sentences go on the wire with \r\n
+        size_t n = strcspn(line, "\r\n");
+        if (!in_block || len + n + 2 > cap) continue;
+        memcpy(out + len, line, n);
+        memcpy(out + len + n, "\r\n", 2);
+        len += n + 2;
+    }
+    fclose(f);
+    return len;
+}
+
+static size_t load_ubx_pvt(uint8_t *out, size_t cap) {
+    FILE *f = fopen(host_data_path("ubx.txt"), "r");
+    if (!f) return 0;
+    char line[1024];
+    bool after_pvt = false;
+    size_t len = 0;
+    while (!len && fgets(line, sizeof(line), f)) {
+        if (after_pvt && strncmp(line, "hex ", 4) == 0) {
+            unsigned v;
+            for (const char *p = line + 4; len < cap && sscanf(p, "%2x", &v) == 1; p += 2) {
+                out[len++] = (uint8_t)v;
+            }
+        }
+        after_pvt = strncmp(line, "pvt ", 4) == 0;
+    }
+    fclose(f);
+    return len;
+}
+
+typedef struct {
+    double latency_us; // first byte on the wire to GPS_UPDATE, mean
+    double dated_us;   // fix_time_us minus the true start of the fix, mean
+    double cpu_ns;     // host time in the rx path per fix
+    uint32_t fixes;
+} result_t;
+
+// hand what the driver has to the parser at time now
+static void deliver(esp_gps_t *gps, const uint8_t *data, size_t len, int64_t now,
+                    int64_t *cpu_ns) {
+    host_gps_uart.data = data;
+    host_gps_uart.len = len;
+    host_gps_uart.pos = 0;
+    host_gps_uart.chunk = len;
+    host_gps_now_us = now;
+    int64_t t0 = host_now_ns();
+    esp_handle_uart_data(gps);
+    *cpu_ns += host_now_ns() - t0;
+}
+
+static result_t run(const uint8_t *epoch, size_t len, bool ubx, uint32_t baud, long fixes) {
+    nmea_parser_config_t config = NMEA_PARSER_CONFIG_DEFAULT();
+    config.uart.baud_rate = baud;
+    config.ubx.enable = ubx;
+    esp_gps_t *gps = nmea_parser_init(&config);
+    result_t res = {0};
+    if (!gps) return res;
+    memset(&host_gps_events, 0, sizeof(host_gps_events));
+
+    double char_us = 10e6 / baud;
+    int64_t cpu_ns = 0;
+    for (long k = 0; k < fixes; k++) {
+        int64_t start_us = 10000000 + k * 1000000; // one fix a second
+        uint32_t updates = host_gps_events.updates;
+        int64_t posted_us = -1;
+        size_t from = 0;
+        for (size_t i = 0; i < len; i++) {
+            bool last = i + 1 == len;
+            if (i + 1 - from < RX_FIFO_FULL && !last) continue;
+            int64_t at = start_us + (int64_t)((i + 1) * char_us);
+            if (last) at += (int64_t)(RX_TIMEOUT_CHARS * char_us);
+            deliver(gps, epoch + from, i + 1 - from, at, &cpu_ns);
+            from = i + 1;
+            if (posted_us < 0 && host_gps_events.updates != updates) posted_us = at;
+        }
+        if (posted_us < 0) continue;
+        res.latency_us += (double)(posted_us - start_us);
+        res.dated_us += (double)(host_gps_events.last.fix_time_us - start_us);
+        res.fixes++;
+    }
+    if (res.fixes) {
+        res.latency_us /= res.fixes;
+        res.dated_us /= res.fixes;
+        res.cpu_ns = (double)cpu_ns / res.fixes;
+    }
+    nmea_parser_deinit(gps);
+    return res;
+}
+
+int main(int argc, char **argv) {
+    long fixes = argc > 1 ? atol(argv[1]) : 2000;
+    static uint8_t nmea[4096], pvt[256];
+    size_t nmea_len = load_nmea_epoch(nmea, sizeof(nmea));
+    size_t pvt_len = load_ubx_pvt(pvt, sizeof(pvt));
+    if (!nmea_len || !pvt_len) {
+        fprintf(stderr, "no fix in %s or %s\n", host_data_path("nmea.txt"),
+                host_data_path("ubx.txt"));
+        return 1;
+    }
+    printf("%ld fixes; a fix is %zu bytes of nmea or %zu of ubx NAV-PVT\n", fixes, nmea_len,
+           pvt_len);
+    printf("  %-6s %-5s %6s %12s %10s %9s\n", "baud", "proto", "fixes", "latency us", "dated us",
+           "cpu ns");
+    const uint32_t bauds[] = {9600, 38400, 115200, 921600};
+    for (size_t b = 0; b < sizeof(bauds) / sizeof(bauds[0]); b++) {
+        for (int ubx = 0; ubx < 2; ubx++) {
+            result_t r = ubx ? run(pvt, pvt_len, true, bauds[b], fixes)
+                             : run(nmea, nmea_len, false, bauds[b], fixes);
+            printf("  %-6u %-5s %6u %12.0f %10.0f %9.0f\n", bauds[b], ubx ? "ubx" : "nmea",
+                   r.fixes, r.latency_us, r.dated_us, r.cpu_ns);
+        }
+    }
+    return 0;
+}
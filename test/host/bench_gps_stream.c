@@ -0,0 +1,105 @@
+// the gps rx path on a recorded stream: the sentences of data/nmea.txt played
+// over and over as a receiver would send them at 115200 and 921600 baud, for
+// a given number of seconds of line time. the driver hands bytes over per
+// line (what uart pattern detection did), per rx fifo (120 bytes) or in
+// buffer-sized blocks, and the reader decodes what it got. reports host cpu
+// per second of gps data, sentences and fixes. MicroNMEA.c is built in
+// (MICRONMEA_C) against nmea_stubs.c.
+// not a ctest, run it by hand: ./bench_gps_stream [seconds]
+
+#include MICRONMEA_C
+#include "host_gps_uart.h"
+#include "host_test.h"
+
+static size_t load_stream(uint8_t *out, size_t cap) {
+    FILE *f = fopen(host_data_path("nmea.txt"), "r");
+    if (!f) return 0;
+    char line[512];
+    size_t len = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] != '$') continue;
+        // sentences go on the wire with \r\n
+        size_t n = strcspn(line, "\r\n");
+        if (len + n + 2 > cap) break;
+        memcpy(out + len, line, n);
+        memcpy(out + len + n, "\r\n", 2);
+        len += n + 2;
+    }
+    fclose(f);
+    return len;
+}
+
+typedef enum { PER_LINE, PER_FIFO, PER_BLOCK } delivery_t;
+
+static const char *const s_delivery[] = {"per line", "per fifo (120)", "per block"};
+
+typedef struct {
+    double cpu_us_per_s;
+    uint32_t reads;
+    uint32_t sentences;
+    uint32_t fixes;
+} result_t;
+
+static result_t run(const uint8_t *stream, size_t len, uint32_t baud, delivery_t how,
+                    long seconds) {
+    nmea_parser_config_t config = NMEA_PARSER_CONFIG_DEFAULT();
+    config.uart.baud_rate = baud;
+    esp_gps_t *gps = nmea_parser_init(&config);
+    result_t res = {0};
+    if (!gps) return res;
+    memset(&host_gps_events, 0, sizeof(host_gps_events));
+
+    size_t total = (size_t)seconds * baud / 10; // bytes of line time
+    double char_us = 10e6 / baud;
+    int64_t cpu_ns = 0;
+    size_t sent = 0, at = 0; // bytes delivered, position in the stream
+    while (sent < total) {
+        size_t n;
+        if (how == PER_LINE) {
+            const uint8_t *nl = memchr(stream + at, '\n', len - at);
+            n = nl ? (size_t)(nl - (stream + at)) + 1 : len - at;
+        } else {
+            n = how == PER_FIFO ? 120 : NMEA_PARSER_RUNTIME_BUFFER_SIZE;
+            if (n > len - at) n = len - at;
+        }
+        host_gps_uart.data = stream + at;
+        host_gps_uart.len = n;
+        host_gps_uart.pos = 0;
+        host_gps_uart.chunk = n;
+        host_gps_now_us = 1000000 + (int64_t)((sent + n) * char_us);
+        int64_t t0 = host_now_ns();
+        esp_handle_uart_data(gps);
+        cpu_ns += host_now_ns() - t0;
+        res.reads++;
+        sent += n;
+        at = (at + n) % len;
+    }
+    res.cpu_us_per_s = (double)cpu_ns / 1e3 / seconds;
+    res.sentences = gps->nmea_good;
+    res.fixes = host_gps_events.updates;
+    nmea_parser_deinit(gps);
+    return res;
+}
+
+int main(int argc, char **argv) {
+    long seconds = argc > 1 ? atol(argv[1]) : 600;
+    static uint8_t stream[16384];
+    size_t len = load_stream(stream, sizeof(stream));
+    if (!len) {
+        fprintf(stderr, "no sentences in %s\n", host_data_path("nmea.txt"));
+        return 1;
+    }
+    printf("%zu bytes of nmea.txt on a loop, %ld s of line time each\n", len, seconds);
+    printf("  %-7s %-15s %9s %11s %11s %12s\n", "baud", "delivery", "reads/s", "sentences/s",
+           "fixes/s", "cpu us/s");
+    const uint32_t bauds[] = {115200, 921600};
+    for (size_t b = 0; b < sizeof(bauds) / sizeof(bauds[0]); b++) {
+        for (int how = PER_LINE; how <= PER_BLOCK; how++) {
+            result_t r = run(stream, len, bauds[b], (delivery_t)how, seconds);
+            printf("  %-7u %-15s %9.0f %11.0f %11.1f %12.1f\n", bauds[b], s_delivery[how],
+                   (double)r.reads / seconds, (double)r.sentences / seconds,
+                   (double)r.fixes / seconds, r.cpu_us_per_s);
+        }
+    }
+    return 0;
+}
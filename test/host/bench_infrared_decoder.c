@@ -0,0 +1,93 @@
+// infrared decoder preamble dispatch against the all-decoders loop it
+// replaced (ir_decoder_ref.h), replaying the captures in data/ir_frames.txt:
+// us per frame and ns per timing, clean captures and jittered / noisy ones
+// apart, plus a stretch of line noise between buttons. not a ctest, run it by
+// hand: ./bench_infrared_decoder [rounds]
+
+#include "ir_decoder_ref.h"
+#include "host_test.h"
+
+typedef InfraredDecodedMessage *(*decode_fn)(InfraredDecoderContext *, bool, uint32_t);
+
+static volatile uintptr_t sink;
+
+// feeds every frame like the receive loop, reset after a message
+static int64_t replay(decode_fn decode, InfraredDecoderContext *dec, const ir_capture_t *caps,
+                      size_t count, bool noisy, long rounds, size_t *frames, size_t *timings) {
+    *frames = 0;
+    *timings = 0;
+    int64_t t0 = host_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (size_t c = 0; c < count; c++) {
+            if ((strchr(caps[c].name, ' ') != NULL) != noisy) continue;
+            infrared_decoder_reset(dec);
+            for (size_t k = 0; k < caps[c].frame_count; k++) {
+                const ir_frame_t *fr = &caps[c].frames[k];
+                for (size_t i = 0; i < fr->timing_count; i++) {
+                    InfraredDecodedMessage *m = decode(dec, i % 2 == 0, fr->timings[i]);
+                    if (m) {
+                        sink += m->command;
+                        infrared_decoder_reset(dec);
+                        break;
+                    }
+                }
+                *timings += fr->timing_count;
+            }
+            *frames += caps[c].frame_count;
+        }
+    }
+    return host_now_ns() - t0;
+}
+
+static void compare(const char *what, InfraredDecoderContext *dec, const ir_capture_t *caps,
+                    size_t count, bool noisy, long rounds) {
+    size_t frames, timings;
+    int64_t fast =
+        replay(infrared_decoder_decode, dec, caps, count, noisy, rounds, &frames, &timings);
+    int64_t slow = replay(ref_decoder_decode, dec, caps, count, noisy, rounds, &frames, &timings);
+    printf("%-16s %6zu frames: dispatch %6.2f us/frame %5.1f ns/timing, all decoders %6.2f "
+           "us/frame %5.1f ns/timing (%.1fx)\n",
+           what, frames / rounds, fast / 1e3 / frames, (double)fast / timings, slow / 1e3 / frames,
+           (double)slow / timings, (double)slow / fast);
+}
+
+// random marks and spaces no protocol starts on, what the receiver sees in
+// sunlight or under a fluorescent tube
+static void compare_noise(InfraredDecoderContext *dec, long rounds) {
+    enum { N = 4096 };
+    static uint32_t noise[N];
+    uint32_t s = 0x2545f491;
+    for (int i = 0; i < N; i++) {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        noise[i] = 50 + s % 12000;
+    }
+    decode_fn fns[2] = {infrared_decoder_decode, ref_decoder_decode};
+    double ns[2];
+    for (int f = 0; f < 2; f++) {
+        infrared_decoder_reset(dec);
+        int64_t t0 = host_now_ns();
+        for (long r = 0; r < rounds; r++) {
+            for (int i = 0; i < N; i++) sink += (uintptr_t)fns[f](dec, i % 2 == 0, noise[i]);
+        }
+        ns[f] = (double)(host_now_ns() - t0) / ((double)rounds * N);
+    }
+    printf("%-16s %6d timings: dispatch %5.1f ns/timing, all decoders %5.1f ns/timing (%.1fx)\n",
+           "line noise", N, ns[0], ns[1], ns[1] / ns[0]);
+}
+
+int main(int argc, char **argv) {
+    long rounds = argc > 1 ? atol(argv[1]) : 2000;
+    size_t count = 0;
+    ir_capture_t *caps = ir_load_captures(host_data_path("ir_frames.txt"), &count);
+    if (!caps) return 1;
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    printf("%zu captures, %ld rounds\n", count, rounds);
+    compare("clean", dec, caps, count, false, rounds);
+    compare("jitter / noisy", dec, caps, count, true, rounds);
+    compare_noise(dec, rounds);
+    infrared_decoder_free(dec);
+    ir_free_captures(caps, count);
+    return 0;
+}
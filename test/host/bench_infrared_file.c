@@ -0,0 +1,179 @@
+// .ir library open and list against the whole-file parser it replaced
+// (ir_file_ref.h), over a generated universal library of n signals, a fifth
+// of them raw: ms and peak heap for a full parse both ways, for building the
+// .gidx index, opening it from the cache and loading one signal through it.
+// heap is live bytes, counted by wrapping malloc, its friends and strdup at
+// link time. not a ctest, run it by hand: ./bench_infrared_file [signals] [rounds]
+
+#include "managers/infrared_file.h"
+#include "ir_file_ref.h"
+#include "host_test.h"
+#include <malloc.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+char *__real_strdup(const char *s);
+
+static size_t s_live, s_peak;
+
+static void *counted(void *p) {
+    if (p) {
+        s_live += malloc_usable_size(p);
+        if (s_live > s_peak) s_peak = s_live;
+    }
+    return p;
+}
+
+void *__wrap_malloc(size_t size) {
+    return counted(__real_malloc(size));
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    return counted(__real_calloc(n, size));
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    if (ptr) s_live -= malloc_usable_size(ptr);
+    void *p = __real_realloc(ptr, size);
+    // a failed realloc leaves the old block in place
+    return counted(p ? p : (size ? ptr : NULL));
+}
+
+// libc allocates this one itself, past the malloc wrap
+char *__wrap_strdup(const char *s) {
+    return counted(__real_strdup(s));
+}
+
+void __wrap_free(void *ptr) {
+    if (ptr) s_live -= malloc_usable_size(ptr);
+    __real_free(ptr);
+}
+
+static uint32_t s_rand = 0x2545f491;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+static const char *const s_protocols[] = {"NEC", "NECext", "Samsung32", "SIRC", "RC5", "RC6",
+                                          "Kaseikyo"};
+static const char *const s_buttons[] = {"Power", "Vol_up", "Vol_dn", "Ch_next", "Ch_prev",
+                                        "Mute"};
+
+static long write_library(const char *path, long signals) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+    fputs("Filetype: IR signals file\nVersion: 1\n", f);
+    for (long i = 0; i < signals; i++) {
+        fprintf(f, "#\nname: %s\n", s_buttons[i % 6]);
+        if (rnd(5)) {
+            fprintf(f, "type: parsed\nprotocol: %s\n", s_protocols[rnd(7)]);
+            fprintf(f, "address: %02X 00 00 00\ncommand: %02X 00 00 00\n", rnd(256), rnd(256));
+            continue;
+        }
+        fputs("type: raw\nfrequency: 38000\nduty_cycle: 0.330000\ndata:", f);
+        for (uint32_t k = 0, n = 60 + rnd(240); k < n; k++) fprintf(f, " %u", 400 + rnd(1400));
+        fputc('\n', f);
+    }
+    long size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+typedef struct {
+    double ms;
+    size_t peak;
+} cost_t;
+
+static void report(const char *what, cost_t c) {
+    printf("  %-28s %9.3f ms  peak heap %8zu bytes\n", what, c.ms, c.peak);
+}
+
+static void start(int64_t *t0) {
+    s_peak = s_live;
+    *t0 = host_now_ns();
+}
+
+static cost_t stop(int64_t t0, size_t base, long rounds) {
+    return (cost_t){(double)(host_now_ns() - t0) / 1e6 / rounds, s_peak - base};
+}
+
+int main(int argc, char **argv) {
+    long signals = argc > 1 ? atol(argv[1]) : 3000;
+    long rounds = argc > 2 ? atol(argv[2]) : 10;
+
+    char dir[] = "/tmp/bench_infrared_file_XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    char path[256], cache[256];
+    snprintf(path, sizeof(path), "%s/universal.ir", dir);
+    snprintf(cache, sizeof(cache), "%s/.universal.gidx", dir);
+    long size = write_library(path, signals);
+    printf("%ld signals, %ld bytes, %ld rounds\n", signals, size, rounds);
+
+    infrared_signal_t *list;
+    size_t count;
+    int64_t t0;
+    size_t base = s_live;
+
+    start(&t0);
+    for (long r = 0; r < rounds; r++) {
+        if (ref_read_list(path, &list, &count)) ref_free_signals(list, count);
+    }
+    report("whole file parse (before)", stop(t0, base, rounds));
+
+    start(&t0);
+    for (long r = 0; r < rounds; r++) {
+        if (infrared_file_read_list(path, &list, &count)) ref_free_signals(list, count);
+    }
+    report("streaming parse", stop(t0, base, rounds));
+
+    infrared_file_index_t index;
+    start(&t0);
+    for (long r = 0; r < rounds; r++) {
+        unlink(cache);
+        if (infrared_file_index_open(path, &index)) infrared_file_index_close(&index);
+    }
+    report("index build + cache write", stop(t0, base, rounds));
+
+    // what "ir show" does: open and print every name
+    volatile size_t sink = 0;
+    start(&t0);
+    for (long r = 0; r < rounds; r++) {
+        if (!infrared_file_index_open(path, &index)) continue;
+        for (size_t i = 0; i < index.count; i++) {
+            sink += strlen(infrared_file_index_name(&index, i));
+        }
+        infrared_file_index_close(&index);
+    }
+    report("index from cache + list", stop(t0, base, rounds));
+
+    // what "ir send" does for the last button in the file
+    infrared_file_index_open(path, &index);
+    base = s_live;
+    infrared_signal_t one;
+    start(&t0);
+    for (long r = 0; r < rounds; r++) {
+        if (infrared_file_index_load(&index, index.count - 1, &one)) {
+            infrared_manager_free_signal(&one);
+        }
+    }
+    report("load last signal via index", stop(t0, base, rounds));
+    infrared_file_index_close(&index);
+
+    struct stat st;
+    if (stat(cache, &st) == 0) printf("  cache %ld bytes\n", (long)st.st_size);
+    unlink(cache);
+    unlink(path);
+    rmdir(dir);
+    return 0;
+}
@@ -0,0 +1,82 @@
+// log ring to server-sent events: an 8 KB ring drained the way
+// log_sse_push_work does it, for a few line length mixes. reports ns per
+// appended line, frames and bytes on the wire per ring of log text, and ns
+// per frame. not a ctest, run it by hand: ./bench_log_sse [rings]
+
+#include "host_test.h"
+#include "managers/log_ring.h"
+
+static uint32_t s_rand = 0x9e3779b9;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+typedef struct {
+    const char *name;
+    uint32_t min, max; // line length without the newline
+} mix_t;
+
+static const mix_t mixes[] = {
+    {"empty lines", 0, 0},
+    {"short lines (0-16)", 0, 16},
+    {"typical lines (30-90)", 30, 90},
+    {"long lines (500-1500)", 500, 1500},
+};
+
+int main(int argc, char **argv) {
+    long rings = argc > 1 ? atol(argv[1]) : 2000;
+    static char buf[LOG_RING_SIZE];
+    static char lines[LOG_RING_SIZE * 2];
+    static size_t offs[LOG_RING_SIZE * 2];
+    char text[LOG_READ_CHUNK];
+    char frame[LOG_SSE_FRAME_SIZE];
+    volatile size_t sink = 0;
+
+    for (size_t m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++) {
+        // one ring's worth of lines, appended and drained again every round
+        size_t len = 0, count = 0;
+        while (len < LOG_RING_SIZE - 1600) {
+            uint32_t l = mixes[m].min + rnd(mixes[m].max - mixes[m].min + 1);
+            offs[count++] = len;
+            memset(lines + len, 'x', l);
+            lines[len + l] = '\n';
+            len += l + 1;
+        }
+        offs[count] = len;
+
+        log_ring_t r = {buf, 0, 0};
+        uint32_t cursor = 0;
+        int64_t t_append = 0, t_drain = 0;
+        uint64_t frames = 0, wire = 0;
+        for (long k = 0; k < rings; k++) {
+            int64_t t0 = host_now_ns();
+            for (size_t i = 0; i < count; i++) {
+                log_ring_append(&r, lines + offs[i], offs[i + 1] - offs[i]);
+            }
+            int64_t t1 = host_now_ns();
+            while (cursor != r.head) {
+                uint32_t dropped;
+                size_t n = log_ring_read_since(&r, &cursor, r.head, text, sizeof(text), &dropped);
+                uint32_t start = cursor - (uint32_t)n;
+                size_t used;
+                size_t f = log_sse_format(text, n, &used, start, dropped, frame, sizeof(frame));
+                cursor = start + (uint32_t)used;
+                sink += f;
+                wire += f;
+                frames++;
+            }
+            t_drain += host_now_ns() - t1;
+            t_append += t1 - t0;
+        }
+        printf("%-22s %4zu lines/ring: append %6.1f ns/line, %5.1f frames/ring, "
+               "%.2f wire bytes per log byte, %7.1f ns/frame\n",
+               mixes[m].name, count, (double)t_append / ((double)count * rings),
+               (double)frames / rings, (double)wire / ((double)len * rings),
+               (double)t_drain / frames);
+    }
+    return 0;
+}
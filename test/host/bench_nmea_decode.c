@@ -0,0 +1,144 @@
+// gps_decode over the sentences of data/nmea.txt, each decoded where it lies
+// in the rx buffer, as the block reader hands it over: sentences/s and ns per
+// sentence by statement, then the coordinate parse against the strtof one it
+// replaced. MicroNMEA.c is built in (MICRONMEA_C) against nmea_stubs.c.
+// not a ctest, run it by hand: ./bench_nmea_decode [rounds]
+
+#include MICRONMEA_C
+#include "host_gps_uart.h"
+#include "host_test.h"
+
+#define MAX_SENTENCES 256
+
+static struct {
+    char text[NMEA_MAX_SENTENCE_LENGTH];
+    size_t len;
+} s_sentences[MAX_SENTENCES];
+
+static size_t load_sentences(void) {
+    FILE *f = fopen(host_data_path("nmea.txt"), "r");
+    if (!f) return 0;
+    char line[512];
+    size_t n = 0;
+    while (n < MAX_SENTENCES && fgets(line, sizeof(line), f)) {
+        size_t len = strcspn(line, "\r\n");
+        if (line[0] != '$' || len >= sizeof(s_sentences[n].text)) continue;
+        memcpy(s_sentences[n].text, line, len);
+        s_sentences[n].len = len;
+        n++;
+    }
+    fclose(f);
+    return n;
+}
+
+// parse_lat_long before the fixed-point parser, minus its debug logs
+static float ref_parse_lat_long_float(const char *item, bool is_latitude) {
+    if (!item[0] || item[0] == ',') return 0.0f;
+    int deg_width = is_latitude ? 2 : 3;
+    char deg_str[4] = {0};
+    strncpy(deg_str, item, deg_width);
+    int degrees = atoi(deg_str);
+    float minutes = strtof(item + deg_width, NULL);
+    return degrees + (minutes / 60.0f);
+}
+
+typedef struct {
+    char name[8]; // "GGA", or "bad crc"
+    uint32_t sentences;
+    int64_t ns;
+} by_statement_t;
+
+static by_statement_t *statement_slot(by_statement_t *slots, size_t *count, const char *name) {
+    for (size_t i = 0; i < *count; i++) {
+        if (strcmp(slots[i].name, name) == 0) return &slots[i];
+    }
+    by_statement_t *s = &slots[(*count)++];
+    memset(s, 0, sizeof(*s));
+    snprintf(s->name, sizeof(s->name), "%s", name);
+    return s;
+}
+
+int main(int argc, char **argv) {
+    long rounds = argc > 1 ? atol(argv[1]) : 20000;
+    size_t n = load_sentences();
+    if (!n) {
+        fprintf(stderr, "no sentences in %s\n", host_data_path("nmea.txt"));
+        return 1;
+    }
+
+    nmea_parser_config_t config = NMEA_PARSER_CONFIG_DEFAULT();
+    esp_gps_t *gps = nmea_parser_init(&config);
+    if (!gps) return 1;
+    printf("%zu sentences from nmea.txt, %ld rounds\n", n, rounds);
+
+    by_statement_t slots[16];
+    size_t slot_count = 0;
+    int64_t total_ns = 0;
+    uint32_t updates = host_gps_events.updates;
+    for (size_t i = 0; i < n; i++) {
+        size_t len = s_sentences[i].len;
+        // the sentence id, the whole address for proprietary ones
+        const char *addr = s_sentences[i].text + 1;
+        int addr_len = (int)strcspn(addr, ",*");
+        char name[8] = "bad crc";
+        if (nmea_checksum_ok(s_sentences[i].text, len)) {
+            if (addr_len == 5 && addr[0] != 'P') {
+                snprintf(name, sizeof(name), "%.3s", addr + 2);
+            } else {
+                snprintf(name, sizeof(name), "%.*s", addr_len, addr);
+            }
+        }
+        by_statement_t *slot = statement_slot(slots, &slot_count, name);
+        // decoded in place; only an unknown statement writes past its end
+        memcpy(gps->buffer, s_sentences[i].text, len);
+        gps->buffer[len] = '\n';
+        gps->rx_len = len + 1;
+        int64_t t0 = host_now_ns();
+        for (long r = 0; r < rounds; r++) gps_decode(gps, (char *)gps->buffer, len);
+        int64_t ns = host_now_ns() - t0;
+        slot->sentences += (uint32_t)rounds;
+        slot->ns += ns;
+        total_ns += ns;
+    }
+    printf("  %-10s %10s %12s %8s\n", "statement", "sentences", "sentences/s", "ns");
+    for (size_t i = 0; i < slot_count; i++) {
+        double per = (double)slots[i].ns / slots[i].sentences;
+        uint32_t in_corpus = slots[i].sentences / (uint32_t)rounds;
+        printf("  %-10s %10u %12.0f %8.1f\n", slots[i].name, in_corpus, 1e9 / per, per);
+    }
+    double per = (double)total_ns / ((double)n * rounds);
+    printf("  %-10s %10zu %12.0f %8.1f\n", "all", n, 1e9 / per, per);
+    printf("  %u fixes posted\n", host_gps_events.updates - updates);
+
+    // the coordinate fields of the corpus, one conversion each
+    const char *coords[] = {"4807.038000", "01131.000002", "3345.925926", "15107.407402",
+                            "0000.000006", "8959.999994", "17959.999994"};
+    const size_t ncoords = sizeof(coords) / sizeof(coords[0]);
+    volatile float fsink = 0;
+    volatile int32_t isink = 0;
+    long calls = rounds * 50;
+    int64_t t0 = host_now_ns();
+    for (long c = 0; c < calls; c++) {
+        fsink += ref_parse_lat_long_float(coords[c % ncoords], c % 2 == 0);
+    }
+    double float_ns = (double)(host_now_ns() - t0) / calls;
+    t0 = host_now_ns();
+    for (long c = 0; c < calls; c++) {
+        snprintf(gps->item_str, sizeof(gps->item_str), "%s", coords[c % ncoords]);
+        isink += parse_lat_long(gps, 180);
+    }
+    double fixed_ns = (double)(host_now_ns() - t0) / calls;
+    // the item copy is gps_decode's, not the parse's
+    t0 = host_now_ns();
+    for (long c = 0; c < calls; c++) {
+        snprintf(gps->item_str, sizeof(gps->item_str), "%s", coords[c % ncoords]);
+        isink += gps->item_str[0];
+    }
+    double copy_ns = (double)(host_now_ns() - t0) / calls;
+    printf("coordinate parse\n");
+    printf("  %-28s %8.1f ns\n", "strtof, float (before)", float_ns);
+    printf("  %-28s %8.1f ns\n", "digits, degrees * 1e7", fixed_ns - copy_ns);
+
+    nmea_parser_deinit(gps);
+    return 0;
+}
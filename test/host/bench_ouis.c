@@ -0,0 +1,41 @@
+// ouis_lookup_vendor against the old json scan, ns per lookup over every oui
+// in the table. not a ctest: ./bench_ouis
+
+#include "core/ouis.h"
+#include "host_test.h"
+#include "ouis_ref.h"
+
+int main(void) {
+    if (!ref_load_json()) return 1;
+
+    static char keys[12000][7];
+    size_t n = 0;
+    for (const char *p = strchr(json_buf, '"'); p && n < 12000; p = strchr(p, '"')) {
+        const char *q = strchr(p + 1, '"');
+        if (!q) break;
+        if (q - p == 7 && q[1] == ':') {
+            memcpy(keys[n], p + 1, 6);
+            keys[n++][6] = '\0';
+        }
+        p = q + 1;
+    }
+
+    char out[128];
+    volatile size_t sink = 0;
+    int64_t t0 = host_now_ns();
+    for (int r = 0; r < 100; r++) {
+        for (size_t i = 0; i < n; i++) sink += ouis_lookup_vendor(keys[i], out, sizeof(out));
+    }
+    int64_t table_ns = host_now_ns() - t0;
+
+    // the scan is linear in the key's position, a strided sample is enough
+    size_t sampled = 0;
+    t0 = host_now_ns();
+    for (size_t i = 0; i < n; i += 16, sampled++) sink += ref_lookup(keys[i], out, sizeof(out));
+    int64_t scan_ns = host_now_ns() - t0;
+
+    printf("%zu ouis: table %.1f ns/lookup, json scan %.1f ns/lookup\n", n,
+           (double)table_ns / (100.0 * n), (double)scan_ns / sampled);
+    free(json_buf);
+    return 0;
+}
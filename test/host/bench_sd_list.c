@@ -0,0 +1,68 @@
+// sd listing pages over a scratch directory of n files: us per page for the
+// first and the last page of 100, sorted and in directory order, and the
+// whole walk. the host file system stands in for fatfs, so the ratios carry
+// over better than the times. not a ctest, run it by hand:
+// ./bench_sd_list [files] [rounds]
+
+#include "host_test.h"
+#include "managers/sd_list.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static size_t s_bytes;
+
+static esp_err_t count_write(void *ctx, const char *data, size_t len) {
+    s_bytes += len;
+    return ESP_OK;
+}
+
+static double time_page(const char *dir, uint32_t offset, bool sorted, long rounds) {
+    sd_list_opts_t opts = {.offset = offset, .limit = SD_LIST_DEFAULT_LIMIT, .sorted = sorted};
+    int64_t t0 = host_now_ns();
+    for (long r = 0; r < rounds; r++) sd_list_dir(dir, &opts, count_write, NULL);
+    return (double)(host_now_ns() - t0) / rounds / 1000.0;
+}
+
+int main(int argc, char **argv) {
+    long files = argc > 1 ? atol(argv[1]) : 2000;
+    long rounds = argc > 2 ? atol(argv[2]) : 20;
+
+    char dir[] = "/tmp/bench_sd_list_XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    char path[256];
+    for (long i = 0; i < files; i++) {
+        // capture-style names, not created in sorted order
+        snprintf(path, sizeof(path), "%s/capture_%06ld.pcap", dir, (i * 7919) % files);
+        FILE *f = fopen(path, "wb");
+        if (f) fclose(f);
+    }
+
+    uint32_t last = files > SD_LIST_DEFAULT_LIMIT ? (uint32_t)(files - SD_LIST_DEFAULT_LIMIT) : 0;
+    for (int sorted = 1; sorted >= 0; sorted--) {
+        double first_us = time_page(dir, 0, sorted, rounds);
+        double last_us = time_page(dir, last, sorted, rounds);
+        s_bytes = 0;
+        int64_t t0 = host_now_ns();
+        long pages = 0;
+        for (uint32_t off = 0; off < (uint32_t)files; off += SD_LIST_DEFAULT_LIMIT, pages++) {
+            sd_list_opts_t opts = {.offset = off, .limit = SD_LIST_DEFAULT_LIMIT, .sorted = sorted};
+            sd_list_dir(dir, &opts, count_write, NULL);
+        }
+        double walk_ms = (double)(host_now_ns() - t0) / 1e6;
+        printf("%-9s %ld files: first page %8.1f us, last page %8.1f us, "
+               "all %ld pages %7.2f ms, %zu bytes\n",
+               sorted ? "sorted" : "dir order", files, first_us, last_us, pages, walk_ms,
+               s_bytes);
+    }
+
+    for (long i = 0; i < files; i++) {
+        snprintf(path, sizeof(path), "%s/capture_%06ld.pcap", dir, i);
+        unlink(path);
+    }
+    rmdir(dir);
+    return 0;
+}
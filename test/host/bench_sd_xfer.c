@@ -0,0 +1,135 @@
+// uploads and downloads through sd_xfer against one task doing network and
+// card one after the other, as the handlers did before. the card and the
+// network are modelled as a fixed cost per call plus a cost per KB (usleep),
+// so the numbers show how much of the two latencies the pipeline hides, not
+// what a real card does. reports MB/s for each model. not a ctest, run it by
+// hand: ./bench_sd_xfer [MB]
+
+#include "host_test.h"
+#include "host_sd_io.h"
+#include "managers/sd_xfer.h"
+#include <fcntl.h>
+#include <unistd.h>
+
+#define NET_PIECE 1460 // one tcp segment per recv/send
+
+typedef struct {
+    const char *name;
+    uint32_t card_call_us, card_us_per_kb; // per write/read call, per KB
+    uint32_t net_us_per_kb;
+} model_t;
+
+static const model_t models[] = {
+    {"fast card, slow wifi", 300, 50, 400},
+    {"balanced", 1000, 100, 100},
+    {"slow card, fast wifi", 3000, 300, 50},
+};
+
+static char s_path[256];
+
+static void net_wait(const model_t *m, size_t len) {
+    usleep((useconds_t)((uint64_t)m->net_us_per_kb * len / 1024));
+}
+
+static void card_model(const model_t *m) {
+    host_sd_io_reset();
+    host_sd_io.delay_us = m->card_call_us;
+    host_sd_io.us_per_kb = m->card_us_per_kb;
+}
+
+// recv into the buffer, write it, repeat
+static double upload_serial(const model_t *m, size_t size) {
+    static uint8_t buf[SD_XFER_BUF_SIZE];
+    card_model(m);
+    int64_t t0 = host_now_ns();
+    int fd = open(s_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    for (size_t pos = 0; pos < size;) {
+        size_t fill = 0;
+        while (fill < sizeof(buf) && pos < size) {
+            size_t n = NET_PIECE < size - pos ? NET_PIECE : size - pos;
+            if (n > sizeof(buf) - fill) n = sizeof(buf) - fill;
+            net_wait(m, n);
+            memset(buf + fill, (int)pos, n);
+            fill += n;
+            pos += n;
+        }
+        if (write(fd, buf, fill) != (ssize_t)fill) break;
+    }
+    close(fd);
+    return (double)(host_now_ns() - t0) / 1e9;
+}
+
+static double upload_pipelined(const model_t *m, size_t size) {
+    card_model(m);
+    int64_t t0 = host_now_ns();
+    sd_xfer_t *x = sd_xfer_begin_write(open(s_path, O_WRONLY | O_CREAT | O_TRUNC, 0644), size);
+    for (size_t pos = 0; pos < size;) {
+        size_t cap, fill = 0;
+        uint8_t *buf = sd_xfer_get_buffer(x, &cap);
+        if (!buf) break;
+        while (fill < cap && pos < size) {
+            size_t n = NET_PIECE < size - pos ? NET_PIECE : size - pos;
+            if (n > cap - fill) n = cap - fill;
+            net_wait(m, n);
+            memset(buf + fill, (int)pos, n);
+            fill += n;
+            pos += n;
+        }
+        sd_xfer_commit(x, fill);
+    }
+    sd_xfer_finish(x, NULL);
+    return (double)(host_now_ns() - t0) / 1e9;
+}
+
+static void send_buffer(const model_t *m, size_t len) {
+    for (size_t off = 0; off < len; off += NET_PIECE) {
+        net_wait(m, len - off < NET_PIECE ? len - off : NET_PIECE);
+    }
+}
+
+static double download_serial(const model_t *m, size_t size) {
+    static uint8_t buf[SD_XFER_BUF_SIZE];
+    card_model(m);
+    int64_t t0 = host_now_ns();
+    int fd = open(s_path, O_RDONLY);
+    for (size_t pos = 0; pos < size;) {
+        ssize_t n = read(fd, buf, size - pos < sizeof(buf) ? size - pos : sizeof(buf));
+        if (n <= 0) break;
+        send_buffer(m, (size_t)n);
+        pos += (size_t)n;
+    }
+    close(fd);
+    return (double)(host_now_ns() - t0) / 1e9;
+}
+
+static double download_pipelined(const model_t *m, size_t size) {
+    card_model(m);
+    int64_t t0 = host_now_ns();
+    sd_xfer_t *x = sd_xfer_begin_read(open(s_path, O_RDONLY), 0, size);
+    size_t len;
+    while (sd_xfer_next(x, &len)) {
+        send_buffer(m, len);
+        sd_xfer_release(x);
+    }
+    sd_xfer_end(x);
+    return (double)(host_now_ns() - t0) / 1e9;
+}
+
+int main(int argc, char **argv) {
+    double mb = argc > 1 ? atof(argv[1]) : 2;
+    size_t size = (size_t)(mb * 1024 * 1024);
+    snprintf(s_path, sizeof(s_path), "/tmp/bench_sd_xfer_%d.bin", (int)getpid());
+
+    for (size_t i = 0; i < sizeof(models) / sizeof(models[0]); i++) {
+        const model_t *m = &models[i];
+        double up_s = upload_serial(m, size), up_p = upload_pipelined(m, size);
+        double down_s = download_serial(m, size), down_p = download_pipelined(m, size);
+        double mbs = (double)size / (1024 * 1024);
+        printf("%-22s upload %5.2f -> %5.2f MB/s (%4.2fx), download %5.2f -> %5.2f MB/s "
+               "(%4.2fx)\n",
+               m->name, mbs / up_s, mbs / up_p, up_s / up_p, mbs / down_s, mbs / down_p,
+               down_s / down_p);
+    }
+    unlink(s_path);
+    return 0;
+}
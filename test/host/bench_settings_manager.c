@@ -0,0 +1,44 @@
+// boot-time settings load: settings_load against an nvs holding every field,
+// as nvs lookups, entries used and host time per load. flash reads dominate
+// on the device, so the lookup count is the number that carries over; build
+// bench_settings_manager_blob for the blob layout to compare. not a ctest,
+// run it by hand: ./bench_settings_manager [loads]
+
+#include SETTINGS_MANAGER_C
+#include "host_nvs.h"
+#include "host_test.h"
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+    long loads = argc > 1 ? atol(argv[1]) : 20000;
+
+    // the loader prints as it goes
+    FILE *out = fdopen(dup(1), "w");
+    freopen("/dev/null", "w", stdout);
+
+    // a device that has had every setting changed once
+    settings_init(&G_Settings);
+    portENTER_CRITICAL(&s_dirty_mux);
+    s_dirty = (1ULL << FIELD_COUNT) - 1;
+    portEXIT_CRITICAL(&s_dirty_mux);
+    settings_flush();
+
+    FSettings s;
+    host_nvs_clear_counts();
+    int64_t t0 = host_now_ns();
+    for (long i = 0; i < loads; i++) settings_load(&s);
+    int64_t ns = host_now_ns() - t0;
+
+    nvs_stats_t stats;
+    nvs_get_stats(NULL, &stats);
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+    const char *layout = "blob";
+#else
+    const char *layout = "per-key";
+#endif
+    fprintf(out, "%s layout, %d fields: %.1f nvs reads per load, %zu nvs entries, %.2f us/load\n",
+            layout, FIELD_COUNT, (double)host_nvs.gets / loads, stats.used_entries,
+            (double)ns / loads / 1000.0);
+    fclose(out);
+    return 0;
+}
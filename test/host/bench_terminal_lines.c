@@ -0,0 +1,100 @@
+// terminal scrollback: ns per appended line (typical, long, dualcomm
+// mixes), ns per incremental layout of a line with a stand-in measure, and
+// finding the first visible line of a full scrollback by the y index against
+// the walk from the oldest line that redraws used before. not a ctest, run
+// it by hand: ./bench_terminal_lines [rounds]
+
+#include "host_test.h"
+#include "managers/views/terminal_lines.h"
+
+static term_line_t s_lines[TERM_MAX_LINES];
+static char s_arena[TERM_TEXT_BYTES];
+
+static uint32_t s_rand = 0x9e3779b9;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+typedef struct {
+    const char *name;
+    uint32_t min, max;
+    int dc_pct;
+} mix_t;
+
+static const mix_t mixes[] = {
+    {"typical (30-90)", 30, 90, 0},
+    {"long (300-1000)", 300, 1000, 0},
+    {"dualcomm half", 30, 90, 50},
+};
+
+// rows of 40 chars, 16 px each; the real one is lv_txt_get_size
+static uint16_t measure(void *ctx, const char *text) {
+    size_t len = strlen(text);
+    return (uint16_t)(16 * (len ? (len + 39) / 40 : 1));
+}
+
+static uint16_t walk_first_visible(const term_lines_t *t, int32_t y) {
+    int32_t at = 0;
+    for (uint16_t i = 0; i < t->laid_out; i++) {
+        at += term_lines_at(t, i)->pxh;
+        if (at >= y) return i;
+    }
+    return t->laid_out;
+}
+
+int main(int argc, char **argv) {
+    long rounds = argc > 1 ? atol(argv[1]) : 200;
+    static char lines[4096][1024];
+    static size_t lens[4096];
+    volatile uint32_t sink = 0;
+
+    for (size_t m = 0; m < sizeof(mixes) / sizeof(mixes[0]); m++) {
+        for (size_t i = 0; i < 4096; i++) {
+            if ((int)rnd(100) < mixes[m].dc_pct) {
+                lens[i] = (size_t)snprintf(lines[i], sizeof(lines[i]), "RX: peer line %zu", i);
+                continue;
+            }
+            lens[i] = mixes[m].min + rnd(mixes[m].max - mixes[m].min + 1);
+            memset(lines[i], 'a' + (int)(i % 26), lens[i]);
+        }
+        term_lines_t t = {.lines = s_lines, .arena = s_arena};
+        term_lines_clear(&t);
+        int64_t t_append = 0, t_layout = 0;
+        for (long r = 0; r < rounds; r++) {
+            // a burst of 32 lines, then a redraw lays them out
+            for (size_t b = 0; b < 4096; b += 32) {
+                int64_t t0 = host_now_ns();
+                for (size_t i = b; i < b + 32; i++) term_lines_append(&t, lines[i], lens[i]);
+                int64_t t1 = host_now_ns();
+                term_lines_layout(&t, measure, NULL);
+                t_layout += host_now_ns() - t1;
+                t_append += t1 - t0;
+            }
+        }
+        double n = 4096.0 * rounds;
+        printf("%-17s append %6.1f ns/line, layout %6.1f ns/line, %3u lines held\n",
+               mixes[m].name, t_append / n, t_layout / n, t.count);
+    }
+
+    // a full scrollback of short lines, scrolled to random positions
+    term_lines_t t = {.lines = s_lines, .arena = s_arena};
+    term_lines_clear(&t);
+    for (int i = 0; i < 1000; i++) term_lines_append(&t, "a short line of output", 22);
+    term_lines_layout(&t, measure, NULL);
+    int32_t height = term_lines_height(&t, false);
+    const long lookups = rounds * 5000;
+    int64_t t0 = host_now_ns();
+    for (long i = 0; i < lookups; i++) {
+        sink += term_lines_first_visible(&t, TERM_COL_ALL, (int32_t)rnd((uint32_t)height));
+    }
+    int64_t t1 = host_now_ns();
+    for (long i = 0; i < lookups; i++) sink += walk_first_visible(&t, (int32_t)rnd((uint32_t)height));
+    int64_t t2 = host_now_ns();
+    printf("first visible of %u lines: index %6.1f ns, walk %7.1f ns\n", t.count,
+           (double)(t1 - t0) / lookups, (double)(t2 - t1) / lookups);
+    return 0;
+}
@@ -0,0 +1,38 @@
+// ns per frame for wifi_ie_parse_mgmt over the frame corpus. not a ctest,
+// run it by hand: ./bench_wifi_ie [rounds]
+
+#include "core/wifi_ie.h"
+#include "host_test.h"
+
+int main(int argc, char **argv) {
+    static uint8_t frames[128][512];
+    static uint32_t lens[128];
+    size_t n = 0;
+    host_pcap_t pcap;
+    host_pcap_pkt_t pkt;
+    if (host_pcap_open(&pcap, host_data_path("mgmt_frames.pcap")) != 0) {
+        fprintf(stderr, "cannot open mgmt_frames.pcap\n");
+        return 1;
+    }
+    while (n < 128 && host_pcap_next(&pcap, &pkt) == 1) {
+        if (pkt.len > sizeof(frames[0])) continue;
+        memcpy(frames[n], pkt.frame, pkt.len);
+        lens[n++] = pkt.len;
+    }
+    host_pcap_close(&pcap);
+
+    long rounds = argc > 1 ? atol(argv[1]) : 20000;
+    volatile uint32_t sink = 0;
+    wifi_ie_info_t info;
+    int64_t t0 = host_now_ns();
+    for (long r = 0; r < rounds; r++) {
+        for (size_t i = 0; i < n; i++) {
+            wifi_ie_parse_mgmt(frames[i], lens[i], &info);
+            sink += info.flags;
+        }
+    }
+    int64_t dt = host_now_ns() - t0;
+    printf("wifi_ie_parse_mgmt: %zu frames x %ld rounds, %.1f ns/frame\n", n, rounds,
+           (double)dt / ((double)n * rounds));
+    return 0;
+}
@@ -0,0 +1,64 @@
+#ifndef BIT_LIB_REF_H
+#define BIT_LIB_REF_H
+
+// bit_lib as flipper_nfc_compat.c had it before the word-wise rewrite, one
+// bit per loop turn, and bit by bit references in flipper's order for the
+// rest. kept as the reference for test_flipper_nfc_compat and bench_bit_lib.
+// the old loop numbered bits from the lsb of data[0] and built the field lsb
+// first; flipper numbers them from the msb and puts the first bit on top, so
+// the old result is the new one with the field's bits and every byte's bits
+// reversed.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+static uint64_t ref_old_get_bits_64(const uint8_t *data, size_t position, uint8_t length) {
+    if (!data || length == 0 || length > 64) return 0;
+
+    uint64_t result = 0;
+    size_t byte_index = position / 8;
+    uint8_t bit_offset = position % 8;
+
+    for (uint8_t i = 0; i < length; i++) {
+        size_t current_byte = byte_index + ((bit_offset + i) / 8);
+        uint8_t current_bit = (bit_offset + i) % 8;
+
+        if (data[current_byte] & (1 << current_bit)) {
+            result |= (1ULL << i);
+        }
+    }
+    return result;
+}
+
+// flipper's order, msb of data[0] first
+static uint64_t ref_get_bits(const uint8_t *data, size_t pos, uint8_t len) {
+    uint64_t v = 0;
+    for (uint8_t i = 0; i < len; i++) {
+        v = v << 1 | ((data[(pos + i) / 8] >> (7 - (pos + i) % 8)) & 1);
+    }
+    return v;
+}
+
+static void ref_set_bits(uint8_t *data, size_t pos, uint64_t value, uint8_t len) {
+    for (uint8_t i = 0; i < len; i++) {
+        uint8_t mask = (uint8_t)(0x80U >> ((pos + i) % 8));
+        if ((value >> (len - 1 - i)) & 1) {
+            data[(pos + i) / 8] |= mask;
+        } else {
+            data[(pos + i) / 8] &= (uint8_t)~mask;
+        }
+    }
+}
+
+static uint64_t ref_reverse(uint64_t v, uint8_t len) {
+    uint64_t r = 0;
+    for (uint8_t i = 0; i < len; i++) r = r << 1 | ((v >> i) & 1);
+    return r;
+}
+
+static uint8_t ref_reverse_byte(uint8_t b) {
+    return (uint8_t)ref_reverse(b, 8);
+}
+
+#endif // BIT_LIB_REF_H
@@ -0,0 +1,84 @@
+#ifndef COMMANDS_REF_H
+#define COMMANDS_REF_H
+
+// the command names registered by main.bak/core/commandline.c, read from
+// COMMANDLINE_C, and the malloc'd linked list the command table replaced,
+// kept as the reference for test_command_table and bench_command_table.
+
+#include "core/command_table.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef COMMANDLINE_C
+#error "COMMANDLINE_C must point at core/commandline.c"
+#endif
+
+#define REF_MAX_COMMANDS 512
+
+static char *ref_names[REF_MAX_COMMANDS];
+static int ref_name_count;
+
+// every register_command("...") literal, in source order
+static bool ref_load_names(void) {
+    FILE *f = fopen(COMMANDLINE_C, "rb");
+    if (!f) {
+        fprintf(stderr, "cannot open %s\n", COMMANDLINE_C);
+        return false;
+    }
+    static const char key[] = "register_command(\"";
+    char line[1024];
+    while (fgets(line, sizeof(line), f) && ref_name_count < REF_MAX_COMMANDS) {
+        for (char *p = strstr(line, key); p; p = strstr(p, key)) {
+            p += sizeof(key) - 1;
+            char *q = strchr(p, '"');
+            if (!q) break;
+            ref_names[ref_name_count++] = strndup(p, (size_t)(q - p));
+            p = q;
+        }
+    }
+    fclose(f);
+    return ref_name_count > 0;
+}
+
+// ---- the list, as commandline.c had it ----
+
+typedef struct RefCommand {
+    char *name;
+    CommandFunction function;
+    struct RefCommand *next;
+} RefCommand;
+
+static RefCommand *ref_list_head;
+
+static void ref_register_command(const char *name, CommandFunction function) {
+    RefCommand *current = ref_list_head;
+    while (current != NULL) {
+        if (strcmp(current->name, name) == 0) {
+            return;
+        }
+        current = current->next;
+    }
+    RefCommand *new_command = (RefCommand *)malloc(sizeof(RefCommand));
+    if (new_command == NULL) {
+        return;
+    }
+    new_command->name = strdup(name);
+    new_command->function = function;
+    new_command->next = ref_list_head;
+    ref_list_head = new_command;
+}
+
+static CommandFunction ref_find_command(const char *name) {
+    RefCommand *current = ref_list_head;
+    while (current != NULL) {
+        if (strcmp(current->name, name) == 0) {
+            return current->function;
+        }
+        current = current->next;
+    }
+    return NULL;
+}
+
+#endif // COMMANDS_REF_H
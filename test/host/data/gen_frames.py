@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Write the 802.11 sample corpus used by the host tests.
+
+mgmt_frames.pcap holds beacons, probe requests and probe responses for a
+dozen access points with the element layouts seen from common routers
+(WPA2/WPA3/transition/enterprise/OWE/WPA/WEP/open, hidden SSIDs, WPS, WMM
+and vendor elements, HT/VHT/HE). Frames are radiotap encapsulated and carry
+an FCS, the way the ESP32 promiscuous callback sees them.
+
+The file is committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_frames.py test/host/data/mgmt_frames.pcap
+"""
+import struct
+import sys
+import zlib
+
+LINKTYPE_IEEE802_11_RADIOTAP = 127
+
+
+def ie(eid, body):
+    return bytes([eid, len(body)]) + body
+
+
+def rsn(group, pairwise, akms, caps=0x000C):
+    body = struct.pack('<H', 1) + b'\x00\x0f\xac' + bytes([group])
+    body += struct.pack('<H', len(pairwise)) + b''.join(b'\x00\x0f\xac' + bytes([c]) for c in pairwise)
+    body += struct.pack('<H', len(akms)) + b''.join(b'\x00\x0f\xac' + bytes([a]) for a in akms)
+    body += struct.pack('<H', caps)
+    return ie(48, body)
+
+
+def wpa(group, pairwise, akms):
+    body = b'\x00\x50\xf2\x01' + struct.pack('<H', 1) + b'\x00\x50\xf2' + bytes([group])
+    body += struct.pack('<H', len(pairwise)) + b''.join(b'\x00\x50\xf2' + bytes([c]) for c in pairwise)
+    body += struct.pack('<H', len(akms)) + b''.join(b'\x00\x50\xf2' + bytes([a]) for a in akms)
+    return ie(221, body)
+
+
+def wps(config_methods):
+    attrs = struct.pack('>HHB', 0x104A, 1, 0x10)             # version
+    attrs += struct.pack('>HHB', 0x1044, 1, 0x02)            # wps state: configured
+    attrs += struct.pack('>HHH', 0x1008, 2, config_methods)  # config methods
+    return ie(221, b'\x00\x50\xf2\x04' + attrs)
+
+
+WMM = ie(221, b'\x00\x50\xf2\x02\x01\x01\x80\x00\x03\xa4\x00\x00\x27\xa4\x00\x00'
+              b'\x42\x43\x5e\x00\x62\x32\x2f\x00')
+BROADCOM = ie(221, b'\x00\x10\x18\x02\x00\x00\x1c\x00\x00')
+APPLE = ie(221, b'\x00\x17\xf2\x0a\x00\x01\x04\x00\x00\x00\x00')
+MICROSOFT_P2P = ie(221, b'\x50\x6f\x9a\x09\x02\x02\x00\x25\x00')
+RATES = ie(1, b'\x82\x84\x8b\x96\x0c\x12\x18\x24')
+EXT_RATES = ie(50, b'\x30\x48\x60\x6c')
+HT_CAP = ie(45, b'\xef\x19\x1b\xff\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00'
+                b'\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00')
+VHT_CAP = ie(191, b'\xb2\x01\x80\x33\xfa\xff\x00\x00\xfa\xff\x00\x00')
+HE_CAP = ie(255, b'\x23\x01\x78\x10\x1a\x00\x00\x00\x20\x0e\x09\x00\x0f\x00\x00\x00'
+                 b'\xfa\xff\xfa\xff\x39\x1c\xc7\x71\x1c\x07')
+TIM = ie(5, b'\x00\x01\x00\x00')
+COUNTRY = ie(7, b'DE\x20\x01\x0d\x14')
+
+
+def ht_oper(channel):
+    return ie(61, bytes([channel]) + b'\x00' * 21)
+
+
+def ds(channel):
+    return ie(3, bytes([channel]))
+
+
+def mac(s):
+    return bytes(int(x, 16) for x in s.split(':'))
+
+
+def mgmt(subtype, da, sa, bssid, seq, body):
+    fc = struct.pack('<H', subtype << 4)
+    return fc + b'\x00\x00' + da + sa + bssid + struct.pack('<H', seq << 4) + body
+
+
+def beacon_body(interval, cap, elements):
+    return struct.pack('<QHH', 0x0000001122334455, interval, cap) + elements
+
+
+BCAST = b'\xff' * 6
+
+# bssid, ssid, channel, capability, elements after ssid/rates/ds
+APS = [
+    ('a4:2b:b0:10:20:30', b'HomeNet', 6, 0x0431,
+     TIM + COUNTRY + rsn(4, [4], [2]) + HT_CAP + EXT_RATES + WMM + wps(0x238C)),
+    ('00:1d:7e:11:22:33', b'CafeGuest', 1, 0x0421, TIM + HT_CAP + WMM),
+    ('f0:9f:c2:44:55:66', b'Office-5G', 36, 0x1111,
+     TIM + rsn(4, [4], [1, 3], 0x0028) + HT_CAP + VHT_CAP + WMM),
+    ('3c:84:6a:77:88:99', b'WPA3-Home', 11, 0x0431,
+     TIM + rsn(4, [4], [8], 0x00CC) + HT_CAP + HE_CAP + WMM),
+    ('b0:be:76:aa:bb:cc', b'Transition', 6, 0x0431,
+     TIM + rsn(4, [4], [2, 8], 0x0080) + HT_CAP + WMM + BROADCOM),
+    ('00:14:bf:01:02:03', b'OldRouter', 3, 0x0411, TIM + wpa(2, [2], [2])),
+    ('00:0f:66:0a:0b:0c', b'WEP-Net', 9, 0x0011, TIM),
+    ('d8:07:b6:12:34:56', b'OWE-Open', 149, 0x0111,
+     TIM + rsn(4, [4], [18], 0x00C0) + HT_CAP + VHT_CAP + WMM),
+    ('e4:f4:c6:65:43:21', b'', 1, 0x0431, TIM + rsn(4, [4], [2]) + HT_CAP + WMM),
+    ('00:13:37:a1:b2:c3', b'FreeWiFi', 11, 0x0421, TIM + HT_CAP + WMM),
+    ('c8:3a:35:de:ad:01', b'Mixed', 4, 0x0431,
+     TIM + wpa(2, [2, 4], [2]) + rsn(4, [2, 4], [2]) + HT_CAP + WMM + wps(0x0088)),
+    ('60:38:e0:0b:0c:0d', b'Legacy-b', 13, 0x0021, TIM),
+    ('8c:85:90:01:02:03', b'iPhone Hotspot', 6, 0x0431,
+     TIM + rsn(4, [4], [2]) + HT_CAP + APPLE + MICROSOFT_P2P + WMM),
+]
+
+STATIONS = ['f8:ff:c2:01:01:01', '44:00:10:02:02:02', 'da:a1:19:03:03:03']
+
+
+def radiotap(channel_mhz, rssi):
+    # present: flags(1), channel(3), dbm antenna signal(5)
+    present = (1 << 1) | (1 << 3) | (1 << 5)
+    body = bytes([0x10])                     # flags: frame includes fcs
+    body += b'\x00'                          # pad channel to 2 bytes
+    body += struct.pack('<HH', channel_mhz, 0x00a0 if channel_mhz < 3000 else 0x0140)
+    body += struct.pack('<b', rssi)
+    hdr_len = 8 + len(body)
+    return struct.pack('<BBHI', 0, 0, hdr_len, present) + body
+
+
+def chan_mhz(ch):
+    return 2407 + 5 * ch if ch <= 13 else 5000 + 5 * ch
+
+
+def with_fcs(frame):
+    return frame + struct.pack('<I', zlib.crc32(frame) & 0xffffffff)
+
+
+def frames():
+    out = []
+    t = 1_700_000_000.0
+    seq = 0
+    for rnd in range(4):
+        for i, (bssid, ssid, ch, cap, extra) in enumerate(APS):
+            b = mac(bssid)
+            body = beacon_body(100, cap, ie(0, ssid) + RATES + ds(ch) + extra)
+            out.append((t, ch, -40 - 3 * i - rnd, mgmt(8, BCAST, b, b, seq, body)))
+            t += 0.0102
+            seq += 1
+        for j, sta in enumerate(STATIONS):
+            s = mac(sta)
+            ssid = b'' if (rnd + j) % 2 == 0 else APS[j][1]
+            body = ie(0, ssid) + RATES + EXT_RATES + HT_CAP
+            out.append((t, 6, -55 - j, mgmt(4, BCAST, s, BCAST, seq, body)))
+            t += 0.0031
+            seq += 1
+            ap = APS[j]
+            b = mac(ap[0])
+            body = beacon_body(100, ap[3], ie(0, ap[1]) + RATES + ds(ap[2]) + ap[4])
+            out.append((t, ap[2], -45 - j, mgmt(5, s, b, b, seq, body)))
+            t += 0.0017
+            seq += 1
+    # an AP that sends two DS elements and an HT operation on another channel
+    b = mac('02:00:00:00:00:01')
+    body = beacon_body(100, 0x0401, ie(0, b'DoubleDS') + ds(1) + ds(7) + HT_CAP + ht_oper(5))
+    out.append((t, 1, -70, mgmt(8, BCAST, b, b, seq, body)))
+    return out
+
+
+def write_pcap(path, records):
+    with open(path, 'wb') as f:
+        f.write(struct.pack('<IHHiIII', 0xa1b2c3d4, 2, 4, 0, 0, 65535, LINKTYPE_IEEE802_11_RADIOTAP))
+        for ts, ch, rssi, frame in records:
+            pkt = radiotap(chan_mhz(ch), rssi) + with_fcs(frame)
+            sec = int(ts)
+            usec = int(round((ts - sec) * 1e6))
+            f.write(struct.pack('<IIII', sec, usec, len(pkt), len(pkt)))
+            f.write(pkt)
+
+
+if __name__ == '__main__':
+    write_pcap(sys.argv[1] if len(sys.argv) > 1 else 'mgmt_frames.pcap', frames())
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Write the ir receiver edge corpus used by test_infrared_edge_ring.
+
+ir_edges.txt holds the edge timestamps the gpio isr would stamp for a
+sequence of signals, each preceded by what the receiver should make of it:
+
+    expect <protocol> <address> <command>   decoded message
+    expect raw <timings...>                 no decode, raw timings kept
+    expect none                             too short, ignored
+    edges <ts...>                           microsecond timestamps, uint32
+
+Edges carry a little jitter, some switch bounce (several edges in the same
+microsecond) and one signal runs across the 32 bit timestamp wrap.
+
+The file is committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_ir_edges.py test/host/data/ir_edges.txt
+"""
+import random
+import sys
+
+GAP_US = 40000  # silence between signals, well past the receiver's 15 ms
+
+
+def pdwm(preamble, bit1, bit0, stop_mark, data, nbits):
+    # mark/space durations, lsb first
+    out = list(preamble)
+    for i in range(nbits):
+        out += bit1 if (data >> i) & 1 else bit0
+    out.append(stop_mark)
+    return out
+
+
+def nec(address, command):
+    data = address | (~address & 0xff) << 8 | command << 16 | (~command & 0xff) << 24
+    return pdwm((9000, 4500), (560, 1690), (560, 560), 560, data, 32)
+
+
+def samsung32(address, command):
+    data = address | address << 8 | command << 16 | (~command & 0xff) << 24
+    return pdwm((4500, 4500), (550, 1650), (550, 550), 550, data, 32)
+
+
+class Stream:
+    def __init__(self, start, seed):
+        self.t = start
+        self.rng = random.Random(seed)
+        self.lines = []
+
+    def signal(self, expect, durations, jitter=40, bounce=(), blip=None):
+        """durations alternate mark/space from a mark. bounce lists edge
+        indexes that get two extra edges in the same microsecond; blip is
+        (interval index, offset) of a zero length pair inside an interval."""
+        edges = [self.t]
+        t = self.t
+        for d in durations:
+            t += d
+            edges.append(t)
+        # jitter every edge but the first, never enough to reorder them
+        edges = [edges[0]] + [e + self.rng.randint(-jitter, jitter) for e in edges[1:]]
+        timings = [b - a for a, b in zip(edges, edges[1:])]
+        out = []
+        for i, e in enumerate(edges):
+            out.append(e)
+            if i in bounce:
+                out += [e, e]
+            if blip and blip[0] == i:
+                out += [e + blip[1]] * 2
+        self.lines.append('expect ' + (expect if expect != 'raw' else
+                                       'raw ' + ' '.join(str(x) for x in timings)))
+        self.lines.append('edges ' + ' '.join(str(e & 0xffffffff) for e in out))
+        self.t = edges[-1] + GAP_US
+
+
+def corpus():
+    s = Stream(1_000_000, 7)
+    s.signal('NEC 0x04 0x08', nec(0x04, 0x08))
+    s.signal('Samsung32 0x07 0x02', samsung32(0x07, 0x02))
+    # bounce on a few edges: an odd number of edges per transition
+    s.signal('NEC 0x20 0xdf', nec(0x20, 0xdf), bounce=(1, 2, 17, 40))
+    # a blip inside the preamble mark: no decode, the raw copy joins it up
+    s.signal('raw', nec(0x11, 0x22), blip=(0, 3000))
+    s.signal('none', (600, 600, 600))
+    # not a known protocol, longer than the raw buffer
+    s.signal('raw', [1500, 700] * 150)
+    # across the wrap of the microsecond timer
+    s.t = (1 << 32) - 20000
+    s.signal('NEC 0x10 0x40', nec(0x10, 0x40))
+    return s.lines
+
+
+if __name__ == '__main__':
+    path = sys.argv[1] if len(sys.argv) > 1 else 'ir_edges.txt'
+    with open(path, 'w') as f:
+        f.write('# generated by gen_ir_edges.py\n')
+        f.write('\n'.join(corpus()) + '\n')
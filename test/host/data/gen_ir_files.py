@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""Write the .ir library used by test_infrared_file and bench_infrared_file.
+
+The files are in the Flipper Zero "IR signals file" format, as the Flipper
+saves learned remotes and as Flipper-IRDB ships them: a Filetype/Version
+header, then one block per button,
+
+    name: <button>
+    type: parsed                    or   type: raw
+    protocol: <protocol>                 frequency: <hz>
+    address: <4 hex bytes, lsb first>    duty_cycle: <fraction>
+    command: <4 hex bytes, lsb first>    data: <mark space mark ...>
+
+with "#" comment lines between blocks.
+
+    samsung_tv.ir     parsed buttons of a Samsung TV remote
+    lg_ac.ir          raw captures of an LG air conditioner remote
+    universal_tv.ir   a universal library in the Flipper's own layout: many
+                      brands, every protocol the firmware knows, raw
+                      signals with data lines longer than the reader's 1 KB
+                      block, CRLF line ends and stray whitespace
+    malformed.ir      hand edited damage: lines without a colon, oversized
+                      keys and names, letters in data lines, fields before
+                      the first name, no newline at the end
+    remote.json       a json remote; not an .ir file, nothing is read
+
+The test holds the streaming reader to the whole-file parser it replaced
+on every well-formed file, and checks malformed.ir line by line.
+
+The files are committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_ir_files.py test/host/data/ir
+"""
+import os
+import random
+import sys
+
+HEADER = ['Filetype: IR signals file', 'Version: 1', '# generated by gen_ir_files.py']
+
+
+def hex_bytes(value):
+    return ' '.join('%02X' % ((value >> (8 * i)) & 0xff) for i in range(4))
+
+
+def parsed(name, protocol, address, command):
+    return ['#', 'name: ' + name, 'type: parsed', 'protocol: ' + protocol,
+            'address: ' + hex_bytes(address), 'command: ' + hex_bytes(command)]
+
+
+def raw(name, timings, frequency=38000, duty='0.330000'):
+    return ['#', 'name: ' + name, 'type: raw', 'frequency: %d' % frequency,
+            'duty_cycle: ' + duty, 'data: ' + ' '.join(str(t) for t in timings)]
+
+
+def learned(rng, bits, header=(8500, 4250), one=(550, 1600), zero=(550, 550), frames=1):
+    """timings as a Flipper learns them: every edge a little off, the
+    repeats of a held button after a long gap"""
+    out = []
+    for f in range(frames):
+        if f:
+            out.append(40000 + rng.randint(-900, 900))
+        frame = list(header)
+        for b in bits:
+            frame += one if b else zero
+        frame.append(one[0])
+        out += [max(1, t + rng.randint(-60, 60)) for t in frame]
+    return out
+
+
+def bits_msb(value, n):
+    return [(value >> i) & 1 for i in range(n - 1, -1, -1)]
+
+
+def samsung_tv():
+    keys = [('Power', 0x02), ('Source', 0x01), ('Vol_up', 0x07), ('Vol_dn', 0x0b),
+            ('Ch_next', 0x12), ('Ch_prev', 0x10), ('Mute', 0x0f), ('Menu', 0x1a),
+            ('Ok', 0x68), ('Up', 0x60), ('Down', 0x61), ('Left', 0x65), ('Right', 0x62),
+            ('Back', 0x58), ('Exit', 0x2d)]
+    lines = list(HEADER)
+    for name, command in keys:
+        lines += parsed(name, 'Samsung32', 0x07, command)
+    return lines
+
+
+def lg_ac(rng):
+    # 28 bit frames: 0x88, then the setting, then a checksum nibble
+    keys = [('Off', 0x88c0051), ('Cool_hi', 0x8800347), ('Cool_lo', 0x8808440),
+            ('Heat_hi', 0x880c34f), ('Heat_lo', 0x880ce52), ('Dh', 0x8809849)]
+    lines = list(HEADER)
+    for name, code in keys:
+        lines += raw(name, learned(rng, bits_msb(code, 28), header=(3150, 9850)))
+    # a held button: the frame and two repeats in one capture
+    lines += raw('Swing', learned(rng, bits_msb(0x8813149, 28), header=(3150, 9850), frames=3))
+    return lines
+
+
+def universal_tv(rng):
+    brands = [
+        ('NEC', 0x04, [0x08, 0x02, 0x03, 0x00, 0x01, 0x09]),
+        ('NECext', 0x7f04, [0xe41b, 0xe01f, 0xe21d, 0xea15, 0xe619, 0xe817]),
+        ('NEC42', 0x1c1, [0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b]),
+        ('Samsung32', 0x07, [0x02, 0x07, 0x0b, 0x12, 0x10, 0x0f]),
+        ('SIRC', 0x01, [0x15, 0x12, 0x13, 0x10, 0x11, 0x14]),
+        ('SIRC15', 0x97, [0x15, 0x12, 0x13, 0x10, 0x11, 0x14]),
+        ('SIRC20', 0x10e1, [0x15, 0x12, 0x13, 0x10, 0x11, 0x14]),
+        ('RC5', 0x00, [0x0c, 0x10, 0x11, 0x20, 0x21, 0x0d]),
+        ('RC5X', 0x00, [0x4c, 0x50, 0x51, 0x60, 0x61, 0x4d]),
+        ('RC6', 0x00, [0x0c, 0x10, 0x11, 0x20, 0x21, 0x0d]),
+        ('RCA', 0x0f, [0x54, 0xf4, 0x74, 0xd4, 0x34, 0xfc]),
+        ('Pioneer', 0xaa, [0x1c, 0x0a, 0x0b, 0x10, 0x11, 0x12]),
+        ('Kaseikyo', 0x80020, [0x3d, 0x20, 0x21, 0x34, 0x35, 0x32]),
+    ]
+    buttons = ['Power', 'Vol_up', 'Vol_dn', 'Ch_next', 'Ch_prev', 'Mute']
+    lines = HEADER + ['# Universal TV remote, one block per brand and button',
+                      '# Last Updated: 18th Oct, 2026', '#']
+    for protocol, address, commands in brands:
+        lines.append('# %s' % protocol)
+        for name, command in zip(buttons, commands):
+            lines += parsed(name, protocol, address, command)
+    # learned power buttons, one of them long enough to span several blocks
+    for n, frames in [(1, 1), (2, 4), (3, 12)]:
+        code = rng.getrandbits(32)
+        lines += raw('Power', learned(rng, bits_msb(code, 32), frames=frames))
+    # stray whitespace a hand edit leaves behind
+    lines += ['#', 'name:   Input  ', 'type:\tparsed', 'protocol: NEC ',
+              'address:  04 00 00 00', 'command: 0B 00 00 00   ', '']
+    lines += ['  name: Sleep', '  type: raw', '  frequency: 36000', '  duty_cycle: 0.25',
+              '  data: 889 889  1778 889\t889 1778 ']
+    return lines
+
+
+def malformed():
+    return HEADER + [
+        # before any name: ignored
+        'type: raw',
+        'data: 1 2 3',
+        '#',
+        'name: Power',
+        'type: parsed',
+        'this line has no colon',
+        'protocol: NEC',
+        'address: 04 00 00 00',
+        'command: 08 00 00 00',
+        'averyveryverylongkeyname: 1 2 3',
+        '#',
+        'name: Letters',
+        'type: raw',
+        'frequency: 38000',
+        'duty_cycle: 0.33',
+        'data: 9000 4500 560 abc 560',
+        '#',
+        'name: Glued',
+        'type: raw',
+        'frequency: 38000',
+        'duty_cycle: 0.33',
+        'data: 9000 4500 560x 560',
+        '#',
+        'name: Overwritten',
+        'type: raw',
+        'frequency: 38000',
+        'duty_cycle: 0.33',
+        'data: 1 2 3',
+        'data: 4 5',
+        '#',
+        'name: Bad_hex',
+        'type: parsed',
+        'protocol: NECext',
+        'address: zz 00 00 00',
+        'command: 1F 0Q 00 00',
+        '#',
+        'name: A_name_much_longer_than_the_thirty_one_characters_kept',
+        'type: parsed',
+        'protocol: Unknown_protocol',
+        'address: 01 00 00 00',
+        'command: 02 00 00 00',
+        '#',
+        'name: No_type',
+        'protocol: NEC',
+        'address: 05 00 00 00',
+        '#',
+        'name: Last',
+        'type: raw',
+        'frequency: 38000',
+        'duty_cycle: 0.33',
+        'data: 100 200 300',
+    ]
+
+
+def write(path, lines, crlf=False, final_newline=True):
+    text = ('\r\n' if crlf else '\n').join(lines)
+    if final_newline:
+        text += '\r\n' if crlf else '\n'
+    with open(path, 'w', newline='') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    out = sys.argv[1] if len(sys.argv) > 1 else 'ir'
+    os.makedirs(out, exist_ok=True)
+    rng = random.Random(42)
+    write(os.path.join(out, 'samsung_tv.ir'), samsung_tv())
+    write(os.path.join(out, 'lg_ac.ir'), lg_ac(rng))
+    write(os.path.join(out, 'universal_tv.ir'), universal_tv(rng), crlf=True)
+    write(os.path.join(out, 'malformed.ir'), malformed(), final_newline=False)
+    write(os.path.join(out, 'remote.json'),
+          ['[{"name": "Power", "type": "parsed", "protocol": "NEC",',
+           '  "address": "0x04", "command": "0x08"}]'])
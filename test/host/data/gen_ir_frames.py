@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""Write the decoder capture corpus used by test_infrared_decoder,
+bench_infrared_decoder and the latency report in test_infrared_edge_ring.
+
+ir_frames.txt holds mark/space timings as the receive loop hands them to
+infrared_decoder_decode, grouped into captures: one remote, one button,
+held for a few frames. Each frame is preceded by what the decoder should
+make of it:
+
+    capture <name>                          a new stream, decoder reset
+    expect <protocol> <address> <command> [repeat]
+    expect none                             nothing decoded from this frame
+    frame <timings...>                      mark first, alternating, the
+                                            last one the space after it
+
+A frame's message is what the receive loop takes from it: the first one the
+decoder returns while fed the frame's timings, after which the loop resets
+the decoder and waits for the next frame. Captures come clean (nominal
+timings), with jitter inside the protocol tolerances, and noisy: jitter plus
+a mark before the last one split by a short dropout, which no decoder
+accepts, so that frame decodes as nothing and the next one still does.
+
+The file is committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_ir_frames.py test/host/data/ir_frames.txt
+"""
+import random
+import sys
+
+
+def bits_lsb(value, n):
+    return [(value >> i) & 1 for i in range(n)]
+
+
+def pdwm(preamble, bit1, bit0, bits, stop=True):
+    """mark/space pairs per bit after a preamble, then a stop mark"""
+    out = list(preamble)
+    for b in bits:
+        out += bit1 if b else bit0
+    if stop:
+        out.append(bit1[0])
+    return out
+
+
+def nec(address, command):
+    data = address | (~address & 0xff) << 8 | command << 16 | (~command & 0xff) << 24
+    return pdwm((9000, 4500), (560, 1690), (560, 560), bits_lsb(data, 32))
+
+
+def necext(address, command):
+    data = address | command << 16
+    return pdwm((9000, 4500), (560, 1690), (560, 560), bits_lsb(data, 32))
+
+
+def nec_repeat():
+    return [9000, 2250, 560]
+
+
+def samsung32(address, command):
+    data = address | address << 8 | command << 16 | (~command & 0xff) << 24
+    return pdwm((4500, 4500), (550, 1650), (550, 550), bits_lsb(data, 32))
+
+
+def sirc(address, command, nbits):
+    # bits are in the marks, command first
+    data = command | address << 7
+    out = [2400, 600]
+    for b in bits_lsb(data, nbits):
+        out += [1200 if b else 600, 600]
+    return out[:-1]
+
+
+def rca(address, command):
+    data = address | command << 4 | (~address & 0xf) << 12 | (~command & 0xff) << 16
+    return pdwm((4000, 4000), (500, 2000), (500, 1000), bits_lsb(data, 24))
+
+
+def pioneer(address, command):
+    data = address | (~address & 0xff) << 8 | command << 16 | (~command & 0xff) << 24
+    return pdwm((8500, 4225), (500, 1500), (500, 500), bits_lsb(data, 32))
+
+
+def kaseikyo(vendor, genre1, genre2, data, ident):
+    b = [vendor & 0xff, vendor >> 8, 0, 0, 0, 0]
+    vp = b[0] ^ b[1]
+    b[2] = ((vp & 0xf) ^ (vp >> 4)) | genre1 << 4
+    b[3] = (data & 0xf) << 4 | genre2
+    b[4] = ident << 6 | (data >> 4) & 0x3f
+    b[5] = b[2] ^ b[3] ^ b[4]
+    value = sum(x << (8 * i) for i, x in enumerate(b))
+    return pdwm((3360, 1665), (420, 1274), (420, 420), bits_lsb(value, 48))
+
+
+def kaseikyo_address(vendor, genre1, genre2, ident):
+    return ident << 24 | vendor << 8 | genre1 << 4 | genre2
+
+
+def manchester(halves, unit):
+    """levels per half bit (1 = mark) to timings, from the first mark;
+    the idle space before it is not part of the frame"""
+    out = []
+    level = None
+    for h in halves:
+        if h == level:
+            out[-1] += unit
+        elif out or h:
+            out.append(unit)
+        level = h
+    if level == 0:
+        out.pop()
+    return out
+
+
+def rc5(address, command, toggle, extended=False):
+    # msb first: two start bits (the second one is inverted command bit 6
+    # in rc5x), toggle, 5 address bits, 6 command bits; a 1 is space-mark
+    bits = [1, 0 if extended else 1, toggle]
+    bits += [(address >> i) & 1 for i in range(4, -1, -1)]
+    bits += [(command >> i) & 1 for i in range(5, -1, -1)]
+    halves = []
+    for b in bits:
+        halves += [0, 1] if b else [1, 0]
+    return manchester(halves, 889)
+
+
+def rc6(address, command, toggle):
+    # leader, start bit 1, mode 0, a double length toggle, then address and
+    # command msb first; a 1 is mark-space
+    halves = [1] * 6 + [0] * 2
+    halves += [1, 0]
+    for _ in range(3):
+        halves += [0, 1]
+    halves += [1, 1, 0, 0] if toggle else [0, 0, 1, 1]
+    for b in [(address >> i) & 1 for i in range(7, -1, -1)] + \
+             [(command >> i) & 1 for i in range(7, -1, -1)]:
+        halves += [1, 0] if b else [0, 1]
+    return manchester(halves, 444)
+
+
+class Corpus:
+    def __init__(self, seed):
+        self.rng = random.Random(seed)
+        self.lines = []
+
+    def capture(self, name):
+        self.lines.append('capture ' + name)
+
+    def frame(self, expect, timings, gap, jitter=0, split=0):
+        """gap is the space after the last mark; jitter is +- us on every
+        timing; split cuts that many marks in two with a 30 us dropout"""
+        t = [max(1, x + self.rng.randint(-jitter, jitter)) for x in timings]
+        for _ in range(split):
+            marks = [i for i in range(0, len(t) - 1, 2) if t[i] > 300]
+            i = self.rng.choice(marks)
+            cut = self.rng.randint(100, t[i] - 130)
+            t[i:i + 1] = [cut, 30, t[i] - cut - 30]
+        t.append(gap)
+        self.lines.append('expect ' + expect)
+        self.lines.append('frame ' + ' '.join(str(x) for x in t))
+
+
+def corpus():
+    c = Corpus(41)
+    # name, frames as (expect, timings, gap), jitter inside the tolerance
+    remotes = [
+        ('nec', [('NEC 0x04 0x08', nec(0x04, 0x08), 40000)] +
+         [('none', nec_repeat(), 97000)] * 3, 90),
+        ('necext', [('NECext 0x7f04 0xe41b', necext(0x7f04, 0xe41b), 40000)] * 3, 90),
+        ('samsung32', [('Samsung32 0x07 0x02', samsung32(0x07, 0x02), 46000)] * 3, 90),
+        ('sirc', [('SIRC 0x01 0x15', sirc(0x01, 0x15, 12), 26000)] * 3, 150),
+        ('sirc15', [('SIRC15 0x97 0x33', sirc(0x97, 0x33, 15), 22000)] * 3, 150),
+        ('sirc20', [('SIRC20 0x10e1 0x2a', sirc(0x10e1, 0x2a, 20), 16000)] * 3, 150),
+        ('rc5', [('RC5 0x05 0x35', rc5(0x05, 0x35, 0), 89000),
+                 ('RC5 0x05 0x35', rc5(0x05, 0x35, 0), 89000),
+                 ('RC5 0x05 0x35', rc5(0x05, 0x35, 1), 89000)], 90),
+        ('rc5x', [('RC5X 0x1a 0x0c', rc5(0x1a, 0x0c, 1, extended=True), 89000)] * 2, 90),
+        ('rc6', [('RC6 0x00 0x0c', rc6(0x00, 0x0c, 0), 83000),
+                 ('RC6 0x00 0x0c', rc6(0x00, 0x0c, 0), 83000),
+                 ('RC6 0x00 0x0c', rc6(0x00, 0x0c, 1), 83000)], 90),
+        ('rca', [('RCA 0x0f 0x54', rca(0x0f, 0x54), 8000)] * 3, 90),
+        ('pioneer', [('Pioneer 0xaa 0x1c', pioneer(0xaa, 0x1c), 30000)] * 3, 90),
+        ('kaseikyo', [('Kaseikyo 0x%x 0x%x' % (kaseikyo_address(0x2002, 0x8, 0x0, 0), 0x3d),
+                       kaseikyo(0x2002, 0x8, 0x0, 0x3d, 0), 64000)] * 3, 90),
+    ]
+    for name, frames, jitter in remotes:
+        c.capture(name)
+        for expect, timings, gap in frames:
+            c.frame(expect, timings, gap)
+        c.capture(name + ' jitter')
+        for expect, timings, gap in frames:
+            c.frame(expect, timings, gap, jitter=jitter)
+        # every other frame has a split mark and is lost
+        c.capture(name + ' noisy')
+        for i, (expect, timings, gap) in enumerate(frames):
+            if i % 2 == 0:
+                c.frame('none', timings, gap, jitter=jitter, split=1)
+            else:
+                c.frame(expect, timings, gap, jitter=jitter)
+
+    # one of each, back to back, no reset in between
+    c.capture('mixed')
+    for name, frames, jitter in remotes:
+        c.frame(*frames[0], jitter=jitter)
+    return c.lines
+
+
+if __name__ == '__main__':
+    path = sys.argv[1] if len(sys.argv) > 1 else 'ir_frames.txt'
+    with open(path, 'w') as f:
+        f.write('# generated by gen_ir_frames.py\n')
+        f.write('\n'.join(corpus()) + '\n')
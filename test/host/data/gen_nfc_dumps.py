@@ -0,0 +1,539 @@
+#!/usr/bin/env python3
+"""Write the MIFARE Classic dumps used by bench_flipper_nfc and
+test_flipper_nfc_compat.
+
+The files are saved Flipper .nfc dumps, as the Flipper and GhostESP's own
+"save" write them:
+
+    Filetype: Flipper NFC device
+    Version: 4
+    Device type: Mifare Classic
+    UID: <bytes>
+    ATQA: <2 bytes>
+    SAK: 08 (1K), 18 (4K) or 09 (Mini)
+    Mifare Classic type: 1K
+    Data format version: 2
+    Block <n>: <16 bytes, ?? for a byte that was not read>
+
+One card per Flipper parser the firmware registers, laid out the way that
+parser looks for it: its keys in the sector trailers it checks and the
+fields it prints in the blocks it reads, the rest of the card blank. Keys a
+reader did not recover are ?? as in a real dump, and a few cards have whole
+sectors missing. Some cards belong to none of the parsers: a blank card, an
+NDEF tag, a Mini and a 4K with only the first sectors read.
+
+Each dump carries a comment naming the parser the dispatcher should settle
+on, "# parser: <name>" or "# parser: none"; a card that an earlier parser
+in the dispatch order also accepts names that one (a two cities card is
+taken by troika, which checks the same key).
+
+The files are committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_nfc_dumps.py test/host/data/nfc
+"""
+import os
+import random
+import struct
+import sys
+
+FF = 0xFFFFFFFFFFFF
+
+
+def bcd(digits):
+    return bytes(int(digits[i:i + 2], 16) for i in range(0, len(digits), 2))
+
+
+class Card:
+    def __init__(self, name, uid, kind='1K', parser=None):
+        self.name = name
+        self.uid = bytes(uid)
+        self.kind = kind
+        self.parser = parser or name
+        sectors = {'1K': 16, '4K': 40, 'Mini': 5}[kind]
+        self.sectors = sectors
+        self.blocks = [bytearray(16) for _ in range(self.first(sectors))]
+        self.unread = set()
+        self.keys = {}
+        for s in range(sectors):
+            self.key(s, FF, FF)
+        # manufacturer block: uid, bcc, sak, atqa, manufacturer data
+        sak, atqa = self.sak_atqa()
+        if len(self.uid) == 4:
+            bcc = self.uid[0] ^ self.uid[1] ^ self.uid[2] ^ self.uid[3]
+            head = self.uid + bytes([bcc, sak]) + atqa[::-1]
+        else:
+            head = self.uid + bytes([sak]) + atqa[::-1]
+        self.set(0, 0, head + b'\x62\x63\x64\x65\x66\x67\x68\x69'[:16 - len(head)])
+
+    def sak_atqa(self):
+        sak = {'1K': 0x08, '4K': 0x18, 'Mini': 0x09}[self.kind]
+        atqa = bytes([0x00, 0x44 if len(self.uid) == 7 else 0x04])
+        if self.kind == '4K':
+            atqa = bytes([0x00, 0x42 if len(self.uid) == 7 else 0x02])
+        return sak, atqa
+
+    @staticmethod
+    def first(sector):
+        return sector * 4 if sector < 32 else 128 + (sector - 32) * 16
+
+    def trailer(self, sector):
+        return self.first(sector + 1) - 1
+
+    def key(self, sector, a, b):
+        self.keys[sector] = (a, b)
+
+    def keys_from(self, table):
+        for s, (a, b) in enumerate(table[:self.sectors]):
+            self.key(s, a, b)
+
+    def set(self, block, offset, data):
+        self.blocks[block][offset:offset + len(data)] = data
+
+    def lines(self):
+        sak, atqa = self.sak_atqa()
+        out = ['Filetype: Flipper NFC device', 'Version: 4',
+               '# generated by gen_nfc_dumps.py', '# parser: %s' % self.parser,
+               '# Device type can be ISO14443-3A, ISO14443-3B, ISO14443-4A, NTAG/Ultralight, '
+               'Mifare Classic, Mifare DESFire',
+               'Device type: Mifare Classic',
+               '# UID is common for all formats',
+               'UID: ' + ' '.join('%02X' % b for b in self.uid),
+               '# ISO14443-3A specific data',
+               'ATQA: %02X %02X' % (atqa[0], atqa[1]),
+               'SAK: %02X' % sak,
+               '# Mifare Classic specific data',
+               'Mifare Classic type: ' + self.kind,
+               'Data format version: 2',
+               "# Mifare Classic blocks, '??' means unknown data"]
+        for s in range(self.sectors):
+            a, b = self.keys[s]
+            t = self.trailer(s)
+            for n in range(self.first(s), t + 1):
+                if s in self.unread:
+                    out.append('Block %d: %s' % (n, ' '.join(['??'] * 16)))
+                    continue
+                data = bytes(self.blocks[n])
+                cells = ['%02X' % c for c in data]
+                if n == t:
+                    ka = ['??'] * 6 if a is None else ['%02X' % c for c in a.to_bytes(6, 'big')]
+                    kb = ['??'] * 6 if b is None else ['%02X' % c for c in b.to_bytes(6, 'big')]
+                    cells = ka + ['FF', '07', '80', '69'] + kb
+                out.append('Block %d: %s' % (n, ' '.join(cells)))
+        return out
+
+
+def aime(rng):
+    c = Card('aime', [0x5A, 0x1E, 0x03, 0xC4])
+    for s in range(16):
+        c.key(s, 0x574343467632, 0x574343467632)
+    c.set(1, 0, b'SBSD' + bytes(9) + bytes([0x7E, 0x21, 0x9C]))
+    c.set(2, 6, bcd('01234567890123456789'))
+    return c
+
+
+BIP_KEYS = [
+    (0x3a42f33af429, 0x1fc235ac1309), (0x6338a371c0ed, 0x243f160918d1),
+    (0xf124c2578ad0, 0x9afc42372af1), (0x32ac3b90ac13, 0x682d401abb09),
+    (0x4ad1e273eaf1, 0x067db45454a9), (0xe2c42591368a, 0x15fc4c7613fe),
+    (0x2a3c347a1200, 0x68d30288910a), (0x16f3d5ab1139, 0xf59a36a2546d),
+    (0x937a4fff3011, 0x64e3c10394c2), (0x35c3d2caee88, 0xb736412614af),
+    (0x693143f10368, 0x324f5df65310), (0xa3f97428dd01, 0x643fb6de2217),
+    (0x63f17a449af0, 0x82f435dedf01), (0xc4652c54261c, 0x0263de1278f3),
+    (0xd49e2826664f, 0x51284c3686a6), (0x3df14c8000a1, 0x6a470d54127c),
+]
+
+
+def bip_datetime(y, mo, d, h, mi, s):
+    """bip_parse_datetime's bit layout"""
+    v = (d << 6) | (mo << 11) | ((y - 2000) << 15) | (h << 20) | (mi << 25) | (s << 31)
+    return v.to_bytes(8, 'little')
+
+
+def bip(rng):
+    c = Card('bip', [0x1B, 0x7C, 0x90, 0x42])
+    c.keys_from(BIP_KEYS)
+    c.set(1, 4, struct.pack('<I', 10453182))
+    c.set(33, 0, struct.pack('<HH', 3620, 0))
+    c.set(21, 0, bip_datetime(2026, 10, 17, 8, 41, 12))
+    for i in range(3):
+        top_up = bytearray(bip_datetime(2026, 9 + i // 2, 3 + 9 * i, 7 + i, 15 * i, 30))
+        top_up += bytes([0]) + struct.pack('<H', (5000 + 1000 * i) << 2)
+        c.set(40 + i, 0, bytes(top_up))
+        trip = bytearray(bip_datetime(2026, 10, 15 + i, 18, 5 * i, 2 * i))
+        trip += bytes(2) + struct.pack('<H', 800 + 20 * i)
+        c.set(44 + i, 0, bytes(trip))
+    return c
+
+
+CHARLIE_KEYS = [(0x3060206F5B0A, 0xF1B9F5669CC8)] + [(0x5EC39B022F2B, 0xF662248E7E89)] * 7 + [
+    (0x3A09594C8587, 0x62387B8D250D), (0xF238D78FF48F, 0x9DC282D46217),
+    (0xAFD0BA94D624, 0x92EE4DC87191), (0xB35A0E4ACC09, 0x756EF55E2507),
+    (0x447AB7FD5A6B, 0x932B9CB730EF), (0x1F1A0A111B5B, 0xAD9E0A1CA2F7),
+    (0xD58023BA2BDC, 0x62CED42A6D87), (0x2548A443DF28, 0x2ED3B15E7C0F),
+]
+
+
+def charliecard(rng):
+    c = Card('charliecard', [0x8E, 0x32, 0x5B, 0x17])
+    c.keys_from(CHARLIE_KEYS)
+    # counters, balance sectors, passes and the transaction ring carry a
+    # card's whole history; random values run every formatting branch
+    for s in range(1, 8):
+        for n in range(c.first(s), c.trailer(s)):
+            c.set(n, 0, bytes(rng.getrandbits(8) for _ in range(16)))
+    return c
+
+
+def csc(rng):
+    c = Card('csc', [0xB2, 0x6D, 0x11, 0xE0])
+    refill = bytearray(16)
+    refill[5:7] = struct.pack('<H', 4)
+    refill[9:11] = struct.pack('<H', 2000)
+    for i in range(15):
+        refill[15] ^= refill[i]
+    c.set(2, 0, bytes(refill))
+    c.set(4, 0, struct.pack('<HH', 1275, 4))
+    c.set(8, 0, struct.pack('<HH', 1275, 4))
+    c.set(9, 0, struct.pack('<H', 37))
+    c.set(13, 0, bytes([0x3C, 0x9A, 0x51, 0x02, 0xE7, 0x44, 0x10, 0x8B]))
+    return c
+
+
+def hi(rng):
+    c = Card('hi', [0x04, 0x5C, 0x38, 0x2A, 0xB1, 0x6F, 0x80])
+    c.key(0, 0xa0a1a2a3a4a5, 0x30871CF60CF1)
+    for s in range(5, 16):
+        c.key(s, rng.getrandbits(48), rng.getrandbits(48))
+    return c
+
+
+def hid(rng):
+    c = Card('hid', [0x9D, 0x02, 0x44, 0x71])
+    for s in range(16):
+        c.key(s, 0x484944204953, None)
+    # 26 bit H10301 credential behind its sentinel bit, big endian
+    c.set(5, 8, ((1 << 26) | 0x2C6A0F1).to_bytes(8, 'big'))
+    return c
+
+
+def hworld(rng):
+    c = Card('hworld', [0x3F, 0xA0, 0x6C, 0x19])
+    c.key(1, 0x543071543071, 0x5F01015F0101)
+    c.key(5, FF, 0x200510241234)
+    c.set(5, 0, bytes([0x01, 0x00, 26, 10, 18, 14, 5, 26, 10, 21, 12, 0, 0, 12, 7, 0]))
+    return c
+
+
+def kazan(rng):
+    c = Card('kazan', [0x72, 0x8B, 0x1E, 0x06])
+    c.key(8, 0xE954024EE754, 0x0CD464CDC100)
+    c.key(9, 0xBC305FE2DA65, 0xCF0EC6ACF2F9)
+    c.key(10, 0xF7A545095C49, 0x6862FD600F78)
+    c.set(32, 6, bytes([0x6D, 26, 9, 1, 26, 12, 31]))
+    c.set(34, 1, bytes([26, 10, 16, 17, 42]))
+    c.set(36, 0, struct.pack('<I', 7))
+    return c
+
+
+def metromoney(rng):
+    c = Card('metromoney', [0xE1, 0x5F, 0x20, 0x33])
+    c.key(0, 0x2803BCB0C7E1, 0x4FA9EB49F75E)
+    for s in range(1, 6):
+        c.key(s, 0x9C616585E26D, 0xA160FCD5EC4C if s > 1 else 0xD1C71E590D16)
+    c.set(5, 0, struct.pack('<I', 1250 + 100))
+    return c
+
+
+def microel_key(uid):
+    total = sum(uid) % 256
+    if total % 2 == 1:
+        total += 2
+    key = [total ^ x for x in (0x01, 0x92, 0xA7, 0x75, 0x2B, 0xF9)]
+    first = key[0] >> 4
+    if first in (0x2, 0x3, 0xA, 0xB):
+        key = [0x40 ^ k for k in key]
+    elif first in (0x6, 0x7, 0xE, 0xF):
+        key = [0xC0 ^ k for k in key]
+    return int.from_bytes(bytes(k & 0xff for k in key), 'big')
+
+
+def microel(rng):
+    uid = [0x41, 0x9A, 0x03, 0x5D]
+    c = Card('microel', uid)
+    key = microel_key(uid)
+    c.key(0, key, None)
+    c.key(1, key, None)
+    c.set(4, 5, struct.pack('<H', 1840))
+    c.set(5, 5, struct.pack('<H', 2340))
+    return c
+
+
+MIZIP_KEYS = [
+    (0xa0a1a2a3a4a5, 0xb4c132439eef), None, None, None, None,
+    (0x0222179AB995, 0x13321774F9B5), (0xB25CBD76A7B4, 0x7571359B4274),
+    (0xDA857B4907CC, 0xD26B856175F7), (0x16D85830C443, 0x8F790871A21E),
+    (0x88BD5098FC82, 0xFCD0D77745E4), (0x983349449D78, 0xEA2631FBDEDD),
+    (0xC599F962F3D9, 0x949B70C14845), (0x72E668846BE8, 0x45490B5AD707),
+    (0xBCA105E5685E, 0x248DAF9D674D), (0x4F6FE072D1FD, 0x4250A05575FA),
+    (0x56438ABE8152, 0x59A45912B311),
+]
+
+
+def mizip(rng):
+    c = Card('mizip', [0xC0, 0x11, 0x7A, 0x2E])
+    for s, pair in enumerate(MIZIP_KEYS):
+        if pair:
+            c.key(s, *pair)
+    c.set(8, 1, struct.pack('<H', 950))
+    c.set(9, 1, struct.pack('<H', 1450))
+    c.set(10, 0, bytes([0x55]))
+    return c
+
+
+PLANTAIN_KEYS = {4: (0xe56ac127dd45, 0x19fc84a3784b), 5: (0x77dabc9825e1, 0x9764fec3154a),
+                 8: (0x26973ea74321, 0xd27058c6e2c7), 9: (0xeb0a8ff88ade, 0x578a9ada41e3),
+                 10: (0xea0fd73cb149, 0x29c35fa068fb), 11: (0xc76bf71a2509, 0x9ba241db3f56),
+                 12: (0xacffffffffff, 0x71f3a315ad26)}
+
+
+def plantain(rng):
+    c = Card('plantain', [0x04, 0x31, 0x16, 0x8A, 0x23, 0x5C, 0x80])
+    for s, pair in PLANTAIN_KEYS.items():
+        c.key(s, *pair)
+    c.set(16, 0, struct.pack('<I', 48500))
+    c.set(18, 0, bytes([0x00, 0x00]) + struct.pack('<I', 8412345)[:3] + bytes(3) +
+          struct.pack('<I', 50000)[:3])
+    c.set(20, 4, struct.pack('<HH', 1732, 5600))
+    c.set(21, 0, bytes([23, 41, 0]) + struct.pack('<I', 8420011)[:3])
+    return c
+
+
+def saflok(rng):
+    c = Card('saflok', [0x2F, 0x94, 0xD3, 0x0B])
+    c.key(0, 0x000000000000, FF)
+    c.key(1, 0x2a2c13cc242a, FF)
+    c.set(1, 0, bytes(rng.getrandbits(8) for _ in range(16)))
+    c.set(2, 0, bytes(rng.getrandbits(8) for _ in range(16)))
+    return c
+
+
+def skylanders(rng):
+    c = Card('skylanders', [0x6A, 0x0E, 0x55, 0xF2])
+    for s in range(16):
+        c.key(s, 0x4b0b20107ccb, None)
+    c.set(1, 0, struct.pack('<H', 0x01C8) + bytes(14))
+    for n in (8, 9, 10, 12, 13):
+        c.set(n, 0, bytes(rng.getrandbits(8) for _ in range(16)))
+    return c
+
+
+def smartrider(rng):
+    c = Card('smartrider', [0x53, 0x8A, 0x71, 0x0C])
+    keys = [0x2031D1E57A3B, 0x4CA6029F9473, 0x19195398E32F]
+    for s in range(16):
+        c.key(s, keys[0] if s == 0 else keys[s % 3], keys[(s + 1) % 3])
+    c.set(0, 14, struct.pack('<H', 1000))
+    c.set(1, 6, bytes([0x07, 0x12, 0x34, 0x56, 0x78]))
+    c.set(4, 0, bytes(16))
+    c.set(5, 0, struct.pack('<HHHH', 8402, 11322, 1000, 2000) + bytes([2]))
+    c.set(14, 7, struct.pack('<H', 2385))
+    routes = [b'950 ', b'40  ', b'GRN1', b'M17 ', b'FRE ', b'550 ']
+    ts = 845000000
+    for i, n in enumerate(b for b in range(40, 53) if b not in (43, 47, 51)):
+        trip = struct.pack('<HHI', 120 + i, 60 + i // 2, ts - i * 5400)
+        trip += bytes([0x10 if i % 2 == 0 else 0]) + routes[i % len(routes)]
+        trip += bytes([0]) + struct.pack('<H', 0 if i % 2 == 0 else 310 + 10 * i)
+        c.set(n, 0, trip[:16])
+    return c
+
+
+SOCIAL_MOSCOW_KEYS = [
+    (0xa0a1a2a3a4a5, 0x7de02a7f6025), (0x2735fc181807, 0xbf23a53c1f63),
+    (0x2aba9519f574, 0xcb9a1f2d7368), (0x84fd7f7a12b6, 0xc7c0adb3284f),
+    (0x73068f118c13, 0x2b7f3253fac5), (0x186d8c4b93f9, 0x9f131d8c2057),
+    (0x3a4bba8adaf0, 0x67362d90f973), (0x8765b17968a2, 0x6202a38f69e2),
+    (0x40ead80721ce, 0x100533b89331), (0x0db5e6523f7c, 0x653a87594079),
+    (0x51119dae5216, 0xd8a274b2e026), (0x51119dae5216, 0xd8a274b2e026),
+    (0x51119dae5216, 0xd8a274b2e026), (0x2aba9519f574, 0xcb9a1f2d7368),
+    (0x84fd7f7a12b6, 0xc7c0adb3284f), (0xa0a1a2a3a4a5, 0x7de02a7f6025),
+]
+
+
+def hex_num(v):
+    """social_moscow.c's hex_num: the low 8 nibbles read as decimal digits"""
+    out = 0
+    for i in range(8):
+        out += (v & 0xf) * 10 ** i
+        v >>= 4
+    return out
+
+
+def luhn(number):
+    payload, total, pos = number // 10, 0, 0
+    while payload > 0:
+        d = payload % 10
+        if pos % 2 == 0:
+            d *= 2
+        if d > 9:
+            d = d // 10 + d % 10
+        total += d
+        payload //= 10
+        pos += 1
+    return (10 - total % 10) % 10
+
+
+def social_moscow(rng):
+    c = Card('social_moscow', [0x8B, 0x25, 0x4F, 0xD0])
+    c.keys_from(SOCIAL_MOSCOW_KEYS)
+    code, region, number = 0x960, 0x77, 0x0012345678
+    for control in range(10):
+        full = (hex_num(control) + hex_num(number) * 10 + hex_num(region) * 10 * 10000000000 +
+                hex_num(code) * 10 * 10000000000 * 100) % (1 << 64)
+        if luhn(full) == control:
+            break
+    # msb first bit fields: code 8-31, region 32-39, number 40-79, check 80-83
+    bits = (code << 96) | (region << 88) | (number << 48) | (control << 44)
+    block = bytearray(bits.to_bytes(16, 'big'))
+    block[11:15] = bytes([0x29, 0x12, 0x20, 0x29])
+    c.set(60, 0, bytes(block))
+    c.set(21, 1, bytes.fromhex('7799000012345678'))
+    return c
+
+
+TROIKA_KEYS = [
+    (0xa0a1a2a3a4a5, 0xfbf225dc5d58), (0xa82607b01c0d, 0x2910989b6880),
+    (0x2aa05ed1856f, 0xeaac88e5dc99), (0x2aa05ed1856f, 0xeaac88e5dc99),
+    (0x73068f118c13, 0x2b7f3253fac5), (0xfbc2793d540b, 0xd3a297dc2698),
+    (0x2aa05ed1856f, 0xeaac88e5dc99), (0xae3d65a3dad4, 0x0f1c63013dba),
+    (0xa73f5dc1d333, 0xe35173494a81), (0x69a32f1c2f19, 0x6b8bd9860763),
+    (0x9becdf3d9273, 0xf8493407799d), (0x08b386463229, 0x5efbaecef46b),
+    (0xcd4c61c26e3d, 0x31c7610de3b0), (0xa82607b01c0d, 0x2910989b6880),
+    (0x0e8f64340ba4, 0x4acec1205d75), (0x2aa05ed1856f, 0xeaac88e5dc99),
+]
+
+
+def troika(rng):
+    c = Card('troika', [0x3A, 0xC2, 0x8D, 0x4E])
+    # key b was not recovered anywhere, as after a reader's default dictionary
+    for s, (a, b) in enumerate(TROIKA_KEYS):
+        c.key(s, a, None)
+    c.set(32, 0, bytes.fromhex('45DB00A06D1E04B0000000000000D4A2'))
+    c.set(33, 0, bytes.fromhex('1B1E0000C35000000000000000009E41'))
+    return c
+
+
+TWO_CITIES_KEYS = [
+    (FF, FF), (FF, FF), (0x2aa05ed1856f, 0xeaac88e5dc99), (0x2aa05ed1856f, 0xeaac88e5dc99),
+    (0xe56ac127dd45, 0x19fc84a3784b), (0x77dabc9825e1, 0x9764fec3154a),
+    (0x2aa05ed1856f, 0xeaac88e5dc99), (FF, FF),
+    (0xa73f5dc1d333, 0xe35173494a81), (0x69a32f1c2f19, 0x6b8bd9860763),
+    (0xea0fd73cb149, 0x29c35fa068fb), (0xc76bf71a2509, 0x9ba241db3f56),
+]
+
+
+def two_cities(rng):
+    c = Card('two_cities', [0x04, 0x4E, 0x22, 0x9A, 0x61, 0x3B, 0x80], '4K', parser='troika')
+    for s, pair in enumerate(TWO_CITIES_KEYS):
+        c.key(s, *pair)
+    c.set(16, 0, struct.pack('<I', 31200))
+    c.set(32, 2, bytes.fromhex('0B2C1F40'))
+    c.set(33, 5, struct.pack('>H', 2500))
+    # sectors past 24 were never read
+    c.unread.update(range(24, 40))
+    return c
+
+
+def umarsh(rng):
+    c = Card('umarsh', [0x11, 0xE4, 0x5A, 0x97])
+    head = 0x4B2E0012
+    c.set(32, 0, struct.pack('>II', head, 0xFFFFFFFF - head) + bytes(8))
+    c.set(33, 0, bytes([0x00, 0x2E, 0x21, 0, 0, 0, 0, 0x05, 0x40, 0x0C, 0x35, 0xA1, 0x03, 0, 0, 0]))
+    c.set(34, 0, bytes([0x2F, 0x01, 0x00, 0x01, 0x86, 0xA0, 0x2E, 0x5C, 0x01, 0x2C, 0x32, 0, 0, 0, 0, 0]))
+    return c
+
+
+def washcity(rng):
+    c = Card('washcity', [0xD7, 0x30, 0x8E, 0x5B])
+    c.key(0, 0xA0A1A2A3A4A5, 0x010155010100)
+    c.key(1, 0xC78A3D0E1BCD, FF)
+    for s in range(2, 9):
+        c.key(s, 0xC78A3D0E0000, FF)
+    c.set(4, 2, struct.pack('>H', 1630))
+    return c
+
+
+ZK_SIGNATURE = bytes([0xE2, 0x87, 0x80, 0x8E, 0x20, 0x87, 0xAE, 0xAB, 0xAE, 0xF2, 0xA0, 0xEF, 0x20,
+                      0x8A, 0xAE, 0xE0, 0xAE, 0xAD, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00])
+
+
+def zolotaya_korona(rng):
+    c = Card('zolotaya_korona', [0x7C, 0x03, 0xB9, 0x21])
+    c.set(60, 0, ZK_SIGNATURE[:16])
+    c.set(61, 0, ZK_SIGNATURE[16:] + bytes([0x54]))
+    c.set(62, 4, bcd('9643') + bcd('3078160012345678'))
+    c.set(16, 7, bytes([0x12, 0x00, 0x2A, 0x00]))
+    c.set(17, 1, struct.pack('<HIIH', 512, 1760000000, 50000, 14))
+    c.set(18, 1, bytes([ord('T')]) + bcd('001234') + bytes([0]) +
+          struct.pack('<IB', 1760700000, 7) + struct.pack('<I', 61200))
+    c.set(24, 0, struct.pack('<I', 58400))
+    return c
+
+
+def zolotaya_korona_online(rng):
+    c = Card('zolotaya_korona_online', [0x5D, 0x8F, 0x02, 0xC6])
+    c.set(60, 1, struct.pack('>H', 0x0401) + bcd('9643') + bcd('3078150012345679'))
+    c.set(16, 0, bytes([66]))
+    return c
+
+
+def blank(rng):
+    return Card('blank_1k', [0xDE, 0xAD, 0xBE, 0xEF], parser='none')
+
+
+def ndef(rng):
+    c = Card('ndef_1k', [0x04, 0xA2, 0x1F, 0x6A, 0x2C, 0x5E, 0x80], parser='none')
+    c.key(0, 0xA0A1A2A3A4A5, None)
+    for s in range(1, 16):
+        c.key(s, 0xD3F7D3F7D3F7, None)
+    # MAD: every sector an NDEF application
+    c.set(1, 0, bytes([0x14, 0x01]) + bytes([0x03, 0xE1] * 7))
+    c.set(2, 0, bytes([0x03, 0xE1] * 8))
+    uri = b'\x04github.com/Spooks4576/Ghost_ESP'
+    record = bytes([0xD1, 0x01, len(uri), 0x55]) + uri
+    tlv = bytes([0x03, len(record)]) + record + b'\xFE'
+    data_blocks = [n for n in range(4, 64) if n % 4 != 3]
+    for i in range(0, len(tlv), 16):
+        c.set(data_blocks[i // 16], 0, tlv[i:i + 16])
+    return c
+
+
+def mini(rng):
+    c = Card('mini', [0x9E, 0x21, 0x66, 0x0A], 'Mini', parser='none')
+    for n in range(1, 19):
+        if n % 4 != 3:
+            c.set(n, 0, bytes(rng.getrandbits(8) for _ in range(16)))
+    return c
+
+
+def partial_4k(rng):
+    c = Card('partial_4k', [0x04, 0x77, 0x18, 0xC2, 0x4A, 0x5F, 0x81], '4K', parser='none')
+    for s in range(4):
+        c.key(s, rng.getrandbits(48), None)
+    for n in (1, 2, 4, 5, 6):
+        c.set(n, 0, bytes(rng.getrandbits(8) for _ in range(16)))
+    c.unread.update(range(4, 40))
+    return c
+
+
+CARDS = [aime, bip, charliecard, csc, hi, hid, hworld, kazan, metromoney, microel, mizip,
+         plantain, saflok, skylanders, smartrider, social_moscow, troika, two_cities, umarsh,
+         washcity, zolotaya_korona, zolotaya_korona_online, blank, ndef, mini, partial_4k]
+
+
+if __name__ == '__main__':
+    out = sys.argv[1] if len(sys.argv) > 1 else 'nfc'
+    os.makedirs(out, exist_ok=True)
+    rng = random.Random(46)
+    for make in CARDS:
+        card = make(rng)
+        with open(os.path.join(out, card.name + '.nfc'), 'w') as f:
+            f.write('\n'.join(card.lines()) + '\n')
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Write the nmea corpus used by test_nmea_parser.
+
+nmea.txt holds blocks of sentences, each block one fix's worth of what a
+receiver sends, preceded by what the parser should make of it:
+
+    fix <lat_e7> <lon_e7> <alt_mm> <hhmmss> <ddmmyy> <sats> <hdop_e2> <speed_mmps> <cog_e2> <valid>
+    drop                            nothing in the block makes a fix
+    <sentence>                      one per line, without the \\r\\n
+
+Expected values come from the numbers the fix was built from, not from the
+sentence text, except where a field is deliberately out of range: there the
+parser has to report 0.
+
+The file is committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_nmea.py test/host/data/nmea.txt
+"""
+from fractions import Fraction
+import sys
+
+
+def checksum(body):
+    c = 0
+    for ch in body.encode():
+        c ^= ch
+    return '%02X' % c
+
+
+def sentence(body, bad_crc=False):
+    crc = checksum(body)
+    if bad_crc:
+        crc = '%02X' % (int(crc, 16) ^ 0x5a)
+    return '$%s*%s' % (body, crc)
+
+
+def coord(e7, deg_digits, decimals=6):
+    """ddmm.mmmmmm for a coordinate in degrees * 1e7, and its hemisphere sign"""
+    v = Fraction(abs(e7), 10**7)
+    deg = int(v)
+    minutes = (v - deg) * 60
+    text = '%0*d%0*.*f' % (deg_digits, deg, 3 + decimals, decimals, float(minutes))
+    # the parser rounds what it reads, which is what the fix should come back as
+    back = deg * 10**7 + round_half_up(Fraction(text[deg_digits:]) / 60 * 10**7)
+    return text, back if e7 >= 0 else -back
+
+
+def round_half_up(x):
+    return int(x + Fraction(1, 2)) if x >= 0 else -int(-x + Fraction(1, 2))
+
+
+class Fix:
+    def __init__(self, lat_e7, lon_e7, msl_mm=45300, sep_mm=-12100, time='123519',
+                 date='180926', sats=8, hdop_e2=92, speed_mmps=5144, cog_e2=8442,
+                 talker='GP', valid=True):
+        self.__dict__.update(locals())
+        del self.__dict__['self']
+        self.lat_text = self.lon_text = None
+
+    def sentences(self):
+        t = self.talker
+        if self.lat_text is None:
+            self.lat_text, self.lat_back = coord(self.lat_e7, 2)
+        if self.lon_text is None:
+            self.lon_text, self.lon_back = coord(self.lon_e7, 3)
+        ns = 'N' if self.lat_e7 >= 0 else 'S'
+        ew = 'E' if self.lon_e7 >= 0 else 'W'
+        if not self.valid:
+            lat = lon = ns = ew = ''
+        else:
+            lat, lon = self.lat_text, self.lon_text
+        kmh = Fraction(self.speed_mmps) * 36 / 10000
+        knots = Fraction(self.speed_mmps) * 3600 / 1852000
+        self.kmh_text = '%.3f' % float(kmh)
+        knots_text = '%.3f' % float(knots)
+        cog = '%d.%02d' % divmod(self.cog_e2, 100)
+        hdop = '%d.%02d' % divmod(self.hdop_e2, 100)
+        msl = '%.1f' % (self.msl_mm / 1000)
+        sep = '%.1f' % (self.sep_mm / 1000)
+        fixq = '1' if self.valid else '0'
+        status = 'A' if self.valid else 'V'
+        sats = ['%02d' % (s + 1) for s in range(self.sats)] + [''] * (12 - self.sats)
+        out = [
+            '%sGGA,%s.00,%s,%s,%s,%s,%s,%02d,%s,%s,M,%s,M,,' %
+            (t, self.time, lat, ns, lon, ew, fixq, self.sats, hdop, msl, sep),
+            '%sGSA,A,%s,%s,1.80,%s,1.50' % (t, '3' if self.valid else '1', ','.join(sats), hdop),
+        ]
+        for n in range(3):
+            sv = ','.join('%02d,%02d,%03d,%02d' % (4 * n + i + 1, 10 + i, 40 * i, 30 + i)
+                          for i in range(4))
+            out.append('%sGSV,3,%d,12,%s' % (t, n + 1, sv))
+        out += [
+            '%sRMC,%s.00,%s,%s,%s,%s,%s,%s,%s,%s,,,A' %
+            (t, self.time, status, lat, ns, lon, ew, knots_text, cog, self.date),
+            '%sGLL,%s,%s,%s,%s,%s.00,%s' % (t, lat, ns, lon, ew, self.time, status),
+            '%sVTG,%s,T,,M,%s,N,%s,K,A' % (t, cog, knots_text, self.kmh_text),
+        ]
+        return [sentence(b) for b in out]
+
+    def expect(self):
+        if not self.valid:
+            lat = lon = 0
+        else:
+            lat, lon = self.lat_back, self.lon_back
+        # vtg comes last, its km/h is the speed that sticks
+        speed = round_half_up(Fraction(self.kmh_text) * 10000 / 36)
+        alt = int(Fraction(self.msl_mm)) + int(Fraction(self.sep_mm))
+        return 'fix %d %d %d %s %s %d %d %d %d %d' % (
+            lat, lon, alt, self.time, self.date, self.sats, self.hdop_e2, speed,
+            self.cog_e2, 1 if self.valid else 0)
+
+
+def corpus():
+    lines = []
+
+    def block(fix):
+        s = fix.sentences()
+        lines.append(fix.expect())
+        lines.extend(s)
+
+    block(Fix(481173000, 115166667))
+    block(Fix(-337654321, -1511234567, talker='GN', time='000001', date='010125'))
+    # six decimals of minutes keep every 1e-7 degree
+    block(Fix(1, -1, talker='GN'))
+    block(Fix(899999999, 1799999999, sats=12, hdop_e2=61))
+    block(Fix(-900000000, -1800000000, time='235959', date='311299'))
+    block(Fix(0, 0, valid=False, sats=0, hdop_e2=9999, speed_mmps=0, cog_e2=0))
+
+    # out of range coordinates come back as 0, never wrapped around
+    for lat_text, lon_text, lat_e7, lon_e7 in (
+            ('9100.000000', '01130.000000', 0, 115000000),  # latitude past the pole
+            ('4807.038000', '18100.000000', 481173000, 0),  # longitude past 180
+            ('4807.038000', '99959.999999', 481173000, 0),  # five digits of degrees
+            ('4860.000000', '01130.000000', 0, 115000000),  # 60 minutes
+            ('21474.836470', '01130.000000', 0, 115000000),  # int32 max as ddmm
+    ):
+        f = Fix(481173000, 115000000)
+        f.lat_text, f.lat_back = lat_text, lat_e7
+        f.lon_text, f.lon_back = lon_text, lon_e7
+        block(f)
+
+    # a fix whose every sentence is corrupt, then sentences nobody parses
+    lines.append('drop')
+    for s in Fix(481173000, 115166667).sentences():
+        body = s[1:-3]
+        lines.append(sentence(body, bad_crc=True))
+    lines.append('drop')
+    lines.append(sentence('PUBX,00,123519.00,4807.03800,N,01131.00000,E,545.4,G3,2.1,2.0'))
+    lines.append(sentence('GPTXT,01,01,02,ANTSTATUS=OK'))
+    lines.append(sentence('XXGGA,123519.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,,M,,'))
+    return lines
+
+
+if __name__ == '__main__':
+    path = sys.argv[1] if len(sys.argv) > 1 else 'nmea.txt'
+    with open(path, 'w') as f:
+        f.write('# generated by gen_nmea.py\n')
+        f.write('\n'.join(corpus()) + '\n')
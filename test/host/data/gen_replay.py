@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Write the capture replayed through the Wi-Fi callbacks by test_wifi_replay.
+
+replay.pcap is twelve seconds of monitor mode traffic built around the
+access points of mgmt_frames.pcap:
+  - every AP beacons once a second, a WPS-PIN printer joins them
+  - a station authenticates and associates with HomeNet, completes a
+    4-way handshake, sends data, is deauthenticated, then rekeys
+  - a second station sends null data to CafeGuest, a third (randomized
+    MAC) probes and gets a probe response from Office-5G
+  - a karma AP with the Pineapple OUI on channel 1 beacons four SSIDs,
+    one of them also served by a legitimate AP on channel 1 (evil twin)
+
+test_wifi_replay.c asserts on what the callbacks make of it, so keep the
+two in step. The file is committed; rerun only when changing the scenario:
+    python3 test/host/data/gen_replay.py test/host/data/replay.pcap
+"""
+import os
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from gen_frames import (APS, BCAST, HT_CAP, RATES, TIM, WMM, beacon_body, ds, ie, mac, mgmt,  # noqa: E402
+                        rsn, wps, write_pcap)
+
+HOMENET = mac(APS[0][0])
+CAFE = mac(APS[1][0])
+OFFICE = mac(APS[2][0])
+
+STA_HOME = mac('f8:ff:c2:01:01:01')
+STA_CAFE = mac('44:00:10:02:02:02')
+STA_RANDOM = mac('da:a1:19:03:03:03')
+
+EXTRA_APS = [
+    ('00:26:ab:11:22:33', b'Printer-WPS', 11, 0x0431,
+     TIM + rsn(4, [4], [2]) + HT_CAP + WMM + wps(0x000C)),
+    ('70:3a:cb:00:00:02', b'attwifi', 1, 0x0431, TIM + rsn(4, [4], [2]) + HT_CAP + WMM),
+]
+
+KARMA = mac('00:13:37:00:00:01')
+KARMA_SSIDS = [b'attwifi', b'xfinitywifi', b'Starbucks WiFi', b'Google Starbucks']
+
+
+def data(fc_flags, a1, a2, a3, seq, body, qos=False):
+    subtype = 8 if qos else 0
+    fc = struct.pack('<BB', (subtype << 4) | (2 << 2), fc_flags)
+    hdr = fc + b'\x00\x00' + a1 + a2 + a3 + struct.pack('<H', seq << 4)
+    if qos:
+        hdr += b'\x00\x00'
+    return hdr + body
+
+
+TO_DS = 0x01
+FROM_DS = 0x02
+
+
+def eapol_key(key_info, replay, key_data=b''):
+    body = struct.pack('>BHH', 2, key_info, 16) + struct.pack('>Q', replay)
+    body += bytes(range(32))                 # nonce
+    body += b'\x00' * (16 + 8 + 8)           # iv, rsc, reserved
+    body += (b'\x5a' * 16 if key_info & 0x0100 else b'\x00' * 16)  # mic
+    body += struct.pack('>H', len(key_data)) + key_data
+    eapol = struct.pack('>BBH', 2, 3, len(body)) + body
+    return b'\xaa\xaa\x03\x00\x00\x00\x88\x8e' + eapol
+
+
+M1, M2, M3, M4 = 0x008A, 0x010A, 0x13CA, 0x030A
+
+
+def handshake(t, seq, replay):
+    out = []
+    for info, rc, from_ap in ((M1, replay, True), (M2, replay, False),
+                              (M3, replay + 1, True), (M4, replay + 1, False)):
+        key_data = rsn(4, [4], [2]) if info == M2 else b''
+        if from_ap:
+            frame = data(FROM_DS, STA_HOME, HOMENET, HOMENET, seq, eapol_key(info, rc, key_data), True)
+        else:
+            frame = data(TO_DS, HOMENET, STA_HOME, HOMENET, seq, eapol_key(info, rc, key_data), True)
+        out.append((t, 6, -50 if from_ap else -62, frame))
+        t += 0.004
+        seq += 1
+    return out
+
+
+def auth(sa, da, bssid, seq, trans):
+    return mgmt(11, da, sa, bssid, seq, struct.pack('<HHH', 0, trans, 0))
+
+
+def frames():
+    t0 = 1_700_000_100.0
+    out = []
+    seq = 0
+    aps = APS + EXTRA_APS
+
+    # beacons, once a second per AP
+    for sec in range(12):
+        for i, (bssid, ssid, ch, cap, extra) in enumerate(aps):
+            b = mac(bssid)
+            body = beacon_body(100, cap, ie(0, ssid) + RATES + ds(ch) + extra)
+            out.append((t0 + sec + 0.0153 * i, ch, -40 - 3 * (i % 12) - sec % 3,
+                        mgmt(8, BCAST, b, b, seq, body)))
+            seq += 1
+
+    # karma AP: one BSSID cycling through SSIDs from 2 s to 6 s
+    for k in range(16):
+        ssid = KARMA_SSIDS[k % len(KARMA_SSIDS)]
+        body = beacon_body(100, 0x0421, ie(0, ssid) + RATES + ds(1) + TIM)
+        out.append((t0 + 2.0 + 0.25 * k + 0.003, 1, -48, mgmt(8, BCAST, KARMA, KARMA, seq, body)))
+        seq += 1
+
+    # STA_HOME joins HomeNet
+    t = t0 + 1.5
+    seq_sta = 100
+    join = [
+        (-62, auth(STA_HOME, HOMENET, HOMENET, seq_sta, 1)),
+        (-50, auth(HOMENET, STA_HOME, HOMENET, seq_sta + 1, 2)),
+        (-62, mgmt(0, HOMENET, STA_HOME, HOMENET, seq_sta + 2,
+                   struct.pack('<HH', 0x0431, 10) + ie(0, b'HomeNet') + RATES + rsn(4, [4], [2]))),
+        (-50, mgmt(1, STA_HOME, HOMENET, HOMENET, seq_sta + 3,
+                   struct.pack('<HHH', 0x0431, 0, 0xc001) + RATES)),
+    ]
+    for rssi, frame in join:
+        out.append((t, 6, rssi, frame))
+        t += 0.002
+    out += handshake(t, seq_sta + 4, 1)
+    t += 0.05
+    for n in range(6):
+        payload = b'\xaa\xaa\x03\x00\x00\x00\x08\x00' + bytes(40)
+        out.append((t, 6, -61, data(TO_DS | 0x40, HOMENET, STA_HOME, mac('a4:2b:b0:ff:ff:fe'),
+                                    seq_sta + 8 + n, payload, True)))
+        t += 0.2
+
+    # deauth spoofed from HomeNet, unicast and broadcast, then the station rejoins
+    t = t0 + 7.0
+    reason = struct.pack('<H', 7)
+    out.append((t, 6, -35, mgmt(12, STA_HOME, HOMENET, HOMENET, 1, reason)))
+    out.append((t + 0.001, 6, -35, mgmt(12, BCAST, HOMENET, HOMENET, 2, reason)))
+    out.append((t + 0.002, 6, -35, mgmt(10, STA_HOME, HOMENET, HOMENET, 3, reason)))
+    out += handshake(t + 0.5, 300, 5)
+
+    # STA_CAFE: null data frames (power save) to CafeGuest
+    for n in range(4):
+        frame = struct.pack('<BB', (4 << 4) | (2 << 2), TO_DS | 0x10) + b'\x00\x00' + \
+            CAFE + STA_CAFE + CAFE + struct.pack('<H', (400 + n) << 4)
+        out.append((t0 + 3.0 + n, 1, -70, frame))
+
+    # STA_RANDOM probes twice inside the dedupe window, Office-5G answers
+    for n, dt in enumerate((0.0, 0.3, 4.0)):
+        body = ie(0, b'') + RATES + HT_CAP
+        out.append((t0 + 2.5 + dt, 36, -66, mgmt(4, BCAST, STA_RANDOM, BCAST, 500 + n, body)))
+    ap = APS[2]
+    body = beacon_body(100, ap[3], ie(0, ap[1]) + RATES + ds(ap[2]) + ap[4])
+    out.append((t0 + 2.502, 36, -58, mgmt(5, STA_RANDOM, OFFICE, OFFICE, 510, body)))
+
+    # a frame too short to parse and one below the rssi floor
+    out.append((t0 + 9.0, 6, -40, b'\x80\x00\x00\x00' + BCAST[:6]))
+    out.append((t0 + 9.1, 6, -93, mgmt(4, BCAST, STA_RANDOM, BCAST, 600, ie(0, b'far') + RATES)))
+
+    out.sort(key=lambda r: r[0])
+    return out
+
+
+if __name__ == '__main__':
+    write_pcap(sys.argv[1] if len(sys.argv) > 1 else 'replay.pcap', frames())
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Write the u-blox UBX corpus used by test_ubx.
+
+ubx.txt is a byte stream cut into pieces, each preceded by what the decoder
+should make of it:
+
+    pvt <itow> <y> <m> <d> <h> <min> <s> <valid> <nano> <fix> <flags> <numsv>
+        <lon_e7> <lat_e7> <height_mm> <hmsl_mm> <h_acc> <v_acc> <gspeed>
+        <head_e5> <pdop_e2> <magdec_e2|->         one NAV-PVT frame (one line)
+    dop <itow> <gdop> <pdop> <tdop> <vdop> <hdop>  one NAV-DOP frame
+    sat <gnss>:<sv>:<cno>:<elev>:<azim>:<used> ...   one NAV-SAT frame
+    ack <class> <id>                               one ACK-ACK frame
+    none <n>       no frame, n bytes handed back to the nmea side
+    hex <bytes>    the bytes themselves
+
+The pieces run back to back through one decoder, so a piece also checks the
+decoder is back in sync after the one before.
+
+The file is committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_ubx.py test/host/data/ubx.txt
+"""
+import random
+import struct
+import sys
+
+
+def frame(cls, mid, payload):
+    body = bytes([cls, mid]) + struct.pack('<H', len(payload)) + payload
+    a = b = 0
+    for c in body:
+        a = (a + c) & 0xff
+        b = (b + a) & 0xff
+    return b'\xb5\x62' + body + bytes([a, b])
+
+
+def nav_pvt(f, long_form=True):
+    p = struct.pack('<IHBBBBBBIiBBBBiiiiIIiiiiiIIHBBBBBBihH',
+                    f['itow'], f['year'], f['month'], f['day'], f['hour'], f['min'],
+                    f['sec'], f['valid'], 50, f['nano'], f['fix'], f['flags'], 0,
+                    f['numsv'], f['lon'], f['lat'], f['height'], f['hmsl'], f['hacc'],
+                    f['vacc'], 100, -200, 300, f['gspeed'], f['head'], 500, 600,
+                    f['pdop'], 0, 0, 0, 0, 0, 0, 0, f.get('magdec', 0), 70)
+    assert len(p) == 92
+    return p if long_form else p[:84]
+
+
+def pvt_line(f, long_form=True):
+    keys = ('itow year month day hour min sec valid nano fix flags numsv lon lat '
+            'height hmsl hacc vacc gspeed head pdop').split()
+    mag = str(f.get('magdec', 0)) if long_form else '-'
+    return 'pvt ' + ' '.join(str(f[k]) for k in keys) + ' ' + mag
+
+
+def hexline(data):
+    return 'hex ' + data.hex()
+
+
+def corpus():
+    rng = random.Random(11)
+    lines = []
+
+    def piece(expect, data):
+        lines.append(expect)
+        lines.append(hexline(data))
+
+    fixes = [
+        dict(itow=475200000, year=2026, month=9, day=18, hour=12, min=35, sec=19, valid=0x37,
+             nano=-120000, fix=3, flags=0x03, numsv=14, lon=115166667, lat=481173000,
+             height=33200, hmsl=45300, hacc=1500, vacc=2300, gspeed=5144, head=8442000,
+             pdop=135, magdec=-314),
+        # southern and western hemisphere, 2d fix
+        dict(itow=1, year=2025, month=1, day=1, hour=0, min=0, sec=1, valid=0x07,
+             nano=999999999, fix=2, flags=0x01, numsv=4, lon=-1511234567, lat=-337654321,
+             height=-25000, hmsl=-1000, hacc=25000, vacc=40000, gspeed=0, head=0,
+             pdop=580),
+        # no fix yet, nothing valid
+        dict(itow=604799999, year=0, month=0, day=0, hour=0, min=0, sec=0, valid=0,
+             nano=0, fix=0, flags=0, numsv=0, lon=0, lat=0, height=0, hmsl=0,
+             hacc=0xffffffff, vacc=0xffffffff, gspeed=0, head=0, pdop=9999),
+    ]
+    piece(pvt_line(fixes[0]), frame(0x01, 0x07, nav_pvt(fixes[0])))
+    piece(pvt_line(fixes[1], False), frame(0x01, 0x07, nav_pvt(fixes[1], False)))
+    piece(pvt_line(fixes[2]), frame(0x01, 0x07, nav_pvt(fixes[2])))
+
+    piece('dop 475200000 180 135 95 110 92',
+          frame(0x01, 0x04, struct.pack('<IHHHHHHH', 475200000, 180, 135, 95, 110, 92, 60, 70)))
+
+    sats = [(0, 5, 41, 67, 212, 1), (0, 13, 0, -91, -1, 0), (2, 36, 33, 12, 359, 1),
+            (3, 19, 28, 45, 90, 0), (6, 2, 17, 5, 180, 1)]
+    payload = struct.pack('<IBBH', 475200000, 1, len(sats), 0)
+    for g, sv, cno, elev, azim, used in sats:
+        flags = (used << 3) | 0x7 | (1 << 12)
+        payload += struct.pack('<BBBbhhI', g, sv, cno, elev, azim, 0, flags)
+    piece('sat ' + ' '.join('%d:%d:%d:%d:%d:%d' % s for s in sats), frame(0x01, 0x35, payload))
+
+    piece('ack 6 1', frame(0x05, 0x01, bytes([0x06, 0x01])))
+
+    # nmea between frames is handed back byte for byte
+    nmea = b'$GPTXT,01,01,02,u-blox ag*50\r\n'
+    piece('none %d' % len(nmea), nmea)
+    # a lone sync byte ahead of a sentence: the '$' after it is handed back
+    piece('none %d' % len(nmea), b'\xb5' + nmea)
+
+    # a corrupt frame costs only itself; when ck_a is already wrong the
+    # decoder is looking for a sync again by ck_b, which goes to the nmea side
+    bad = bytearray(frame(0x01, 0x04, struct.pack('<IHHHHHHH', 1, 2, 3, 4, 5, 6, 7, 8)))
+    bad[10] ^= 0x40
+    assert bad[-1] != 0xb5
+    piece('none 1', bytes(bad))
+    bad = bytearray(frame(0x05, 0x01, bytes([0x06, 0x8a])))
+    bad[-1] ^= 0x01
+    piece('none 0', bytes(bad))
+    # a length past UBX_MAX_PAYLOAD is taken for a false sync
+    piece('none 0', b'\xb5\x62\x01\x35\x01\x04')
+    piece(pvt_line(fixes[0]), frame(0x01, 0x07, nav_pvt(fixes[0])))
+
+    # repeated sync bytes before a frame
+    piece('ack 6 138', b'\xb5\xb5' + frame(0x05, 0x01, bytes([0x06, 0x8a])))
+
+    # random bytes that never hold a sync byte are all handed back
+    noise = bytes(rng.choice([c for c in range(256) if c != 0xb5]) for _ in range(200))
+    piece('none %d' % len(noise), noise)
+    piece(pvt_line(fixes[1]), frame(0x01, 0x07, nav_pvt(fixes[1])))
+    return lines
+
+
+if __name__ == '__main__':
+    path = sys.argv[1] if len(sys.argv) > 1 else 'ubx.txt'
+    with open(path, 'w') as f:
+        f.write('# generated by gen_ubx.py\n')
+        f.write('\n'.join(corpus()) + '\n')
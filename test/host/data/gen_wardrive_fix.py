@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Write the fix history corpus used by test_wardrive_fix.
+
+wardrive_fix.txt is a list of steps run in order against one history:
+
+    history <max_age_ms> <max_hdop_e2>   start over with an empty history
+    push <t_us> <utc_ms> <lat_e7> <lon_e7> <alt_mm> <speed_mmps> <cog_e2> <dop_h_e2> ok|drop
+    at <t_us> <result> [<lat_e7> <lon_e7> <alt_mm> <dop_h_e2> <utc_ms> <tol_e7>]
+    utc <year> <month> <day> <hour> <minute> <second> <ms> <utc_ms>
+
+at checks wd_fix_history_at; the position fields are only there for the
+usable results (interpolated, dead_reckoned, nearest). Dead reckoning goes
+through float trig in the firmware, so lat and lon may be off by tol_e7; the
+rest is integer math and exact. utc checks wd_fix_utc_ms (0 for a rejected
+date) and, when valid, that wd_fix_utc_split gives the date back.
+
+The expected values come from a model of the history written here from its
+description: interpolation in integer e7 with a 16-bit fraction, dead
+reckoning capped at 3 s and held below 0.5 m/s, the utc time carried along
+from the fix the position was taken from.
+
+The file is committed; rerun this script only when changing the corpus:
+    python3 test/host/data/gen_wardrive_fix.py test/host/data/wardrive_fix.txt
+"""
+import calendar
+import math
+import sys
+
+LEN = 8
+E7_PER_M = 89.83152
+MIN_DR_SPEED = 500
+MAX_DR_US = 3000000
+LAT_MAX = 900000000
+LON_MAX = 1800000000
+
+
+def cdiv(a, b):
+    """C integer division, truncating towards zero"""
+    q = abs(a) // abs(b)
+    return q if (a >= 0) == (b >= 0) else -q
+
+
+def wrap_lon(lon):
+    if lon > LON_MAX:
+        lon -= 2 * LON_MAX
+    elif lon < -LON_MAX:
+        lon += 2 * LON_MAX
+    return lon
+
+
+class Fix:
+    def __init__(self, t, utc, lat, lon, alt=45000, speed=0, cog=0, hdop=90):
+        self.t, self.utc, self.lat, self.lon, self.alt = t, utc, lat, lon, alt
+        self.speed, self.cog, self.hdop = speed, cog, hdop
+        self.vlat = self.vlon = 0
+        if speed >= MIN_DR_SPEED:
+            v = speed * E7_PER_M / 1000
+            c = math.radians(cog / 100)
+            coslat = max(math.cos(math.radians(lat / 1e7)), 0.01)
+            self.vlat = round(v * math.cos(c))
+            self.vlon = round(v * math.sin(c) / coslat)
+
+    def line(self, ok):
+        return 'push %d %d %d %d %d %d %d %d %s' % (
+            self.t, self.utc, self.lat, self.lon, self.alt, self.speed, self.cog, self.hdop,
+            'ok' if ok else 'drop')
+
+
+class History:
+    def __init__(self, max_age_ms, max_hdop):
+        self.max_age_us = max_age_ms * 1000 or 1 << 62
+        self.max_hdop = max_hdop
+        self.fixes = []
+
+    def push(self, f):
+        if self.max_hdop and f.hdop > self.max_hdop:
+            return False
+        if self.fixes and f.t < self.fixes[-1].t:
+            return False
+        if self.fixes and f.t == self.fixes[-1].t:
+            self.fixes[-1] = f
+        else:
+            self.fixes = (self.fixes + [f])[-LEN:]
+        return True
+
+    @staticmethod
+    def place(base, t, dr=False):
+        lat, lon = base.lat, base.lon
+        if dr:
+            dt = min(t - base.t, MAX_DR_US)
+            lat = max(-LAT_MAX, min(LAT_MAX, lat + cdiv(base.vlat * dt, 1000000)))
+            lon = wrap_lon(lon + cdiv(base.vlon * dt, 1000000))
+        utc = base.utc + cdiv(t - base.t, 1000) if base.utc else 0
+        return [lat, lon, base.alt, base.hdop, utc]
+
+    def at(self, t):
+        """(result, fields) as wd_fix_history_at gives them"""
+        if not self.fixes:
+            return 'none', None
+        newest, oldest = self.fixes[-1], self.fixes[0]
+        if t >= newest.t:
+            if t - newest.t > self.max_age_us:
+                return 'stale', None
+            return 'dead_reckoned', self.place(newest, t, dr=True)
+        if t < oldest.t:
+            if oldest.t - t > self.max_age_us:
+                return 'stale', None
+            return 'nearest', self.place(oldest, t)
+        i = len(self.fixes) - 1
+        while self.fixes[i - 1].t > t:
+            i -= 1
+        a, b = self.fixes[i - 1], self.fixes[i]
+        since_a, until_b = t - a.t, b.t - t
+        if b.t - a.t > self.max_age_us:
+            if since_a <= self.max_age_us:
+                return 'dead_reckoned', self.place(a, t, dr=True)
+            if until_b <= self.max_age_us:
+                return 'nearest', self.place(b, t)
+            return 'stale', None
+        frac = (since_a << 16) // (b.t - a.t)
+        out = self.place(a if since_a <= until_b else b, t)
+        out[0] = a.lat + (((b.lat - a.lat) * frac) >> 16)
+        dlon = b.lon - a.lon
+        if dlon > LON_MAX:
+            dlon -= 2 * LON_MAX
+        elif dlon < -LON_MAX:
+            dlon += 2 * LON_MAX
+        out[1] = wrap_lon(a.lon + ((dlon * frac) >> 16))
+        out[2] = a.alt + (((b.alt - a.alt) * frac) >> 16)
+        out[3] = max(a.hdop, b.hdop)
+        return 'interpolated', out
+
+
+def utc_ms(y, mo, d, h, mi, s, ms):
+    return (calendar.timegm((y, mo, d, h, mi, s)) * 1000) + ms
+
+
+def corpus():
+    lines = []
+    hist = None
+
+    def history(max_age_ms=2000, max_hdop=1000):
+        nonlocal hist
+        hist = History(max_age_ms, max_hdop)
+        lines.append('history %d %d' % (max_age_ms, max_hdop))
+
+    def push(f, expect=True):
+        assert hist.push(f) == expect
+        lines.append(f.line(expect))
+
+    def at(t):
+        res, out = hist.at(t)
+        if out is None:
+            lines.append('at %d %s' % (t, res))
+            return res
+        tol = 4 if res == 'dead_reckoned' else 0
+        lines.append('at %d %s %s %d' % (t, res, ' '.join(str(v) for v in out), tol))
+        return res
+
+    # utc conversion, a leap day and the edges of what is accepted
+    for y, mo, d, h, mi, s, ms in ((2000, 1, 1, 0, 0, 0, 0), (2026, 10, 18, 12, 35, 19, 250),
+                                   (2024, 2, 29, 23, 59, 59, 999), (2000, 2, 29, 0, 0, 0, 0),
+                                   (2099, 12, 31, 23, 59, 59, 0), (2025, 3, 1, 0, 0, 0, 1)):
+        lines.append('utc %d %d %d %d %d %d %d %d' % (y, mo, d, h, mi, s, ms,
+                                                      utc_ms(y, mo, d, h, mi, s, ms)))
+    for bad in ((2025, 2, 29, 0, 0, 0, 0), (2026, 4, 31, 0, 0, 0, 0), (2026, 13, 1, 0, 0, 0, 0),
+                (2026, 0, 1, 0, 0, 0, 0), (2026, 1, 0, 0, 0, 0, 0), (2026, 1, 1, 24, 0, 0, 0),
+                (2026, 1, 1, 0, 60, 0, 0), (2026, 1, 1, 0, 0, 60, 0), (2026, 1, 1, 0, 0, 0, 1000),
+                (1999, 12, 31, 23, 59, 59, 999), (1970, 1, 1, 0, 0, 0, 0), (2100, 1, 1, 0, 0, 0, 0)):
+        lines.append('utc %d %d %d %d %d %d %d 0' % bad)
+
+    history()
+    at(5000000)
+
+    # a car at 15 m/s heading north-east, one fix a second sent a little late
+    # by the receiver; twelve fixes overflow the eight kept
+    t0, utc0 = 10000000, utc_ms(2026, 10, 18, 12, 35, 19, 0)
+    lat, lon, alt = 481173000, 115166667, 520000
+    jitter = (0, 37000, 112000, 8000, 95000, 61000, 0, 140000, 23000, 77000, 5000, 130000)
+    for k in range(12):
+        f = Fix(t0 + k * 1000000 + jitter[k], utc0 + k * 1000, lat, lon, alt, 15000, 4500,
+                80 + 5 * k)
+        push(f)
+        lat += f.vlat
+        lon += f.vlon
+        alt += 120
+    oldest, newest = hist.fixes[0].t, hist.fixes[-1].t
+    assert at(oldest - 1000000) == 'nearest'
+    assert at(oldest - 2500000) == 'stale'
+    assert at(oldest) == 'interpolated'
+    for t in (oldest + 1, oldest + 250000, oldest + 500000, newest - 400000, newest - 1):
+        assert at(t) == 'interpolated'
+    assert at(newest) == 'dead_reckoned'
+    assert at(newest + 500000) == 'dead_reckoned'
+    assert at(newest + 1999000) == 'dead_reckoned'
+    assert at(newest + 2001000) == 'stale'
+
+    # refused: poor hdop, out of order; the same timestamp replaces the newest
+    push(Fix(newest + 1000000, utc0 + 12000, lat, lon, hdop=1200), False)
+    push(Fix(newest - 300000, utc0 + 11000, lat, lon), False)
+    push(Fix(newest, utc0 + 11000, lat + 500, lon - 500, alt, 15000, 4500, 120))
+    at(newest + 300000)
+    at(newest - 300000)
+
+    # a gap of dropped fixes: each end is good for max_age, nothing between
+    history()
+    t0, utc0 = 50000000, utc_ms(2026, 10, 18, 23, 59, 58, 500)
+    push(Fix(t0, utc0, -337654321, -1511234567, -2000, 20000, 27000))
+    push(Fix(t0 + 5000000, utc0 + 5000, -337654321, -1511434567, -2000, 20000, 27000))
+    assert at(t0 + 1000000) == 'dead_reckoned'  # and the date rolls over
+    assert at(t0 + 2500000) == 'stale'
+    assert at(t0 + 4500000) == 'nearest'
+
+    # across the antimeridian, heading east
+    history()
+    push(Fix(1000000, utc0, 0, 1799999000, 0, 25000, 9000))
+    push(Fix(2000000, utc0 + 1000, 0, -1799998750, 0, 25000, 9000))
+    for t in (1200000, 1500000, 1900000):
+        assert at(t) == 'interpolated'
+    assert at(3500000) == 'dead_reckoned'
+
+    # too slow to trust the course: held where it is
+    history()
+    push(Fix(1000000, utc0, 515000000, -1000000, 30000, 300, 18000))
+    at(2500000)
+
+    # no age limit, dead reckoning still stops at 3 s; a fix with no utc
+    # time leaves it unknown
+    history(0, 0)
+    push(Fix(1000000, 0, 899990000, 0, 0, 30000, 0, 9999))
+    assert at(100000000) == 'dead_reckoned'
+    assert at(200000) == 'nearest'
+    return lines
+
+
+if __name__ == '__main__':
+    path = sys.argv[1] if len(sys.argv) > 1 else 'wardrive_fix.txt'
+    with open(path, 'w') as f:
+        f.write('# generated by gen_wardrive_fix.py\n')
+        f.write('\n'.join(corpus()) + '\n')
@@ -0,0 +1,6 @@
+#ifndef HOST_STUB_DRIVER_RMT_RX_H
+#define HOST_STUB_DRIVER_RMT_RX_H
+
+#include "driver/rmt_types.h"
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef HOST_STUB_DRIVER_RMT_TYPES_H
+#define HOST_STUB_DRIVER_RMT_TYPES_H
+
+#include <stdint.h>
+
+// only what infrared_manager.h names; no rmt driver on the host
+typedef union {
+    struct {
+        uint16_t duration0 : 15;
+        uint16_t level0 : 1;
+        uint16_t duration1 : 15;
+        uint16_t level1 : 1;
+    };
+    uint32_t val;
+} rmt_symbol_word_t;
+
+typedef struct rmt_channel_t *rmt_channel_handle_t;
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_STUB_DRIVER_SDMMC_HOST_H
+#define HOST_STUB_DRIVER_SDMMC_HOST_H
+
+#include "driver/sdmmc_types.h"
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_STUB_DRIVER_SDMMC_TYPES_H
+#define HOST_STUB_DRIVER_SDMMC_TYPES_H
+
+// sd_card_manager.h only holds a pointer to the card
+typedef struct sdmmc_card sdmmc_card_t;
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef HOST_STUB_ESP_ATTR_H
+#define HOST_STUB_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif
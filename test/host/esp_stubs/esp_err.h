@@ -0,0 +1,35 @@
+#ifndef HOST_STUB_ESP_ERR_H
+#define HOST_STUB_ESP_ERR_H
+
+// host stand-ins for the esp-idf headers the wifi capture callbacks pull in.
+// only what the firmware headers and callbacks.c reference is declared; the
+// behaviour lives in esp_stubs.c.
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_NOT_FOUND 0x105
+#define ESP_ERR_NOT_SUPPORTED 0x106
+#define ESP_ERR_TIMEOUT 0x107
+#define ESP_ERR_INVALID_RESPONSE 0x108
+#define ESP_ERR_INVALID_CRC 0x109
+#define ESP_ERR_INVALID_VERSION 0x10A
+
+const char *esp_err_to_name(esp_err_t code);
+
+#define ESP_ERROR_CHECK(x)                                                     \
+    do {                                                                       \
+        esp_err_t _rc = (x);                                                   \
+        if (_rc != ESP_OK) host_stub_error_check(_rc, #x, __FILE__, __LINE__); \
+    } while (0)
+
+void host_stub_error_check(esp_err_t rc, const char *expr, const char *file, int line);
+
+#endif
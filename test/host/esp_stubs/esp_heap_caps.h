@@ -0,0 +1,34 @@
+#ifndef HOST_STUB_ESP_HEAP_CAPS_H
+#define HOST_STUB_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+// one heap on the host
+static inline void *heap_caps_malloc(size_t size, uint32_t caps) {
+    return malloc(size);
+}
+
+static inline void *heap_caps_aligned_alloc(size_t align, size_t size, uint32_t caps) {
+    return aligned_alloc(align, (size + align - 1) / align * align);
+}
+
+static inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps) {
+    return realloc(ptr, size);
+}
+
+static inline void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps) {
+    return 0;
+}
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef HOST_STUB_ESP_IDF_VERSION_H
+#define HOST_STUB_ESP_IDF_VERSION_H
+
+// reported as 4.4 so the led strip headers skip the rmt/spi driver types
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(4, 4, 0)
+
+#endif
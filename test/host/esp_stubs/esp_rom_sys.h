@@ -0,0 +1,6 @@
+#ifndef HOST_STUB_ESP_ROM_SYS_H
+#define HOST_STUB_ESP_ROM_SYS_H
+
+int esp_rom_printf(const char *fmt, ...);
+
+#endif
@@ -0,0 +1,322 @@
+// esp-idf and freertos behaviour for the host replay: a clock driven by the
+// capture, inert timers, tasks run cooperatively from host_replay_run_tasks()
+// and heap calls counted through the linker's --wrap.
+
+#include "esp_err.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "host_replay.h"
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+host_replay_t host_replay;
+
+static int64_t s_now_us;
+static uint8_t s_channel = 1;
+
+void host_replay_reset(void) {
+    host_replay.counting = false;
+    host_replay.allocs = 0;
+    host_replay.frees = 0;
+    host_replay.alloc_bytes = 0;
+    host_replay.pcap_frames = 0;
+    host_replay.queue_drops = 0;
+    host_replay.tasks_created = 0;
+    host_replay.glog_lines = 0;
+    host_replay.row_count = 0;
+    host_replay.log_len = 0;
+    host_replay.log[0] = '\0';
+}
+
+void host_replay_set_time_us(int64_t now_us) {
+    s_now_us = now_us;
+}
+
+uint8_t host_replay_channel(void) {
+    return s_channel;
+}
+
+uint32_t host_replay_log_count(const char *needle) {
+    uint32_t n = 0;
+    size_t len = strlen(needle);
+    for (const char *p = host_replay.log; (p = strstr(p, needle)) != NULL; p += len) n++;
+    return n;
+}
+
+// ---- heap, counted while a callback runs ----
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size) {
+    if (host_replay.counting) {
+        host_replay.allocs++;
+        host_replay.alloc_bytes += size;
+    }
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    if (host_replay.counting) {
+        host_replay.allocs++;
+        host_replay.alloc_bytes += n * size;
+    }
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    if (host_replay.counting) {
+        host_replay.allocs++;
+        host_replay.alloc_bytes += size;
+    }
+    return __real_realloc(ptr, size);
+}
+
+void __wrap_free(void *ptr) {
+    if (host_replay.counting && ptr) host_replay.frees++;
+    __real_free(ptr);
+}
+
+// ---- esp_err / rom ----
+
+const char *esp_err_to_name(esp_err_t code) {
+    switch (code) {
+    case ESP_OK:
+        return "ESP_OK";
+    case ESP_ERR_NO_MEM:
+        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:
+        return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:
+        return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_NOT_FOUND:
+        return "ESP_ERR_NOT_FOUND";
+    default:
+        return "ESP_FAIL";
+    }
+}
+
+void host_stub_error_check(esp_err_t rc, const char *expr, const char *file, int line) {
+    fprintf(stderr, "%s:%d: ESP_ERROR_CHECK(%s) failed: %s\n", file, line, expr,
+            esp_err_to_name(rc));
+    abort();
+}
+
+// appended to the same log as glog, replay_stubs.c
+void host_replay_log_append(const char *fmt, va_list ap) {
+    size_t room = sizeof(host_replay.log) - host_replay.log_len;
+    int n = vsnprintf(host_replay.log + host_replay.log_len, room, fmt, ap);
+    if (n > 0) host_replay.log_len += (size_t)n < room ? (size_t)n : room - 1;
+    host_replay.glog_lines++;
+}
+
+int esp_rom_printf(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    host_replay_log_append(fmt, ap);
+    va_end(ap);
+    return 0;
+}
+
+// ---- timer and wifi ----
+
+struct host_esp_timer {
+    esp_timer_create_args_t args;
+    uint64_t period_us;
+    bool running;
+};
+
+int64_t esp_timer_get_time(void) {
+    return s_now_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out) {
+    struct host_esp_timer *t = calloc(1, sizeof(*t));
+    if (!t) return ESP_ERR_NO_MEM;
+    t->args = *args;
+    *out = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    if (!timer || timer->running) return ESP_ERR_INVALID_STATE;
+    timer->period_us = period_us;
+    timer->running = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    return esp_timer_start_periodic(timer, timeout_us);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer || !timer->running) return ESP_ERR_INVALID_STATE;
+    timer->running = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    free(timer);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t second) {
+    if (primary == 0 || primary > 196) return ESP_ERR_INVALID_ARG;
+    s_channel = primary;
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_get_channel(uint8_t *primary, wifi_second_chan_t *second) {
+    if (primary) *primary = s_channel;
+    if (second) *second = WIFI_SECOND_CHAN_NONE;
+    return ESP_OK;
+}
+
+// ---- queues ----
+
+struct host_queue {
+    size_t item_size;
+    size_t length;
+    size_t head;
+    size_t count;
+    uint8_t *items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    struct host_queue *q = calloc(1, sizeof(*q));
+    if (!q) return NULL;
+    q->items = calloc(length, item_size);
+    if (!q->items) {
+        free(q);
+        return NULL;
+    }
+    q->item_size = item_size;
+    q->length = length;
+    return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait) {
+    if (q->count == q->length) {
+        host_replay.queue_drops++;
+        return pdFALSE;
+    }
+    memcpy(q->items + ((q->head + q->count) % q->length) * q->item_size, item, q->item_size);
+    q->count++;
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+    return (UBaseType_t)q->count;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    if (!q) return;
+    free(q->items);
+    free(q);
+}
+
+// ---- tasks ----
+
+typedef struct {
+    bool used;
+    bool slept;       // the vTaskDelay the task is resuming from has passed
+    TaskFunction_t fn;
+    void *arg;
+    const char *name;
+    int64_t wake_us;
+} host_task_t;
+
+#define HOST_TASKS_MAX 32
+
+static host_task_t s_tasks[HOST_TASKS_MAX];
+static host_task_t *s_running;
+static jmp_buf s_task_yield;
+
+// leave the running task; it is resumed (from the top) by the next
+// host_replay_run_tasks() once the clock has reached wake_us
+static void task_yield(int64_t wake_us) {
+    s_running->wake_us = wake_us;
+    longjmp(s_task_yield, 1);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) {
+    if (q->count == 0) {
+        if (s_running && wait > 0) task_yield(0);
+        return pdFALSE;
+    }
+    memcpy(item, q->items + q->head * q->item_size, q->item_size);
+    q->head = (q->head + 1) % q->length;
+    q->count--;
+    return pdTRUE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *out) {
+    for (int i = 0; i < HOST_TASKS_MAX; i++) {
+        host_task_t *t = &s_tasks[i];
+        if (t->used) continue;
+        memset(t, 0, sizeof(*t));
+        t->used = true;
+        t->fn = fn;
+        t->arg = arg;
+        t->name = name;
+        t->wake_us = s_now_us;
+        host_replay.tasks_created++;
+        if (out) *out = t;
+        return pdPASS;
+    }
+    return pdFAIL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *out,
+                                   BaseType_t core) {
+    return xTaskCreate(fn, name, stack, arg, prio, out);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    host_task_t *t = task ? (host_task_t *)task : s_running;
+    if (!t) return;
+    t->used = false;
+    if (t == s_running) task_yield(0);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    if (!s_running) return;
+    if (s_running->slept) {
+        s_running->slept = false;
+        return;
+    }
+    s_running->slept = true;
+    task_yield(s_now_us + (int64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(s_now_us / 1000 / portTICK_PERIOD_MS);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return 0;
+}
+
+void host_replay_run_tasks(void) {
+    for (int i = 0; i < HOST_TASKS_MAX; i++) {
+        host_task_t *t = &s_tasks[i];
+        if (!t->used || t->wake_us > s_now_us) continue;
+        s_running = t;
+        if (setjmp(s_task_yield) == 0) {
+            t->fn(t->arg);
+            t->used = false; // returned instead of deleting itself
+        }
+        s_running = NULL;
+    }
+}
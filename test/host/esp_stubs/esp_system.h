@@ -0,0 +1,13 @@
+#ifndef HOST_STUB_ESP_SYSTEM_H
+#define HOST_STUB_ESP_SYSTEM_H
+
+#include "esp_err.h"
+
+typedef void (*shutdown_handler_t)(void);
+
+// the tests that need these define them: a restart ends the test, the
+// shutdown handlers are theirs to run
+void esp_restart(void);
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler);
+
+#endif
@@ -0,0 +1,312 @@
+// freertos tasks as pthreads, for the host tests that need producers and
+// consumers to really run at the same time (test_glog, test_settings_manager,
+// test_sd_xfer and their benches), with queues and semaphores that block
+// across threads and esp_timer_get_time on the monotonic clock. the replay
+// tests use the cooperative tasks of esp_stubs.c instead.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct host_thread {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notify;
+    volatile int done; // the task function returned or deleted itself
+    struct host_thread *next;
+} host_thread_t;
+
+static __thread host_thread_t *s_self;
+// handles outlive their tasks (eTaskGetState asks about deleted ones), so
+// they are kept here instead of being freed
+static host_thread_t *s_threads;
+static pthread_mutex_t s_threads_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *task_main(void *p) {
+    host_thread_t *t = p;
+    s_self = t;
+    t->fn(t->arg);
+    __atomic_store_n(&t->done, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *out) {
+    host_thread_t *t = calloc(1, sizeof(*t));
+    if (!t) return pdFAIL;
+    t->fn = fn;
+    t->arg = arg;
+    pthread_mutex_init(&t->lock, NULL);
+    pthread_cond_init(&t->cond, NULL);
+    // published before the thread starts, tasks may be notified right away
+    if (out) *out = t;
+    if (pthread_create(&t->thread, NULL, task_main, t) != 0) {
+        if (out) *out = NULL;
+        free(t);
+        return pdFAIL;
+    }
+    pthread_detach(t->thread);
+    pthread_mutex_lock(&s_threads_lock);
+    t->next = s_threads;
+    s_threads = t;
+    pthread_mutex_unlock(&s_threads_lock);
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *out,
+                                   BaseType_t core) {
+    return xTaskCreate(fn, name, stack, arg, prio, out);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    // only self-deletion is supported, like every caller under test uses it
+    if (!task || task == s_self) {
+        if (s_self) __atomic_store_n(&s_self->done, 1, __ATOMIC_RELEASE);
+        pthread_exit(NULL);
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    usleep((useconds_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+TickType_t xTaskGetTickCount(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000) / portTICK_PERIOD_MS;
+}
+
+int64_t esp_timer_get_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait) {
+    host_thread_t *t = xTaskGetCurrentTaskHandle();
+
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    if (wait != portMAX_DELAY) {
+        uint64_t ms = (uint64_t)wait * portTICK_PERIOD_MS;
+        deadline.tv_sec += (time_t)(ms / 1000);
+        deadline.tv_nsec += (long)(ms % 1000) * 1000000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+    }
+
+    pthread_mutex_lock(&t->lock);
+    while (t->notify == 0) {
+        if (wait == portMAX_DELAY) {
+            pthread_cond_wait(&t->cond, &t->lock);
+        } else if (wait == 0 || pthread_cond_timedwait(&t->cond, &t->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    uint32_t value = t->notify;
+    if (value) t->notify = clear_on_exit ? 0 : value - 1;
+    pthread_mutex_unlock(&t->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    host_thread_t *t = task;
+    if (!t) return pdFAIL;
+    pthread_mutex_lock(&t->lock);
+    t->notify++;
+    pthread_cond_signal(&t->cond);
+    pthread_mutex_unlock(&t->lock);
+    return pdPASS;
+}
+
+// threads that were not started by xTaskCreate (main, or a test's own
+// pthreads) get a handle on first use, so each of them is a task of its own
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    if (!s_self) {
+        s_self = calloc(1, sizeof(*s_self));
+        pthread_mutex_init(&s_self->lock, NULL);
+        pthread_cond_init(&s_self->cond, NULL);
+        s_self->thread = pthread_self();
+        pthread_mutex_lock(&s_threads_lock);
+        s_self->next = s_threads;
+        s_threads = s_self;
+        pthread_mutex_unlock(&s_threads_lock);
+    }
+    return s_self;
+}
+
+eTaskState eTaskGetState(TaskHandle_t task) {
+    host_thread_t *t = task;
+    if (!t) return eInvalid;
+    return __atomic_load_n(&t->done, __ATOMIC_ACQUIRE) ? eDeleted : eRunning;
+}
+
+// ---- queues and semaphores ----
+
+// a mutex is a plain pthread mutex (owned, timed lock); everything else is a
+// bounded queue under lock and cond, semaphores being queues of empty items
+struct host_queue {
+    bool is_mutex;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint8_t *items;
+    UBaseType_t length, item_size, count, head;
+};
+
+// absolute CLOCK_REALTIME time wait ticks from now
+static struct timespec deadline_in(TickType_t wait) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    uint64_t ns = (uint64_t)deadline.tv_nsec + (uint64_t)wait * portTICK_PERIOD_MS * 1000000;
+    deadline.tv_sec += (time_t)(ns / 1000000000);
+    deadline.tv_nsec = (long)(ns % 1000000000);
+    return deadline;
+}
+
+// caller holds q->lock; false once wait ran out
+static bool queue_wait(QueueHandle_t q, TickType_t wait, const struct timespec *deadline) {
+    if (wait == 0) return false;
+    if (wait == portMAX_DELAY) return pthread_cond_wait(&q->cond, &q->lock) == 0;
+    return pthread_cond_timedwait(&q->cond, &q->lock, deadline) != ETIMEDOUT;
+}
+
+static QueueHandle_t queue_new(UBaseType_t length, UBaseType_t item_size, UBaseType_t count) {
+    QueueHandle_t q = calloc(1, sizeof(*q));
+    if (!q) return NULL;
+    q->items = calloc(length ? length : 1, item_size ? item_size : 1);
+    if (!q->items) {
+        free(q);
+        return NULL;
+    }
+    q->length = length;
+    q->item_size = item_size;
+    q->count = count;
+    pthread_mutex_init(&q->lock, NULL);
+    pthread_cond_init(&q->cond, NULL);
+    return q;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    return queue_new(length, item_size, 0);
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait) {
+    struct timespec deadline = deadline_in(wait == portMAX_DELAY ? 0 : wait);
+    pthread_mutex_lock(&q->lock);
+    while (q->count == q->length) {
+        if (!queue_wait(q, wait, &deadline)) {
+            pthread_mutex_unlock(&q->lock);
+            return pdFALSE;
+        }
+    }
+    if (q->item_size) {
+        UBaseType_t tail = (q->head + q->count) % q->length;
+        memcpy(q->items + tail * q->item_size, item, q->item_size);
+    }
+    q->count++;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) {
+    struct timespec deadline = deadline_in(wait == portMAX_DELAY ? 0 : wait);
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0) {
+        if (!queue_wait(q, wait, &deadline)) {
+            pthread_mutex_unlock(&q->lock);
+            return pdFALSE;
+        }
+    }
+    if (q->item_size) {
+        memcpy(item, q->items + q->head * q->item_size, q->item_size);
+        q->head = (q->head + 1) % q->length;
+    }
+    q->count--;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    UBaseType_t n = q->count;
+    pthread_mutex_unlock(&q->lock);
+    return n;
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    q->count = 0;
+    q->head = 0;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return pdPASS;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    if (!q) return;
+    if (!q->is_mutex) pthread_cond_destroy(&q->cond);
+    pthread_mutex_destroy(&q->lock);
+    free(q->items);
+    free(q);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    SemaphoreHandle_t sem = calloc(1, sizeof(*sem));
+    if (!sem) return NULL;
+    sem->is_mutex = true;
+    pthread_mutex_init(&sem->lock, NULL);
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return queue_new(1, 0, 0);
+}
+
+// the buffer is not used, the handle is heap allocated like any other
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buf) {
+    return queue_new(1, 0, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+    return queue_new(max, 0, initial);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait) {
+    if (!sem->is_mutex) return xQueueReceive(sem, NULL, wait);
+    if (wait == portMAX_DELAY) return pthread_mutex_lock(&sem->lock) == 0 ? pdTRUE : pdFALSE;
+    struct timespec deadline = deadline_in(wait);
+    return pthread_mutex_timedlock(&sem->lock, &deadline) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (!sem->is_mutex) return xQueueSend(sem, NULL, 0);
+    return pthread_mutex_unlock(&sem->lock) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return xSemaphoreGive(sem);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    vQueueDelete(sem);
+}
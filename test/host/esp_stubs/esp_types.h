@@ -0,0 +1,8 @@
+#ifndef HOST_STUB_ESP_TYPES_H
+#define HOST_STUB_ESP_TYPES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef HOST_STUB_ESP_VFS_FAT_H
+#define HOST_STUB_ESP_VFS_FAT_H
+
+#include "esp_err.h"
+
+#endif
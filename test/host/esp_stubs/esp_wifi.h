@@ -0,0 +1,11 @@
+#ifndef HOST_STUB_ESP_WIFI_H
+#define HOST_STUB_ESP_WIFI_H
+
+#include "esp_err.h"
+#include "esp_wifi_types.h"
+
+// the replay records the channel the callbacks tune to
+esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t second);
+esp_err_t esp_wifi_get_channel(uint8_t *primary, wifi_second_chan_t *second);
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef HOST_STUB_ESP_WIFI_TYPES_H
+#define HOST_STUB_ESP_WIFI_TYPES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum {
+    WIFI_PKT_MGMT,
+    WIFI_PKT_CTRL,
+    WIFI_PKT_DATA,
+    WIFI_PKT_MISC,
+} wifi_promiscuous_pkt_type_t;
+
+typedef enum {
+    WIFI_SECOND_CHAN_NONE = 0,
+    WIFI_SECOND_CHAN_ABOVE,
+    WIFI_SECOND_CHAN_BELOW,
+} wifi_second_chan_t;
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_ENTERPRISE,
+    WIFI_AUTH_WPA3_PSK,
+    WIFI_AUTH_WPA2_WPA3_PSK,
+    WIFI_AUTH_WAPI_PSK,
+    WIFI_AUTH_OWE,
+    WIFI_AUTH_MAX
+} wifi_auth_mode_t;
+
+// field names as in esp_wifi_types.h; the channel is 8 bits wide as on the
+// esp32c5 so 5 GHz frames from the corpus keep their channel
+typedef struct {
+    signed rssi : 8;
+    unsigned rate : 5;
+    unsigned : 1;
+    unsigned sig_mode : 2;
+    unsigned : 16;
+    unsigned mcs : 7;
+    unsigned cwb : 1;
+    unsigned : 16;
+    unsigned smoothing : 1;
+    unsigned not_sounding : 1;
+    unsigned : 1;
+    unsigned aggregation : 1;
+    unsigned stbc : 2;
+    unsigned fec_coding : 1;
+    unsigned sgi : 1;
+    signed noise_floor : 8;
+    unsigned ampdu_cnt : 8;
+    unsigned channel : 8;
+    unsigned secondary_channel : 4;
+    unsigned : 4;
+    unsigned timestamp : 32;
+    unsigned : 32;
+    unsigned : 31;
+    unsigned ant : 1;
+    unsigned sig_len : 12;
+    unsigned : 12;
+    unsigned rx_state : 8;
+} wifi_pkt_rx_ctrl_t;
+
+typedef struct {
+    wifi_pkt_rx_ctrl_t rx_ctrl;
+    uint8_t payload[0];
+} wifi_promiscuous_pkt_t;
+
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t ssid[33];
+    uint8_t primary;
+    wifi_second_chan_t second;
+    int8_t rssi;
+    wifi_auth_mode_t authmode;
+} wifi_ap_record_t;
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef HOST_STUB_FREERTOS_H
+#define HOST_STUB_FREERTOS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef struct host_queue *QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+typedef void (*TaskFunction_t)(void *);
+typedef uint8_t StackType_t;
+typedef struct { void *pad; } StaticTask_t;
+typedef struct { void *pad; } StaticSemaphore_t;
+typedef struct {
+    volatile int locked;
+} portMUX_TYPE;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xffffffffu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7fffffff
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux) host_stub_mux_lock(mux)
+#define portEXIT_CRITICAL(mux) host_stub_mux_unlock(mux)
+#define portENTER_CRITICAL_ISR(mux) host_stub_mux_lock(mux)
+#define portEXIT_CRITICAL_ISR(mux) host_stub_mux_unlock(mux)
+#define portMUX_INITIALIZE(mux) host_stub_mux_unlock(mux)
+#define portYIELD_FROM_ISR() ((void)0)
+#define taskENTER_CRITICAL(mux) host_stub_mux_lock(mux)
+#define taskEXIT_CRITICAL(mux) host_stub_mux_unlock(mux)
+#define BIT0 0x01
+#define BIT1 0x02
+
+// a real spinlock, so the critical sections also hold with the threaded tasks
+// of esp_threads.c. not recursive, unlike the esp-idf one
+static inline void host_stub_mux_lock(portMUX_TYPE *mux) {
+    while (__atomic_exchange_n(&mux->locked, 1, __ATOMIC_ACQUIRE)) {
+    }
+}
+
+static inline void host_stub_mux_unlock(portMUX_TYPE *mux) {
+    __atomic_store_n(&mux->locked, 0, __ATOMIC_RELEASE);
+}
+
+#endif
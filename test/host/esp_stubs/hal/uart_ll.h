@@ -0,0 +1,6 @@
+#ifndef HOST_STUB_HAL_UART_LL_H
+#define HOST_STUB_HAL_UART_LL_H
+
+// only the esp32c5 clock gating in MicroNMEA.c uses it
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef HOST_GPS_UART_H
+#define HOST_GPS_UART_H
+
+// the receiver as MicroNMEA.c sees it, for test_nmea_parser and the gps
+// benches (nmea_stubs.c): uart reads come from a buffer, at most chunk bytes
+// at a time, writes and baud changes are recorded, and GPS_UPDATE posts are
+// counted with the last fix kept. the clock only moves when the caller or
+// vTaskDelay moves it.
+
+#include "vendor/GPS/MicroNMEA.h"
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    // set by the caller
+    const uint8_t *data;
+    size_t len;
+    size_t pos;
+    size_t chunk; // most bytes one uart_read_bytes hands out
+    // recorded
+    uint32_t writes;
+    uint32_t bauds[16]; // uart_set_baudrate calls, in order
+    uint32_t baud_sets;
+} host_gps_uart_t;
+
+typedef struct {
+    uint32_t updates;
+    uint32_t unknown;
+    gps_t last;
+} host_gps_events_t;
+
+extern host_gps_uart_t host_gps_uart;
+extern host_gps_events_t host_gps_events;
+extern int64_t host_gps_now_us; // esp_timer_get_time()
+
+#endif // HOST_GPS_UART_H
@@ -0,0 +1,30 @@
+#ifndef HOST_NVS_H
+#define HOST_NVS_H
+
+// what the tests see of the in-memory nvs in nvs_stub.c: counters for every
+// call that would touch flash, and direct access to the stored entries
+
+#include "nvs.h"
+#include <stdbool.h>
+
+typedef struct {
+    uint32_t sets;    // nvs_set_* calls
+    uint32_t writes;  // of those, the ones that changed the stored value
+    uint64_t bytes;   // value bytes written by those
+    uint32_t erases;  // nvs_erase_key calls that removed a key
+    uint32_t commits;
+    uint32_t gets;    // nvs_get_* calls, found or not
+    esp_err_t fail_sets; // when not ESP_OK, every nvs_set_* returns it
+} host_nvs_t;
+
+extern host_nvs_t host_nvs;
+
+// drops every stored entry and zeroes the counters
+void host_nvs_erase_all(void);
+// zeroes the counters, keeps the entries
+void host_nvs_clear_counts(void);
+
+bool host_nvs_has(const char *name_space, const char *key);
+size_t host_nvs_key_count(const char *name_space);
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef HOST_REPLAY_H
+#define HOST_REPLAY_H
+
+// state shared by the esp-idf stand-ins (esp_stubs.c), the firmware
+// stand-ins (replay_stubs.c) and test_wifi_replay.c. everything runs on one
+// thread: frames are fed in capture order, the clock follows the capture and
+// tasks only run from host_replay_run_tasks().
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HOST_REPLAY_LOG_MAX (512 * 1024)
+#define HOST_REPLAY_ROWS_MAX 4096
+
+typedef struct {
+  uint8_t bssid[6];
+  char ssid[33];
+  char encryption[8];
+  int channel;
+  int rssi;
+} host_replay_row_t;
+
+typedef struct {
+  // malloc/calloc/realloc/free through the --wrap hooks, only while counting
+  bool counting;
+  uint64_t allocs;
+  uint64_t frees;
+  uint64_t alloc_bytes;
+
+  uint32_t pcap_frames;    // frames handed to pcap_write_packet_to_buffer
+  uint32_t queue_drops;    // xQueueSend on a full queue
+  uint32_t tasks_created;
+  uint32_t glog_lines;     // glog and esp_rom_printf calls
+
+  // wardriving rows, as gps_manager_log_wardriving_data received them
+  host_replay_row_t rows[HOST_REPLAY_ROWS_MAX];
+  uint32_t row_count;
+
+  // glog / esp_rom_printf output, concatenated
+  char log[HOST_REPLAY_LOG_MAX];
+  size_t log_len;
+} host_replay_t;
+
+extern host_replay_t host_replay;
+
+// clears the counters, the rows and the log, not the callbacks' own state
+void host_replay_reset(void);
+
+void host_replay_set_time_us(int64_t now_us);
+
+// runs every task until it blocks: a task waiting in vTaskDelay resumes once
+// the replay clock has passed its wake time, a task blocking on an empty
+// queue returns to the caller. tasks restart from the top each time, which
+// the loops in callbacks.c tolerate
+void host_replay_run_tasks(void);
+
+// the channel the callbacks last tuned the radio to
+uint8_t host_replay_channel(void);
+
+// occurrences of needle in the captured log
+uint32_t host_replay_log_count(const char *needle);
+
+#endif // HOST_REPLAY_H
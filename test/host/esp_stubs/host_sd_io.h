@@ -0,0 +1,36 @@
+#ifndef HOST_SD_IO_H
+#define HOST_SD_IO_H
+
+// the card as sd_xfer.c sees it, for test_sd_xfer and bench_sd_xfer:
+// read() and write() are wrapped at link time (sd_xfer_stubs.c) to add card
+// latency, split and interrupt calls and fail past a byte count, and they
+// record what reached the card. sd_card_bus_arbiter() hands out a real
+// arbiter while shared is set, as on boards where display and sd share spi.
+
+#include "core/bus_arbiter.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    // set by the test
+    uint32_t delay_us;     // per call
+    uint32_t us_per_kb;    // plus per KB moved
+    size_t max_io;         // a call moves at most this much, 0 no limit
+    uint32_t eintr_every;  // every nth call fails with EINTR first, 0 never
+    size_t fail_after;     // calls fail (EIO) once this much moved, 0 never
+    bool shared;           // sd_card_bus_arbiter() returns the arbiter
+    // recorded
+    uint32_t reads, writes, eintrs;
+    size_t bytes_read, bytes_written;
+    size_t max_read, max_write;
+    uint32_t unowned; // calls while the sd client did not hold the bus (shared only)
+} host_sd_io_t;
+
+extern host_sd_io_t host_sd_io;
+
+// clears the settings and the records, the arbiter keeps its clients
+void host_sd_io_reset(void);
+bus_arbiter_t *host_sd_arbiter(void);
+
+#endif // HOST_SD_IO_H
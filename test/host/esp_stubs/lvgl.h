@@ -0,0 +1,26 @@
+#ifndef HOST_STUB_LVGL_H
+#define HOST_STUB_LVGL_H
+
+// opaque or minimal, the capture code never draws
+#include <stdint.h>
+
+typedef struct _lv_obj_t lv_obj_t;
+typedef struct _lv_timer_t lv_timer_t;
+typedef struct {
+    int16_t x, y;
+    int state;
+} lv_indev_data_t;
+typedef union {
+    uint16_t full;
+} lv_color_t;
+typedef struct {
+    const void *data;
+} lv_img_dsc_t;
+
+#define LV_IMG_DECLARE(name) extern const lv_img_dsc_t name
+
+typedef void (*lv_timer_cb_t)(lv_timer_t *timer);
+lv_timer_t *lv_timer_create(lv_timer_cb_t cb, uint32_t period, void *user_data);
+void lv_timer_del(lv_timer_t *timer);
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef HOST_STUB_MBEDTLS_BASE64_H
+#define HOST_STUB_MBEDTLS_BASE64_H
+
+// declarations only, for sources that include it without calling it
+#include <stddef.h>
+
+int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src,
+                          size_t slen);
+int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src,
+                          size_t slen);
+
+#endif
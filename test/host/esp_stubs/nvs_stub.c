@@ -0,0 +1,314 @@
+// nvs for the host tests: entries live in memory for the life of the process
+// (nvs_flash_erase or host_nvs_erase_all drop them), every call that would
+// touch flash is counted in host_nvs. values are written through at once,
+// so nvs_commit only counts.
+
+#include "freertos/FreeRTOS.h"
+#include "host_nvs.h"
+#include "nvs_flash.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NVS_MAX_ENTRIES 512
+#define NVS_MAX_HANDLES 16
+#define NVS_TOTAL_ENTRIES 630 // five 4 KB pages of 126 entries
+#define NVS_SPAN_BYTES 32     // a string or blob takes one entry per 32 bytes
+
+typedef enum { NVS_T_U8, NVS_T_U16, NVS_T_U32, NVS_T_I32, NVS_T_STR, NVS_T_BLOB } nvs_type_t;
+
+typedef struct {
+    char ns[NVS_KEY_NAME_MAX_SIZE];
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    uint8_t type;
+    uint8_t *data;
+    size_t len;
+} nvs_entry_t;
+
+typedef struct {
+    bool open;
+    bool writable;
+    char ns[NVS_KEY_NAME_MAX_SIZE];
+} nvs_open_t;
+
+host_nvs_t host_nvs;
+
+static portMUX_TYPE s_nvs_mux = portMUX_INITIALIZER_UNLOCKED;
+static nvs_entry_t s_entries[NVS_MAX_ENTRIES];
+static size_t s_count;
+static nvs_open_t s_handles[NVS_MAX_HANDLES];
+
+static size_t entry_span(const nvs_entry_t *e) {
+    if (e->type != NVS_T_STR && e->type != NVS_T_BLOB) return 1;
+    return 1 + (e->len + NVS_SPAN_BYTES - 1) / NVS_SPAN_BYTES;
+}
+
+static nvs_entry_t *find(const char *ns, const char *key) {
+    for (size_t i = 0; i < s_count; i++) {
+        if (strcmp(s_entries[i].ns, ns) == 0 && strcmp(s_entries[i].key, key) == 0) {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+static void drop(nvs_entry_t *e) {
+    free(e->data);
+    *e = s_entries[--s_count];
+}
+
+static const nvs_open_t *handle_of(nvs_handle_t handle) {
+    if (handle == 0 || handle > NVS_MAX_HANDLES || !s_handles[handle - 1].open) return NULL;
+    return &s_handles[handle - 1];
+}
+
+static esp_err_t check_key(const char *key) {
+    if (!key || !key[0]) return ESP_ERR_NVS_INVALID_NAME;
+    if (strlen(key) >= NVS_KEY_NAME_MAX_SIZE) return ESP_ERR_NVS_KEY_TOO_LONG;
+    return ESP_OK;
+}
+
+static esp_err_t set(nvs_handle_t handle, const char *key, nvs_type_t type, const void *value,
+                     size_t len) {
+    const nvs_open_t *h = handle_of(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (!h->writable) return ESP_ERR_NVS_READ_ONLY;
+    esp_err_t err = check_key(key);
+    if (err != ESP_OK) return err;
+
+    portENTER_CRITICAL(&s_nvs_mux);
+    host_nvs.sets++;
+    if (host_nvs.fail_sets != ESP_OK) {
+        err = host_nvs.fail_sets;
+        goto out;
+    }
+    nvs_entry_t *e = find(h->ns, key);
+    // flash keeps an identical value as it is
+    if (e && e->type == type && e->len == len && memcmp(e->data, value, len) == 0) goto out;
+
+    uint8_t *data = malloc(len ? len : 1);
+    if (!data) {
+        err = ESP_ERR_NO_MEM;
+        goto out;
+    }
+    memcpy(data, value, len);
+    if (!e) {
+        if (s_count == NVS_MAX_ENTRIES) {
+            free(data);
+            err = ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+            goto out;
+        }
+        e = &s_entries[s_count++];
+        memset(e, 0, sizeof(*e));
+        strcpy(e->ns, h->ns);
+        strcpy(e->key, key);
+    }
+    free(e->data);
+    e->type = (uint8_t)type;
+    e->data = data;
+    e->len = len;
+    host_nvs.writes++;
+    host_nvs.bytes += len;
+out:
+    portEXIT_CRITICAL(&s_nvs_mux);
+    return err;
+}
+
+// copies the value out; out may be NULL for strings and blobs to ask for the
+// length, a length too small fails without copying, like the real api
+static esp_err_t get(nvs_handle_t handle, const char *key, nvs_type_t type, void *out,
+                     size_t *len) {
+    const nvs_open_t *h = handle_of(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    esp_err_t err = check_key(key);
+    if (err != ESP_OK) return err;
+
+    portENTER_CRITICAL(&s_nvs_mux);
+    host_nvs.gets++;
+    const nvs_entry_t *e = find(h->ns, key);
+    if (!e) {
+        err = ESP_ERR_NVS_NOT_FOUND;
+    } else if (e->type != type) {
+        err = ESP_ERR_NVS_TYPE_MISMATCH;
+    } else if (type == NVS_T_STR || type == NVS_T_BLOB) {
+        if (out && *len < e->len) {
+            err = ESP_ERR_NVS_INVALID_LENGTH;
+        } else if (out) {
+            memcpy(out, e->data, e->len);
+        }
+        *len = e->len;
+    } else {
+        memcpy(out, e->data, e->len);
+    }
+    portEXIT_CRITICAL(&s_nvs_mux);
+    return err;
+}
+
+// ---- flash ----
+
+esp_err_t nvs_flash_init(void) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void) {
+    host_nvs_erase_all();
+    return ESP_OK;
+}
+
+// ---- handles ----
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t mode, nvs_handle_t *out) {
+    if (!name || strlen(name) >= NVS_KEY_NAME_MAX_SIZE) return ESP_ERR_NVS_INVALID_NAME;
+    for (int i = 0; i < NVS_MAX_HANDLES; i++) {
+        if (s_handles[i].open) continue;
+        s_handles[i].open = true;
+        s_handles[i].writable = mode == NVS_READWRITE;
+        strcpy(s_handles[i].ns, name);
+        *out = (nvs_handle_t)i + 1;
+        return ESP_OK;
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    if (handle_of(handle)) s_handles[handle - 1].open = false;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    if (!handle_of(handle)) return ESP_ERR_NVS_INVALID_HANDLE;
+    __atomic_add_fetch(&host_nvs.commits, 1, __ATOMIC_RELAXED);
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key) {
+    const nvs_open_t *h = handle_of(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (!h->writable) return ESP_ERR_NVS_READ_ONLY;
+    esp_err_t err = check_key(key);
+    if (err != ESP_OK) return err;
+
+    portENTER_CRITICAL(&s_nvs_mux);
+    nvs_entry_t *e = find(h->ns, key);
+    if (e) {
+        drop(e);
+        host_nvs.erases++;
+    } else {
+        err = ESP_ERR_NVS_NOT_FOUND;
+    }
+    portEXIT_CRITICAL(&s_nvs_mux);
+    return err;
+}
+
+// ---- values ----
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char *key, uint8_t value) {
+    return set(handle, key, NVS_T_U8, &value, sizeof(value));
+}
+
+esp_err_t nvs_set_u16(nvs_handle_t handle, const char *key, uint16_t value) {
+    return set(handle, key, NVS_T_U16, &value, sizeof(value));
+}
+
+esp_err_t nvs_set_u32(nvs_handle_t handle, const char *key, uint32_t value) {
+    return set(handle, key, NVS_T_U32, &value, sizeof(value));
+}
+
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char *key, int32_t value) {
+    return set(handle, key, NVS_T_I32, &value, sizeof(value));
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char *key, const char *value) {
+    return set(handle, key, NVS_T_STR, value, strlen(value) + 1);
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) {
+    return set(handle, key, NVS_T_BLOB, value, length);
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char *key, uint8_t *out) {
+    return get(handle, key, NVS_T_U8, out, NULL);
+}
+
+esp_err_t nvs_get_u16(nvs_handle_t handle, const char *key, uint16_t *out) {
+    return get(handle, key, NVS_T_U16, out, NULL);
+}
+
+esp_err_t nvs_get_u32(nvs_handle_t handle, const char *key, uint32_t *out) {
+    return get(handle, key, NVS_T_U32, out, NULL);
+}
+
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char *key, int32_t *out) {
+    return get(handle, key, NVS_T_I32, out, NULL);
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char *key, char *out, size_t *length) {
+    return get(handle, key, NVS_T_STR, out, length);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out, size_t *length) {
+    return get(handle, key, NVS_T_BLOB, out, length);
+}
+
+// ---- stats ----
+
+esp_err_t nvs_get_stats(const char *part_name, nvs_stats_t *stats) {
+    char seen[NVS_MAX_HANDLES][NVS_KEY_NAME_MAX_SIZE];
+    size_t used = 0, spaces = 0;
+    portENTER_CRITICAL(&s_nvs_mux);
+    for (size_t i = 0; i < s_count; i++) {
+        used += entry_span(&s_entries[i]);
+        size_t j = 0;
+        while (j < spaces && strcmp(seen[j], s_entries[i].ns) != 0) j++;
+        if (j == spaces && spaces < NVS_MAX_HANDLES) strcpy(seen[spaces++], s_entries[i].ns);
+    }
+    portEXIT_CRITICAL(&s_nvs_mux);
+    stats->used_entries = used;
+    stats->total_entries = NVS_TOTAL_ENTRIES;
+    stats->free_entries = used < NVS_TOTAL_ENTRIES ? NVS_TOTAL_ENTRIES - used : 0;
+    stats->namespace_count = spaces;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_used_entry_count(nvs_handle_t handle, size_t *used_entries) {
+    const nvs_open_t *h = handle_of(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    size_t used = 0;
+    portENTER_CRITICAL(&s_nvs_mux);
+    for (size_t i = 0; i < s_count; i++) {
+        if (strcmp(s_entries[i].ns, h->ns) == 0) used += entry_span(&s_entries[i]);
+    }
+    portEXIT_CRITICAL(&s_nvs_mux);
+    *used_entries = used;
+    return ESP_OK;
+}
+
+// ---- test access ----
+
+void host_nvs_erase_all(void) {
+    portENTER_CRITICAL(&s_nvs_mux);
+    while (s_count) drop(&s_entries[0]);
+    portEXIT_CRITICAL(&s_nvs_mux);
+    host_nvs_clear_counts();
+}
+
+void host_nvs_clear_counts(void) {
+    esp_err_t fail = host_nvs.fail_sets;
+    memset(&host_nvs, 0, sizeof(host_nvs));
+    host_nvs.fail_sets = fail;
+}
+
+bool host_nvs_has(const char *name_space, const char *key) {
+    portENTER_CRITICAL(&s_nvs_mux);
+    bool found = find(name_space, key) != NULL;
+    portEXIT_CRITICAL(&s_nvs_mux);
+    return found;
+}
+
+size_t host_nvs_key_count(const char *name_space) {
+    size_t n = 0;
+    portENTER_CRITICAL(&s_nvs_mux);
+    for (size_t i = 0; i < s_count; i++) {
+        if (strcmp(s_entries[i].ns, name_space) == 0) n++;
+    }
+    portEXIT_CRITICAL(&s_nvs_mux);
+    return n;
+}
@@ -0,0 +1,126 @@
+// fuzz target for the ie parser. built with clang and HOST_FUZZ=ON it is a
+// libfuzzer target; otherwise main() below runs files given on the command
+// line (afl-style, `fuzz_wifi_ie @@`) or, with no arguments, a seeded
+// mutation loop over the frame corpus so ctest exercises it on every build.
+
+#include "core/wifi_ie.h"
+#include "host_test.h"
+
+static void check_inside(const uint8_t *base, size_t len, const uint8_t *p, size_t n) {
+    if (!n) return;
+    if (p < base || p + n > base + len) abort();
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    wifi_ie_info_t info;
+    char ssid[33];
+
+    if (wifi_ie_parse_mgmt(data, size, &info)) {
+        check_inside(data, size, info.ssid, info.ssid_len);
+        check_inside(data, size, info.wps, info.wps_len);
+        if (info.ssid_len > 32 || info.vendor_oui_count > WIFI_IE_MAX_VENDOR_OUIS) abort();
+        if (wifi_ie_copy_ssid(&info, ssid, sizeof(ssid)) != info.ssid_len) abort();
+        wifi_ie_security_label(&info);
+    }
+
+    memset(&info, 0, sizeof(info));
+    wifi_ie_parse(data, size, &info);
+    check_inside(data, size, info.ssid, info.ssid_len);
+    check_inside(data, size, info.wps, info.wps_len);
+    return 0;
+}
+
+#ifndef HOST_FUZZ_LIBFUZZER
+
+static uint32_t rng_state = 0x9e3779b9;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// run on an exact-size heap copy so asan catches reads past the end
+static void run_one(const uint8_t *data, size_t size) {
+    uint8_t *copy = malloc(size ? size : 1);
+    memcpy(copy, data, size);
+    LLVMFuzzerTestOneInput(copy, size);
+    free(copy);
+}
+
+static void run_file(const char *path) {
+    static uint8_t buf[4096];
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    size_t n = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+    run_one(buf, n);
+}
+
+static void mutate(uint8_t *buf, size_t *len, size_t cap) {
+    switch (rng() % 5) {
+    case 0: // flip a bit
+        if (*len) buf[rng() % *len] ^= (uint8_t)(1u << (rng() % 8));
+        break;
+    case 1: // interesting byte, aimed at length fields
+        if (*len) buf[rng() % *len] = (uint8_t[]){0x00, 0x01, 0x02, 0x7f, 0x80, 0xfe, 0xff}[rng() % 7];
+        break;
+    case 2: // truncate
+        if (*len) *len = rng() % *len;
+        break;
+    case 3: // duplicate a chunk onto the end
+        if (*len && *len < cap) {
+            size_t from = rng() % *len;
+            size_t n = rng() % (*len - from) + 1;
+            if (n > cap - *len) n = cap - *len;
+            memcpy(buf + *len, buf + from, n);
+            *len += n;
+        }
+        break;
+    default: // random byte
+        if (*len) buf[rng() % *len] = (uint8_t)rng();
+        break;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) run_file(argv[i]);
+        return 0;
+    }
+
+    static uint8_t seeds[128][512];
+    static size_t seed_len[128];
+    size_t nseeds = 0;
+    host_pcap_t pcap;
+    host_pcap_pkt_t pkt;
+    if (host_pcap_open(&pcap, host_data_path("mgmt_frames.pcap")) != 0) {
+        fprintf(stderr, "cannot open mgmt_frames.pcap\n");
+        return 1;
+    }
+    while (nseeds < 128 && host_pcap_next(&pcap, &pkt) == 1) {
+        if (pkt.len > sizeof(seeds[0])) continue;
+        memcpy(seeds[nseeds], pkt.frame, pkt.len);
+        seed_len[nseeds++] = pkt.len;
+    }
+    host_pcap_close(&pcap);
+
+    const char *env = getenv("FUZZ_ITERATIONS");
+    long iterations = env ? atol(env) : 200000;
+    uint8_t buf[1024];
+    for (long i = 0; i < iterations; i++) {
+        size_t s = rng() % nseeds;
+        size_t len = seed_len[s];
+        memcpy(buf, seeds[s], len);
+        for (uint32_t m = rng() % 8 + 1; m; m--) mutate(buf, &len, sizeof(buf));
+        run_one(buf, len);
+    }
+    printf("fuzz_wifi_ie: %ld inputs from %zu seeds\n", iterations, nseeds);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+// tiny helpers shared by the host tests: checks that count failures instead
+// of aborting, a monotonic clock for the benchmarks and a pcap reader for the
+// frame corpora under data/. plain c, no esp headers.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static int host_test_failures __attribute__((unused));
+
+#define CHECK(cond)                                                            \
+    do {                                                                       \
+        if (!(cond)) {                                                         \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            host_test_failures++;                                              \
+        }                                                                      \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                         \
+    do {                                                                       \
+        long long _a = (long long)(a), _b = (long long)(b);                    \
+        if (_a != _b) {                                                        \
+            fprintf(stderr, "%s:%d: %s == %s failed: %lld != %lld\n", __FILE__, \
+                    __LINE__, #a, #b, _a, _b);                                 \
+            host_test_failures++;                                              \
+        }                                                                      \
+    } while (0)
+
+#define CHECK_STR(a, b)                                                        \
+    do {                                                                       \
+        const char *_a = (a), *_b = (b);                                       \
+        if (!_a || !_b || strcmp(_a, _b) != 0) {                               \
+            fprintf(stderr, "%s:%d: %s == \"%s\" failed: got \"%s\"\n", __FILE__, \
+                    __LINE__, #a, _b ? _b : "(null)", _a ? _a : "(null)");     \
+            host_test_failures++;                                              \
+        }                                                                      \
+    } while (0)
+
+// return value for main()
+#define HOST_TEST_RESULT()                                                     \
+    (host_test_failures ? (fprintf(stderr, "%d check(s) failed\n", host_test_failures), 1) : 0)
+
+static inline int64_t host_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// path of a corpus file; tests run with data/ reachable from the source dir
+static inline const char *host_data_path(const char *name) {
+    static char path[512];
+    const char *dir = getenv("HOST_TEST_DATA");
+    snprintf(path, sizeof(path), "%s/%s", dir ? dir : "data", name);
+    return path;
+}
+
+// --- pcap (little endian, microsecond, radiotap or raw 802.11) ---
+
+#define HOST_PCAP_LINKTYPE_80211 105
+#define HOST_PCAP_LINKTYPE_RADIOTAP 127
+
+typedef struct {
+    FILE *f;
+    uint32_t linktype;
+    uint8_t buf[65536];
+} host_pcap_t;
+
+typedef struct {
+    int64_t ts_us;
+    const uint8_t *frame; // 802.11 header onwards, radiotap stripped
+    uint32_t len;         // includes the fcs when the capture has one
+    int8_t rssi;          // dbm antenna signal from radiotap, 0 if absent
+    uint16_t freq_mhz;    // from radiotap, 0 if absent
+} host_pcap_pkt_t;
+
+static inline int host_pcap_open(host_pcap_t *p, const char *path) {
+    uint32_t hdr[6];
+    p->f = fopen(path, "rb");
+    if (!p->f) return -1;
+    if (fread(hdr, 4, 6, p->f) != 6 || hdr[0] != 0xa1b2c3d4) {
+        fclose(p->f);
+        p->f = NULL;
+        return -1;
+    }
+    p->linktype = hdr[5];
+    return 0;
+}
+
+static inline void host_pcap_close(host_pcap_t *p) {
+    if (p->f) fclose(p->f);
+    p->f = NULL;
+}
+
+// walk the radiotap fields we care about; the field table is just enough for
+// the present bits below channel/signal
+static inline void host_radiotap(const uint8_t *rt, uint32_t rt_len, host_pcap_pkt_t *pkt) {
+    static const uint8_t align[] = {8, 1, 1, 2, 1, 1};
+    static const uint8_t size[] = {8, 1, 1, 4, 2, 1};
+    uint32_t present = rt[4] | rt[5] << 8 | rt[6] << 16 | (uint32_t)rt[7] << 24;
+    uint32_t pos = 8;
+    for (int bit = 0; bit <= 5; bit++) {
+        if (!(present & (1u << bit))) continue;
+        pos = (pos + align[bit] - 1) & ~(uint32_t)(align[bit] - 1);
+        if (pos + size[bit] > rt_len) return;
+        if (bit == 3) pkt->freq_mhz = (uint16_t)(rt[pos] | rt[pos + 1] << 8);
+        if (bit == 5) pkt->rssi = (int8_t)rt[pos];
+        pos += size[bit];
+    }
+}
+
+// 1 with a packet, 0 at the end of the file, -1 on a malformed record
+static inline int host_pcap_next(host_pcap_t *p, host_pcap_pkt_t *pkt) {
+    uint32_t rec[4];
+    if (fread(rec, 4, 4, p->f) != 4) return 0;
+    if (rec[2] > sizeof(p->buf) || fread(p->buf, 1, rec[2], p->f) != rec[2]) return -1;
+    memset(pkt, 0, sizeof(*pkt));
+    pkt->ts_us = (int64_t)rec[0] * 1000000 + rec[1];
+    pkt->frame = p->buf;
+    pkt->len = rec[2];
+    if (p->linktype == HOST_PCAP_LINKTYPE_RADIOTAP) {
+        if (rec[2] < 8) return -1;
+        uint32_t rt_len = p->buf[2] | p->buf[3] << 8;
+        if (rt_len < 8 || rt_len > rec[2]) return -1;
+        host_radiotap(p->buf, rt_len, pkt);
+        pkt->frame += rt_len;
+        pkt->len -= rt_len;
+    }
+    return 1;
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,112 @@
+#ifndef IR_DECODER_REF_H
+#define IR_DECODER_REF_H
+
+// the decode loop infrared_decoder_decode used before the preamble dispatch,
+// every timing to every protocol decoder, kept as the reference for
+// test_infrared_decoder and bench_infrared_decoder; and the capture corpus
+// in data/ir_frames.txt (see data/gen_ir_frames.py) they replay, which
+// test_infrared_edge_ring also times through the receive path.
+
+#include "managers/infrared_decoder.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static InfraredDecodedMessage *ref_decoder_decode(InfraredDecoderContext *decoder, bool level,
+                                                  uint32_t timing) {
+    for (int i = 0; i < decoder->decoder_count; i++) {
+        InfraredCommonDecoder *d = decoder->decoders[i];
+        if (!d || !d->protocol) continue;
+        InfraredDecoderStatus status = d->protocol->decode(d, level, timing);
+        if (status == InfraredDecoderStatusError) {
+            infrared_common_decoder_reset(d);
+        } else if (status == InfraredDecoderStatusReady && d->protocol->interpret &&
+                   d->protocol->interpret(d)) {
+            decoder->last_message = d->message;
+            return &decoder->last_message;
+        }
+    }
+    return NULL;
+}
+
+#define IR_MAX_FRAME_TIMINGS 256
+
+typedef struct {
+    char expect[48]; // "NEC 0x04 0x08", "... repeat" or "none"
+    uint32_t *timings;
+    size_t timing_count;
+} ir_frame_t;
+
+typedef struct {
+    char name[32];
+    ir_frame_t *frames;
+    size_t frame_count;
+} ir_capture_t;
+
+static void ir_trim(char *s) {
+    size_t n = strlen(s);
+    while (n && (s[n - 1] == '\n' || s[n - 1] == '\r')) s[--n] = '\0';
+}
+
+// the corpus as captures; NULL when the file can't be read
+static ir_capture_t *ir_load_captures(const char *path, size_t *count) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return NULL;
+    }
+    ir_capture_t *caps = NULL;
+    size_t n = 0;
+    char expect[48] = "none";
+    static char line[8192];
+    while (fgets(line, sizeof(line), f)) {
+        ir_trim(line);
+        if (strncmp(line, "capture ", 8) == 0) {
+            caps = realloc(caps, (n + 1) * sizeof(*caps));
+            memset(&caps[n], 0, sizeof(caps[n]));
+            snprintf(caps[n].name, sizeof(caps[n].name), "%.31s", line + 8);
+            n++;
+        } else if (strncmp(line, "expect ", 7) == 0) {
+            snprintf(expect, sizeof(expect), "%.47s", line + 7);
+        } else if (strncmp(line, "frame ", 6) == 0 && n) {
+            ir_capture_t *c = &caps[n - 1];
+            c->frames = realloc(c->frames, (c->frame_count + 1) * sizeof(*c->frames));
+            ir_frame_t *fr = &c->frames[c->frame_count++];
+            snprintf(fr->expect, sizeof(fr->expect), "%s", expect);
+            fr->timings = malloc(IR_MAX_FRAME_TIMINGS * sizeof(uint32_t));
+            fr->timing_count = 0;
+            char *p = line + 6;
+            while (*p && fr->timing_count < IR_MAX_FRAME_TIMINGS) {
+                char *end;
+                unsigned long v = strtoul(p, &end, 10);
+                if (end == p) break;
+                fr->timings[fr->timing_count++] = (uint32_t)v;
+                p = end;
+            }
+        }
+    }
+    fclose(f);
+    *count = n;
+    return caps;
+}
+
+static void ir_free_captures(ir_capture_t *caps, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        for (size_t k = 0; k < caps[i].frame_count; k++) free(caps[i].frames[k].timings);
+        free(caps[i].frames);
+    }
+    free(caps);
+}
+
+// "<protocol> 0x<address> 0x<command>[ repeat]", the form expect lines use
+static void ir_format_message(char *out, size_t size, const InfraredDecodedMessage *m) {
+    if (!m) {
+        snprintf(out, size, "none");
+        return;
+    }
+    snprintf(out, size, "%s 0x%02lx 0x%02lx%s", infrared_protocol_to_string(m->protocol),
+             (unsigned long)m->address, (unsigned long)m->command, m->repeat ? " repeat" : "");
+}
+
+#endif // IR_DECODER_REF_H
@@ -0,0 +1,166 @@
+#ifndef IR_FILE_REF_H
+#define IR_FILE_REF_H
+
+// the .ir parser infrared_manager_read_list used before managers/infrared_file.c:
+// the whole file read into one buffer and split with strtok_r. kept as the
+// reference for test_infrared_file and bench_infrared_file. it loops forever
+// on a data line with letters in it, so it only ever sees well-formed files.
+
+#include "managers/infrared_manager.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// infrared_manager.c is not built on the host; this is its free
+void infrared_manager_free_signal(infrared_signal_t *signal) {
+    if (!signal) return;
+    if (signal->is_raw && signal->payload.raw.timings) {
+        free(signal->payload.raw.timings);
+        signal->payload.raw.timings = NULL;
+        signal->payload.raw.timings_size = 0;
+    }
+}
+
+static void ref_free_signals(infrared_signal_t *list, size_t count) {
+    if (!list) return;
+    for (size_t i = 0; i < count; i++) infrared_manager_free_signal(&list[i]);
+    free(list);
+}
+
+static char *ref_read_file(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    if (size <= 0) {
+        fclose(f);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_SET);
+    char *buf = malloc(size + 1);
+    if (!buf || fread(buf, 1, size, f) != (size_t)size) {
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    buf[size] = '\0';
+    fclose(f);
+    return buf;
+}
+
+// little endian hex bytes, as the old parser read address and command
+static uint32_t ref_hex_bytes(const char *value) {
+    uint32_t v = 0;
+    uint8_t shift = 0;
+    const char *p = value;
+    char *end;
+    while (*p) {
+        while (*p && isspace((unsigned char)*p)) p++;
+        if (!*p) break;
+        unsigned long b = strtoul(p, &end, 16);
+        v |= (uint32_t)(b & 0xFF) << shift;
+        shift += 8;
+        p = end;
+    }
+    return v;
+}
+
+static bool ref_push(infrared_signal_t **list, size_t *count, size_t *capacity,
+                     infrared_signal_t *sig) {
+    if (*count == *capacity) {
+        size_t new_cap = *capacity ? *capacity * 2 : 4;
+        infrared_signal_t *tmp = realloc(*list, new_cap * sizeof(infrared_signal_t));
+        if (!tmp) return false;
+        *list = tmp;
+        *capacity = new_cap;
+    }
+    (*list)[(*count)++] = *sig;
+    return true;
+}
+
+static bool ref_parse_ir_file(char *buf, infrared_signal_t **signals, size_t *count) {
+    infrared_signal_t *list = NULL;
+    size_t list_count = 0, list_capacity = 0;
+    infrared_signal_t current;
+    bool in_block = false;
+    char *saveptr;
+
+    for (char *line = strtok_r(buf, "\r\n", &saveptr); line;
+         line = strtok_r(NULL, "\r\n", &saveptr)) {
+        char *s = line;
+        while (*s && isspace((unsigned char)*s)) s++;
+        if (*s == '\0' || *s == '#') continue;
+        char *colon = strchr(s, ':');
+        if (!colon) continue;
+        *colon = '\0';
+        char *key = s, *value = colon + 1;
+        char *end = key + strlen(key) - 1;
+        while (end > key && isspace((unsigned char)*end)) *end-- = '\0';
+        while (*value && isspace((unsigned char)*value)) value++;
+        char *v_end = value + strlen(value) - 1;
+        while (v_end > value && isspace((unsigned char)*v_end)) *v_end-- = '\0';
+
+        if (strcmp(key, "name") == 0) {
+            if (in_block && !ref_push(&list, &list_count, &list_capacity, &current)) break;
+            memset(&current, 0, sizeof(current));
+            in_block = true;
+            strncpy(current.name, value, sizeof(current.name) - 1);
+        } else if (in_block && strcmp(key, "type") == 0) {
+            current.is_raw = (strcmp(value, "raw") == 0);
+        } else if (in_block && current.is_raw) {
+            if (strcmp(key, "frequency") == 0) {
+                current.payload.raw.frequency = (uint32_t)strtoul(value, NULL, 10);
+            } else if (strcmp(key, "duty_cycle") == 0) {
+                current.payload.raw.duty_cycle = strtof(value, NULL);
+            } else if (strcmp(key, "data") == 0) {
+                size_t n = 0;
+                for (const char *p = value; *p;) {
+                    while (*p && isspace((unsigned char)*p)) p++;
+                    if (!*p) break;
+                    n++;
+                    while (*p && !isspace((unsigned char)*p)) p++;
+                }
+                uint32_t *timings = malloc(sizeof(uint32_t) * n);
+                size_t i = 0;
+                char *endptr;
+                for (const char *p = value; *p && timings;) {
+                    while (*p && isspace((unsigned char)*p)) p++;
+                    if (!*p) break;
+                    timings[i++] = (uint32_t)strtoul(p, &endptr, 10);
+                    p = endptr;
+                }
+                current.payload.raw.timings = timings;
+                current.payload.raw.timings_size = n;
+            }
+        } else if (in_block) {
+            if (strcmp(key, "protocol") == 0) {
+                strncpy(current.payload.message.protocol, value,
+                        sizeof(current.payload.message.protocol) - 1);
+            } else if (strcmp(key, "address") == 0) {
+                current.payload.message.address = ref_hex_bytes(value);
+            } else if (strcmp(key, "command") == 0) {
+                current.payload.message.command = ref_hex_bytes(value);
+            }
+        }
+    }
+    if (in_block) ref_push(&list, &list_count, &list_capacity, &current);
+    if (list_count == 0) {
+        ref_free_signals(list, list_count);
+        return false;
+    }
+    *signals = list;
+    *count = list_count;
+    return true;
+}
+
+// what infrared_manager_read_list did for an .ir file
+static bool ref_read_list(const char *path, infrared_signal_t **signals, size_t *count) {
+    char *buf = ref_read_file(path);
+    if (!buf) return false;
+    bool ok = ref_parse_ir_file(buf, signals, count);
+    free(buf);
+    return ok;
+}
+
+#endif // IR_FILE_REF_H
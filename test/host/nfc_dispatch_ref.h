@@ -0,0 +1,73 @@
+#ifndef NFC_DISPATCH_REF_H
+#define NFC_DISPATCH_REF_H
+
+// flipper_nfc_try_parse_mfclassic_from_cache as it was before the parser
+// registry and its quick checks: every plugin in turn, each handed a fresh
+// string and a full parse, the first that succeeds wins. kept as the
+// reference for test_flipper_nfc_compat and bench_flipper_nfc; it also
+// reports which parser won.
+
+#include "managers/nfc/flipper_nfc_compat.h"
+#include <stdlib.h>
+#include <string.h>
+
+// private to flipper_nfc_compat.c; the same layout, so the parsers can be
+// called one by one without going through the dispatcher
+struct NfcDevice {
+    NfcProtocol protocol;
+    void *data;
+};
+
+extern const NfcSupportedCardsPlugin smartrider_plugin, aime_plugin, csc_plugin, washcity_plugin,
+    metromoney_plugin, bip_plugin, charliecard_plugin, disney_infinity_plugin, hi_plugin,
+    hid_plugin, hworld_plugin, kazan_plugin, microel_plugin, mizip_plugin, plantain_plugin,
+    saflok_plugin, skylanders_plugin, social_moscow_plugin, troika_plugin, two_cities_plugin,
+    umarsh_plugin, zolotaya_korona_plugin, zolotaya_korona_online_plugin;
+
+#define REF_PARSER(name) {#name, &name##_plugin}
+
+// the order the dispatcher has always used
+static const struct {
+    const char *name;
+    const NfcSupportedCardsPlugin *plugin;
+} ref_parsers[] = {
+    REF_PARSER(smartrider),      REF_PARSER(aime),       REF_PARSER(csc),
+    REF_PARSER(washcity),        REF_PARSER(metromoney), REF_PARSER(bip),
+    REF_PARSER(charliecard),     REF_PARSER(disney_infinity), REF_PARSER(hi),
+    REF_PARSER(hid),             REF_PARSER(hworld),     REF_PARSER(kazan),
+    REF_PARSER(microel),         REF_PARSER(mizip),      REF_PARSER(plantain),
+    REF_PARSER(saflok),          REF_PARSER(skylanders), REF_PARSER(social_moscow),
+    REF_PARSER(troika),          REF_PARSER(two_cities), REF_PARSER(umarsh),
+    REF_PARSER(zolotaya_korona), REF_PARSER(zolotaya_korona_online),
+};
+
+static char *ref_try_parse_sequential(const MfClassicData *data, const char **parsed_by) {
+    if (parsed_by) *parsed_by = "none";
+    if (!data || data->uid_len == 0) return NULL;
+
+    NfcDevice dev = {NfcProtocolMfClassic, (void *)data};
+    FuriStringArena *arena = furi_string_arena_alloc(1024);
+    FuriStringArena *prev = furi_string_arena_set_current(arena);
+    char *result_copy = NULL;
+
+    for (size_t i = 0; i < COUNT_OF(ref_parsers); i++) {
+        const NfcSupportedCardsPlugin *p = ref_parsers[i].plugin;
+        if (p->protocol != NfcProtocolMfClassic || !p->parse) continue;
+        FuriString *out = furi_string_alloc();
+        if (!out) break;
+        bool parsed = p->parse(&dev, out);
+        if (parsed) {
+            const char *res = furi_string_get_cstr(out);
+            if (res && strlen(res) > 0) result_copy = strdup(res);
+            if (parsed_by) *parsed_by = ref_parsers[i].name;
+        }
+        furi_string_free(out);
+        if (parsed) break;
+    }
+
+    furi_string_arena_set_current(prev);
+    furi_string_arena_free(arena);
+    return result_copy;
+}
+
+#endif // NFC_DISPATCH_REF_H
@@ -0,0 +1,104 @@
+#ifndef NFC_DUMP_H
+#define NFC_DUMP_H
+
+// saved flipper .nfc mifare classic dumps (data/nfc/, see
+// data/gen_nfc_dumps.py) turned into the MfClassicData the parsers see, the
+// way nfc_view.c's build_mfc_details_from_file does it: the type from the
+// SAK, a block counts as read only when none of its bytes is ??, unknown
+// bytes are 0. used by test_flipper_nfc_compat and bench_flipper_nfc.
+
+#include "managers/nfc/flipper_nfc_compat.h"
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NFC_DUMP_MAX 64
+
+typedef struct {
+    char name[64];   // file name without .nfc
+    char parser[32]; // "# parser:" line, what the dispatcher should settle on
+    MfClassicData data;
+} nfc_dump_t;
+
+static int nfc_blocks_total(MfClassicType type) {
+    return type == MfClassicType4k ? 256 : type == MfClassicTypeMini ? 20 : 64;
+}
+
+static bool nfc_load_dump(const char *path, nfc_dump_t *dump) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+    memset(&dump->data, 0, sizeof(dump->data));
+    snprintf(dump->parser, sizeof(dump->parser), "none");
+    MfClassicData *d = &dump->data;
+    d->type = MfClassicType1k;
+    bool is_mfc = false;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        unsigned v;
+        int n = 0, blk;
+        if (strncmp(line, "# parser: ", 10) == 0) {
+            sscanf(line + 10, "%31s", dump->parser);
+        } else if (strncmp(line, "Device type:", 12) == 0) {
+            is_mfc = strstr(line, "Mifare Classic") != NULL;
+        } else if (strncmp(line, "UID:", 4) == 0) {
+            for (const char *p = line + 4; d->uid_len < sizeof(d->uid) &&
+                                           sscanf(p, " %2x%n", &v, &n) == 1;
+                 p += n) {
+                d->uid[d->uid_len++] = (uint8_t)v;
+            }
+        } else if (sscanf(line, "SAK: %2x", &v) == 1) {
+            d->type = v == 0x18   ? MfClassicType4k
+                      : v == 0x09 ? MfClassicTypeMini
+                                  : MfClassicType1k;
+        } else if (sscanf(line, "Block %d:%n", &blk, &n) == 1 && blk >= 0 &&
+                   blk < nfc_blocks_total(d->type)) {
+            const char *p = line + n;
+            bool complete = true;
+            for (int i = 0; i < 16; i++) {
+                int used = 0;
+                while (*p == ' ') p++;
+                if (p[0] == '?' && p[1] == '?') {
+                    complete = false;
+                    p += 2;
+                } else if (sscanf(p, "%2x%n", &v, &used) == 1) {
+                    d->block[blk].data[i] = (uint8_t)v;
+                    p += used;
+                } else {
+                    complete = false;
+                    break;
+                }
+            }
+            if (complete) d->block_read_mask[blk / 8] |= 1U << (blk % 8);
+        }
+    }
+    fclose(f);
+    return is_mfc;
+}
+
+static int nfc_dump_filter(const struct dirent *e) {
+    size_t len = strlen(e->d_name);
+    return len > 4 && strcmp(e->d_name + len - 4, ".nfc") == 0;
+}
+
+// every dump in dir, in name order; returns how many were loaded
+static size_t nfc_load_dumps(const char *dir, nfc_dump_t *dumps, size_t max) {
+    struct dirent **names;
+    int n = scandir(dir, &names, nfc_dump_filter, alphasort);
+    if (n < 0) return 0;
+    size_t count = 0;
+    for (int i = 0; i < n; i++) {
+        char path[512];
+        int len = snprintf(path, sizeof(path), "%s/%s", dir, names[i]->d_name);
+        if (len < (int)sizeof(path) && count < max && nfc_load_dump(path, &dumps[count])) {
+            snprintf(dumps[count].name, sizeof(dumps[count].name), "%.*s",
+                     (int)strlen(names[i]->d_name) - 4, names[i]->d_name);
+            count++;
+        }
+        free(names[i]);
+    }
+    free(names);
+    return count;
+}
+
+#endif // NFC_DUMP_H
@@ -0,0 +1,145 @@
+// esp-idf stand-ins for the gps receiver path, test_nmea_parser and the gps
+// benches: uart, event loop, clock and the parser task, driven through
+// host_gps_uart.h. the parser task is never started; callers step the rx path
+// themselves.
+
+#include "host_gps_uart.h"
+#include "core/uart_share.h"
+#include "driver/uart.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include <stdlib.h>
+#include <string.h>
+
+host_gps_uart_t host_gps_uart;
+host_gps_events_t host_gps_events;
+int64_t host_gps_now_us = 1000000;
+
+int64_t esp_timer_get_time(void) {
+    return host_gps_now_us;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(host_gps_now_us / 1000 / portTICK_PERIOD_MS);
+}
+
+void vTaskDelay(TickType_t ticks) {
+    host_gps_now_us += (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+}
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                               UBaseType_t prio, StackType_t *stack_buf, StaticTask_t *tcb) {
+    return tcb; // never started, the test calls into the rx path itself
+}
+
+void vTaskDelete(TaskHandle_t task) {
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) {
+    return pdFALSE;
+}
+
+esp_err_t uart_share_ensure_installed(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size,
+                                      int event_queue_size) {
+    return ESP_OK;
+}
+
+esp_err_t uart_share_acquire(uart_port_t uart_num, uart_share_owner_t owner, TickType_t timeout) {
+    return ESP_OK;
+}
+
+esp_err_t uart_share_release(uart_port_t uart_num, uart_share_owner_t owner) {
+    return ESP_OK;
+}
+
+QueueHandle_t uart_share_get_event_queue(uart_port_t uart_num) {
+    static int queue;
+    return (QueueHandle_t)&queue;
+}
+
+esp_err_t uart_param_config(uart_port_t uart_num, const uart_config_t *config) {
+    return ESP_OK;
+}
+
+esp_err_t uart_set_pin(uart_port_t uart_num, int tx, int rx, int rts, int cts) {
+    return ESP_OK;
+}
+
+esp_err_t uart_set_baudrate(uart_port_t uart_num, uint32_t baud_rate) {
+    if (host_gps_uart.baud_sets < 16) host_gps_uart.bauds[host_gps_uart.baud_sets] = baud_rate;
+    host_gps_uart.baud_sets++;
+    return ESP_OK;
+}
+
+int uart_read_bytes(uart_port_t uart_num, void *buf, uint32_t length, TickType_t wait) {
+    size_t n = host_gps_uart.len - host_gps_uart.pos;
+    if (n > length) n = length;
+    if (n > host_gps_uart.chunk) n = host_gps_uart.chunk;
+    memcpy(buf, host_gps_uart.data + host_gps_uart.pos, n);
+    host_gps_uart.pos += n;
+    return (int)n;
+}
+
+int uart_write_bytes(uart_port_t uart_num, const void *src, size_t size) {
+    host_gps_uart.writes++;
+    return (int)size;
+}
+
+esp_err_t uart_wait_tx_done(uart_port_t uart_num, TickType_t wait) {
+    return ESP_OK;
+}
+
+esp_err_t uart_flush(uart_port_t uart_num) {
+    return ESP_OK;
+}
+
+esp_err_t uart_flush_input(uart_port_t uart_num) {
+    return ESP_OK;
+}
+
+esp_err_t uart_disable_pattern_det_intr(uart_port_t uart_num) {
+    return ESP_OK;
+}
+
+esp_err_t esp_event_loop_create(const esp_event_loop_args_t *args, esp_event_loop_handle_t *out) {
+    static int loop;
+    *out = &loop;
+    return ESP_OK;
+}
+
+esp_err_t esp_event_loop_delete(esp_event_loop_handle_t loop) {
+    return ESP_OK;
+}
+
+esp_err_t esp_event_loop_run(esp_event_loop_handle_t loop, TickType_t ticks) {
+    return ESP_OK;
+}
+
+esp_err_t esp_event_post_to(esp_event_loop_handle_t loop, esp_event_base_t base, int32_t id,
+                            const void *data, size_t size, TickType_t wait) {
+    if (id == GPS_UPDATE) {
+        if (size != sizeof(gps_t)) abort(); // the fix changed shape under the parser
+        memcpy(&host_gps_events.last, data, sizeof(gps_t));
+        host_gps_events.updates++;
+    } else {
+        host_gps_events.unknown++;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_event_handler_register_with(esp_event_loop_handle_t loop, esp_event_base_t base,
+                                          int32_t id, esp_event_handler_t handler, void *arg) {
+    return ESP_OK;
+}
+
+esp_err_t esp_event_handler_unregister_with(esp_event_loop_handle_t loop, esp_event_base_t base,
+                                            int32_t id, esp_event_handler_t handler) {
+    return ESP_OK;
+}
@@ -0,0 +1,66 @@
+#ifndef OUIS_REF_H
+#define OUIS_REF_H
+
+// the strstr scan over the embedded json that the generated table replaced,
+// kept as the reference for test_ouis and bench_ouis. reads the json from
+// OUIS_JSON instead of the linked blob.
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef OUIS_JSON
+#error "OUIS_JSON must point at core/ouis.json"
+#endif
+
+static char *json_buf;
+static size_t json_len;
+
+static void ref_caps(char *s) {
+    bool new_word = true;
+    for (size_t i = 0; s[i]; ++i) {
+        if (s[i] == ' ' || s[i] == '-' || s[i] == '_') { new_word = true; continue; }
+        if (new_word) { s[i] = (char)toupper((unsigned char)s[i]); new_word = false; }
+        else { s[i] = (char)tolower((unsigned char)s[i]); }
+    }
+}
+
+static bool ref_lookup(const char *prefix6, char *out, size_t out_sz) {
+    const char *end = json_buf + json_len;
+    char keypat[16];
+    snprintf(keypat, sizeof(keypat), "\"%.6s\"", prefix6);
+    const char *k = strstr(json_buf, keypat);
+    if (!k) return false;
+    const char *colon = strchr(k + strlen(keypat), ':');
+    if (!colon || colon >= end) return false;
+    const char *q1 = strchr(colon + 1, '"');
+    if (!q1 || q1 >= end) return false;
+    const char *q2 = strchr(q1 + 1, '"');
+    if (!q2 || q2 >= end) return false;
+    size_t vlen = (size_t)(q2 - (q1 + 1));
+    if (vlen >= out_sz) vlen = out_sz - 1;
+    memcpy(out, q1 + 1, vlen);
+    out[vlen] = '\0';
+    ref_caps(out);
+    return true;
+}
+
+static bool ref_load_json(void) {
+    FILE *f = fopen(OUIS_JSON, "rb");
+    if (!f) {
+        perror(OUIS_JSON);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    json_len = (size_t)ftell(f);
+    rewind(f);
+    json_buf = malloc(json_len + 1);
+    json_len = fread(json_buf, 1, json_len, f);
+    json_buf[json_len] = '\0';
+    fclose(f);
+    return true;
+}
+
+#endif // OUIS_REF_H
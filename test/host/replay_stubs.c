@@ -0,0 +1,89 @@
+// firmware stand-ins for test_wifi_replay: what callbacks.c and
+// wifi_station_sniffer.c call outside themselves. outputs are recorded in
+// host_replay instead of going to the display, the sd card or the gps logger.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "core/glog.h"
+#include "core/utils.h"
+#include "host_replay.h"
+#include "managers/gps_manager.h"
+#include "managers/rgb_manager.h"
+#include "managers/wifi_manager.h"
+#include "vendor/pcap.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+void host_replay_log_append(const char *fmt, va_list ap);
+
+// wifi_manager.c
+uint16_t ap_count;
+wifi_ap_record_t *scanned_aps;
+station_ap_pair_t station_ap_list[MAX_STATIONS];
+int station_count;
+
+void wifi_manager_stop_monitor_mode(void) {
+}
+
+// gps_manager.c
+nmea_parser_handle_t nmea_hdl;
+
+esp_err_t gps_manager_log_wardriving_data(wardriving_data_t *data) {
+    if (host_replay.row_count >= HOST_REPLAY_ROWS_MAX) return ESP_ERR_NO_MEM;
+    host_replay_row_t *row = &host_replay.rows[host_replay.row_count++];
+    memcpy(row->bssid, data->bssid_addr, 6);
+    snprintf(row->ssid, sizeof(row->ssid), "%.32s", data->ssid);
+    snprintf(row->encryption, sizeof(row->encryption), "%s", data->encryption_type);
+    row->channel = data->channel;
+    row->rssi = data->rssi;
+    return ESP_OK;
+}
+
+// gps_logger.c
+size_t csv_get_pending_bytes(void) {
+    return 0;
+}
+
+void gps_logger_record_fix(const gps_t *gps) {
+}
+
+// pcap.c
+esp_err_t pcap_write_packet_to_buffer(const void *packet, size_t length,
+                                      pcap_capture_type_t capture_type) {
+    host_replay.pcap_frames++;
+    return ESP_OK;
+}
+
+esp_err_t pcap_flush_buffer_to_file(void) {
+    return ESP_OK;
+}
+
+bool pcap_is_capturing(void) {
+    return true;
+}
+
+// rgb_manager.c
+RGBManager_t rgb_manager;
+
+void pulse_once(RGBManager_t *rgb_manager, uint8_t red, uint8_t green, uint8_t blue) {
+}
+
+// glog.c
+void glog(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    host_replay_log_append(fmt, ap);
+    va_end(ap);
+}
+
+// utils.c, as is
+void format_mac_address(const uint8_t *mac, char *buffer, size_t buffer_len, bool uppercase) {
+    if (mac == NULL || buffer == NULL || buffer_len < 18) {
+        return;
+    }
+
+    const char *format = uppercase ? "%02X:%02X:%02X:%02X:%02X:%02X"
+                                   : "%02x:%02x:%02x:%02x:%02x:%02x";
+    snprintf(buffer, buffer_len, format, mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
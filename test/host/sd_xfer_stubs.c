@@ -0,0 +1,130 @@
+// firmware stand-ins for test_sd_xfer and bench_sd_xfer: the sd card
+// manager's bus accessors, glog for bus_arbiter.c, and read()/write() wrapped
+// (-Wl,--wrap=read,--wrap=write) to play the card, see host_sd_io.h.
+
+#include "host_sd_io.h"
+#include "core/glog.h"
+#include "managers/sd_card_manager.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+ssize_t __real_read(int fd, void *buf, size_t len);
+ssize_t __real_write(int fd, const void *buf, size_t len);
+
+host_sd_io_t host_sd_io;
+
+static bus_arbiter_t s_arb;
+static bus_client_t *s_clients[BUS_CLASS_COUNT];
+static pthread_once_t s_arb_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t s_io_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void arb_init(void) {
+    static const char *names[BUS_CLASS_COUNT] = {"display", "sd", "sd_bg"};
+    bus_arbiter_init(&s_arb);
+    for (int c = 0; c < BUS_CLASS_COUNT; c++) {
+        s_clients[c] = bus_arbiter_register(&s_arb, names[c], (bus_class_t)c);
+    }
+}
+
+bus_arbiter_t *host_sd_arbiter(void) {
+    pthread_once(&s_arb_once, arb_init);
+    return &s_arb;
+}
+
+void host_sd_io_reset(void) {
+    pthread_mutex_lock(&s_io_lock);
+    memset(&host_sd_io, 0, sizeof(host_sd_io));
+    pthread_mutex_unlock(&s_io_lock);
+}
+
+// sd_card_manager.c
+bus_arbiter_t *sd_card_bus_arbiter(void) {
+    return host_sd_io.shared ? host_sd_arbiter() : NULL;
+}
+
+bus_client_t *sd_card_bus_client(bus_class_t cls) {
+    if (!host_sd_io.shared || cls >= BUS_CLASS_COUNT) return NULL;
+    host_sd_arbiter();
+    return s_clients[cls];
+}
+
+// glog.c
+void glog(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+}
+
+static bool sd_client_owns_bus(void) {
+    bus_arbiter_t *arb = host_sd_arbiter();
+    portENTER_CRITICAL(&arb->mux);
+    bool owns = arb->owner == s_clients[BUS_CLASS_BULK] &&
+                arb->owner_task == xTaskGetCurrentTaskHandle();
+    portEXIT_CRITICAL(&arb->mux);
+    return owns;
+}
+
+// how much of len this call may move, 0 to fail it with errno set
+static size_t card_call(size_t len, bool is_write) {
+    host_sd_io_t *io = &host_sd_io;
+    pthread_mutex_lock(&s_io_lock);
+    uint32_t calls = is_write ? ++io->writes : ++io->reads;
+    size_t moved = is_write ? io->bytes_written : io->bytes_read;
+    if (io->shared && !sd_client_owns_bus()) io->unowned++;
+    if (io->eintr_every && calls % io->eintr_every == 0) {
+        io->eintrs++;
+        pthread_mutex_unlock(&s_io_lock);
+        errno = EINTR;
+        return 0;
+    }
+    if (io->max_io && len > io->max_io) len = io->max_io;
+    if (io->fail_after) {
+        if (moved >= io->fail_after) {
+            pthread_mutex_unlock(&s_io_lock);
+            errno = EIO;
+            return 0;
+        }
+        if (len > io->fail_after - moved) len = io->fail_after - moved;
+    }
+    uint32_t delay = io->delay_us + (uint32_t)((uint64_t)io->us_per_kb * len / 1024);
+    pthread_mutex_unlock(&s_io_lock);
+    if (delay) usleep(delay);
+    return len;
+}
+
+static void card_done(ssize_t n, bool is_write) {
+    if (n <= 0) return;
+    host_sd_io_t *io = &host_sd_io;
+    pthread_mutex_lock(&s_io_lock);
+    if (is_write) {
+        io->bytes_written += (size_t)n;
+        if ((size_t)n > io->max_write) io->max_write = (size_t)n;
+    } else {
+        io->bytes_read += (size_t)n;
+        if ((size_t)n > io->max_read) io->max_read = (size_t)n;
+    }
+    pthread_mutex_unlock(&s_io_lock);
+}
+
+ssize_t __wrap_read(int fd, void *buf, size_t len) {
+    if (len == 0) return __real_read(fd, buf, 0);
+    size_t take = card_call(len, false);
+    if (!take) return -1;
+    ssize_t n = __real_read(fd, buf, take);
+    card_done(n, false);
+    return n;
+}
+
+ssize_t __wrap_write(int fd, const void *buf, size_t len) {
+    if (len == 0) return __real_write(fd, buf, 0);
+    size_t take = card_call(len, true);
+    if (!take) return -1;
+    ssize_t n = __real_write(fd, buf, take);
+    card_done(n, true);
+    return n;
+}
@@ -0,0 +1,53 @@
+// firmware stand-ins for test_settings_manager and bench_settings_manager:
+// what settings_manager.c calls outside itself. the leds and the display are
+// left alone, a restart ends the test.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+#include "managers/display_manager.h"
+#include "managers/rgb_manager.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+RGBManager_t rgb_manager;
+
+void rainbow_task(void *arg) {
+}
+
+esp_err_t rgb_manager_set_color(RGBManager_t *rgb_manager, int led_idx, uint8_t red,
+                                uint8_t green, uint8_t blue, bool pulse) {
+    return ESP_OK;
+}
+
+void rgb_manager_signal_rainbow_exit(void) {
+}
+
+lv_timer_t *lv_timer_create(lv_timer_cb_t cb, uint32_t period, void *user_data) {
+    return NULL;
+}
+
+void lv_timer_del(lv_timer_t *timer) {
+}
+
+void display_manager_update_status_bar_color(void) {
+}
+
+void rainbow_effect_cb(lv_timer_t *timer) {
+}
+
+void esp_restart(void) {
+    fprintf(stderr, "esp_restart called\n");
+    abort();
+}
+
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler) {
+    return ESP_OK;
+}
+
+const char *esp_err_to_name(esp_err_t code) {
+    static __thread char name[16];
+    if (code == ESP_OK) return "ESP_OK";
+    snprintf(name, sizeof(name), "0x%x", (unsigned)code);
+    return name;
+}
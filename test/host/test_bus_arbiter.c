@@ -0,0 +1,413 @@
+// shared bus arbiter (core/bus_arbiter.c) built into the test, so the
+// waiter queues can be inspected, with pthreads as tasks: the order
+// queued waiters get the bus in (class order, fifo within a class, overdue
+// waiters first), yield decisions, nested holds, a hold ended from "isr"
+// context on another thread, the wait histogram and its percentiles, and
+// mixed display / sd / background workloads on a fake bus that fails the
+// test whenever two holders are on it at once.
+
+#include BUS_ARBITER_C
+#include "host_test.h"
+#include <pthread.h>
+#include <stdarg.h>
+#include <unistd.h>
+
+static char s_glog[4096];
+static size_t s_glog_len;
+
+void glog(const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(s_glog + s_glog_len, sizeof(s_glog) - s_glog_len, fmt, ap);
+    va_end(ap);
+    if (n > 0) s_glog_len += (size_t)n;
+    if (s_glog_len >= sizeof(s_glog)) s_glog_len = sizeof(s_glog) - 1;
+}
+
+// ---- fake bus: a holder marks it busy for the length of a transfer ----
+
+static int s_on_bus;
+static int s_overlaps;
+
+static void bus_transfer(useconds_t us) {
+    if (__atomic_exchange_n(&s_on_bus, 1, __ATOMIC_ACQ_REL)) {
+        __atomic_add_fetch(&s_overlaps, 1, __ATOMIC_RELAXED);
+    }
+    if (us) usleep(us);
+    __atomic_store_n(&s_on_bus, 0, __ATOMIC_RELEASE);
+}
+
+static int queued(bus_arbiter_t *arb, bus_class_t cls) {
+    int n = 0;
+    portENTER_CRITICAL(&arb->mux);
+    for (bus_waiter_t *w = arb->head[cls]; w; w = w->next) n++;
+    portEXIT_CRITICAL(&arb->mux);
+    return n;
+}
+
+static void wait_queued(bus_arbiter_t *arb, bus_class_t cls, int n) {
+    for (int i = 0; i < 5000 && queued(arb, cls) < n; i++) usleep(200);
+    CHECK_EQ(queued(arb, cls), n);
+}
+
+// ---- order of service ----
+
+typedef struct {
+    bus_arbiter_t *arb;
+    bus_client_t *client;
+    int id;
+} waiter_arg_t;
+
+static int s_order[16];
+static int s_order_len;
+
+static void *waiter_thread(void *p) {
+    waiter_arg_t *a = p;
+    bus_arbiter_acquire(a->arb, a->client);
+    s_order[s_order_len++] = a->id; // under the bus
+    bus_transfer(100);
+    bus_arbiter_release(a->arb, a->client);
+    return NULL;
+}
+
+// queue one waiter per entry, in order, while the main thread holds the bus
+static void run_queue(bus_arbiter_t *arb, bus_client_t *holder, bus_client_t **clients, int n,
+                      useconds_t gap_us) {
+    pthread_t th[8];
+    waiter_arg_t args[8];
+    int per_class[BUS_CLASS_COUNT] = {0};
+    s_order_len = 0;
+    bus_arbiter_acquire(arb, holder);
+    for (int i = 0; i < n; i++) {
+        args[i] = (waiter_arg_t){arb, clients[i], i};
+        pthread_create(&th[i], NULL, waiter_thread, &args[i]);
+        wait_queued(arb, clients[i]->cls, ++per_class[clients[i]->cls]);
+        if (gap_us) usleep(gap_us);
+    }
+    bus_arbiter_release(arb, holder);
+    for (int i = 0; i < n; i++) pthread_join(th[i], NULL);
+    CHECK_EQ(s_order_len, n);
+    CHECK(arb->owner == NULL);
+}
+
+static void test_order(void) {
+    bus_arbiter_t arb;
+    bus_arbiter_init(&arb);
+    bus_client_t *disp = bus_arbiter_register(&arb, "display", BUS_CLASS_INTERACTIVE);
+    bus_client_t *sd = bus_arbiter_register(&arb, "sd", BUS_CLASS_BULK);
+    bus_client_t *bg = bus_arbiter_register(&arb, "stats", BUS_CLASS_BACKGROUND);
+
+    // class order beats arrival order
+    bus_client_t *mix[] = {bg, sd, disp, sd};
+    run_queue(&arb, sd, mix, 4, 0);
+    CHECK_EQ(s_order[0], 2);
+    CHECK_EQ(s_order[1], 1);
+    CHECK_EQ(s_order[2], 3);
+    CHECK_EQ(s_order[3], 0);
+
+    // fifo within a class
+    bus_client_t *bulk[] = {sd, sd, sd, sd, sd};
+    run_queue(&arb, disp, bulk, 5, 0);
+    for (int i = 0; i < 5; i++) CHECK_EQ(s_order[i], i);
+
+    // a waiter past its class deadline jumps the class order, the longest
+    // overdue first
+    arb.max_wait_us[BUS_CLASS_BACKGROUND] = 2000;
+    arb.max_wait_us[BUS_CLASS_BULK] = 2000;
+    bus_client_t *late[] = {bg, sd, disp};
+    run_queue(&arb, disp, late, 3, 3000);
+    CHECK_EQ(s_order[0], 0);
+    CHECK_EQ(s_order[1], 1);
+    CHECK_EQ(s_order[2], 2);
+    bus_arbiter_init(&arb);
+
+    // a full client table
+    bus_arbiter_t full;
+    bus_arbiter_init(&full);
+    for (int i = 0; i < BUS_ARBITER_MAX_CLIENTS; i++) {
+        CHECK(bus_arbiter_register(&full, "c", BUS_CLASS_BULK) != NULL);
+    }
+    CHECK(bus_arbiter_register(&full, "c", BUS_CLASS_BULK) == NULL);
+    CHECK(bus_arbiter_register(&full, "c", BUS_CLASS_COUNT) == NULL);
+    CHECK(bus_arbiter_register(NULL, "c", BUS_CLASS_BULK) == NULL);
+}
+
+// ---- yield ----
+
+static void *hold_briefly(void *p) {
+    waiter_arg_t *a = p;
+    bus_arbiter_acquire(a->arb, a->client);
+    bus_arbiter_release(a->arb, a->client);
+    return NULL;
+}
+
+static void test_yield(void) {
+    bus_arbiter_t arb;
+    bus_arbiter_init(&arb);
+    bus_client_t *disp = bus_arbiter_register(&arb, "display", BUS_CLASS_INTERACTIVE);
+    bus_client_t *sd = bus_arbiter_register(&arb, "sd", BUS_CLASS_BULK);
+    bus_client_t *bg = bus_arbiter_register(&arb, "stats", BUS_CLASS_BACKGROUND);
+    arb.hold_budget_us[BUS_CLASS_BULK] = 20000;
+
+    // nobody waiting, or not the owner: keep going
+    CHECK(!bus_arbiter_yield(&arb, sd));
+    bus_arbiter_acquire(&arb, sd);
+    CHECK(!bus_arbiter_yield(&arb, sd));
+    CHECK(!bus_arbiter_yield(&arb, disp));
+    CHECK(!bus_arbiter_yield(NULL, sd));
+
+    // a lower class waiting inside the budget: keep the bus (batching)
+    pthread_t th;
+    waiter_arg_t a = {&arb, bg, 0};
+    pthread_create(&th, NULL, hold_briefly, &a);
+    wait_queued(&arb, BUS_CLASS_BACKGROUND, 1);
+    CHECK(!bus_arbiter_yield(&arb, sd));
+    // once the budget is spent it goes, and comes back to us
+    usleep(25000);
+    CHECK(bus_arbiter_yield(&arb, sd));
+    CHECK(arb.owner == sd && arb.depth == 1);
+    pthread_join(th, NULL);
+    CHECK_EQ(bg->acquires, 1);
+
+    // a higher class waiting: hand over at once, budget or not
+    arb.owner_since_us = esp_timer_get_time();
+    a.client = disp;
+    pthread_create(&th, NULL, hold_briefly, &a);
+    wait_queued(&arb, BUS_CLASS_INTERACTIVE, 1);
+    // but never from inside a nested hold
+    bus_arbiter_acquire(&arb, sd);
+    CHECK(!bus_arbiter_yield(&arb, sd));
+    bus_arbiter_release(&arb, sd);
+    CHECK(bus_arbiter_yield(&arb, sd));
+    pthread_join(th, NULL);
+    CHECK_EQ(disp->acquires, 1);
+
+    // a same class waiter inside the budget does not get it
+    arb.owner_since_us = esp_timer_get_time();
+    a.client = sd;
+    pthread_create(&th, NULL, hold_briefly, &a);
+    wait_queued(&arb, BUS_CLASS_BULK, 1);
+    CHECK(!bus_arbiter_yield(&arb, sd));
+    bus_arbiter_release(&arb, sd);
+    pthread_join(th, NULL);
+    CHECK(arb.owner == NULL);
+}
+
+// ---- nesting and isr release ----
+
+static void *release_foreign(void *p) {
+    waiter_arg_t *a = p;
+    bus_arbiter_release(a->arb, a->client); // not the owner task: ignored
+    return NULL;
+}
+
+static void *release_isr(void *p) {
+    waiter_arg_t *a = p;
+    bus_arbiter_release_from_isr(a->arb, a->client);
+    return NULL;
+}
+
+static void test_nesting(void) {
+    bus_arbiter_t arb;
+    bus_arbiter_init(&arb);
+    bus_client_t *disp = bus_arbiter_register(&arb, "display", BUS_CLASS_INTERACTIVE);
+    bus_client_t *sd = bus_arbiter_register(&arb, "sd", BUS_CLASS_BULK);
+
+    for (int i = 0; i < 3; i++) bus_arbiter_acquire(&arb, sd);
+    CHECK_EQ(arb.depth, 3);
+    CHECK_EQ(sd->acquires, 1); // nested holds are not acquisitions
+
+    // a waiter stays queued until the outermost hold ends
+    pthread_t th, other;
+    waiter_arg_t a = {&arb, disp, 0};
+    pthread_create(&th, NULL, hold_briefly, &a);
+    wait_queued(&arb, BUS_CLASS_INTERACTIVE, 1);
+    bus_arbiter_release(&arb, sd);
+    bus_arbiter_release(&arb, sd);
+    CHECK(arb.owner == sd);
+    CHECK_EQ(queued(&arb, BUS_CLASS_INTERACTIVE), 1);
+
+    // another task, or the wrong client, cannot end the hold
+    waiter_arg_t f = {&arb, sd, 0};
+    pthread_create(&other, NULL, release_foreign, &f);
+    pthread_join(other, NULL);
+    bus_arbiter_release(&arb, disp);
+    CHECK(arb.owner == sd && arb.depth == 1);
+
+    bus_arbiter_release(&arb, sd);
+    pthread_join(th, NULL);
+    CHECK(arb.owner == NULL);
+    CHECK_EQ(disp->acquires, 1);
+
+    // a hold handed to a transfer's completion isr: the isr (another
+    // thread here) ends it and the waiter gets the bus from there
+    bus_arbiter_acquire(&arb, disp);
+    bus_arbiter_acquire(&arb, disp);
+    a.client = sd;
+    pthread_create(&th, NULL, hold_briefly, &a);
+    wait_queued(&arb, BUS_CLASS_BULK, 1);
+    waiter_arg_t isr = {&arb, disp, 0};
+    pthread_create(&other, NULL, release_isr, &isr);
+    pthread_join(other, NULL);
+    CHECK(arb.owner == disp && arb.depth == 1); // the inner hold only
+    isr.client = sd;
+    pthread_create(&other, NULL, release_isr, &isr); // not the owner: ignored
+    pthread_join(other, NULL);
+    CHECK(arb.owner == disp);
+    isr.client = disp;
+    pthread_create(&other, NULL, release_isr, &isr);
+    pthread_join(other, NULL);
+    pthread_join(th, NULL);
+    CHECK(arb.owner == NULL);
+    CHECK_EQ(sd->acquires, 2);
+    CHECK(disp->hold_max_us > 0);
+
+    // a NULL arbiter or client is a no-op everywhere
+    bus_arbiter_acquire(NULL, sd);
+    bus_arbiter_acquire(&arb, NULL);
+    bus_arbiter_release(NULL, sd);
+    bus_arbiter_release_from_isr(NULL, sd);
+    CHECK(arb.owner == NULL);
+}
+
+// ---- histogram and percentiles ----
+
+static void test_percentile(void) {
+    bus_client_t c = {0};
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 50), 0);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(NULL, 50), 0);
+    c.acquires = 100;
+    c.hist[0] = 50;  // < 16us
+    c.hist[3] = 40;  // < 128us
+    c.hist[BUS_ARBITER_HIST_BUCKETS - 1] = 10; // open ended
+    c.wait_max_us = 900000;
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 1), 16);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 50), 16);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 51), 128);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 90), 128);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 91), 900000);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 100), 900000);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(&c, 200), 900000);
+
+    // bucket b holds waits below 16 << b
+    bus_client_t r = {0};
+    record_wait(&r, 15);
+    record_wait(&r, 16);
+    record_wait(&r, 31);
+    record_wait(&r, 32);
+    record_wait(&r, 16u << (BUS_ARBITER_HIST_BUCKETS - 2));
+    record_wait(&r, UINT32_MAX);
+    CHECK_EQ(r.hist[0], 1);
+    CHECK_EQ(r.hist[1], 2);
+    CHECK_EQ(r.hist[2], 1);
+    CHECK_EQ(r.hist[BUS_ARBITER_HIST_BUCKETS - 1], 2);
+    CHECK_EQ(r.acquires, 6);
+    CHECK_EQ(r.wait_max_us, UINT32_MAX);
+
+    // real waits land in the bucket of their length
+    bus_arbiter_t arb;
+    bus_arbiter_init(&arb);
+    bus_client_t *sd = bus_arbiter_register(&arb, "sd", BUS_CLASS_BULK);
+    bus_client_t *bg = bus_arbiter_register(&arb, "stats", BUS_CLASS_BACKGROUND);
+    for (int i = 0; i < 10; i++) {
+        pthread_t th;
+        waiter_arg_t a = {&arb, bg, 0};
+        bus_arbiter_acquire(&arb, sd);
+        pthread_create(&th, NULL, hold_briefly, &a);
+        wait_queued(&arb, BUS_CLASS_BACKGROUND, 1);
+        usleep(5000);
+        bus_arbiter_release(&arb, sd);
+        pthread_join(th, NULL);
+    }
+    CHECK_EQ(bg->acquires, 10);
+    CHECK(bg->wait_max_us >= 5000);
+    CHECK(bg->wait_total_us >= 50000);
+    // every wait was at least 5 ms, the bucket bound above that is 8192
+    CHECK(bus_arbiter_wait_percentile_us(bg, 1) >= 8192);
+    CHECK_EQ(bus_arbiter_wait_percentile_us(sd, 100), 16); // never waited
+    CHECK(sd->hold_max_us >= 5000);
+
+    s_glog_len = 0;
+    bus_arbiter_print_stats(&arb);
+    CHECK(strstr(s_glog, "sd ") != NULL && strstr(s_glog, "stats") != NULL);
+    CHECK(strstr(s_glog, "wait histogram") != NULL);
+}
+
+// ---- mixed workloads on the fake bus ----
+
+typedef struct {
+    bus_arbiter_t *arb;
+    bus_client_t *client;
+    volatile bool *stop;
+    useconds_t hold_us, idle_us;
+    int chunks; // > 1: hold across chunks, yielding in between (sd writes)
+    int nested; // extra nested holds per round (sd_card_bus_lock)
+    uint32_t rounds;
+} worker_t;
+
+static void *worker_thread(void *p) {
+    worker_t *w = p;
+    while (!*w->stop) {
+        bus_arbiter_acquire(w->arb, w->client);
+        for (int n = 0; n < w->nested; n++) bus_arbiter_acquire(w->arb, w->client);
+        for (int c = 0; c < w->chunks; c++) {
+            bus_transfer(w->hold_us);
+            if (c + 1 < w->chunks && !w->nested) bus_arbiter_yield(w->arb, w->client);
+        }
+        for (int n = 0; n < w->nested; n++) bus_arbiter_release(w->arb, w->client);
+        bus_arbiter_release(w->arb, w->client);
+        w->rounds++;
+        if (w->idle_us) usleep(w->idle_us);
+    }
+    return NULL;
+}
+
+static void test_mixed(void) {
+    bus_arbiter_t arb;
+    bus_arbiter_init(&arb);
+    bus_client_t *disp = bus_arbiter_register(&arb, "display", BUS_CLASS_INTERACTIVE);
+    bus_client_t *sd = bus_arbiter_register(&arb, "sd", BUS_CLASS_BULK);
+    bus_client_t *bg = bus_arbiter_register(&arb, "stats", BUS_CLASS_BACKGROUND);
+
+    volatile bool stop = false;
+    worker_t w[] = {
+        // two display flushers that keep the bus busy
+        {&arb, disp, &stop, 2000, 0, 1, 0, 0},
+        {&arb, disp, &stop, 2000, 0, 1, 0, 0},
+        // two sd writers in 4 KB chunks, one of them under a nested lock
+        {&arb, sd, &stop, 300, 500, 16, 0, 0},
+        {&arb, sd, &stop, 300, 2000, 4, 2, 0},
+        // housekeeping now and then
+        {&arb, bg, &stop, 200, 5000, 1, 0, 0},
+    };
+    const int n = sizeof(w) / sizeof(w[0]);
+    pthread_t th[8];
+    s_overlaps = 0;
+    for (int i = 0; i < n; i++) pthread_create(&th[i], NULL, worker_thread, &w[i]);
+    usleep(1500 * 1000);
+    stop = true;
+    for (int i = 0; i < n; i++) pthread_join(th[i], NULL);
+
+    CHECK_EQ(s_overlaps, 0);
+    CHECK(arb.owner == NULL);
+    for (int c = 0; c < BUS_CLASS_COUNT; c++) CHECK(arb.head[c] == NULL);
+    // with the display hogging the bus every class still gets through, and
+    // no wait runs far past its class deadline plus one hold
+    for (int i = 0; i < n; i++) CHECK(w[i].rounds > 0);
+    CHECK(sd->wait_max_us < arb.max_wait_us[BUS_CLASS_BULK] + 50000);
+    CHECK(bg->wait_max_us < arb.max_wait_us[BUS_CLASS_BACKGROUND] + 50000);
+    // the display is served ahead of the others when nobody is overdue
+    CHECK(bus_arbiter_wait_percentile_us(disp, 50) <= bus_arbiter_wait_percentile_us(sd, 50));
+    s_glog_len = 0;
+    bus_arbiter_print_stats(&arb);
+    printf("%s", s_glog);
+}
+
+int main(void) {
+    test_order();
+    test_yield();
+    test_nesting();
+    test_percentile();
+    test_mixed();
+    return HOST_TEST_RESULT();
+}
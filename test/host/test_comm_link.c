@@ -0,0 +1,254 @@
+// framed dualcomm link: two comm_link_t endpoints talk over a pty pair with
+// bit flips and dropped bytes injected on the wire. time is virtual and the
+// wire is paced at the link baud rate, so the reported throughput is what the
+// uart would see, independent of how fast the host runs the loop.
+
+#include "core/comm_link.h"
+#include "host_test.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pty.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define BAUD 115200
+#define BYTES_PER_MS (BAUD / 11 / 1000) // 8E1
+#define MAX_VIRTUAL_MS (10 * 60 * 1000)
+
+#define TYPE_DATA 0x01
+
+typedef struct {
+    comm_link_t link;
+    int fd;
+
+    // frame being clocked out onto the wire
+    uint8_t out[COMM_LINK_FRAME_MAX];
+    size_t out_len;
+    size_t out_pos;
+
+    // sender side: payloads queued so far, receiver side: payloads delivered
+    uint32_t queued;
+    uint32_t delivered;
+    uint32_t total;
+    uint64_t payload_bytes;
+    uint32_t corrupt;
+    uint32_t refused; // data frames not committed, like a full protocol queue
+} endpoint_t;
+
+typedef struct {
+    double byte_error; // per byte chance of a flipped bit
+    double byte_drop;  // per byte chance of losing it
+    double busy;       // per frame chance the receiver refuses an in-order frame
+    uint32_t seed;
+} wire_t;
+
+static uint32_t s_rng;
+
+static uint32_t rng_next(void) {
+    // xorshift32, seeded per case so failures reproduce
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+static bool rng_chance(double p) {
+    return p > 0 && rng_next() < (uint32_t)(p * 4294967295.0);
+}
+
+// payload n of a stream: length and contents are a function of n, so the
+// receiver can check every byte without keeping a copy
+static size_t payload_fill(uint32_t stream, uint32_t n, uint8_t *out) {
+    uint32_t x = (stream * 2654435761u) ^ (n * 40503u) ^ 0x9e3779b9u;
+    size_t len = 1 + (x % COMM_LINK_MAX_PAYLOAD);
+    for (size_t i = 0; i < len; i++) {
+        x = x * 1103515245u + 12345u;
+        out[i] = (uint8_t)(x >> 16);
+    }
+    return len;
+}
+
+static void open_wire(int *a, int *b) {
+    int master, slave;
+    CHECK(openpty(&master, &slave, NULL, NULL, NULL) == 0);
+    struct termios tio;
+    tcgetattr(slave, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+    *a = master;
+    *b = slave;
+}
+
+// read exactly len bytes the peer just wrote; the pty hands them over
+// asynchronously, so this blocks until they are through
+static void wire_read(int fd, uint8_t *buf, size_t len) {
+    size_t got = 0;
+    while (got < len) {
+        ssize_t n = read(fd, buf + got, len - got);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            fprintf(stderr, "pty read failed: %s\n", strerror(errno));
+            exit(1);
+        }
+        got += (size_t)n;
+    }
+}
+
+// clock up to BYTES_PER_MS bytes of tx's current frame onto the wire and feed
+// what survives to rx
+static void wire_step(endpoint_t *tx, endpoint_t *rx, uint32_t stream, const wire_t *wire,
+                      uint32_t now) {
+    uint8_t chunk[BYTES_PER_MS];
+    size_t n = 0;
+
+    for (int budget = BYTES_PER_MS; budget > 0; budget--) {
+        if (tx->out_pos == tx->out_len) {
+            // top up the window before asking for the next frame
+            while (tx->queued < tx->total && !comm_link_window_full(&tx->link)) {
+                uint8_t payload[COMM_LINK_MAX_PAYLOAD];
+                size_t len = payload_fill(stream, tx->queued, payload);
+                CHECK(comm_link_queue(&tx->link, TYPE_DATA, NULL, 0, payload, len));
+                tx->queued++;
+            }
+            tx->out_len = comm_link_next_tx(&tx->link, now, tx->out);
+            tx->out_pos = 0;
+            if (tx->out_len == 0) break;
+        }
+        uint8_t byte = tx->out[tx->out_pos++];
+        if (rng_chance(wire->byte_drop)) continue;
+        if (rng_chance(wire->byte_error)) byte ^= (uint8_t)(1u << (rng_next() % 8));
+        chunk[n++] = byte;
+    }
+    if (n == 0) return;
+
+    CHECK_EQ(write(tx->fd, chunk, n), (ssize_t)n);
+    uint8_t in[BYTES_PER_MS];
+    wire_read(rx->fd, in, n);
+
+    for (size_t i = 0; i < n; i++) {
+        if (comm_link_rx_byte(&rx->link, in[i], now) != COMM_LINK_RX_DATA) continue;
+        if (rng_chance(wire->busy)) {
+            rx->refused++;
+            continue;
+        }
+        uint8_t want[COMM_LINK_MAX_PAYLOAD];
+        size_t len = payload_fill(stream, rx->delivered, want);
+        if (rx->link.rx_type != TYPE_DATA || rx->link.rx_len != len ||
+            memcmp(rx->link.rx_payload, want, len) != 0) {
+            rx->corrupt++;
+        }
+        comm_link_rx_commit(&rx->link);
+        rx->delivered++;
+        rx->payload_bytes += rx->link.rx_len;
+    }
+}
+
+typedef struct {
+    const char *name;
+    wire_t wire;
+    uint32_t a_to_b; // payloads each way
+    uint32_t b_to_a;
+} link_case_t;
+
+static void run_case(const link_case_t *c) {
+    static endpoint_t a, b;
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    uint32_t rto = comm_link_rto_for_baud(BAUD);
+    comm_link_init(&a.link, rto);
+    comm_link_init(&b.link, rto);
+    open_wire(&a.fd, &b.fd);
+    a.total = c->a_to_b;
+    b.total = c->b_to_a;
+    s_rng = c->wire.seed;
+
+    uint32_t now = 1;
+    while (now < MAX_VIRTUAL_MS && (b.delivered < c->a_to_b || a.delivered < c->b_to_a)) {
+        // full duplex: both directions get a millisecond of wire time
+        wire_step(&a, &b, 0, &c->wire, now);
+        wire_step(&b, &a, 1, &c->wire, now);
+        now++;
+    }
+
+    // the bulk a -> b direction sets the run time; b -> a shares the wire
+    // with a's acks and finishes early
+    double rate = (double)b.payload_bytes / now * 1000.0;
+    double wire_rate = BYTES_PER_MS * 1000.0;
+    printf("%-10s %7llu payload bytes in %6u ms: %6.0f B/s (%3.0f%% of wire), "
+           "retransmits %u/%u, crc errors %u/%u, refused %u/%u\n",
+           c->name, (unsigned long long)b.payload_bytes, now, rate, 100.0 * rate / wire_rate,
+           a.link.retransmits, b.link.retransmits, a.link.crc_errors, b.link.crc_errors,
+           a.refused, b.refused);
+
+    // everything arrives, in order, intact
+    CHECK(now < MAX_VIRTUAL_MS);
+    CHECK_EQ(b.delivered, c->a_to_b);
+    CHECK_EQ(a.delivered, c->b_to_a);
+    CHECK_EQ(b.corrupt, 0);
+    CHECK_EQ(a.corrupt, 0);
+
+    if (c->wire.byte_error == 0 && c->wire.byte_drop == 0 && c->wire.busy == 0) {
+        // a clean wire never retransmits and stays close to wire rate
+        CHECK_EQ(a.link.retransmits + b.link.retransmits, 0);
+        CHECK_EQ(a.link.crc_errors + b.link.crc_errors, 0);
+        CHECK(rate > 0.9 * wire_rate);
+    } else {
+        CHECK(a.link.retransmits + b.link.retransmits > 0);
+    }
+
+    close(a.fd);
+    close(b.fd);
+}
+
+static void test_crc(void) {
+    // standard crc-32 check value
+    CHECK_EQ(comm_link_crc32(0, (const uint8_t *)"123456789", 9), 0xCBF43926u);
+    // chaining equals one pass
+    uint32_t crc = comm_link_crc32(0, (const uint8_t *)"1234", 4);
+    CHECK_EQ(comm_link_crc32(crc, (const uint8_t *)"56789", 5), 0xCBF43926u);
+}
+
+static void test_window(void) {
+    comm_link_t link;
+    uint8_t frame[COMM_LINK_FRAME_MAX];
+    uint8_t big[COMM_LINK_MAX_PAYLOAD + 1] = {0};
+    comm_link_init(&link, 100);
+
+    CHECK(!comm_link_queue(&link, TYPE_DATA, NULL, 0, big, sizeof(big)));
+    CHECK(!comm_link_queue(&link, TYPE_DATA, big, 1, big, COMM_LINK_MAX_PAYLOAD));
+    for (int i = 0; i < COMM_LINK_WINDOW; i++) {
+        CHECK(comm_link_queue(&link, TYPE_DATA, NULL, 0, big, 8));
+    }
+    CHECK(comm_link_window_full(&link));
+    CHECK(!comm_link_queue(&link, TYPE_DATA, NULL, 0, big, 8));
+
+    for (int i = 0; i < COMM_LINK_WINDOW; i++) {
+        CHECK_EQ(comm_link_next_tx(&link, 0, frame), COMM_LINK_HDR_LEN + 8 + COMM_LINK_CRC_LEN);
+    }
+    CHECK_EQ(comm_link_next_tx(&link, 50, frame), 0);
+    // the rto goes back to the oldest unacked frame
+    CHECK_EQ(comm_link_next_tx(&link, 100, frame), COMM_LINK_HDR_LEN + 8 + COMM_LINK_CRC_LEN);
+    CHECK_EQ(frame[2], 0);
+    CHECK_EQ(link.retransmits, 1);
+
+    // the rto must cover a full window at the baud rate
+    uint32_t window_ms = (uint32_t)((uint64_t)COMM_LINK_WINDOW * COMM_LINK_FRAME_MAX * 11 * 1000 / BAUD);
+    CHECK(comm_link_rto_for_baud(BAUD) > window_ms);
+    CHECK_EQ(comm_link_rto_for_baud(0), comm_link_rto_for_baud(115200));
+}
+
+int main(void) {
+    test_crc();
+    test_window();
+
+    static const link_case_t cases[] = {
+        {"clean", {0, 0, 0, 1}, 200, 50},
+        {"err 1e-5", {1e-5, 0, 0, 2}, 200, 50},
+        {"err 1e-4", {1e-4, 2.5e-5, 0, 3}, 200, 50},
+        {"err 1e-3", {1e-3, 2.5e-4, 0, 4}, 100, 25},
+        {"busy rx", {0, 0, 0.05, 5}, 200, 50},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) run_case(&cases[i]);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,143 @@
+// command table and tokenizer: quoting and long lines, table churn checked
+// against a plain array, and the names commandline.c really registers,
+// looked up in the table and in the list it replaced (commands_ref.h).
+
+#include "core/command_table.h"
+#include "commands_ref.h"
+#include "host_test.h"
+
+static void cmd_a(int argc, char **argv) {
+}
+
+static void cmd_b(int argc, char **argv) {
+}
+
+static int split(const char *line, char *buf, size_t size, char **argv) {
+    snprintf(buf, size, "%s", line);
+    int counted = command_tokenize(buf, NULL);
+    CHECK_STR(buf, line); // counting leaves the line alone
+    int argc = command_tokenize(buf, argv);
+    CHECK_EQ(argc, counted);
+    return argc;
+}
+
+static void test_tokenize(void) {
+    char buf[512];
+    char *argv[128];
+
+    CHECK_EQ(split("", buf, sizeof(buf), argv), 0);
+    CHECK_EQ(split(" \t \r\n", buf, sizeof(buf), argv), 0);
+
+    CHECK_EQ(split("scanap", buf, sizeof(buf), argv), 1);
+    CHECK_STR(argv[0], "scanap");
+
+    CHECK_EQ(split("  attack  -d\t-c 6 ", buf, sizeof(buf), argv), 4);
+    CHECK_STR(argv[0], "attack");
+    CHECK_STR(argv[1], "-d");
+    CHECK_STR(argv[2], "-c");
+    CHECK_STR(argv[3], "6");
+
+    CHECK_EQ(split("connect \"My Network\" 'pass word' x", buf, sizeof(buf), argv), 4);
+    CHECK_STR(argv[1], "My Network");
+    CHECK_STR(argv[2], "pass word");
+    CHECK_STR(argv[3], "x");
+
+    // an empty quoted argument counts; a quote inside a word is literal, and
+    // text right after a closing quote starts the next argument
+    CHECK_EQ(split("ssid \"\" it's \"a b\"c", buf, sizeof(buf), argv), 5);
+    CHECK_STR(argv[1], "");
+    CHECK_STR(argv[2], "it's");
+    CHECK_STR(argv[3], "a b");
+    CHECK_STR(argv[4], "c");
+
+    strcpy(buf, "say \"unterminated");
+    CHECK_EQ(command_tokenize(buf, NULL), -1);
+    CHECK_EQ(command_tokenize(buf, argv), -1);
+
+    // the old tokenizer stopped at ten arguments
+    char line[512] = "beaconspam";
+    for (int i = 0; i < 40; i++) snprintf(line + strlen(line), sizeof(line) - strlen(line), " s%d", i);
+    CHECK_EQ(split(line, buf, sizeof(buf), argv), 41);
+    CHECK_STR(argv[10], "s9");
+    CHECK_STR(argv[40], "s39");
+}
+
+static void test_table(void) {
+    static command_table_t table;
+    command_table_init(&table);
+
+    CHECK_EQ(command_table_add(&table, "scanap", cmd_a), 1);
+    CHECK_EQ(command_table_add(&table, "scanap", cmd_b), 0);
+    CHECK(command_table_find(&table, "scanap") == cmd_a);
+    CHECK(command_table_find(&table, "scan") == NULL);
+    CHECK(command_table_find(&table, "") == NULL);
+    CHECK_EQ(table.count, 1);
+    command_table_remove(&table, "missing");
+    command_table_remove(&table, "scanap");
+    CHECK_EQ(table.count, 0);
+    CHECK(command_table_find(&table, "scanap") == NULL);
+
+    // fill to capacity: one slot always stays free
+    static char names[COMMAND_TABLE_SIZE][16];
+    for (int i = 0; i < COMMAND_TABLE_SIZE; i++) snprintf(names[i], sizeof(names[i]), "cmd%d", i);
+    for (int i = 0; i < COMMAND_TABLE_SIZE - 1; i++) CHECK_EQ(command_table_add(&table, names[i], cmd_a), 1);
+    CHECK_EQ(command_table_add(&table, names[COMMAND_TABLE_SIZE - 1], cmd_a), -1);
+    CHECK(command_table_find(&table, "nope") == NULL);
+    for (int i = 0; i < COMMAND_TABLE_SIZE - 1; i++) CHECK(command_table_find(&table, names[i]) == cmd_a);
+
+    // random add/remove churn against a plain array: backward-shift deletion
+    // must never strand an entry behind a hole
+    command_table_init(&table);
+    bool present[COMMAND_TABLE_SIZE] = {0};
+    uint32_t seed = 12345;
+    int mismatches = 0;
+    for (int step = 0; step < 200000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        int i = (int)((seed >> 8) % 200);
+        if (present[i]) {
+            command_table_remove(&table, names[i]);
+            present[i] = false;
+        } else {
+            CHECK_EQ(command_table_add(&table, names[i], cmd_b), 1);
+            present[i] = true;
+        }
+        if (step % 1000 == 0) {
+            int n = 0;
+            for (int k = 0; k < 200; k++) {
+                n += present[k];
+                if ((command_table_find(&table, names[k]) != NULL) != present[k]) mismatches++;
+            }
+            if (table.count != n) mismatches++;
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+static void test_real_commands(void) {
+    CHECK(ref_load_names());
+    static command_table_t table;
+    command_table_init(&table);
+    for (int i = 0; i < ref_name_count; i++) {
+        CHECK_EQ(command_table_add(&table, ref_names[i], cmd_a), 1);
+        ref_register_command(ref_names[i], cmd_a);
+    }
+    // keep probe runs short: the table is sized for at most half full
+    CHECK(ref_name_count > 50);
+    CHECK(table.count <= COMMAND_TABLE_SIZE / 2);
+
+    for (int i = 0; i < ref_name_count; i++) {
+        CHECK(command_table_find(&table, ref_names[i]) == ref_find_command(ref_names[i]));
+    }
+    static const char *misses[] = {"scan", "scanap ", "SCANAP", "help2", "x"};
+    for (size_t i = 0; i < sizeof(misses) / sizeof(misses[0]); i++) {
+        CHECK(command_table_find(&table, misses[i]) == NULL);
+        CHECK(ref_find_command(misses[i]) == NULL);
+    }
+}
+
+int main(void) {
+    test_tokenize();
+    test_table();
+    test_real_commands();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,267 @@
+// capture file numbering (core/file_index.c) built into the test over a
+// scratch directory, so a reboot is clearing the lru table. opendir and
+// fopen are wrapped at link time to count full scans and index file reads.
+// covers a fresh directory, callers that do and don't create the file, a
+// stale or broken .ghost_index, deleted files, files added behind the cache
+// (from another machine), look-alike names, and lru eviction.
+
+#include FILE_INDEX_C
+#include "host_test.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <unistd.h>
+
+DIR *__real_opendir(const char *path);
+FILE *__real_fopen(const char *path, const char *mode);
+
+static int s_scans, s_loads;
+
+DIR *__wrap_opendir(const char *path) {
+    s_scans++;
+    return __real_opendir(path);
+}
+
+// a store also reads the old index, but with its .tmp already open
+FILE *__wrap_fopen(const char *path, const char *mode) {
+    size_t n = strlen(path), k = strlen(FILE_INDEX_NAME);
+    if (mode[0] == 'r' && n >= k && strcmp(path + n - k, FILE_INDEX_NAME) == 0) {
+        char tmp[512];
+        snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+        if (access(tmp, F_OK) != 0) s_loads++;
+    }
+    return __real_fopen(path, mode);
+}
+
+static char s_dir[] = "/tmp/test_file_index_XXXXXX";
+
+// the lru table is gone, .ghost_index files stay
+static void reboot(void) {
+    memset(s_index_cache, 0, sizeof(s_index_cache));
+    s_index_stamp = 0;
+}
+
+static void touch(const char *dir, const char *name) {
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    close(open(path, O_WRONLY | O_CREAT, 0644));
+}
+
+static void touchf(const char *dir, const char *base, int n, const char *ext) {
+    char name[128];
+    snprintf(name, sizeof(name), "%s_%d.%s", base, n, ext);
+    touch(dir, name);
+}
+
+static void rmf(const char *dir, const char *base, int n, const char *ext) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s_%d.%s", dir, base, n, ext);
+    unlink(path);
+}
+
+static void write_index(const char *dir, const char *text) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dir, FILE_INDEX_NAME);
+    FILE *f = __real_fopen(path, "w");
+    fputs(text, f);
+    fclose(f);
+}
+
+static int next_created(const char *dir, const char *base, const char *ext) {
+    int n = file_index_next(dir, base, ext);
+    if (n >= 0) touchf(dir, base, n, ext);
+    return n;
+}
+
+// a directory of its own for each case
+static const char *subdir(const char *name) {
+    static char path[256];
+    snprintf(path, sizeof(path), "%s/%s", s_dir, name);
+    mkdir(path, 0755);
+    return path;
+}
+
+static void test_fresh(void) {
+    const char *d = subdir("fresh");
+    reboot();
+    s_scans = 0;
+    CHECK_EQ(next_created(d, "capture", "pcap"), 0);
+    CHECK_EQ(s_scans, 1);
+    for (int i = 1; i < 50; i++) CHECK_EQ(next_created(d, "capture", "pcap"), i);
+    // every number after the first came from the cache and a probe
+    CHECK_EQ(s_scans, 1);
+
+    // a caller that never creates its file gets the same number again
+    CHECK_EQ(file_index_next(d, "capture", "pcap"), 50);
+    CHECK_EQ(file_index_next(d, "capture", "pcap"), 50);
+    CHECK_EQ(s_scans, 1);
+
+    // the number survives a reboot through .ghost_index, without a scan
+    reboot();
+    s_loads = 0;
+    CHECK_EQ(next_created(d, "capture", "pcap"), 50);
+    CHECK_EQ(s_loads, 1);
+    CHECK_EQ(s_scans, 1);
+
+    CHECK_EQ(file_index_next("/nonexistent/dir", "capture", "pcap"), -1);
+}
+
+static void test_stale_index(void) {
+    const char *d = subdir("stale");
+    for (int i = 0; i <= 10; i++) touchf(d, "wardrive", i, "csv");
+
+    // behind the files: both probed numbers are taken, so it scans
+    write_index(d, "wardrive csv 3\n");
+    reboot();
+    s_scans = 0;
+    CHECK_EQ(file_index_next(d, "wardrive", "csv"), 11);
+    CHECK_EQ(s_scans, 1);
+    // and the corrected number is what the next boot finds
+    reboot();
+    s_scans = 0;
+    CHECK_EQ(file_index_next(d, "wardrive", "csv"), 11);
+    CHECK_EQ(s_scans, 0);
+
+    // one behind (the file was created, the index not yet updated)
+    write_index(d, "wardrive csv 10\n");
+    reboot();
+    s_scans = 0;
+    CHECK_EQ(file_index_next(d, "wardrive", "csv"), 11);
+    CHECK_EQ(s_scans, 0);
+
+    // garbage, negative numbers and other series are not taken for ours
+    write_index(d, "junk\nwardrive csv -4\nwardrive pcap 99\nwardrivex csv 50\n");
+    reboot();
+    CHECK_EQ(file_index_next(d, "wardrive", "csv"), 11);
+
+    // an index ahead of the files is trusted; the names are still unused
+    write_index(d, "wardrive csv 40\n");
+    reboot();
+    CHECK_EQ(file_index_next(d, "wardrive", "csv"), 40);
+}
+
+static void test_deleted(void) {
+    const char *d = subdir("deleted");
+    reboot();
+    for (int i = 0; i < 6; i++) CHECK_EQ(next_created(d, "portal", "log"), i);
+    // only the last number handed out can come back once its file is gone,
+    // never an older one
+    rmf(d, "portal", 5, "log");
+    rmf(d, "portal", 4, "log");
+    CHECK_EQ(file_index_next(d, "portal", "log"), 5);
+    reboot();
+    CHECK_EQ(file_index_next(d, "portal", "log"), 5);
+    // not even with the directory emptied
+    for (int i = 0; i < 4; i++) rmf(d, "portal", i, "log");
+    reboot();
+    s_scans = 0;
+    CHECK_EQ(next_created(d, "portal", "log"), 5);
+    CHECK_EQ(next_created(d, "portal", "log"), 6);
+    CHECK_EQ(s_scans, 0);
+}
+
+static void test_external(void) {
+    const char *d = subdir("external");
+    reboot();
+    for (int i = 0; i < 3; i++) CHECK_EQ(next_created(d, "capture", "pcap"), i);
+    CHECK_EQ(file_index_next(d, "capture", "pcap"), 3);
+
+    // another machine wrote capture_3: the probe of the next number finds it
+    touchf(d, "capture", 3, "pcap");
+    s_scans = 0;
+    CHECK_EQ(file_index_next(d, "capture", "pcap"), 4);
+    CHECK_EQ(s_scans, 0);
+
+    // a run of them: both probes are taken and it scans to the real end
+    for (int i = 4; i < 9; i++) touchf(d, "capture", i, "pcap");
+    CHECK_EQ(file_index_next(d, "capture", "pcap"), 9);
+    CHECK_EQ(s_scans, 1);
+
+    // a file far ahead is not seen until the numbers run into it, but no
+    // taken name is ever handed out
+    touchf(d, "capture", 12, "pcap");
+    for (int want = 9; want < 12; want++) CHECK_EQ(next_created(d, "capture", "pcap"), want);
+    CHECK_EQ(next_created(d, "capture", "pcap"), 13);
+
+    // look-alike names never count as part of the series
+    const char *e = subdir("lookalike");
+    touch(e, "capture_50.pcap.bak");
+    touch(e, "capture_51.pcapng");
+    touch(e, "capture_2g_52.pcap");
+    touch(e, "capture52.pcap");
+    touch(e, "capture_.pcap");
+    touch(e, "capture_-3.pcap");
+    touch(e, "Capture_53.pcap");
+    touch(e, "capture_99999999999.pcap"); // does not fit an int
+    touch(e, "capture_007.pcap");
+    reboot();
+    CHECK_EQ(file_index_next(e, "capture", "pcap"), 8);
+    CHECK_EQ(file_index_next(e, "capture_2g", "pcap"), 53);
+
+    // names that don't fit the table or the index format still number right
+    char base[64];
+    memset(base, 'b', sizeof(base) - 1);
+    base[sizeof(base) - 1] = '\0';
+    touchf(e, base, 4, "pcap");
+    CHECK_EQ(file_index_next(e, base, "pcap"), 5);
+    touch(e, "two words_1.pcap");
+    CHECK_EQ(file_index_next(e, "two words", "pcap"), 2);
+}
+
+static void test_lru(void) {
+    char dirs[FILE_INDEX_CACHE_SLOTS + 1][256];
+    for (int i = 0; i <= FILE_INDEX_CACHE_SLOTS; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "lru%d", i);
+        snprintf(dirs[i], sizeof(dirs[i]), "%s", subdir(name));
+    }
+    reboot();
+    // fill the table, each series a different number
+    for (int i = 0; i < FILE_INDEX_CACHE_SLOTS; i++) {
+        for (int k = 0; k <= i; k++) next_created(dirs[i], "scan", "csv");
+    }
+    // settle: each series moves past its last created file
+    for (int i = 0; i < FILE_INDEX_CACHE_SLOTS; i++) file_index_next(dirs[i], "scan", "csv");
+    // all cached: no index file is read
+    s_loads = 0;
+    for (int i = 0; i < FILE_INDEX_CACHE_SLOTS; i++) {
+        CHECK_EQ(file_index_next(dirs[i], "scan", "csv"), i + 1);
+    }
+    CHECK_EQ(s_loads, 0);
+
+    // touch the oldest, then a new series evicts the next least recent
+    CHECK_EQ(file_index_next(dirs[0], "scan", "csv"), 1);
+    s_loads = 0;
+    CHECK_EQ(next_created(dirs[FILE_INDEX_CACHE_SLOTS], "scan", "csv"), 0);
+    CHECK_EQ(s_loads, 1); // looked for an index first
+    s_loads = 0;
+    CHECK_EQ(file_index_next(dirs[0], "scan", "csv"), 1);
+    CHECK_EQ(s_loads, 0);
+    // the evicted series comes back from its index file, same number
+    CHECK_EQ(file_index_next(dirs[1], "scan", "csv"), 2);
+    CHECK_EQ(s_loads, 1);
+
+    // same directory and base, another extension is a series of its own
+    s_loads = 0;
+    CHECK_EQ(next_created(dirs[0], "scan", "pcap"), 0);
+    CHECK_EQ(file_index_next(dirs[0], "scan", "csv"), 1);
+    // and both live in the one index file
+    reboot();
+    CHECK_EQ(file_index_next(dirs[0], "scan", "pcap"), 1);
+    CHECK_EQ(file_index_next(dirs[0], "scan", "csv"), 1);
+}
+
+int main(void) {
+    if (!mkdtemp(s_dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    test_fresh();
+    test_stale_index();
+    test_deleted();
+    test_external();
+    test_lru();
+    char cmd[300];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", s_dir);
+    if (system(cmd) != 0) fprintf(stderr, "could not remove %s\n", s_dir);
+    return HOST_TEST_RESULT();
+}
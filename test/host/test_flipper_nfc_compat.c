@@ -0,0 +1,465 @@
+// flipper nfc shim: FuriString against a plain snprintf reference, on the
+// heap and in per-parse arenas, bit_lib against bit by bit references with
+// flipper's semantics and against the bit loop it replaced, the dispatcher's
+// parser counters with several tasks parsing at once, and the dispatcher on
+// the saved dumps in data/nfc/ against the sequential one it replaced. run
+// under HOST_SANITIZE to catch overruns and leaks.
+
+#include "managers/nfc/flipper_nfc_compat.h"
+#include "bit_lib_ref.h"
+#include "host_test.h"
+#include "nfc_dispatch_ref.h"
+#include "nfc_dump.h"
+#include <pthread.h>
+#include <stdarg.h>
+
+// the disney infinity parser needs mbedtls; registered as an empty plugin
+const NfcSupportedCardsPlugin disney_infinity_plugin = {0};
+
+int64_t esp_timer_get_time(void) {
+    return host_now_ns() / 1000;
+}
+
+// ---- FuriString ----
+
+typedef struct {
+    char buf[8192];
+    size_t len;
+} ref_t;
+
+static void ref_cat(ref_t *r, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(r->buf + r->len, sizeof(r->buf) - r->len, fmt, ap);
+    va_end(ap);
+    if (n > 0) r->len += (size_t)n;
+}
+
+static bool same(const FuriString *s, const ref_t *r) {
+    const char *c = furi_string_get_cstr(s);
+    return s->len == r->len && strlen(c) == r->len && memcmp(c, r->buf, r->len) == 0 &&
+           (s->cap == 0 || s->len < s->cap);
+}
+
+static void test_string_basics(void) {
+    FuriString *s = furi_string_alloc();
+    CHECK(s != NULL);
+    CHECK_STR(furi_string_get_cstr(s), "");
+    CHECK_EQ(s->len, 0);
+    CHECK_EQ(furi_string_get_char(s, 0), '\0');
+    CHECK_STR(furi_string_get_cstr(NULL), "");
+
+    furi_string_set_str(s, "abc");
+    CHECK_STR(furi_string_get_cstr(s), "abc");
+    CHECK_EQ(furi_string_get_char(s, 2), 'c');
+    CHECK_EQ(furi_string_get_char(s, 3), '\0');
+
+    furi_string_push_back(s, 'd');
+    furi_string_cat_str(s, "ef");
+    furi_string_cat_str(s, "");
+    furi_string_cat_str(s, NULL);
+    CHECK_STR(furi_string_get_cstr(s), "abcdef");
+    CHECK_EQ(s->len, 6);
+
+    FuriString *t = furi_string_alloc_set_str("-xyz");
+    furi_string_cat(s, t);
+    CHECK_STR(furi_string_get_cstr(s), "abcdef-xyz");
+    // appending a string to itself
+    furi_string_cat(t, t);
+    CHECK_STR(furi_string_get_cstr(t), "-xyz-xyz");
+    for (int i = 0; i < 4; i++) furi_string_cat(t, t);
+    CHECK_EQ(t->len, 128);
+    CHECK_EQ(strlen(furi_string_get_cstr(t)), 128);
+
+    // printf replaces, reset keeps the capacity
+    furi_string_printf(s, "%d-%s", 42, "x");
+    CHECK_STR(furi_string_get_cstr(s), "42-x");
+    size_t cap = s->cap;
+    furi_string_reset(s);
+    CHECK_STR(furi_string_get_cstr(s), "");
+    CHECK_EQ(s->cap, cap);
+    furi_string_set_str(s, "");
+    CHECK_STR(furi_string_get_cstr(s), "");
+
+    // an empty format adds nothing
+    furi_string_cat_printf(s, "%s", "");
+    CHECK_EQ(s->len, 0);
+
+    // reserve leaves the content alone and makes room for len characters
+    furi_string_set_str(s, "keep");
+    CHECK(furi_string_reserve(s, 1000));
+    CHECK(s->cap > 1000);
+    CHECK_STR(furi_string_get_cstr(s), "keep");
+
+    furi_string_free(t);
+    furi_string_free(s);
+    furi_string_free(NULL);
+}
+
+// appends of every size around the capacity steps, checked after each one
+static void grow_against_ref(FuriString *s, uint32_t seed) {
+    static ref_t ref;
+    ref.len = 0;
+    ref.buf[0] = '\0';
+    furi_string_reset(s);
+
+    uint32_t x = seed;
+    bool ok = true;
+    while (ok && ref.len < 6000) {
+        x = x * 1103515245u + 12345u;
+        switch ((x >> 16) % 5) {
+        case 0: {
+            int w = (int)((x >> 8) % 90);
+            furi_string_cat_printf(s, "%0*u|", w, (unsigned)(x & 0xff));
+            ref_cat(&ref, "%0*u|", w, (unsigned)(x & 0xff));
+            break;
+        }
+        case 1:
+            furi_string_push_back(s, (char)('a' + x % 26));
+            ref_cat(&ref, "%c", (char)('a' + x % 26));
+            break;
+        case 2: {
+            char chunk[300];
+            size_t n = (x >> 4) % sizeof(chunk);
+            memset(chunk, 'k', n);
+            chunk[n] = '\0';
+            furi_string_cat_str(s, chunk);
+            ref_cat(&ref, "%s", chunk);
+            break;
+        }
+        case 3:
+            furi_string_cat_printf(s, "%02X:%02X ", x & 0xff, (x >> 8) & 0xff);
+            ref_cat(&ref, "%02X:%02X ", x & 0xff, (x >> 8) & 0xff);
+            break;
+        default:
+            furi_string_cat_printf(s, "\n");
+            ref_cat(&ref, "\n");
+            break;
+        }
+        ok = same(s, &ref);
+    }
+    CHECK(ok);
+}
+
+static void test_string_growth(void) {
+    FuriString *s = furi_string_alloc();
+    for (uint32_t seed = 1; seed <= 20; seed++) grow_against_ref(s, seed);
+    furi_string_free(s);
+}
+
+static void test_arena(void) {
+    // small blocks so strings outgrow them
+    FuriStringArena *arena = furi_string_arena_alloc(64);
+    CHECK(arena != NULL);
+    CHECK_EQ(furi_string_arena_used(arena), 0);
+    CHECK(furi_string_arena_set_current(arena) == NULL);
+
+    FuriString *a = furi_string_alloc();
+    FuriString *b = furi_string_alloc();
+    CHECK(a->arena == arena);
+    CHECK(furi_string_arena_used(arena) > 0);
+
+    // interleaved growth: only the newest allocation can extend in place,
+    // the other one moves and must keep its content
+    static ref_t ra, rb;
+    ra.len = rb.len = 0;
+    for (int i = 0; i < 200; i++) {
+        furi_string_cat_printf(a, "a%d,", i);
+        ref_cat(&ra, "a%d,", i);
+        if (i % 3 == 0) {
+            furi_string_cat_printf(b, "[%03d]", i);
+            ref_cat(&rb, "[%03d]", i);
+        }
+    }
+    CHECK(same(a, &ra));
+    CHECK(same(b, &rb));
+
+    // appends far larger than a block
+    char big[1500];
+    memset(big, 'z', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    furi_string_cat_str(b, big);
+    ref_cat(&rb, "%s", big);
+    CHECK(same(b, &rb));
+    grow_against_ref(a, 99);
+
+    // free is a no-op for arena strings, the arena releases them
+    furi_string_free(a);
+    CHECK(same(b, &rb));
+
+    // nested arena, then back to the outer one and to the heap
+    FuriStringArena *inner = furi_string_arena_alloc(0);
+    CHECK(furi_string_arena_set_current(inner) == arena);
+    FuriString *c = furi_string_alloc_set_str("inner");
+    CHECK(c->arena == inner);
+    CHECK(furi_string_arena_set_current(arena) == inner);
+    furi_string_arena_free(inner);
+    CHECK(furi_string_arena_set_current(NULL) == arena);
+
+    FuriString *heap = furi_string_alloc();
+    CHECK(heap->arena == NULL);
+    furi_string_cat(heap, b);
+    CHECK(same(heap, &rb));
+    furi_string_free(heap);
+    furi_string_arena_free(arena);
+    furi_string_arena_free(NULL);
+}
+
+// ---- bit_lib ----
+
+static void fill(uint8_t *buf, size_t n, uint32_t seed) {
+    for (size_t i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        buf[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+static void test_bit_fields(void) {
+    uint8_t data[24];
+    fill(data, sizeof(data), 5);
+
+    // every position and length that stays inside the buffer
+    bool ok8 = true, ok16 = true, ok32 = true, ok64 = true;
+    for (size_t pos = 0; pos < 8 * 12; pos++) {
+        for (uint8_t len = 1; len <= 64; len++) {
+            uint64_t want = ref_get_bits(data, pos, len);
+            if (len <= 8) ok8 &= bit_lib_get_bits(data, pos, len) == want;
+            if (len <= 16) ok16 &= bit_lib_get_bits_16(data, pos, len) == want;
+            if (len <= 32) ok32 &= bit_lib_get_bits_32(data, pos, len) == want;
+            ok64 &= bit_lib_get_bits_64(data, pos, len) == want;
+        }
+    }
+    CHECK(ok8 && ok16 && ok32 && ok64);
+    // over-long requests give 0
+    CHECK_EQ(bit_lib_get_bits(data, 0, 9), 0);
+    CHECK_EQ(bit_lib_get_bits_32(data, 0, 33), 0);
+
+    // set_bits only touches the field
+    bool ok_set = true;
+    for (size_t pos = 0; pos < 8 * 12; pos++) {
+        for (uint8_t len = 1; len <= 8; len++) {
+            uint8_t buf[24], want[24];
+            fill(buf, sizeof(buf), (uint32_t)(pos * 9 + len));
+            memcpy(want, buf, sizeof(buf));
+            uint8_t v = (uint8_t)(pos * 37 + len);
+            ref_set_bits(want, pos, v, len);
+            bit_lib_set_bits(buf, pos, v, len);
+            ok_set &= memcmp(buf, want, sizeof(buf)) == 0;
+        }
+    }
+    CHECK(ok_set);
+
+    // reverse, short runs through the word path, long ones bit by bit
+    bool ok_rev = true;
+    for (size_t pos = 0; pos < 24; pos++) {
+        for (uint8_t len = 2; len <= 80; len++) {
+            uint8_t buf[24], orig[24];
+            fill(buf, sizeof(buf), (uint32_t)(pos + 100 * len));
+            memcpy(orig, buf, sizeof(buf));
+            bit_lib_reverse_bits(buf, pos, len);
+            for (size_t i = 0; i < 8 * sizeof(buf); i++) {
+                size_t from = (i >= pos && i < pos + len) ? pos + len - 1 - (i - pos) : i;
+                ok_rev &= bit_lib_get_bit(buf, i) == bit_lib_get_bit(orig, from);
+            }
+        }
+    }
+    CHECK(ok_rev);
+    bool ok_fast = true;
+    for (uint32_t i = 0; i < 1u << 16; i++) {
+        uint32_t w = i * 0x9E3779B1u;
+        ok_fast &= bit_lib_reverse_8_fast((uint8_t)i) == ref_reverse(i & 0xff, 8);
+        ok_fast &= bit_lib_reverse_16_fast((uint16_t)i) == ref_reverse(i, 16);
+        ok_fast &= bit_lib_reverse_32_fast(w) == ref_reverse(w, 32);
+    }
+    CHECK(ok_fast);
+    CHECK_EQ(bit_lib_reverse_8_fast(0x01), 0x80);
+    CHECK_EQ(bit_lib_reverse_16_fast(0x0003), 0xC000);
+    CHECK_EQ(bit_lib_reverse_32_fast(0x12345678), 0x1E6A2C48);
+}
+
+// the old lsb first loop on a buffer is the new code on the same buffer with
+// every byte mirrored, read back to front; random buffers, every position in
+// the first 8 bytes and every length
+static void test_bit_fields_old_loop(void) {
+    uint32_t x = 0x2545f491;
+    bool ok = true;
+    for (int round = 0; round < 300; round++) {
+        uint8_t data[24], mirrored[24];
+        for (size_t i = 0; i < sizeof(data); i++) {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            data[i] = (uint8_t)x;
+            mirrored[i] = ref_reverse_byte(data[i]);
+        }
+        for (size_t pos = 0; pos < 64; pos++) {
+            for (uint8_t len = 1; len <= 64; len++) {
+                uint64_t old = ref_old_get_bits_64(data, pos, len);
+                ok &= bit_lib_get_bits_64(mirrored, pos, len) == ref_reverse(old, len);
+            }
+        }
+    }
+    CHECK(ok);
+    // a buffer that is its own mirror image reads the same both ways
+    const uint8_t pal[8] = {0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81};
+    CHECK_EQ(bit_lib_get_bits_64(pal, 0, 64), ref_old_get_bits_64(pal, 0, 64));
+}
+
+static void test_bytes(void) {
+    const uint8_t b[] = {0x12, 0x34, 0x56, 0x78};
+    CHECK_EQ(bit_lib_bytes_to_num_be(b, 4), 0x12345678);
+    CHECK_EQ(bit_lib_bytes_to_num_le(b, 4), 0x78563412);
+    uint8_t out[4];
+    bit_lib_num_to_bytes_be(0xA1B2C3, 3, out);
+    CHECK(out[0] == 0xA1 && out[1] == 0xB2 && out[2] == 0xC3);
+    bit_lib_num_to_bytes_le(0xA1B2C3, 3, out);
+    CHECK(out[0] == 0xC3 && out[1] == 0xB2 && out[2] == 0xA1);
+
+    bool is_bcd = false;
+    CHECK_EQ(bit_lib_bytes_to_num_bcd(b, 4, &is_bcd), 12345678);
+    CHECK(is_bcd);
+    const uint8_t nb[] = {0x1A};
+    bit_lib_bytes_to_num_bcd(nb, 1, &is_bcd);
+    CHECK(!is_bcd);
+}
+
+static void test_parity(void) {
+    // the bit that would make the word even / odd: 0 when it already is
+    CHECK_EQ(bit_lib_test_parity_32(0x0, BitLibParityEven), 0);
+    CHECK_EQ(bit_lib_test_parity_32(0x1, BitLibParityEven), 1);
+    CHECK_EQ(bit_lib_test_parity_32(0x3, BitLibParityEven), 0);
+    CHECK_EQ(bit_lib_test_parity_32(0x1, BitLibParityOdd), 0);
+    CHECK_EQ(bit_lib_test_parity_32(0x3, BitLibParityOdd), 1);
+    CHECK_EQ(bit_lib_test_parity_32(0xFFFFFFFF, BitLibParityEven), 0);
+
+    // 26 bit wiegand: even parity over the first 13 bits, odd over the last
+    // 13, written as two blocks each ending in its parity bit
+    uint8_t w[4] = {0};
+    uint32_t payload = 0x0ABCDE; // 24 data bits
+    uint32_t hi = payload >> 12, lo = payload & 0xFFF;
+    uint32_t even_block = hi << 1 | (uint32_t)__builtin_parity(hi);
+    uint32_t odd_block = lo << 1 | (uint32_t)!__builtin_parity(lo);
+    for (int i = 0; i < 13; i++) bit_lib_set_bit(w, i, (even_block >> (12 - i)) & 1);
+    for (int i = 0; i < 13; i++) bit_lib_set_bit(w, 13 + i, (odd_block >> (12 - i)) & 1);
+    CHECK(bit_lib_test_parity(w, 0, 13, BitLibParityEven, 13));
+    CHECK(bit_lib_test_parity(w, 13, 13, BitLibParityOdd, 13));
+    CHECK(!bit_lib_test_parity(w, 0, 13, BitLibParityOdd, 13));
+    CHECK(!bit_lib_test_parity(w, 13, 13, BitLibParityEven, 13));
+
+    // one flipped bit fails its block, and with it the whole run
+    uint8_t bytes[4] = {0x03, 0x05, 0x06, 0x00}; // each byte an even block
+    CHECK(bit_lib_test_parity(bytes, 0, 32, BitLibParityEven, 8));
+    bytes[1] ^= 0x10;
+    CHECK(!bit_lib_test_parity(bytes, 0, 32, BitLibParityEven, 8));
+    CHECK(bit_lib_test_parity(bytes, 0, 8, BitLibParityEven, 8));
+
+    // fixed parity bits
+    const uint8_t fixed[] = {0x02, 0x03}; // blocks end in 0 and 1
+    CHECK(bit_lib_test_parity(fixed, 0, 8, BitLibParityAlways0, 8));
+    CHECK(!bit_lib_test_parity(fixed, 0, 16, BitLibParityAlways0, 8));
+    CHECK(bit_lib_test_parity(fixed, 8, 8, BitLibParityAlways1, 8));
+    CHECK(!bit_lib_test_parity(fixed, 0, 16, BitLibParityAlways1, 8));
+
+    // lengths that are not a whole number of blocks are rejected
+    CHECK(!bit_lib_test_parity(bytes, 0, 12, BitLibParityEven, 8));
+}
+
+// ---- dispatcher ----
+
+#define STATS_THREADS 4
+#define STATS_PARSES 1000
+
+static pthread_barrier_t s_start;
+
+static void *parse_blank(void *arg) {
+    const MfClassicData *dump = arg;
+    pthread_barrier_wait(&s_start);
+    for (int i = 0; i < STATS_PARSES; i++) {
+        free(flipper_nfc_try_parse_mfclassic_from_cache(dump));
+    }
+    return NULL;
+}
+
+static void test_parser_stats(void) {
+    size_t n = flipper_nfc_parser_count();
+    FlipperNfcParserStats before[64], after;
+    CHECK(n > 0 && n <= 64);
+    for (size_t i = 0; i < n; i++) CHECK(flipper_nfc_get_parser_stats(i, &before[i]));
+    CHECK(!flipper_nfc_get_parser_stats(n, &after));
+    CHECK(!flipper_nfc_get_parser_stats(0, NULL));
+
+    // a 1k card with only its uid known: every classic parser gets asked,
+    // none of them can make anything of it
+    static MfClassicData dump;
+    dump.type = MfClassicType1k;
+    dump.uid_len = 4;
+    memcpy(dump.uid, "\x04\x11\x22\x33", 4);
+
+    pthread_t threads[STATS_THREADS];
+    pthread_barrier_init(&s_start, NULL, STATS_THREADS);
+    for (int t = 0; t < STATS_THREADS; t++) {
+        CHECK_EQ(pthread_create(&threads[t], NULL, parse_blank, &dump), 0);
+    }
+    for (int t = 0; t < STATS_THREADS; t++) pthread_join(threads[t], NULL);
+    pthread_barrier_destroy(&s_start);
+
+    size_t classic = 0;
+    for (size_t i = 0; i < n; i++) {
+        CHECK(flipper_nfc_get_parser_stats(i, &after));
+        CHECK(after.name != NULL);
+        uint32_t checked = after.checked - before[i].checked;
+        // no count lost between the parsing tasks
+        CHECK(checked == 0 || checked == STATS_THREADS * STATS_PARSES);
+        if (checked) classic++;
+        CHECK(after.candidates - before[i].candidates <= checked);
+        CHECK_EQ(after.matches, before[i].matches);
+    }
+    CHECK(classic > 0);
+}
+
+// ---- saved dumps ----
+
+// the registry's quick checks only skip parsers that would fail anyway: on
+// every dump in data/nfc/ it gives the old sequential dispatcher's output, and
+// both settle on the parser the dump names
+static void test_saved_dumps(void) {
+    static nfc_dump_t dumps[NFC_DUMP_MAX];
+    size_t n = nfc_load_dumps(host_data_path("nfc"), dumps, NFC_DUMP_MAX);
+    CHECK(n >= 20);
+    size_t parsers = flipper_nfc_parser_count();
+    for (size_t d = 0; d < n; d++) {
+        FlipperNfcParserStats before[32], after;
+        for (size_t i = 0; i < parsers && i < 32; i++) {
+            flipper_nfc_get_parser_stats(i, &before[i]);
+        }
+        const char *seq_by;
+        char *seq = ref_try_parse_sequential(&dumps[d].data, &seq_by);
+        char *reg = flipper_nfc_try_parse_mfclassic_from_cache(&dumps[d].data);
+        const char *reg_by = "none";
+        for (size_t i = 0; i < parsers && i < 32; i++) {
+            if (flipper_nfc_get_parser_stats(i, &after) && after.matches != before[i].matches) {
+                reg_by = after.name;
+            }
+        }
+        CHECK_STR(seq_by, dumps[d].parser);
+        CHECK_STR(reg_by, dumps[d].parser);
+        CHECK_EQ(seq != NULL, strcmp(dumps[d].parser, "none") != 0);
+        CHECK_EQ(reg != NULL, seq != NULL);
+        if (seq && reg) CHECK_STR(reg, seq);
+        free(seq);
+        free(reg);
+    }
+}
+
+int main(void) {
+    test_string_basics();
+    test_string_growth();
+    test_arena();
+    test_bit_fields();
+    test_bit_fields_old_loop();
+    test_bytes();
+    test_parity();
+    test_parser_stats();
+    test_saved_dumps();
+    return HOST_TEST_RESULT();
+}
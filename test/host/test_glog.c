@@ -0,0 +1,389 @@
+// glog ring: console, terminal and web sinks, deferral, per-sink drop
+// counting when a sink falls a full ring behind, and many producer threads
+// against slow consumers. tasks are real threads (esp_stubs/esp_threads.c)
+// so the ring's critical sections are exercised for real. built twice: as
+// test_glog with every sink drained by its worker, and as test_glog_inline
+// with CONFIG_GLOG_INLINE_OUTPUT, where console and terminal are written by
+// the caller.
+
+#include "core/glog.h"
+#include "host_test.h"
+#include <pthread.h>
+#include <unistd.h>
+
+#define PRODUCERS 8
+#define LINES_PER_PRODUCER 20000
+
+// ---- sinks ----
+
+typedef struct {
+    glog_sink_t id;
+    char text[32768];
+    uint32_t count;
+    int64_t last[PRODUCERS]; // stress: last sequence number seen per producer
+    uint32_t disorder;
+    volatile int hold;
+} sink_t;
+
+static pthread_mutex_t s_sink_lock = PTHREAD_MUTEX_INITIALIZER;
+static sink_t s_term = {.id = GLOG_SINK_TERMINAL};
+static sink_t s_web = {.id = GLOG_SINK_WEB};
+static uint32_t s_corrupt;
+
+static void append(char *dst, size_t size, const char *text) {
+    size_t len = strlen(dst);
+    snprintf(dst + len, size - len, "%s", text);
+}
+
+// stress lines are "p<producer> <seq>\n"; anything else is a test line
+static bool parse_stress(const char *text, unsigned *p, unsigned *seq) {
+    int used = 0;
+    if (text[0] != 'p') return false;
+    if (sscanf(text, "p%u %u\n%n", p, seq, &used) != 2 || text[used] != '\0' || *p >= PRODUCERS) {
+        __atomic_add_fetch(&s_corrupt, 1, __ATOMIC_RELAXED);
+        return true;
+    }
+    return true;
+}
+
+// hold stalls the sink like a busy display or an http handler holding the
+// log mutex would
+static void sink_add(sink_t *s, const char *text) {
+    while (__atomic_load_n(&s->hold, __ATOMIC_ACQUIRE)) usleep(100);
+
+    unsigned p, seq;
+    pthread_mutex_lock(&s_sink_lock);
+    if (parse_stress(text, &p, &seq)) {
+        if (p < PRODUCERS) {
+            if ((int64_t)seq <= s->last[p]) s->disorder++;
+            s->last[p] = seq;
+        }
+    } else {
+        append(s->text, sizeof(s->text), text);
+    }
+    s->count++;
+    pthread_mutex_unlock(&s_sink_lock);
+}
+
+void terminal_view_add_text(const char *text) {
+    sink_add(&s_term, text);
+}
+
+void ap_manager_add_log(const char *text) {
+    sink_add(&s_web, text);
+}
+
+bool esp_comm_manager_is_remote_command(void) {
+    return false;
+}
+
+bool esp_comm_manager_send_response(const uint8_t *data, size_t length) {
+    return true;
+}
+
+static void sinks_clear(void) {
+    pthread_mutex_lock(&s_sink_lock);
+    s_term.text[0] = '\0';
+    s_web.text[0] = '\0';
+    pthread_mutex_unlock(&s_sink_lock);
+}
+
+static uint32_t sink_count(sink_t *s) {
+    pthread_mutex_lock(&s_sink_lock);
+    uint32_t n = s->count;
+    pthread_mutex_unlock(&s_sink_lock);
+    return n;
+}
+
+static bool sink_has(sink_t *s, const char *needle) {
+    pthread_mutex_lock(&s_sink_lock);
+    bool found = strstr(s->text, needle) != NULL;
+    pthread_mutex_unlock(&s_sink_lock);
+    return found;
+}
+
+// waits until the sink has delivered or dropped everything up to expected
+// (counted from the start of the process); false on timeout
+static bool sink_settle(sink_t *s, uint32_t expected) {
+    for (int i = 0; i < 5000; i++) {
+        if (sink_count(s) + glog_sink_dropped(s->id) >= expected) return true;
+        usleep(1000);
+    }
+    return false;
+}
+
+// ---- console, stdout pointed at a temporary file ----
+
+static FILE *s_console;
+static int s_stdout_fd = -1;
+
+static void console_capture(void) {
+    fflush(stdout);
+    s_console = tmpfile();
+    s_stdout_fd = dup(1);
+    dup2(fileno(s_console), 1);
+}
+
+static void console_restore(void) {
+    fflush(stdout);
+    dup2(s_stdout_fd, 1);
+    close(s_stdout_fd);
+    fclose(s_console);
+}
+
+static void console_text(char *out, size_t size) {
+    ssize_t n = pread(fileno(s_console), out, size - 1, 0);
+    out[n > 0 ? n : 0] = '\0';
+}
+
+static bool console_wait(const char *needle) {
+    char text[16384];
+    for (int i = 0; i < 5000; i++) {
+        console_text(text, sizeof(text));
+        if (strstr(text, needle)) return true;
+        usleep(1000);
+    }
+    return false;
+}
+
+// ---- tests ----
+
+static uint32_t s_logged;       // lines glog was called with, all tests
+static uint32_t s_term_skipped; // of those, logged with the terminal disabled
+
+static bool term_settle(void) {
+    return sink_settle(&s_term, s_logged - s_term_skipped);
+}
+
+static void test_sinks(void) {
+    sinks_clear();
+    glog("hello %d", 42);
+    glog("already terminated\n");
+    s_logged += 2;
+    CHECK(term_settle());
+    CHECK_STR(s_term.text, "hello 42\nalready terminated\n");
+    CHECK(sink_settle(&s_web, s_logged));
+    CHECK_STR(s_web.text, "hello 42\nalready terminated\n");
+
+    // long lines are cut to 511 bytes and still end in a newline
+    char long_line[700];
+    memset(long_line, 'x', sizeof(long_line) - 1);
+    long_line[sizeof(long_line) - 1] = '\0';
+    sinks_clear();
+    glog("%s", long_line);
+    s_logged++;
+    CHECK(term_settle());
+    CHECK_EQ(strlen(s_term.text), 511);
+    CHECK_EQ(s_term.text[510], '\n');
+    CHECK(sink_settle(&s_web, s_logged));
+    CHECK_EQ(strlen(s_web.text), 511);
+
+    // a disabled sink is skipped, the others still get the line; the web
+    // log is last, so once it has the line the terminal worker has had it
+    sinks_clear();
+    glog_set_sink_enabled(GLOG_SINK_TERMINAL, false);
+    glog("quiet");
+    s_logged++;
+    CHECK(sink_settle(&s_web, s_logged));
+    usleep(20000);
+    glog_set_sink_enabled(GLOG_SINK_TERMINAL, true);
+    s_term_skipped++;
+    CHECK_STR(s_term.text, "");
+    CHECK_STR(s_web.text, "quiet\n");
+}
+
+static void test_defer(void) {
+    sinks_clear();
+    glog_set_defer(1);
+    glog("a");
+    glog("b");
+    glog("c");
+    s_logged += 3;
+    CHECK(sink_settle(&s_web, s_logged));
+    CHECK_STR(s_web.text, "a\nb\nc\n");
+#ifdef CONFIG_GLOG_INLINE_OUTPUT
+    // deferred lines skip the inline sinks until they are flushed
+    CHECK_STR(s_term.text, "");
+#else
+    // only the console waits: the terminal is not on the uart
+    CHECK(term_settle());
+    CHECK_STR(s_term.text, "a\nb\nc\n");
+#endif
+
+    glog_set_defer(0);
+    glog_flush_deferred();
+    CHECK(term_settle());
+    CHECK_STR(s_term.text, "a\nb\nc\n");
+    glog_flush_deferred();
+    usleep(20000);
+    CHECK_STR(s_term.text, "a\nb\nc\n");
+}
+
+static int count_lines(const char *text, const char *prefix) {
+    int n = 0;
+    for (const char *p = text; (p = strstr(p, prefix)) != NULL; p++) n++;
+    return n;
+}
+
+static void test_console(void) {
+    static char text[16384];
+    glog_set_sink_enabled(GLOG_SINK_CONSOLE, true);
+    console_capture();
+
+    glog("console %d", 1);
+    s_logged++;
+    CHECK(console_wait("console 1\n"));
+
+    // nothing reaches the console while a binary transfer owns the uart
+    glog_set_defer(1);
+    glog("held");
+    s_logged++;
+    usleep(20000);
+    console_text(text, sizeof(text));
+    CHECK(strstr(text, "held") == NULL);
+    glog_set_defer(0);
+    glog_flush_deferred();
+    CHECK(console_wait("console 1\nheld\n"));
+
+    // more deferred text than the ring holds: the oldest deferred lines are
+    // lost and counted against the console
+    uint32_t dropped = glog_sink_dropped(GLOG_SINK_CONSOLE);
+    glog_set_defer(1);
+    for (int i = 0; i < 100; i++) {
+        glog("deferred %03d %080d", i, 0);
+        s_logged++;
+    }
+    console_text(text, sizeof(text));
+    CHECK_EQ(count_lines(text, "deferred "), 0);
+    glog_set_defer(0);
+    glog_flush_deferred();
+    CHECK(console_wait("deferred 099"));
+    console_text(text, sizeof(text));
+    uint32_t flushed = (uint32_t)count_lines(text, "deferred ");
+    uint32_t lost = glog_sink_dropped(GLOG_SINK_CONSOLE) - dropped;
+    CHECK(lost > 0);
+    CHECK_EQ(flushed + lost, 100);
+    // what survives is the newest text
+    CHECK(strstr(text, "deferred 000") == NULL);
+
+    glog_set_sink_enabled(GLOG_SINK_CONSOLE, false);
+    console_restore();
+    CHECK(term_settle());
+    CHECK(sink_settle(&s_web, s_logged));
+}
+
+// stall one sink and log far more than the ring holds: the stalled sink
+// loses the oldest lines, the caller and the other sinks carry on
+static void test_slow_sink(sink_t *slow) {
+    CHECK(term_settle());
+    CHECK(sink_settle(&s_web, s_logged));
+    sink_t *sinks[] = {&s_term, &s_web};
+    uint32_t count[2], dropped[2];
+    for (int i = 0; i < 2; i++) {
+        count[i] = sink_count(sinks[i]);
+        dropped[i] = glog_sink_dropped(sinks[i]->id);
+    }
+
+    __atomic_store_n(&slow->hold, 1, __ATOMIC_RELEASE);
+    sinks_clear();
+    for (int i = 0; i < 200; i++) {
+        glog("line %03d %090d", i, 0);
+        s_logged++;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (sinks[i] == slow) continue;
+        CHECK(sinks[i] == &s_term ? term_settle() : sink_settle(sinks[i], s_logged));
+        CHECK(sink_has(sinks[i], "line 199"));
+    }
+    __atomic_store_n(&slow->hold, 0, __ATOMIC_RELEASE);
+
+    for (int i = 0; i < 2; i++) {
+        CHECK(sinks[i] == &s_term ? term_settle() : sink_settle(sinks[i], s_logged));
+        uint32_t delivered = sink_count(sinks[i]) - count[i];
+        uint32_t lost = glog_sink_dropped(sinks[i]->id) - dropped[i];
+        CHECK_EQ(delivered + lost, 200);
+        CHECK(sink_has(sinks[i], "line 199"));
+        if (sinks[i] == slow) CHECK(lost > 150);
+    }
+#ifdef CONFIG_GLOG_INLINE_OUTPUT
+    // the inline terminal never loses a line that was not deferred
+    CHECK_EQ(glog_sink_dropped(GLOG_SINK_TERMINAL), dropped[0]);
+#endif
+}
+
+typedef struct {
+    unsigned id;
+    int64_t ns;
+} producer_t;
+
+static void *producer(void *arg) {
+    producer_t *p = arg;
+    int64_t t0 = host_now_ns();
+    for (unsigned i = 0; i < LINES_PER_PRODUCER; i++) glog("p%u %u", p->id, i);
+    p->ns = host_now_ns() - t0;
+    return NULL;
+}
+
+static void test_producers(void) {
+    CHECK(term_settle());
+    CHECK(sink_settle(&s_web, s_logged));
+    sink_t *sinks[] = {&s_term, &s_web};
+    uint32_t count[2], dropped[2];
+    for (int i = 0; i < 2; i++) {
+        count[i] = sink_count(sinks[i]);
+        dropped[i] = glog_sink_dropped(sinks[i]->id);
+        for (int p = 0; p < PRODUCERS; p++) sinks[i]->last[p] = -1;
+    }
+
+    pthread_t threads[PRODUCERS];
+    producer_t prod[PRODUCERS];
+    for (unsigned i = 0; i < PRODUCERS; i++) {
+        prod[i].id = i;
+        pthread_create(&threads[i], NULL, producer, &prod[i]);
+    }
+    int64_t ns = 0;
+    for (int i = 0; i < PRODUCERS; i++) {
+        pthread_join(threads[i], NULL);
+        ns += prod[i].ns;
+    }
+    uint32_t total = PRODUCERS * LINES_PER_PRODUCER;
+    s_logged += total;
+
+    CHECK(term_settle());
+    CHECK(sink_settle(&s_web, s_logged));
+    uint32_t delivered[2], lost[2];
+    for (int i = 0; i < 2; i++) {
+        delivered[i] = sink_count(sinks[i]) - count[i];
+        lost[i] = glog_sink_dropped(sinks[i]->id) - dropped[i];
+    }
+    printf("%d producers x %d lines: %.0f ns/call, terminal got %u, dropped %u, web log got %u, "
+           "dropped %u\n",
+           PRODUCERS, LINES_PER_PRODUCER, (double)ns / total, delivered[0], lost[0], delivered[1],
+           lost[1]);
+
+    // every sink gets each line whole, at most once, in order per producer,
+    // or counts it as dropped
+    for (int i = 0; i < 2; i++) {
+        CHECK_EQ(delivered[i] + lost[i], total);
+        CHECK_EQ(sinks[i]->disorder, 0);
+    }
+    CHECK_EQ(s_corrupt, 0);
+#ifdef CONFIG_GLOG_INLINE_OUTPUT
+    CHECK_EQ(delivered[0], total);
+#endif
+}
+
+int main(void) {
+    // unbuffered, so console lines reach the capture file as they are printed
+    setvbuf(stdout, NULL, _IONBF, 0);
+    glog_set_sink_enabled(GLOG_SINK_CONSOLE, false);
+    test_sinks();
+    test_defer();
+    test_console();
+    test_slow_sink(&s_web);
+#ifndef CONFIG_GLOG_INLINE_OUTPUT
+    test_slow_sink(&s_term);
+#endif
+    test_producers();
+    return HOST_TEST_RESULT();
+}
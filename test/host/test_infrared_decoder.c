@@ -0,0 +1,207 @@
+// infrared decoder (managers/infrared_decoder.c) over the captures in
+// data/ir_frames.txt: every protocol clean, jittered and with split marks,
+// held buttons with repeat codes and toggles, and one of each back to back.
+// the preamble dispatch is held to the all-decoders loop it replaced
+// (ir_decoder_ref.h) timing by timing, on the corpus and on random timings
+// drawn around every protocol's windows and their exact edges, and with each
+// capture's preamble slid across those edges.
+
+#include "ir_decoder_ref.h"
+#include "host_test.h"
+
+static uint32_t s_rand = 0x2545f491;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+// what the receive loop takes from a frame: the first message, after which
+// it resets the decoder and the rest of the frame is not a new signal
+static void feed_frame(InfraredDecoderContext *dec, const ir_frame_t *fr, char *got, size_t size) {
+    snprintf(got, size, "none");
+    for (size_t i = 0; i < fr->timing_count; i++) {
+        InfraredDecodedMessage *m = infrared_decoder_decode(dec, i % 2 == 0, fr->timings[i]);
+        if (m) {
+            ir_format_message(got, size, m);
+            infrared_decoder_reset(dec);
+            return;
+        }
+    }
+}
+
+static void test_corpus(const ir_capture_t *caps, size_t count) {
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    CHECK(dec != NULL);
+    size_t frames = 0, decoded = 0;
+    for (size_t c = 0; c < count; c++) {
+        infrared_decoder_reset(dec);
+        for (size_t k = 0; k < caps[c].frame_count; k++) {
+            char got[64];
+            feed_frame(dec, &caps[c].frames[k], got, sizeof(got));
+            if (strcmp(got, caps[c].frames[k].expect) != 0) {
+                fprintf(stderr, "%s frame %zu:\n", caps[c].name, k);
+            }
+            CHECK_STR(got, caps[c].frames[k].expect);
+            frames++;
+            decoded += strcmp(got, "none") != 0;
+        }
+    }
+    // the corpus is all there: a dozen protocols, three variants each
+    CHECK(count >= 36);
+    CHECK(decoded > frames / 2);
+    infrared_decoder_free(dec);
+}
+
+// both decoders see the same timings; every call returns the same
+static bool same_step(InfraredDecoderContext *dec, InfraredDecoderContext *ref, bool level,
+                      uint32_t timing) {
+    char a[64], b[64];
+    ir_format_message(a, sizeof(a), infrared_decoder_decode(dec, level, timing));
+    ir_format_message(b, sizeof(b), ref_decoder_decode(ref, level, timing));
+    if (strcmp(a, b) == 0) return true;
+    fprintf(stderr, "level %d timing %u: dispatch %s, all decoders %s\n", level, timing, a, b);
+    CHECK_STR(a, b);
+    return false;
+}
+
+static void test_reference_corpus(const ir_capture_t *caps, size_t count) {
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    InfraredDecoderContext *ref = infrared_decoder_alloc();
+    // per capture from a reset, then everything as one stream
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t c = 0; c < count; c++) {
+            if (pass == 0) {
+                infrared_decoder_reset(dec);
+                infrared_decoder_reset(ref);
+            }
+            for (size_t k = 0; k < caps[c].frame_count; k++) {
+                const ir_frame_t *fr = &caps[c].frames[k];
+                for (size_t i = 0; i < fr->timing_count; i++) {
+                    if (!same_step(dec, ref, i % 2 == 0, fr->timings[i])) {
+                        fprintf(stderr, "in %s frame %zu\n", caps[c].name, k);
+                        goto next;
+                    }
+                }
+            }
+        next:;
+        }
+    }
+    infrared_decoder_free(dec);
+    infrared_decoder_free(ref);
+}
+
+// every nominal timing of every protocol, with the tolerance it is matched at
+static const uint32_t s_centers[][2] = {
+    {9000, 200}, {4500, 200}, {2250, 200}, {560, 120},  {1690, 120}, {550, 120},
+    {1650, 120}, {2400, 200}, {600, 200},  {1200, 200}, {888, 120},  {1776, 120},
+    {444, 120},  {888, 120},  {1332, 120}, {2666, 200}, {889, 200},  {4000, 200},
+    {500, 120},  {2000, 120}, {1000, 120}, {8500, 200}, {4225, 200}, {1500, 120},
+    {3360, 200}, {1665, 200}, {420, 120},  {1274, 120}, {40000, 0},  {5000, 0},
+};
+
+static uint32_t random_timing(void) {
+    const uint32_t *c = s_centers[rnd(sizeof(s_centers) / sizeof(s_centers[0]))];
+    switch (rnd(6)) {
+    case 0: return c[0] - c[1];     // just outside, bounds are exclusive
+    case 1: return c[0] - c[1] + 1; // just inside
+    case 2: return c[0] + c[1] - 1;
+    case 3: return c[0] + c[1];
+    case 4: return rnd(12000);
+    default: return c[0] - c[1] + rnd(2 * c[1] + 1);
+    }
+}
+
+static void test_reference_random(const ir_capture_t *caps, size_t count) {
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    InfraredDecoderContext *ref = infrared_decoder_alloc();
+    bool ok = true;
+    bool level = true;
+    for (int n = 0; n < 400000 && ok; n++) {
+        // now and then a real frame, so decoders are mid-frame when noise hits
+        if (rnd(500) == 0) {
+            const ir_capture_t *c = &caps[rnd((uint32_t)count)];
+            const ir_frame_t *fr = &c->frames[rnd((uint32_t)c->frame_count)];
+            size_t stop = rnd((uint32_t)fr->timing_count) + 1;
+            for (size_t i = 0; i < stop && ok; i++) {
+                ok = same_step(dec, ref, i % 2 == 0, fr->timings[i]);
+            }
+            level = stop % 2 == 0;
+            continue;
+        }
+        // mostly alternating, sometimes the same level twice
+        ok = same_step(dec, ref, level, random_timing());
+        if (rnd(50)) level = !level;
+        if (rnd(5000) == 0) {
+            infrared_decoder_reset(dec);
+            infrared_decoder_reset(ref);
+        }
+    }
+    CHECK(ok);
+    infrared_decoder_free(dec);
+    infrared_decoder_free(ref);
+}
+
+// a capture's first mark and space slid across every window edge, so a
+// frame that really follows hits the dispatch bounds exactly
+static void test_reference_edges(const ir_capture_t *caps, size_t count) {
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    InfraredDecoderContext *ref = infrared_decoder_alloc();
+    uint32_t t[IR_MAX_FRAME_TIMINGS];
+    bool ok = true;
+    for (size_t c = 0; c < count && ok; c++) {
+        const ir_frame_t *fr = &caps[c].frames[0];
+        for (size_t at = 0; at < 2; at++) {
+            for (int d = -260; d <= 260 && ok; d++) {
+                memcpy(t, fr->timings, fr->timing_count * sizeof(t[0]));
+                t[at] += d;
+                infrared_decoder_reset(dec);
+                infrared_decoder_reset(ref);
+                for (size_t i = 0; i < fr->timing_count && ok; i++) {
+                    ok = same_step(dec, ref, i % 2 == 0, t[i]);
+                }
+                if (!ok) fprintf(stderr, "in %s, timing %zu moved by %d\n", caps[c].name, at, d);
+            }
+        }
+    }
+    CHECK(ok);
+    infrared_decoder_free(dec);
+    infrared_decoder_free(ref);
+}
+
+// noise leaves nothing behind: a clean frame right after still decodes
+static void test_recovery(const ir_capture_t *caps, size_t count) {
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    for (size_t c = 0; c < count; c++) {
+        const ir_frame_t *fr = &caps[c].frames[0];
+        if (strstr(caps[c].name, " ") || strcmp(fr->expect, "none") == 0) continue;
+        for (int i = 0; i < 200; i++) infrared_decoder_decode(dec, i % 2 == 0, random_timing());
+        // the noise ends on a long space, as it would before a button press
+        infrared_decoder_decode(dec, false, 40000);
+        char got[64];
+        feed_frame(dec, fr, got, sizeof(got));
+        if (strcmp(got, fr->expect) != 0) fprintf(stderr, "%s after noise:\n", caps[c].name);
+        CHECK_STR(got, fr->expect);
+    }
+    infrared_decoder_free(dec);
+
+    CHECK(infrared_decoder_decode(NULL, true, 9000) == NULL);
+    CHECK_STR(infrared_protocol_to_string(InfraredProtocolKaseikyo), "Kaseikyo");
+    CHECK_STR(infrared_protocol_to_string(InfraredProtocolUnknown), "Unknown");
+}
+
+int main(void) {
+    size_t count = 0;
+    ir_capture_t *caps = ir_load_captures(host_data_path("ir_frames.txt"), &count);
+    CHECK(caps != NULL);
+    if (!caps) return HOST_TEST_RESULT();
+    test_corpus(caps, count);
+    test_reference_corpus(caps, count);
+    test_reference_random(caps, count);
+    test_reference_edges(caps, count);
+    test_recovery(caps, count);
+    ir_free_captures(caps, count);
+    return HOST_TEST_RESULT();
+}
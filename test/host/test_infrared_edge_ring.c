@@ -0,0 +1,432 @@
+// ir receiver edge path: the isr ring, the signal segmenter, and the corpus in
+// data/ir_edges.txt replayed through ring, segmenter and decoder the way
+// infrared_rx_gpio.c's receive loop drives them. the first frame of every
+// remote in data/ir_frames.txt is replayed the same way to report how long
+// after the end of its signal each result is ready, in signal time with the
+// receive loop's tick rounding at 1000 and 100 Hz, and in host cpu time.
+
+#include "managers/infrared_edge_ring.h"
+#include "managers/infrared_decoder.h"
+#include "ir_decoder_ref.h"
+#include "host_test.h"
+
+#define GAP_US 15000      // IR_RX_GAP_US
+#define MIN_TIMINGS 5     // IR_RX_MIN_TIMINGS
+#define DRAIN_BATCH 32    // IR_RX_DRAIN_BATCH
+#define MAX_EDGES 1024
+#define MAX_SIGNALS 16
+#define POLL_MS 10        // IR_RX_POLL_MS
+
+static void test_ring(void) {
+    static infrared_edge_ring_t r;
+    uint32_t out[INFRARED_EDGE_RING_SIZE + 8];
+    bool was_empty;
+
+    // start just short of the index wrap
+    memset(&r, 0, sizeof(r));
+    r.head = r.tail = UINT32_MAX - 4;
+
+    CHECK(infrared_edge_ring_push(&r, 100, &was_empty));
+    CHECK(was_empty);
+    CHECK(infrared_edge_ring_push(&r, 200, &was_empty));
+    CHECK(!was_empty);
+    CHECK_EQ(infrared_edge_ring_drain(&r, out, 8), 2);
+    CHECK_EQ(out[0], 100);
+    CHECK_EQ(out[1], 200);
+    CHECK_EQ(infrared_edge_ring_drain(&r, out, 8), 0);
+
+    // fill it, the next edge is dropped and counted
+    for (uint32_t i = 0; i < INFRARED_EDGE_RING_SIZE; i++) {
+        CHECK(infrared_edge_ring_push(&r, 1000 + i, &was_empty));
+        CHECK_EQ(was_empty, i == 0);
+    }
+    CHECK(!infrared_edge_ring_push(&r, 1, &was_empty));
+    CHECK(!was_empty);
+    CHECK_EQ(infrared_edge_ring_dropped(&r), 1);
+
+    // drained in order across the index wrap, in batches
+    size_t n = infrared_edge_ring_drain(&r, out, 10);
+    CHECK_EQ(n, 10);
+    n += infrared_edge_ring_drain(&r, out + n, sizeof(out) / sizeof(out[0]) - n);
+    CHECK_EQ(n, INFRARED_EDGE_RING_SIZE);
+    bool ordered = true;
+    for (size_t i = 0; i < n; i++) ordered &= out[i] == 1000 + i;
+    CHECK(ordered);
+
+    // reset throws away what is queued, the drop count stays
+    CHECK(infrared_edge_ring_push(&r, 5, &was_empty));
+    infrared_edge_ring_reset(&r);
+    CHECK_EQ(infrared_edge_ring_drain(&r, out, 8), 0);
+    CHECK_EQ(infrared_edge_ring_dropped(&r), 1);
+}
+
+// pushes edges and returns how many intervals they closed
+static int seg_feed(infrared_edge_seg_t *seg, const uint32_t *ts, size_t n, bool *levels,
+                    uint32_t *durations) {
+    int closed = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (infrared_edge_seg_push(seg, ts[i], &levels[closed], &durations[closed])) closed++;
+    }
+    return closed;
+}
+
+static void test_seg(void) {
+    static infrared_edge_seg_t seg;
+    bool lv[16];
+    uint32_t d[16];
+    infrared_edge_seg_init(&seg, GAP_US);
+
+    // signals start with a mark and alternate
+    const uint32_t a[] = {1000, 10000, 14500, 15060};
+    CHECK_EQ(seg_feed(&seg, a, 4, lv, d), 3);
+    CHECK(lv[0] && !lv[1] && lv[2]);
+    CHECK_EQ(d[0], 9000);
+    CHECK_EQ(d[1], 4500);
+    CHECK_EQ(d[2], 560);
+    CHECK_EQ(seg.count, 3);
+    CHECK(!infrared_edge_seg_expired(&seg, 15060 + GAP_US - 1));
+    CHECK(infrared_edge_seg_expired(&seg, 15060 + GAP_US));
+
+    // an edge after the gap starts a new signal, with a mark again
+    const uint32_t b[] = {40000, 40600};
+    CHECK_EQ(seg_feed(&seg, b, 2, lv, d), 1);
+    CHECK(lv[0]);
+    CHECK_EQ(seg.count, 1);
+
+    // across the timer wrap
+    infrared_edge_seg_init(&seg, GAP_US);
+    const uint32_t w[] = {UINT32_MAX - 99, 400, 900};
+    CHECK_EQ(seg_feed(&seg, w, 3, lv, d), 2);
+    CHECK_EQ(d[0], 500);
+    CHECK(lv[0] && !lv[1]);
+
+    // resync: everything up to the next gap is skipped
+    infrared_edge_seg_resync(&seg, 1000);
+    const uint32_t r[] = {1500, 2000, 2000 + GAP_US, 2000 + GAP_US + 700};
+    CHECK_EQ(seg_feed(&seg, r, 4, lv, d), 1);
+    CHECK(lv[0]);
+    CHECK_EQ(d[0], 700);
+
+    // past the raw buffer the timings stop but the decoder still gets them
+    infrared_edge_seg_init(&seg, GAP_US);
+    bool level;
+    uint32_t duration;
+    infrared_edge_seg_push(&seg, 0, &level, &duration);
+    for (uint32_t i = 1; i <= INFRARED_EDGE_SEG_MAX + 10; i++) {
+        CHECK(infrared_edge_seg_push(&seg, i * 100, &level, &duration));
+    }
+    CHECK_EQ(seg.count, INFRARED_EDGE_SEG_MAX);
+    CHECK(seg.truncated);
+}
+
+static void test_seg_same_microsecond(void) {
+    static infrared_edge_seg_t seg;
+    bool lv[16];
+    uint32_t d[16];
+
+    // a bounce (three edges in one microsecond) is one edge
+    infrared_edge_seg_init(&seg, GAP_US);
+    const uint32_t bounce[] = {1000, 10000, 10000, 10000, 14500, 15060};
+    CHECK_EQ(seg_feed(&seg, bounce, 6, lv, d), 3);
+    CHECK(lv[0] && !lv[1] && lv[2]);
+    CHECK_EQ(d[1], 4500);
+    CHECK_EQ(seg.count, 3);
+
+    // a blip pair inside the mark leaves the level alone; the raw copy joins
+    // the two halves back up and keeps alternating
+    infrared_edge_seg_init(&seg, GAP_US);
+    const uint32_t blip[] = {1000, 4000, 4000, 10000, 14500, 15060};
+    CHECK_EQ(seg_feed(&seg, blip, 6, lv, d), 4);
+    CHECK(lv[0] && lv[1] && !lv[2] && lv[3]);
+    CHECK_EQ(seg.count, 3);
+    CHECK_EQ(seg.timings[0], 9000);
+    CHECK_EQ(seg.timings[1], 4500);
+    CHECK_EQ(seg.timings[2], 560);
+
+    // a blip as the very first edges is no signal at all
+    infrared_edge_seg_init(&seg, GAP_US);
+    const uint32_t lead[] = {1000, 1000, 2000, 11000};
+    CHECK_EQ(seg_feed(&seg, lead, 4, lv, d), 1);
+    CHECK(lv[0]);
+    CHECK_EQ(d[0], 9000);
+}
+
+// ---- corpus replay ----
+
+typedef struct {
+    char expect[64];                  // "NEC 0x04 0x08", "raw" or "none"
+    uint32_t timings[512];            // raw only
+    size_t timing_count;
+} expected_t;
+
+typedef struct {
+    char got[64];
+    uint32_t timings[INFRARED_EDGE_SEG_MAX];
+    size_t timing_count;
+    bool truncated;
+} result_t;
+
+static result_t s_results[MAX_SIGNALS];
+static size_t s_result_count;
+
+static void record_decoded(const InfraredDecodedMessage *m) {
+    if (s_result_count >= MAX_SIGNALS) return;
+    result_t *r = &s_results[s_result_count++];
+    snprintf(r->got, sizeof(r->got), "%s 0x%02lx 0x%02lx", infrared_protocol_to_string(m->protocol),
+             (unsigned long)m->address, (unsigned long)m->command);
+}
+
+// ir_rx_finish_signal
+static void finish_signal(infrared_edge_seg_t *seg, InfraredDecoderContext *dec) {
+    size_t count = seg->count;
+    bool truncated = seg->truncated;
+    infrared_edge_seg_reset(seg);
+    if (count < MIN_TIMINGS) {
+        infrared_decoder_reset(dec);
+        return;
+    }
+    InfraredDecodedMessage *m = infrared_decoder_decode(dec, false, 0);
+    infrared_decoder_reset(dec);
+    if (m) {
+        record_decoded(m);
+        return;
+    }
+    if (s_result_count >= MAX_SIGNALS) return;
+    result_t *r = &s_results[s_result_count++];
+    snprintf(r->got, sizeof(r->got), "raw");
+    memcpy(r->timings, seg->timings, count * sizeof(uint32_t));
+    r->timing_count = count;
+    r->truncated = truncated;
+}
+
+// the receive loop: edges reach the task in ring batches
+static void replay(const uint32_t *edges, size_t n) {
+    static infrared_edge_ring_t ring;
+    static infrared_edge_seg_t seg;
+    memset(&ring, 0, sizeof(ring));
+    infrared_edge_seg_init(&seg, GAP_US);
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+    CHECK(dec != NULL);
+    if (!dec) return;
+
+    size_t pushed = 0;
+    while (pushed < n) {
+        // the isr runs ahead of the task by up to a few batches
+        size_t burst = 3 * DRAIN_BATCH + (pushed % 7);
+        for (size_t i = 0; i < burst && pushed < n; i++) {
+            bool was_empty;
+            CHECK(infrared_edge_ring_push(&ring, edges[pushed++], &was_empty));
+        }
+        uint32_t batch[DRAIN_BATCH];
+        size_t got;
+        while ((got = infrared_edge_ring_drain(&ring, batch, DRAIN_BATCH)) > 0) {
+            for (size_t i = 0; i < got; i++) {
+                if (infrared_edge_seg_expired(&seg, batch[i])) finish_signal(&seg, dec);
+                bool level;
+                uint32_t duration;
+                if (!infrared_edge_seg_push(&seg, batch[i], &level, &duration)) continue;
+                InfraredDecodedMessage *m = infrared_decoder_decode(dec, level, duration);
+                if (m) {
+                    record_decoded(m);
+                    infrared_edge_seg_resync(&seg, batch[i]);
+                    infrared_decoder_reset(dec);
+                }
+            }
+        }
+    }
+    // silence after the last edge
+    if (infrared_edge_seg_expired(&seg, edges[n - 1] + GAP_US)) finish_signal(&seg, dec);
+    CHECK_EQ(infrared_edge_ring_dropped(&ring), 0);
+    infrared_decoder_free(dec);
+}
+
+static void test_corpus(void) {
+    FILE *f = fopen(host_data_path("ir_edges.txt"), "r");
+    CHECK(f != NULL);
+    if (!f) return;
+
+    static uint32_t edges[MAX_EDGES * MAX_SIGNALS];
+    static expected_t expected[MAX_SIGNALS];
+    static char line[16384];
+    size_t edge_count = 0, signal_count = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        if (strncmp(line, "expect ", 7) == 0 && signal_count < MAX_SIGNALS) {
+            expected_t *e = &expected[signal_count++];
+            char *p = line + 7;
+            if (strncmp(p, "raw ", 4) == 0) {
+                snprintf(e->expect, sizeof(e->expect), "raw");
+                for (char *tok = strtok(p + 4, " \n"); tok && e->timing_count < 512;
+                     tok = strtok(NULL, " \n")) {
+                    e->timings[e->timing_count++] = (uint32_t)strtoul(tok, NULL, 10);
+                }
+            } else {
+                p[strcspn(p, "\n")] = '\0';
+                snprintf(e->expect, sizeof(e->expect), "%.63s", p);
+            }
+        } else if (strncmp(line, "edges ", 6) == 0) {
+            for (char *tok = strtok(line + 6, " \n"); tok && edge_count < MAX_EDGES * MAX_SIGNALS;
+                 tok = strtok(NULL, " \n")) {
+                edges[edge_count++] = (uint32_t)strtoul(tok, NULL, 10);
+            }
+        }
+    }
+    fclose(f);
+    CHECK(signal_count > 0);
+    CHECK(edge_count > 0);
+    if (!edge_count) return;
+
+    s_result_count = 0;
+    replay(edges, edge_count);
+
+    // "none" signals leave no result, everything else one, in order
+    size_t r = 0;
+    for (size_t i = 0; i < signal_count; i++) {
+        const expected_t *e = &expected[i];
+        if (strcmp(e->expect, "none") == 0) continue;
+        CHECK(r < s_result_count);
+        if (r >= s_result_count) break;
+        const result_t *res = &s_results[r++];
+        printf("signal %zu: want %-20s got %s\n", i, e->expect, res->got);
+        CHECK_STR(res->got, e->expect);
+        if (strcmp(e->expect, "raw") != 0 || strcmp(res->got, "raw") != 0) continue;
+
+        size_t kept = e->timing_count < INFRARED_EDGE_SEG_MAX ? e->timing_count : INFRARED_EDGE_SEG_MAX;
+        CHECK_EQ(res->timing_count, kept);
+        CHECK_EQ(res->truncated, e->timing_count > INFRARED_EDGE_SEG_MAX);
+        size_t same = 0;
+        while (same < kept && res->timings[same] == e->timings[same]) same++;
+        CHECK_EQ(same, kept);
+    }
+    CHECK_EQ(r, s_result_count);
+}
+
+// ---- latency, end of signal to result ----
+
+// when the receive loop's wait for a silent signal returns: it sleeps until
+// the gap runs out in whole ms, converted to ticks as pdMS_TO_TICKS does,
+// plus one, and never longer than the poll interval
+static uint32_t gap_wake(uint32_t last_ts, uint32_t tick_us) {
+    uint32_t now = last_ts;
+    while (now - last_ts < GAP_US) {
+        uint32_t left_ms = (GAP_US - (now - last_ts) + 999) / 1000;
+        uint32_t ticks = left_ms * 1000 / tick_us + 1;
+        uint32_t poll = POLL_MS * 1000 / tick_us;
+        if (poll < ticks) ticks = poll;
+        // a wait of n ticks ends on the n-th tick boundary from now
+        now = (now / tick_us + ticks) * tick_us;
+    }
+    return now;
+}
+
+typedef struct {
+    char got[64];
+    bool on_edge;     // decoded as an edge arrived, not when the gap ran out
+    int32_t fast_us;  // result time minus the signal's last edge, 1000 Hz tick
+    int32_t slow_us;  // the same at 100 Hz
+    double cpu_ns;    // host time for the step that produced the result
+} latency_t;
+
+// one frame through ring, segmenter and decoder as the receive loop runs
+// them; the frame's last timing is the silence after it
+static void replay_latency(const ir_frame_t *fr, InfraredDecoderContext *dec, latency_t *out) {
+    static infrared_edge_ring_t ring;
+    static infrared_edge_seg_t seg;
+    memset(&ring, 0, sizeof(ring));
+    infrared_edge_seg_init(&seg, GAP_US);
+    infrared_decoder_reset(dec);
+    snprintf(out->got, sizeof(out->got), "none");
+
+    uint32_t t = 100000, end = t;
+    bool was_empty;
+    infrared_edge_ring_push(&ring, t, &was_empty);
+    for (size_t i = 0; i + 1 < fr->timing_count; i++) {
+        end = t += fr->timings[i];
+        infrared_edge_ring_push(&ring, t, &was_empty);
+    }
+
+    uint32_t batch[DRAIN_BATCH];
+    size_t got;
+    while ((got = infrared_edge_ring_drain(&ring, batch, DRAIN_BATCH)) > 0) {
+        for (size_t i = 0; i < got; i++) {
+            int64_t t0 = host_now_ns();
+            bool level;
+            uint32_t duration;
+            if (!infrared_edge_seg_push(&seg, batch[i], &level, &duration)) continue;
+            InfraredDecodedMessage *m = infrared_decoder_decode(dec, level, duration);
+            if (!m) continue;
+            ir_format_message(out->got, sizeof(out->got), m);
+            infrared_edge_seg_resync(&seg, batch[i]);
+            infrared_decoder_reset(dec);
+            out->cpu_ns = (double)(host_now_ns() - t0);
+            out->on_edge = true;
+            out->fast_us = out->slow_us = (int32_t)(batch[i] - end);
+            return;
+        }
+    }
+
+    // silent: ir_rx_finish_signal once the wait runs out
+    int64_t t0 = host_now_ns();
+    infrared_edge_seg_reset(&seg);
+    InfraredDecodedMessage *m = infrared_decoder_decode(dec, false, 0);
+    if (m) ir_format_message(out->got, sizeof(out->got), m);
+    infrared_decoder_reset(dec);
+    out->cpu_ns = (double)(host_now_ns() - t0);
+    out->on_edge = false;
+    out->fast_us = (int32_t)(gap_wake(end, 1000) - end);
+    out->slow_us = (int32_t)(gap_wake(end, 10000) - end);
+}
+
+static void test_latency(void) {
+    size_t count = 0;
+    ir_capture_t *caps = ir_load_captures(host_data_path("ir_frames.txt"), &count);
+    CHECK(caps != NULL);
+    if (!caps) return;
+    InfraredDecoderContext *dec = infrared_decoder_alloc();
+
+    CHECK_EQ(gap_wake(0, 1000), GAP_US + 1000);
+    CHECK_EQ(gap_wake(0, 10000), 20000);
+
+    printf("end of signal to result (negative: before the stop mark ends):\n");
+    int on_edge = 0, at_gap = 0;
+    for (size_t c = 0; c < count; c++) {
+        // one remote each, the clean captures
+        if (strchr(caps[c].name, ' ') || strcmp(caps[c].name, "mixed") == 0) continue;
+        const ir_frame_t *fr = &caps[c].frames[0];
+        latency_t l = {0};
+        double cpu = 0;
+        enum { ROUNDS = 200 };
+        for (int r = 0; r < ROUNDS; r++) {
+            replay_latency(fr, dec, &l);
+            cpu += l.cpu_ns;
+        }
+        printf("  %-28s %-9s %6d us at 1000 Hz %6d us at 100 Hz, %5.0f ns cpu\n", l.got,
+               l.on_edge ? "on edge" : "at gap", l.fast_us, l.slow_us, cpu / ROUNDS);
+        CHECK_STR(l.got, fr->expect);
+        if (l.on_edge) {
+            on_edge++;
+            // no later than the last edge, at most one trailing mark early
+            CHECK(l.fast_us <= 0 && l.fast_us > -1000);
+        } else {
+            at_gap++;
+            CHECK(l.fast_us >= GAP_US && l.fast_us <= GAP_US + 2000);
+            CHECK(l.slow_us >= GAP_US && l.slow_us <= GAP_US + 10000);
+        }
+    }
+    // the old capture-then-decode path waited for a 15 ms timer and then a
+    // 10 ms poll on every signal
+    printf("  %d on an edge, %d at the gap; before the edge ring: %d-%d us for all\n", on_edge,
+           at_gap, GAP_US, GAP_US + POLL_MS * 1000);
+    CHECK(on_edge > at_gap);
+    infrared_decoder_free(dec);
+    ir_free_captures(caps, count);
+}
+
+int main(void) {
+    test_ring();
+    test_seg();
+    test_seg_same_microsecond();
+    test_corpus();
+    test_latency();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,385 @@
+// .ir reader and signal index (managers/infrared_file.c) over the flipper
+// files in data/ir/, copied to a scratch directory so the .gidx caches land
+// there. well-formed files are held to the whole-file parser it replaced
+// (ir_file_ref.h), also with every block boundary moved through them;
+// malformed.ir is checked line by line. the index has to match a full parse
+// and reload every signal, be reused while the file is unchanged and rebuilt
+// when it grows, is touched, or its cache is damaged. fopen is wrapped at
+// link time to count reads of the .ir file itself.
+
+#include "managers/infrared_file.h"
+#include "ir_file_ref.h"
+#include "host_test.h"
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+FILE *__real_fopen(const char *path, const char *mode);
+
+static int s_ir_reads;
+
+FILE *__wrap_fopen(const char *path, const char *mode) {
+    size_t n = strlen(path);
+    if (n > 3 && strcmp(path + n - 3, ".ir") == 0) s_ir_reads++;
+    return __real_fopen(path, mode);
+}
+
+static char s_dir[] = "/tmp/test_infrared_file_XXXXXX";
+
+static const char *const s_good[] = {"samsung_tv.ir", "lg_ac.ir", "universal_tv.ir"};
+
+// two at a time, for copies
+static const char *scratch(const char *name) {
+    static char path[2][PATH_MAX];
+    static int next;
+    char *p = path[next++ % 2];
+    snprintf(p, PATH_MAX, "%s/%s", s_dir, name);
+    return p;
+}
+
+static void copy_file(const char *from, const char *to, const char *prefix) {
+    FILE *in = __real_fopen(from, "rb");
+    FILE *out = __real_fopen(to, "wb");
+    CHECK(in && out);
+    if (!in || !out) return;
+    if (prefix) fputs(prefix, out);
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), in)) > 0) fwrite(buf, 1, n, out);
+    fclose(in);
+    fclose(out);
+}
+
+static void append(const char *path, const char *text) {
+    FILE *f = __real_fopen(path, "ab");
+    fputs(text, f);
+    fclose(f);
+}
+
+static bool exists(const char *path) {
+    return access(path, F_OK) == 0;
+}
+
+static bool same_signal(const infrared_signal_t *a, const infrared_signal_t *b) {
+    if (strcmp(a->name, b->name) != 0 || a->is_raw != b->is_raw) return false;
+    if (!a->is_raw) {
+        return strcmp(a->payload.message.protocol, b->payload.message.protocol) == 0 &&
+               a->payload.message.address == b->payload.message.address &&
+               a->payload.message.command == b->payload.message.command;
+    }
+    return a->payload.raw.frequency == b->payload.raw.frequency &&
+           a->payload.raw.duty_cycle == b->payload.raw.duty_cycle &&
+           a->payload.raw.timings_size == b->payload.raw.timings_size &&
+           (a->payload.raw.timings_size == 0 ||
+            memcmp(a->payload.raw.timings, b->payload.raw.timings,
+                   a->payload.raw.timings_size * sizeof(uint32_t)) == 0);
+}
+
+// the streaming reader against the old parser, signal by signal
+static bool same_as_ref(const char *path) {
+    infrared_signal_t *got = NULL, *want = NULL;
+    size_t got_n = 0, want_n = 0;
+    bool ok = infrared_file_read_list(path, &got, &got_n) && ref_read_list(path, &want, &want_n) &&
+              got_n == want_n;
+    for (size_t i = 0; ok && i < got_n; i++) {
+        ok = same_signal(&got[i], &want[i]);
+        if (!ok) fprintf(stderr, "%s: signal %zu (%s) differs\n", path, i, want[i].name);
+    }
+    ref_free_signals(got, got_n);
+    ref_free_signals(want, want_n);
+    return ok;
+}
+
+static void test_parsed(void) {
+    infrared_signal_t *s = NULL;
+    size_t n = 0;
+    CHECK(infrared_file_read_list(scratch("samsung_tv.ir"), &s, &n));
+    CHECK_EQ(n, 15);
+    CHECK_STR(s[0].name, "Power");
+    CHECK(!s[0].is_raw);
+    CHECK_STR(s[0].payload.message.protocol, "Samsung32");
+    CHECK_EQ(s[0].payload.message.address, 0x07);
+    CHECK_EQ(s[0].payload.message.command, 0x02);
+    CHECK_STR(s[14].name, "Exit");
+    CHECK_EQ(s[14].payload.message.command, 0x2d);
+    ref_free_signals(s, n);
+
+    for (size_t i = 0; i < sizeof(s_good) / sizeof(s_good[0]); i++) {
+        CHECK(same_as_ref(scratch(s_good[i])));
+    }
+}
+
+static void test_raw(void) {
+    infrared_signal_t *s = NULL;
+    size_t n = 0;
+    CHECK(infrared_file_read_list(scratch("lg_ac.ir"), &s, &n));
+    CHECK_EQ(n, 7);
+    CHECK(s[0].is_raw);
+    CHECK_EQ(s[0].payload.raw.frequency, 38000);
+    CHECK(s[0].payload.raw.duty_cycle > 0.329f && s[0].payload.raw.duty_cycle < 0.331f);
+    // header, 28 bits, stop mark; the held button is three of those
+    CHECK_EQ(s[0].payload.raw.timings_size, 2 + 56 + 1);
+    CHECK_EQ(s[6].payload.raw.timings_size, 3 * 59 + 2);
+    ref_free_signals(s, n);
+
+    // crlf, indented keys and tabs; the long raw lines span several blocks
+    CHECK(infrared_file_read_list(scratch("universal_tv.ir"), &s, &n));
+    CHECK_EQ(n, 13 * 6 + 3 + 2);
+    CHECK(s[80].is_raw && s[80].payload.raw.timings_size > INFRARED_FILE_BLOCK / 4);
+    CHECK_STR(s[81].name, "Input");
+    CHECK_STR(s[81].payload.message.protocol, "NEC");
+    CHECK_EQ(s[81].payload.message.command, 0x0b);
+    CHECK_STR(s[82].name, "Sleep");
+    CHECK_EQ(s[82].payload.raw.frequency, 36000);
+    CHECK_EQ(s[82].payload.raw.timings_size, 6);
+    CHECK_EQ(s[82].payload.raw.timings[2], 1778);
+    ref_free_signals(s, n);
+}
+
+// a comment of every length up to two blocks in front, so each line break,
+// key and timing of the files lands on a block boundary at some point
+static void test_block_edges(void) {
+    static char pad[2 * INFRARED_FILE_BLOCK + 3];
+    bool ok = true;
+    for (size_t f = 0; f < sizeof(s_good) / sizeof(s_good[0]) && ok; f++) {
+        char from[PATH_MAX];
+        snprintf(from, sizeof(from), "%s", scratch(s_good[f]));
+        for (size_t len = 0; len <= 2 * INFRARED_FILE_BLOCK && ok; len += f == 2 ? 7 : 1) {
+            pad[0] = '#';
+            memset(pad + 1, 'x', len);
+            pad[len + 1] = '\n';
+            pad[len + 2] = '\0';
+            copy_file(from, scratch("padded.ir"), pad);
+            ok = same_as_ref(scratch("padded.ir"));
+            if (!ok) fprintf(stderr, "%s with %zu bytes in front\n", s_good[f], len + 2);
+        }
+    }
+    CHECK(ok);
+    unlink(scratch("padded.ir"));
+}
+
+static void test_malformed(void) {
+    infrared_signal_t *s = NULL;
+    size_t n = 0;
+    CHECK(infrared_file_read_list(scratch("malformed.ir"), &s, &n));
+    CHECK_EQ(n, 8);
+    if (n != 8) return;
+    // fields before the first name, lines without a colon and oversized
+    // keys are skipped
+    CHECK_STR(s[0].name, "Power");
+    CHECK_STR(s[0].payload.message.protocol, "NEC");
+    CHECK_EQ(s[0].payload.message.address, 0x04);
+    CHECK_EQ(s[0].payload.message.command, 0x08);
+    // a data line that is not all numbers gives no timings, not some
+    CHECK_STR(s[1].name, "Letters");
+    CHECK(s[1].is_raw);
+    CHECK_EQ(s[1].payload.raw.timings_size, 0);
+    CHECK(s[1].payload.raw.timings == NULL);
+    CHECK_EQ(s[1].payload.raw.frequency, 38000);
+    CHECK_STR(s[2].name, "Glued");
+    CHECK_EQ(s[2].payload.raw.timings_size, 0);
+    // the last data line wins
+    CHECK_STR(s[3].name, "Overwritten");
+    CHECK_EQ(s[3].payload.raw.timings_size, 2);
+    CHECK_EQ(s[3].payload.raw.timings[1], 5);
+    // hex bytes stop at the first one that is not hex
+    CHECK_STR(s[4].name, "Bad_hex");
+    CHECK_EQ(s[4].payload.message.address, 0);
+    CHECK_EQ(s[4].payload.message.command, 0x1f);
+    CHECK_EQ(strlen(s[5].name), sizeof(s[5].name) - 1);
+    CHECK(strncmp(s[5].name, "A_name_much_longer", 18) == 0);
+    CHECK_STR(s[5].payload.message.protocol, "Unknown_protocol");
+    // no type line reads as parsed
+    CHECK_STR(s[6].name, "No_type");
+    CHECK(!s[6].is_raw);
+    CHECK_EQ(s[6].payload.message.address, 0x05);
+    // the file ends without a newline
+    CHECK_STR(s[7].name, "Last");
+    CHECK_EQ(s[7].payload.raw.timings_size, 3);
+    CHECK_EQ(s[7].payload.raw.timings[2], 300);
+    ref_free_signals(s, n);
+
+    CHECK(!infrared_file_read_list(scratch("remote.json"), &s, &n));
+    CHECK(!infrared_file_read_list(scratch("missing.ir"), &s, &n));
+}
+
+// every entry says what a full parse says and reloads to the same signal
+static bool index_matches(const char *path, const infrared_file_index_t *index) {
+    infrared_signal_t *s = NULL;
+    size_t n = 0;
+    if (!infrared_file_read_list(path, &s, &n) || n != index->count) {
+        ref_free_signals(s, n);
+        return false;
+    }
+    bool ok = true;
+    for (size_t i = 0; i < n && ok; i++) {
+        const char *proto = infrared_file_index_protocol(index, i);
+        ok = strcmp(infrared_file_index_name(index, i), s[i].name) == 0 &&
+             index->entries[i].is_raw == s[i].is_raw;
+        if (ok && !s[i].is_raw) {
+            ok = index->entries[i].address == s[i].payload.message.address &&
+                 index->entries[i].command == s[i].payload.message.command &&
+                 (proto ? strcmp(proto, s[i].payload.message.protocol) == 0
+                        : strcmp(s[i].payload.message.protocol, "Unknown_protocol") == 0);
+        } else if (ok) {
+            ok = proto == NULL;
+        }
+        infrared_signal_t one;
+        ok = ok && infrared_file_index_load(index, i, &one);
+        if (ok) {
+            ok = same_signal(&one, &s[i]);
+            infrared_manager_free_signal(&one);
+        }
+        if (!ok) fprintf(stderr, "%s: index entry %zu (%s) differs\n", path, i, s[i].name);
+    }
+    ref_free_signals(s, n);
+    return ok;
+}
+
+static void test_index(void) {
+    const char *files[] = {"samsung_tv.ir", "lg_ac.ir", "universal_tv.ir", "malformed.ir"};
+    const char *caches[] = {".samsung_tv.gidx", ".lg_ac.gidx", ".universal_tv.gidx",
+                            ".malformed.gidx"};
+    for (size_t f = 0; f < 4; f++) {
+        infrared_file_index_t index;
+        CHECK(!exists(scratch(caches[f])));
+        CHECK(infrared_file_index_open(scratch(files[f]), &index));
+        CHECK(exists(scratch(caches[f])));
+        CHECK(index_matches(scratch(files[f]), &index));
+        infrared_file_index_close(&index);
+
+        // the second open comes from the cache alone
+        s_ir_reads = 0;
+        CHECK(infrared_file_index_open(scratch(files[f]), &index));
+        CHECK_EQ(s_ir_reads, 0);
+        CHECK(index_matches(scratch(files[f]), &index));
+        infrared_file_index_close(&index);
+    }
+
+    infrared_file_index_t index;
+    CHECK(!infrared_file_index_open(scratch("remote.json"), &index));
+    CHECK(!exists(scratch(".remote.gidx")));
+    CHECK(!infrared_file_index_open(scratch("missing.ir"), &index));
+    CHECK(!infrared_file_index_open(s_dir, &index));
+    CHECK(!infrared_file_index_open(NULL, &index));
+    CHECK(infrared_file_index_name(&index, 0) == NULL);
+}
+
+static size_t open_count(const char *name, int *reads) {
+    infrared_file_index_t index;
+    s_ir_reads = 0;
+    size_t n = infrared_file_index_open(scratch(name), &index) ? index.count : 0;
+    *reads = s_ir_reads;
+    if (n) CHECK(index_matches(scratch(name), &index));
+    infrared_file_index_close(&index);
+    return n;
+}
+
+static void damage_cache(const char *cache, long at, const void *bytes, size_t len) {
+    FILE *f = __real_fopen(cache, "r+b");
+    fseek(f, at, SEEK_SET);
+    fwrite(bytes, 1, len, f);
+    fclose(f);
+}
+
+// the cache goes when the .ir changes or the cache itself is not sound
+static void test_invalidation(void) {
+    copy_file(scratch("samsung_tv.ir"), scratch("tv.ir"), NULL);
+    char cache[PATH_MAX];
+    snprintf(cache, sizeof(cache), "%s", scratch(".tv.gidx"));
+    int reads;
+    CHECK_EQ(open_count("tv.ir", &reads), 15);
+    CHECK(reads > 0);
+    CHECK_EQ(open_count("tv.ir", &reads), 15);
+    CHECK_EQ(reads, 0);
+
+    // grown: a button learned and saved
+    append(scratch("tv.ir"), "#\nname: Sleep\ntype: parsed\nprotocol: Samsung32\n"
+                             "address: 07 00 00 00\ncommand: 03 00 00 00\n");
+    CHECK_EQ(open_count("tv.ir", &reads), 16);
+    CHECK(reads > 0);
+    CHECK_EQ(open_count("tv.ir", &reads), 16);
+    CHECK_EQ(reads, 0);
+
+    // same size, new mtime: a button renamed in place
+    struct stat st;
+    stat(scratch("tv.ir"), &st);
+    damage_cache(scratch("tv.ir"), st.st_size - 81, "Doze!", 5);
+    struct timeval tv[2] = {{st.st_atime, 0}, {st.st_mtime + 10, 0}};
+    utimes(scratch("tv.ir"), tv);
+    CHECK_EQ(open_count("tv.ir", &reads), 16);
+    CHECK(reads > 0);
+    infrared_file_index_t index;
+    CHECK(infrared_file_index_open(scratch("tv.ir"), &index));
+    CHECK_STR(infrared_file_index_name(&index, 15), "Doze!");
+    infrared_file_index_close(&index);
+
+    // bad magic, version, entry size, a count of zero, a name off the end of
+    // the pool, a truncated file: each rebuilt, then reused
+    static const struct {
+        long at;
+        uint32_t value;
+    } damage[] = {{0, 0}, {4, 2}, {6, 1}, {16, 0}, {16, 1000}, {24 + 4, 0x7fffffff}, {20, 0}};
+    for (size_t i = 0; i < sizeof(damage) / sizeof(damage[0]); i++) {
+        damage_cache(cache, damage[i].at, &damage[i].value, i == 1 || i == 2 ? 2 : 4);
+        CHECK_EQ(open_count("tv.ir", &reads), 16);
+        if (reads == 0) fprintf(stderr, "cache damage %zu not noticed\n", i);
+        CHECK(reads > 0);
+        CHECK_EQ(open_count("tv.ir", &reads), 16);
+        CHECK_EQ(reads, 0);
+    }
+    if (truncate(cache, 40) != 0) perror("truncate");
+    CHECK_EQ(open_count("tv.ir", &reads), 16);
+    CHECK(reads > 0);
+}
+
+static void test_forget(void) {
+    infrared_file_index_t index;
+    copy_file(scratch("samsung_tv.ir"), scratch("gone.ir"), NULL);
+    CHECK(infrared_file_index_open(scratch("gone.ir"), &index));
+    infrared_file_index_close(&index);
+    CHECK(exists(scratch(".gone.gidx")));
+    unlink(scratch("gone.ir"));
+    infrared_file_index_forget(scratch("gone.ir"));
+    CHECK(!exists(scratch(".gone.gidx")));
+
+    // .IR as the web ui uploads it; other extensions are left alone
+    copy_file(scratch("samsung_tv.ir"), scratch("UPPER.IR"), NULL);
+    CHECK(infrared_file_index_open(scratch("UPPER.IR"), &index));
+    infrared_file_index_close(&index);
+    CHECK(exists(scratch(".UPPER.gidx")));
+    infrared_file_index_forget(scratch("UPPER.IR"));
+    CHECK(!exists(scratch(".UPPER.gidx")));
+    copy_file(scratch("samsung_tv.ir"), scratch(".remote.gidx"), NULL);
+    infrared_file_index_forget(scratch("remote.json"));
+    CHECK(exists(scratch(".remote.gidx")));
+    infrared_file_index_forget(NULL);
+}
+
+int main(void) {
+    if (!mkdtemp(s_dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    const char *files[] = {"samsung_tv.ir", "lg_ac.ir", "universal_tv.ir", "malformed.ir",
+                           "remote.json"};
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        char from[64];
+        snprintf(from, sizeof(from), "ir/%s", files[i]);
+        copy_file(host_data_path(from), scratch(files[i]), NULL);
+    }
+
+    test_parsed();
+    test_raw();
+    test_block_edges();
+    test_malformed();
+    test_index();
+    test_invalidation();
+    test_forget();
+
+    char cmd[300];
+    snprintf(cmd, sizeof(cmd), "rm -rf %s", s_dir);
+    if (system(cmd) != 0) fprintf(stderr, "could not remove %s\n", s_dir);
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,403 @@
+// web ui log ring and its server-sent event framing (managers/log_ring.c):
+// the ring against a plain copy of everything appended, the read cursor
+// cases, the framing limits of log_sse_format, and an sse client reading
+// the ring the way log_sse_push_work does while a writer overruns it.
+
+#include "host_test.h"
+#include "managers/log_ring.h"
+
+static char s_buf[LOG_RING_SIZE];
+
+static void ring_reset(log_ring_t *r, uint32_t at) {
+    memset(s_buf, 0, sizeof(s_buf));
+    r->buf = s_buf;
+    r->head = r->tail = at;
+}
+
+static uint32_t s_rand = 0x2545f491;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+// a log line of len bytes plus its newline, numbered so misplaced bytes show
+static size_t make_line(char *out, size_t len, unsigned n) {
+    for (size_t i = 0; i < len; i++) out[i] = (char)('a' + (n + i) % 26);
+    out[len] = '\n';
+    return len + 1;
+}
+
+// ---- ring ----
+
+// everything appended is kept in full, the ring must hold exactly the end of
+// it, starting on a line
+static void test_append(void) {
+    static char all[1 << 20];
+    size_t total = 0;
+    log_ring_t r;
+    ring_reset(&r, 0xfffff000); // cursors wrap past 2^32 on the way
+    uint32_t base = r.head;
+    char line[LOG_RING_SIZE];
+    char out[LOG_RING_SIZE];
+
+    for (unsigned n = 0; total + LOG_RING_SIZE < sizeof(all); n++) {
+        size_t len = rnd(8) == 0 ? rnd(2000) : rnd(120);
+        len = make_line(line, len, n);
+        log_ring_append(&r, line, len);
+        memcpy(all + total, line, len);
+        total += len;
+
+        CHECK_EQ(r.head, base + (uint32_t)total);
+        CHECK(r.head - r.tail <= LOG_RING_SIZE);
+        uint32_t held = r.head - r.tail;
+        CHECK(held == total || all[total - held - 1] == '\n');
+        if (n % 64 == 0) {
+            uint32_t cursor = r.tail, dropped;
+            size_t got = log_ring_read_since(&r, &cursor, r.head, out, sizeof(out), &dropped);
+            CHECK_EQ(got, held);
+            CHECK_EQ(dropped, 0);
+            CHECK(memcmp(out, all + total - held, held) == 0);
+        }
+    }
+
+    // empty messages leave the ring alone
+    uint32_t head = r.head, tail = r.tail;
+    log_ring_append(&r, "", 0);
+    CHECK_EQ(r.head, head);
+    CHECK_EQ(r.tail, tail);
+}
+
+static void test_oversized(void) {
+    static char big[3 * LOG_RING_SIZE];
+    log_ring_t r;
+    ring_reset(&r, 0);
+    log_ring_append(&r, "before\n", 7);
+    for (size_t i = 0; i < sizeof(big); i++) big[i] = (char)('0' + i % 10);
+    log_ring_append(&r, big, sizeof(big));
+
+    // the end of the message survives, everything before it is gone
+    CHECK_EQ(r.head, 7 + LOG_RING_SIZE - 1);
+    CHECK_EQ(r.tail, 7);
+    char out[LOG_RING_SIZE];
+    uint32_t cursor = 0, dropped;
+    size_t n = log_ring_read_since(&r, &cursor, r.head, out, sizeof(out), &dropped);
+    CHECK_EQ(dropped, 7);
+    CHECK_EQ(n, LOG_RING_SIZE - 1);
+    CHECK(memcmp(out, big + sizeof(big) - n, n) == 0);
+}
+
+static void test_read_since(void) {
+    log_ring_t r;
+    ring_reset(&r, 1000);
+    char out[LOG_RING_SIZE];
+    uint32_t cursor, dropped;
+
+    log_ring_append(&r, "one\ntwo\nthree\n", 14);
+
+    // from the tail, everything
+    cursor = 1000;
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, sizeof(out), &dropped), 14);
+    CHECK_EQ(cursor, 1014);
+    CHECK(memcmp(out, "one\ntwo\nthree\n", 14) == 0);
+
+    // caught up: nothing, and the cursor stays
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, sizeof(out), &dropped), 0);
+    CHECK_EQ(cursor, 1014);
+
+    // a short read stops after the last whole line that fits
+    cursor = 1000;
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, 10, &dropped), 8);
+    CHECK_EQ(cursor, 1008);
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, 10, &dropped), 6);
+    CHECK(memcmp(out, "three\n", 6) == 0);
+
+    // a line longer than max comes out in pieces
+    cursor = 1008;
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, 4, &dropped), 4);
+    CHECK(memcmp(out, "thre", 4) == 0);
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, 4, &dropped), 2);
+    CHECK(memcmp(out, "e\n", 2) == 0);
+
+    // end stops the read early, an end past the head is the head
+    cursor = 1000;
+    CHECK_EQ(log_ring_read_since(&r, &cursor, 1004, out, sizeof(out), &dropped), 4);
+    CHECK_EQ(cursor, 1004);
+    CHECK_EQ(log_ring_read_since(&r, &cursor, 5000, out, sizeof(out), &dropped), 10);
+    CHECK_EQ(cursor, 1014);
+
+    // a cursor from before a reboot is ahead of the head: start at the tail
+    cursor = 90000;
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, sizeof(out), &dropped), 14);
+    CHECK_EQ(dropped, 0);
+    CHECK_EQ(cursor, 1014);
+
+    // cleared logs: tail moved up to the head, old cursors see a gap
+    r.tail = r.head;
+    cursor = 1004;
+    CHECK_EQ(log_ring_read_since(&r, &cursor, r.head, out, sizeof(out), &dropped), 0);
+    CHECK_EQ(dropped, 10);
+    CHECK_EQ(cursor, 1014);
+
+    // overrun: the reader behind the tail is told how much it missed
+    char line[200];
+    for (unsigned i = 0; i < 100; i++) log_ring_append(&r, line, make_line(line, 150, i));
+    cursor = 1014;
+    size_t n = log_ring_read_since(&r, &cursor, r.head, out, LOG_READ_CHUNK, &dropped);
+    CHECK_EQ(dropped, r.tail - 1014);
+    CHECK_EQ(n % 151, 0);
+    CHECK_EQ(cursor, r.tail + n);
+}
+
+// ---- sse framing ----
+
+typedef struct {
+    char data[4 * LOG_RING_SIZE]; // data: lines joined back with newlines
+    size_t len;
+    uint32_t gap;    // from an event: gap, 0 without one
+    uint32_t id;
+    int bad;
+} sse_event_t;
+
+// parse one frame back; a frame is an optional gap event, then one message
+// event of data: lines ending with its id
+static void sse_parse(const char *f, size_t len, sse_event_t *ev) {
+    memset(ev, 0, sizeof(*ev));
+    const char *end = f + len;
+    if (len >= 11 && memcmp(f, "event: gap\n", 11) == 0) {
+        char *next;
+        if (memcmp(f + 11, "data: ", 6) != 0) ev->bad++;
+        ev->gap = (uint32_t)strtoul(f + 17, &next, 10);
+        if (next + 2 > end || memcmp(next, "\n\n", 2) != 0) ev->bad++;
+        f = next + 2;
+    }
+    while (f < end && memcmp(f, "data: ", 6) == 0) {
+        const char *nl = memchr(f + 6, '\n', (size_t)(end - f - 6));
+        if (!nl) {
+            ev->bad++;
+            return;
+        }
+        memcpy(ev->data + ev->len, f + 6, (size_t)(nl - f - 6));
+        ev->len += (size_t)(nl - f - 6);
+        ev->data[ev->len++] = '\n';
+        f = nl + 1;
+    }
+    char *next;
+    if (f + 4 > end || memcmp(f, "id: ", 4) != 0) {
+        ev->bad++;
+        return;
+    }
+    ev->id = (uint32_t)strtoul(f + 4, &next, 10);
+    if (next + 2 != end || memcmp(next, "\n\n", 2) != 0) ev->bad++;
+}
+
+// what the data: lines of a frame stand for: the used text, with the
+// newline every data: line ends with
+static int sse_matches(const sse_event_t *ev, const char *text, size_t used) {
+    size_t want = used + (used && text[used - 1] != '\n');
+    if (ev->len != want) return 0;
+    if (memcmp(ev->data, text, used) != 0) return 0;
+    return want == used || ev->data[used] == '\n';
+}
+
+static void test_sse_basic(void) {
+    char out[LOG_SSE_FRAME_SIZE];
+    sse_event_t ev;
+    size_t used, n;
+
+    n = log_sse_format("a\nbc\n", 5, &used, 100, 0, out, sizeof(out));
+    out[n] = 0;
+    CHECK_STR(out, "data: a\ndata: bc\nid: 105\n\n");
+    CHECK_EQ(used, 5);
+
+    // a last line without its newline still goes out whole
+    n = log_sse_format("a\nbc", 4, &used, 7, 0, out, sizeof(out));
+    out[n] = 0;
+    CHECK_STR(out, "data: a\ndata: bc\nid: 11\n\n");
+    CHECK_EQ(used, 4);
+
+    // empty lines stay lines
+    n = log_sse_format("\n\nx\n", 4, &used, 0, 0, out, sizeof(out));
+    out[n] = 0;
+    CHECK_STR(out, "data: \ndata: \ndata: x\nid: 4\n\n");
+
+    // a gap with nothing after it, then one with text
+    n = log_sse_format("", 0, &used, 40, 12, out, sizeof(out));
+    out[n] = 0;
+    CHECK_STR(out, "event: gap\ndata: 12\n\nid: 40\n\n");
+    CHECK_EQ(used, 0);
+    n = log_sse_format("x\n", 2, &used, 40, 12, out, sizeof(out));
+    sse_parse(out, n, &ev);
+    CHECK_EQ(ev.bad, 0);
+    CHECK_EQ(ev.gap, 12);
+    CHECK_EQ(ev.id, 42);
+    CHECK(sse_matches(&ev, "x\n", used));
+}
+
+// the frame buffer is sized so the largest read always fits in one event:
+// the biggest gap, a whole chunk with no line break and the biggest id
+static void test_sse_worst_case(void) {
+    char text[LOG_READ_CHUNK];
+    char out[LOG_SSE_FRAME_SIZE];
+    size_t used;
+    sse_event_t ev;
+    memset(text, 'w', sizeof(text));
+
+    size_t n = log_sse_format(text, sizeof(text), &used, 0xfffffc00u - 1, 0xffffffffu, out,
+                              sizeof(out));
+    CHECK_EQ(used, sizeof(text));
+    CHECK(n < sizeof(out));
+    sse_parse(out, n, &ev);
+    CHECK_EQ(ev.bad, 0);
+    CHECK_EQ(ev.gap, 0xffffffffu);
+    CHECK_EQ(ev.id, 0xffffffffu);
+    CHECK(sse_matches(&ev, text, used));
+
+    // a chunk of empty lines grows 7x and takes several frames; each one
+    // stops on a line and ids follow the text consumed
+    memset(text, '\n', sizeof(text));
+    size_t done = 0;
+    int frames = 0;
+    while (done < sizeof(text)) {
+        n = log_sse_format(text + done, sizeof(text) - done, &used, (uint32_t)done, 0, out,
+                           sizeof(out));
+        CHECK(used > 0);
+        CHECK(n < sizeof(out));
+        sse_parse(out, n, &ev);
+        CHECK_EQ(ev.bad, 0);
+        CHECK_EQ(ev.id, done + used);
+        CHECK(sse_matches(&ev, text + done, used));
+        done += used;
+        if (++frames > 16 || used == 0) break;
+    }
+    CHECK_EQ(done, sizeof(text));
+    size_t per_frame = (sizeof(out) - LOG_SSE_ID_MAX) / 7;
+    CHECK_EQ(frames, (sizeof(text) + per_frame - 1) / per_frame);
+}
+
+// every buffer size from the smallest allowed up: nothing written past
+// out_len, the frame always terminated, and the text that fits is exactly
+// the whole lines that fit
+static void test_sse_limits(void) {
+    char text[300];
+    size_t len = 0;
+    for (unsigned i = 0; len + 40 < sizeof(text); i++) len += make_line(text + len, rnd(30), i);
+
+    char out[512 + 16];
+    for (size_t out_len = LOG_SSE_GAP_MAX + LOG_SSE_ID_MAX; out_len <= 512; out_len++) {
+        for (int gap = 0; gap < 2; gap++) {
+            memset(out, 0x5a, sizeof(out));
+            size_t used;
+            size_t n = log_sse_format(text, len, &used, 123456, gap ? 4000000000u : 0, out,
+                                      out_len);
+            CHECK(n < out_len);
+            for (size_t i = out_len; i < sizeof(out); i++) {
+                if (out[i] != 0x5a) {
+                    fprintf(stderr, "out_len %zu: byte %zu written\n", out_len, i);
+                    host_test_failures++;
+                    break;
+                }
+            }
+            CHECK(used == 0 || used == len || text[used - 1] == '\n');
+            sse_event_t ev;
+            sse_parse(out, n, &ev);
+            CHECK_EQ(ev.bad, 0);
+            CHECK_EQ(ev.id, 123456 + used);
+            CHECK(sse_matches(&ev, text, used));
+            // the next line would not have fitted
+            if (used < len) {
+                const char *nl = memchr(text + used, '\n', len - used);
+                size_t line = (size_t)(nl - (text + used));
+                size_t id_len = (size_t)snprintf(NULL, 0, "id: %zu\n\n", 123456 + used);
+                size_t framed = n - id_len;
+                CHECK(framed + 7 + line + LOG_SSE_ID_MAX > out_len);
+            }
+        }
+    }
+}
+
+// ---- ring to client ----
+
+// a writer appends lines of every size while an sse client drains the ring
+// at its own pace, exactly as log_sse_push_work does; what the client
+// rebuilds from the frames plus the gaps it was told about must account for
+// every byte, and each piece it got must be the text written at that cursor
+static void test_stream(void) {
+    static char all[1 << 21];
+    size_t total = 0;
+    log_ring_t r;
+    ring_reset(&r, 0xffff0000);
+    uint32_t base = r.head;
+
+    uint32_t cursor = r.tail;
+    char text[LOG_READ_CHUNK];
+    char frame[LOG_SSE_FRAME_SIZE];
+    char line[LOG_RING_SIZE];
+    static sse_event_t ev;
+    uint64_t got = 0, gaps = 0;
+    int events = 0, gap_events = 0;
+
+    for (unsigned n = 0; total + 2 * LOG_RING_SIZE < sizeof(all); n++) {
+        size_t len = rnd(16) == 0 ? rnd(3000) : rnd(100);
+        len = make_line(line, len, n);
+        log_ring_append(&r, line, len);
+        memcpy(all + total, line, len);
+        total += len;
+
+        // the client keeps up, except for a stall every 2000 lines
+        int rounds = (n / 500) % 4 == 3 ? 0 : (int)rnd(3);
+        for (int k = 0; k < rounds; k++) {
+            uint32_t dropped;
+            size_t t = log_ring_read_since(&r, &cursor, r.head, text, sizeof(text), &dropped);
+            if (t == 0 && dropped == 0) break;
+            uint32_t start = cursor - (uint32_t)t;
+            size_t used;
+            size_t f = log_sse_format(text, t, &used, start, dropped, frame, sizeof(frame));
+            cursor = start + (uint32_t)used;
+            CHECK(f <= sizeof(frame));
+            sse_parse(frame, f, &ev);
+            CHECK_EQ(ev.bad, 0);
+            CHECK_EQ(ev.gap, dropped);
+            CHECK_EQ(ev.id, cursor);
+            size_t at = start - base;
+            CHECK(sse_matches(&ev, all + at, used));
+            got += used;
+            gaps += dropped;
+            events++;
+            gap_events += dropped != 0;
+        }
+    }
+    // drain
+    for (;;) {
+        uint32_t dropped;
+        size_t t = log_ring_read_since(&r, &cursor, r.head, text, sizeof(text), &dropped);
+        if (t == 0 && dropped == 0) break;
+        uint32_t start = cursor - (uint32_t)t;
+        size_t used;
+        size_t f = log_sse_format(text, t, &used, start, dropped, frame, sizeof(frame));
+        cursor = start + (uint32_t)used;
+        sse_parse(frame, f, &ev);
+        CHECK_EQ(ev.bad, 0);
+        CHECK(sse_matches(&ev, all + (start - base), used));
+        got += used;
+        gaps += dropped;
+    }
+    CHECK_EQ(cursor, r.head);
+    CHECK_EQ(got + gaps, total);
+    CHECK(gap_events > 0); // the writer did overrun the client
+    printf("stream: %zu bytes written, %llu sent in %d events, %llu dropped in %d gaps\n", total,
+           (unsigned long long)got, events, (unsigned long long)gaps, gap_events);
+}
+
+int main(void) {
+    test_append();
+    test_oversized();
+    test_read_since();
+    test_sse_basic();
+    test_sse_worst_case();
+    test_sse_limits();
+    test_stream();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,374 @@
+// gps receiver path: MicroNMEA.c is built into the test (MICRONMEA_C) so its
+// rx buffer handling and the ubx timeouts can be driven without the parser
+// task. the uart, the event loop and the clock are stand-ins (nmea_stubs.c):
+// reads come from a test buffer, GPS_UPDATE posts and baud changes are
+// recorded.
+// data/nmea.txt holds the sentences and the fixes they should make.
+
+#include MICRONMEA_C
+#include "host_gps_uart.h"
+#include "host_test.h"
+
+// ---- helpers ----
+
+static esp_gps_t *parser_open(bool ubx) {
+    nmea_parser_config_t config = NMEA_PARSER_CONFIG_DEFAULT();
+    config.ubx.enable = ubx;
+    esp_gps_t *gps = nmea_parser_init(&config);
+    CHECK(gps != NULL);
+    memset(&host_gps_events, 0, sizeof(host_gps_events));
+    return gps;
+}
+
+// everything in data goes through the block reader, at most chunk bytes a read
+static void feed(esp_gps_t *gps, const void *data, size_t len, size_t chunk) {
+    host_gps_uart.data = data;
+    host_gps_uart.len = len;
+    host_gps_uart.pos = 0;
+    host_gps_uart.chunk = chunk;
+    while (host_gps_uart.pos < host_gps_uart.len) {
+        esp_handle_uart_data(gps);
+        host_gps_now_us += 1000;
+    }
+}
+
+static int32_t lat_long(esp_gps_t *gps, const char *item, int32_t max_deg) {
+    snprintf(gps->item_str, sizeof(gps->item_str), "%s", item);
+    return parse_lat_long(gps, max_deg);
+}
+
+// ---- tests ----
+
+static void test_lat_long(void) {
+    esp_gps_t *gps = parser_open(false);
+
+    CHECK_EQ(lat_long(gps, "4807.038", 90), 481173000);
+    CHECK_EQ(lat_long(gps, "01131.000", 180), 115166667);
+    CHECK_EQ(lat_long(gps, "0000.000006", 90), 1);
+    CHECK_EQ(lat_long(gps, "9000.0000", 90), 900000000);
+    CHECK_EQ(lat_long(gps, "18000.0000", 180), 1800000000);
+
+    // malformed
+    CHECK_EQ(lat_long(gps, "", 90), 0);
+    CHECK_EQ(lat_long(gps, "07", 90), 0);
+    CHECK_EQ(lat_long(gps, "4807,038", 90), 0);
+    CHECK_EQ(lat_long(gps, "123456.0", 180), 0);
+    CHECK_EQ(lat_long(gps, "4860.0000", 90), 0);
+
+    // out of range: past the pole, past 180, and five digits of degrees
+    // that do not fit degrees * 1e7 in an int32
+    CHECK_EQ(lat_long(gps, "9000.0001", 90), 0);
+    CHECK_EQ(lat_long(gps, "9100.0000", 180), 910000000);
+    CHECK_EQ(lat_long(gps, "18000.0001", 180), 0);
+    CHECK_EQ(lat_long(gps, "21500.0000", 180), 0);
+    CHECK_EQ(lat_long(gps, "99959.999999", 180), 0);
+
+    nmea_parser_deinit(gps);
+}
+
+// the fraction of a second is ms, however many digits the receiver sends
+static void test_utc_fraction(void) {
+    esp_gps_t *gps = parser_open(false);
+    const struct {
+        const char *item;
+        uint16_t ms;
+    } cases[] = {{"123519", 0}, {"123519.00", 0}, {"123519.5", 500}, {"123519.25", 250},
+                 {"123519.125", 125}, {"123519.123456", 123}, {"123519.", 0}};
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        gps->parent.tim.thousand = 777;
+        snprintf(gps->item_str, sizeof(gps->item_str), "%s", cases[i].item);
+        parse_utc_time(gps);
+        CHECK_EQ(gps->parent.tim.hour, 12);
+        CHECK_EQ(gps->parent.tim.second, 19);
+        CHECK_EQ(gps->parent.tim.thousand, cases[i].ms);
+    }
+    nmea_parser_deinit(gps);
+}
+
+typedef struct {
+    bool fix;
+    int32_t lat_e7;
+    int32_t lon_e7;
+    int32_t alt_mm;
+    char time[7];
+    char date[7];
+    int sats;
+    int hdop_e2;
+    int speed_mmps;
+    int cog_e2;
+    int valid;
+} expect_t;
+
+static bool parse_expect(const char *line, expect_t *e) {
+    memset(e, 0, sizeof(*e));
+    if (strncmp(line, "drop", 4) == 0) return true;
+    e->fix = true;
+    return sscanf(line, "fix %d %d %d %6s %6s %d %d %d %d %d", &e->lat_e7, &e->lon_e7,
+                  &e->alt_mm, e->time, e->date, &e->sats, &e->hdop_e2, &e->speed_mmps,
+                  &e->cog_e2, &e->valid) == 10;
+}
+
+static void check_block(const expect_t *e, uint32_t updates, int line) {
+    const gps_t *g = &host_gps_events.last;
+    char time[16], date[16];
+    if (!e->fix) {
+        if (host_gps_events.updates != updates) fprintf(stderr, "block at line %d\n", line);
+        CHECK_EQ(host_gps_events.updates, updates);
+        return;
+    }
+    if (host_gps_events.updates != updates + 1) {
+        fprintf(stderr, "block at line %d\n", line);
+        CHECK_EQ(host_gps_events.updates, updates + 1);
+        return;
+    }
+    snprintf(time, sizeof(time), "%02u%02u%02u", g->tim.hour, g->tim.minute, g->tim.second);
+    snprintf(date, sizeof(date), "%02u%02u%02u", g->date.day, g->date.month, g->date.year);
+    int before = host_test_failures;
+    CHECK_EQ(g->latitude_e7, e->lat_e7);
+    CHECK_EQ(g->longitude_e7, e->lon_e7);
+    CHECK_EQ(g->altitude_mm, e->alt_mm);
+    CHECK_EQ(g->valid, e->valid);
+    CHECK_EQ(g->fix, e->valid ? GPS_FIX_GPS : GPS_FIX_INVALID);
+    CHECK_EQ(g->sats_in_use, e->sats);
+    CHECK_EQ(g->dop_h_e2, e->hdop_e2);
+    CHECK_EQ(g->speed_mmps, e->speed_mmps);
+    CHECK_EQ(g->cog_e2, e->cog_e2);
+    CHECK_EQ(g->sats_in_view, 12);
+    if (e->valid) {
+        CHECK_STR(time, e->time);
+        CHECK_STR(date, e->date);
+    }
+    // the float view follows the fixed-point fields
+    CHECK(g->latitude == e7_to_float(g->latitude_e7));
+    CHECK(g->longitude == e7_to_float(g->longitude_e7));
+    if (host_test_failures != before) fprintf(stderr, "block at line %d\n", line);
+}
+
+// the corpus again at a given read size, so sentences split across reads
+static void test_corpus(size_t chunk) {
+    FILE *f = fopen(host_data_path("nmea.txt"), "r");
+    CHECK(f != NULL);
+    if (!f) return;
+
+    esp_gps_t *gps = parser_open(false);
+    static char block[16384];
+    size_t block_len = 0;
+    expect_t expect;
+    bool have_expect = false;
+    int expect_line = 0, lineno = 0, blocks = 0;
+    char line[512];
+    uint32_t updates = 0;
+
+    for (;;) {
+        bool more = fgets(line, sizeof(line), f) != NULL;
+        lineno++;
+        if (more && (line[0] == '#' || line[0] == '\n')) continue;
+        if (!more || line[0] != '$') {
+            if (have_expect) {
+                feed(gps, block, block_len, chunk);
+                check_block(&expect, updates, expect_line);
+                updates = host_gps_events.updates;
+                blocks++;
+            }
+            if (!more) break;
+            CHECK(parse_expect(line, &expect));
+            have_expect = true;
+            expect_line = lineno;
+            block_len = 0;
+            continue;
+        }
+        // sentences go on the wire with \r\n
+        size_t n = strcspn(line, "\r\n");
+        CHECK(block_len + n + 2 <= sizeof(block));
+        memcpy(block + block_len, line, n);
+        memcpy(block + block_len + n, "\r\n", 2);
+        block_len += n + 2;
+    }
+    fclose(f);
+
+    CHECK(blocks >= 10);
+    // proprietary and foreign talker sentences are handed on, not parsed
+    CHECK_EQ(host_gps_events.unknown, 3);
+    CHECK_EQ(gps->rx_len, 0);
+    nmea_parser_deinit(gps);
+}
+
+static const char GGA[] =
+    "$GPGGA,123519.00,4807.038000,N,01131.000002,E,1,08,0.92,45.3,M,-12.1,M,,*4F\r\n";
+
+static size_t put(uint8_t *out, size_t at, const void *data, size_t len) {
+    memcpy(out + at, data, len);
+    return at + len;
+}
+
+// nmea and ubx back to back with the damage a real uart line sees: a
+// sentence without its \r, one that lost its end, noise, and a stray '$'
+// right before a frame
+static void test_mixed_stream(void) {
+    static uint8_t stream[8192];
+    uint8_t ack[16];
+    size_t ack_len = ubx_frame(UBX_CLASS_ACK, UBX_ID_ACK_ACK, (const uint8_t[]){0x06, 0x01}, 2,
+                               ack, sizeof(ack));
+    CHECK(memchr(ack, '\n', ack_len) == NULL);
+    size_t len = 0;
+    for (int i = 0; i < 20; i++) {
+        len = put(stream, len, GGA, sizeof(GGA) - 1);
+        len = put(stream, len, ack, ack_len);
+        len = put(stream, len, "\r\n\xff\x00 ", 5);
+        len = put(stream, len, "$GPRMC,1235", 11);
+        len = put(stream, len, GGA, sizeof(GGA) - 3);
+        len = put(stream, len, "\n$", 2);
+        len = put(stream, len, ack, ack_len);
+    }
+    CHECK(len <= sizeof(stream));
+
+    const size_t chunks[] = {1, 3, 64, NMEA_PARSER_RUNTIME_BUFFER_SIZE};
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        esp_gps_t *gps = parser_open(true);
+        feed(gps, stream, len, chunks[i]);
+        if (gps->nmea_good != 40 || gps->ubx->frames != 40)
+            fprintf(stderr, "chunk %zu\n", chunks[i]);
+        CHECK_EQ(gps->nmea_good, 40);
+        CHECK_EQ(gps->ubx->frames, 40);
+        CHECK_EQ(gps->rx_len, 0);
+        nmea_parser_deinit(gps);
+    }
+}
+
+// a '$' that never gets a line end holds back only what a sentence can be
+// long, not a buffer's worth: ubx frames behind it still come through
+static void test_unterminated(void) {
+    static uint8_t stream[4096];
+    uint8_t ack[16];
+    size_t ack_len = ubx_frame(UBX_CLASS_ACK, UBX_ID_ACK_ACK, (const uint8_t[]){0x06, 0x01}, 2,
+                               ack, sizeof(ack));
+    size_t len = put(stream, 0, "$", 1);
+    for (int i = 0; i < 100; i++) len = put(stream, len, ack, ack_len);
+    len = put(stream, len, GGA, sizeof(GGA) - 1);
+
+    esp_gps_t *gps = parser_open(true);
+    feed(gps, stream, len, 64);
+    CHECK_EQ(gps->ubx->frames, 100);
+    CHECK_EQ(gps->nmea_good, 1);
+    CHECK_EQ(gps->rx_len, 0);
+    nmea_parser_deinit(gps);
+
+    // text without a line end is dropped and the reader carries on
+    len = put(stream, 0, "$GPTXT,", 7);
+    memset(stream + len, 'A', 2 * NMEA_PARSER_RUNTIME_BUFFER_SIZE);
+    len += 2 * NMEA_PARSER_RUNTIME_BUFFER_SIZE;
+    len = put(stream, len, GGA, sizeof(GGA) - 1);
+    gps = parser_open(false);
+    feed(gps, stream, len, NMEA_PARSER_RUNTIME_BUFFER_SIZE);
+    CHECK_EQ(gps->nmea_good, 1);
+    CHECK_EQ(host_gps_events.unknown, 0);
+    CHECK_EQ(gps->rx_len, 0);
+    nmea_parser_deinit(gps);
+}
+
+static size_t pvt_frame(int32_t lat_e7, int32_t lon_e7, uint8_t *out, size_t cap) {
+    uint8_t p[92] = {0};
+    p[11] = UBX_PVT_VALID_DATE | UBX_PVT_VALID_TIME;
+    p[20] = UBX_FIX_3D;
+    p[21] = UBX_PVT_FLAG_GNSS_FIX_OK;
+    p[23] = 9;
+    for (int i = 0; i < 4; i++) {
+        p[24 + i] = (uint8_t)((uint32_t)lon_e7 >> (8 * i));
+        p[28 + i] = (uint8_t)((uint32_t)lat_e7 >> (8 * i));
+    }
+    return ubx_frame(UBX_CLASS_NAV, UBX_ID_NAV_PVT, p, sizeof(p), out, cap);
+}
+
+// ms of parser task loop: the timeout check, with a sentence fed first when
+// the receiver is talking
+static void run_ms(esp_gps_t *gps, int ms, bool talking) {
+    for (int t = 0; t < ms; t += 250) {
+        if (talking) feed(gps, GGA, sizeof(GGA) - 1, sizeof(GGA));
+        host_gps_now_us += 250 * 1000;
+        ubx_check_timeouts(gps);
+    }
+}
+
+static void test_ubx_timeouts(void) {
+    nmea_parser_config_t config = NMEA_PARSER_CONFIG_DEFAULT();
+    config.uart.tx_pin = 17;
+    config.ubx.enable = true;
+    config.ubx.baud_rate = 115200;
+    config.ubx.rate_hz = 5;
+    esp_gps_t *gps = nmea_parser_init(&config);
+    CHECK(gps != NULL);
+    if (!gps) return;
+    memset(&host_gps_events, 0, sizeof(host_gps_events));
+    host_gps_uart.baud_sets = 0;
+    host_gps_uart.writes = 0;
+
+    // the task's first step: init sequence, then on to the fast rate
+    ubx_configure_receiver(gps);
+    CHECK(host_gps_uart.writes >= 2);
+    CHECK_EQ(host_gps_uart.baud_sets, 1);
+    CHECK_EQ(host_gps_uart.bauds[0], 115200);
+    CHECK_EQ(gps->baud_fallback, 9600);
+
+    // the receiver follows, a NAV-PVT at the new rate confirms it
+    uint8_t frame[128];
+    size_t len = pvt_frame(-337654321, -1511234567, frame, sizeof(frame));
+    feed(gps, frame, len, len);
+    ubx_check_timeouts(gps);
+    CHECK_EQ(gps->baud_fallback, 0);
+    CHECK(gps->ubx_live);
+    CHECK_EQ(host_gps_events.updates, 1);
+    CHECK_EQ(host_gps_events.last.latitude_e7, -337654321);
+    CHECK_EQ(host_gps_events.last.longitude_e7, -1511234567);
+
+    // nmea is skipped while ubx fixes arrive
+    uint32_t nmea_good = gps->nmea_good;
+    feed(gps, GGA, sizeof(GGA) - 1, sizeof(GGA));
+    CHECK_EQ(gps->nmea_good, nmea_good);
+
+    // the fixes stop but nmea keeps coming: back on nmea, at the same rate
+    run_ms(gps, UBX_STALE_MS + 500, true);
+    CHECK(!gps->ubx_live);
+    CHECK(gps->nmea_good > nmea_good);
+    CHECK_EQ(host_gps_uart.baud_sets, 1);
+    run_ms(gps, 2 * UBX_STALE_MS, true);
+    CHECK_EQ(host_gps_uart.baud_sets, 1);
+
+    // then nothing valid at all, as after a receiver restart: back to the
+    // configured rate and through the init sequence again
+    uint32_t writes = host_gps_uart.writes;
+    run_ms(gps, UBX_STALE_MS - 250, false);
+    CHECK_EQ(host_gps_uart.baud_sets, 1);
+    run_ms(gps, 500, false);
+    CHECK_EQ(host_gps_uart.baud_sets, 3);
+    CHECK_EQ(host_gps_uart.bauds[1], 9600);
+    CHECK_EQ(host_gps_uart.bauds[2], 115200);
+    CHECK(host_gps_uart.writes > writes);
+    CHECK_EQ(gps->baud_fallback, 9600);
+
+    // this time the receiver stays at its default rate, so the unconfirmed
+    // switch is undone and nmea at 9600 is kept from then on
+    run_ms(gps, UBX_BAUD_CHECK_MS + 250, false);
+    CHECK_EQ(host_gps_uart.baud_sets, 4);
+    CHECK_EQ(host_gps_uart.bauds[3], 9600);
+    CHECK_EQ(gps->baud_fallback, 0);
+    writes = host_gps_uart.writes;
+    run_ms(gps, 3 * UBX_STALE_MS, true);
+    CHECK_EQ(host_gps_uart.baud_sets, 4);
+    CHECK_EQ(host_gps_uart.writes, writes);
+    CHECK_EQ(gps->baud_rate, 9600);
+
+    nmea_parser_deinit(gps);
+}
+
+int main(void) {
+    test_lat_long();
+    test_utc_fraction();
+    test_corpus(NMEA_PARSER_RUNTIME_BUFFER_SIZE);
+    test_corpus(1);
+    test_corpus(7);
+    test_corpus(100);
+    test_mixed_stream();
+    test_unterminated();
+    test_ubx_timeouts();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,89 @@
+// the generated table against the strstr scan it replaced (ouis_ref.h), for
+// every oui in main.bak/core/ouis.json. the only expected differences are the
+// three names that use \u escapes in the json, which the generator decodes
+// and folds to ascii.
+
+#include "core/ouis.h"
+#include "host_test.h"
+#include "ouis_ref.h"
+
+static const struct {
+    const char *oui;
+    const char *name;
+} decoded[] = {
+    {"001D40", "Intel - Ge Care Innovations Llc"},
+    {"906DC8", "Dlg Automacao Industrial Ltda"},
+    {"C08B6F", "S I Sistemas Inteligentes Eletronicos Ltda"},
+};
+
+static void test_parity(void) {
+    int checked = 0, laa = 0, escaped = 0;
+    for (const char *p = strchr(json_buf, '"'); p; p = strchr(p, '"')) {
+        const char *q = strchr(p + 1, '"');
+        if (!q) break;
+        if (q - p != 7 || q[1] != ':') {
+            p = q + 1;
+            continue;
+        }
+        char oui[7];
+        memcpy(oui, p + 1, 6);
+        oui[6] = '\0';
+        p = q + 1;
+
+        char mac[32], got[128], want[128];
+        snprintf(mac, sizeof(mac), "%c%c:%c%c:%c%c:12:34:56", tolower((unsigned char)oui[0]),
+                 oui[1], oui[2], oui[3], oui[4], oui[5]);
+        bool ok = ouis_lookup_vendor(mac, got, sizeof(got));
+        checked++;
+
+        unsigned first;
+        sscanf(oui, "%2x", &first);
+        if (first & 0x02) {
+            // locally administered prefixes never resolve, before or after
+            CHECK(!ok);
+            laa++;
+            continue;
+        }
+        CHECK(ok);
+        CHECK(ref_lookup(oui, want, sizeof(want)));
+        if (strstr(want, "\\u")) {
+            escaped++;
+            const char *expect = NULL;
+            for (size_t i = 0; i < sizeof(decoded) / sizeof(decoded[0]); i++) {
+                if (strcmp(decoded[i].oui, oui) == 0) expect = decoded[i].name;
+            }
+            CHECK(expect != NULL);
+            if (expect) CHECK_STR(got, expect);
+            continue;
+        }
+        CHECK_STR(got, want);
+    }
+    CHECK(checked > 10000);
+    CHECK_EQ(escaped, 3);
+    printf("test_ouis: %d ouis, %d locally administered, %d decoded\n", checked, laa, escaped);
+}
+
+static void test_formats(void) {
+    char out[64];
+    CHECK(ouis_lookup_vendor("00:00:0C:11:22:33", out, sizeof(out)));
+    CHECK_STR(out, "Cisco Systems, Inc");
+    CHECK(ouis_lookup_vendor("00-00-0c-11-22-33", out, sizeof(out)));
+    CHECK_STR(out, "Cisco Systems, Inc");
+    CHECK(ouis_lookup_vendor("00000c", out, sizeof(out)));
+    CHECK(!ouis_lookup_vendor("00:00", out, sizeof(out)));
+    CHECK(!ouis_lookup_vendor("", out, sizeof(out)));
+    CHECK(!ouis_lookup_vendor("FF:FF:FF:00:00:00", out, sizeof(out)));
+    // truncated output
+    CHECK(ouis_lookup_vendor("00:00:0C", out, 6));
+    CHECK_STR(out, "Cisco");
+    CHECK(!ouis_lookup_vendor("00:00:0C", out, 0));
+}
+
+int main(void) {
+    if (!ref_load_json()) return 1;
+
+    test_parity();
+    test_formats();
+    free(json_buf);
+    return HOST_TEST_RESULT();
+}
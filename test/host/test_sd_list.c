@@ -0,0 +1,488 @@
+// paginated sd directory listing (managers/sd_list.c) over a scratch
+// directory: every page parsed back from the json, pages walked to the end
+// in both sort orders and in directory order, the limit and offset edges,
+// name escaping, the chunking of the output and the error paths.
+
+#include "host_test.h"
+#include "managers/sd_list.h"
+#include <dirent.h>
+#include <strings.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define NUMBERED 250
+#define MAX_ENTRIES 1200
+
+typedef struct {
+    char name[256];
+    bool is_dir;
+    long size; // -1 for folders
+} entry_t;
+
+static char s_root[64];
+static entry_t s_expect[MAX_ENTRIES];
+static size_t s_expect_count;
+
+// ---- scratch tree ----
+
+static void add_file(const char *dir, const char *name, size_t size, bool listed) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    for (size_t i = 0; i < size; i++) fputc('x', f);
+    fclose(f);
+    if (!listed) return;
+    entry_t *e = &s_expect[s_expect_count++];
+    snprintf(e->name, sizeof(e->name), "%s", name);
+    e->is_dir = false;
+    e->size = (long)size;
+}
+
+static void add_dir(const char *dir, const char *name, bool listed) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    mkdir(path, 0755);
+    if (!listed) return;
+    entry_t *e = &s_expect[s_expect_count++];
+    snprintf(e->name, sizeof(e->name), "%s", name);
+    e->is_dir = true;
+    e->size = -1;
+}
+
+static void make_tree(void) {
+    snprintf(s_root, sizeof(s_root), "/tmp/sd_list_XXXXXX");
+    if (!mkdtemp(s_root)) {
+        perror("mkdtemp");
+        exit(1);
+    }
+    add_dir(s_root, "Alpha", true);
+    add_dir(s_root, "beta", true);
+    add_dir(s_root, "Zeta dir", true);
+    add_file(s_root, "a.txt", 1, true);
+    add_file(s_root, "A.txt", 2, true); // same name ignoring case
+    add_file(s_root, "B.txt", 3, true);
+    add_file(s_root, "c.TXT", 4, true);
+    add_file(s_root, "quote\"name.ir", 5, true);
+    add_file(s_root, "back\\slash.sub", 6, true);
+    add_file(s_root, "tab\tname", 7, true);
+    add_file(s_root, "\xc3\xbcnicode.nfc", 8, true);
+    add_file(s_root, "empty", 0, true);
+    for (int i = 0; i < NUMBERED; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "f%03d.bin", i);
+        add_file(s_root, name, (size_t)i, true);
+    }
+    // left out: hidden entries and anything that is not a file or a folder
+    add_file(s_root, ".hidden", 1, false);
+    add_dir(s_root, ".config", false);
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/pipe", s_root);
+    mkfifo(path, 0644);
+    // a link to a file lists as the file
+    snprintf(path, sizeof(path), "%s/link.txt", s_root);
+    if (symlink("B.txt", path) == 0) {
+        entry_t *e = &s_expect[s_expect_count++];
+        strcpy(e->name, "link.txt");
+        e->is_dir = false;
+        e->size = 3;
+    }
+}
+
+static void remove_tree(const char *dir) {
+    DIR *d = opendir(dir);
+    if (!d) return;
+    struct dirent *e;
+    char path[1024];
+    while ((e = readdir(d)) != NULL) {
+        if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) continue;
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        struct stat st;
+        if (lstat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+            remove_tree(path);
+        } else {
+            unlink(path);
+        }
+    }
+    closedir(d);
+    rmdir(dir);
+}
+
+static bool s_desc;
+
+static int expect_cmp(const void *a, const void *b) {
+    const entry_t *ea = a, *eb = b;
+    if (ea->is_dir != eb->is_dir) return ea->is_dir ? -1 : 1;
+    int r = strcasecmp(ea->name, eb->name);
+    if (r == 0) r = strcmp(ea->name, eb->name);
+    return s_desc ? -r : r;
+}
+
+// ---- output capture ----
+
+typedef struct {
+    char *data;
+    size_t len, cap;
+    int writes;
+    size_t max_write;
+    size_t short_writes; // writes below SD_LIST_CHUNK that were not the last
+    size_t last_write;
+    int fail_at; // write number that fails, 0 never
+} sink_t;
+
+static esp_err_t sink_write(void *ctx, const char *data, size_t len) {
+    sink_t *s = ctx;
+    s->writes++;
+    if (s->fail_at && s->writes >= s->fail_at) return ESP_FAIL;
+    if (s->last_write && s->last_write < SD_LIST_CHUNK) s->short_writes++;
+    s->last_write = len;
+    if (len > s->max_write) s->max_write = len;
+    if (s->len + len + 1 > s->cap) {
+        s->cap = (s->len + len + 1) * 2;
+        s->data = realloc(s->data, s->cap);
+    }
+    memcpy(s->data + s->len, data, len);
+    s->len += len;
+    s->data[s->len] = '\0';
+    return ESP_OK;
+}
+
+static void sink_reset(sink_t *s) {
+    free(s->data);
+    memset(s, 0, sizeof(*s));
+}
+
+// ---- json, just the shape sd_list_dir writes ----
+
+typedef struct {
+    char path[512];
+    long offset, limit, total;
+    int more; // -1 missing
+    entry_t files[SD_LIST_MAX_LIMIT];
+    char file_paths[SD_LIST_MAX_LIMIT][512];
+    size_t count;
+} page_t;
+
+static const char *parse_string(const char *p, char *out, size_t max) {
+    if (*p != '"') return NULL;
+    size_t o = 0;
+    for (p++; *p && *p != '"'; p++) {
+        char c = *p;
+        if ((unsigned char)c < 0x20) return NULL; // must have been escaped
+        if (c == '\\') {
+            p++;
+            if (*p == '"' || *p == '\\' || *p == '/') {
+                c = *p;
+            } else if (*p == 'u') {
+                unsigned v;
+                if (sscanf(p + 1, "%4x", &v) != 1) return NULL;
+                c = (char)v;
+                p += 4;
+            } else {
+                return NULL;
+            }
+        }
+        if (o + 1 >= max) return NULL;
+        out[o++] = c;
+    }
+    if (*p != '"') return NULL;
+    out[o] = '\0';
+    return p + 1;
+}
+
+static const char *parse_number(const char *p, long *out) {
+    char *end;
+    *out = strtol(p, &end, 10);
+    return end == p ? NULL : end;
+}
+
+static const char *parse_file(const char *p, page_t *pg) {
+    entry_t *e = &pg->files[pg->count];
+    char *fpath = pg->file_paths[pg->count];
+    char key[16], type[16] = "";
+    e->size = -1;
+    fpath[0] = '\0';
+    if (*p++ != '{') return NULL;
+    while (p && *p != '}') {
+        p = parse_string(p, key, sizeof(key));
+        if (!p || *p++ != ':') return NULL;
+        if (strcmp(key, "name") == 0) {
+            p = parse_string(p, e->name, sizeof(e->name));
+        } else if (strcmp(key, "type") == 0) {
+            p = parse_string(p, type, sizeof(type));
+        } else if (strcmp(key, "path") == 0) {
+            p = parse_string(p, fpath, 512);
+        } else if (strcmp(key, "size") == 0) {
+            p = parse_number(p, &e->size);
+        } else {
+            return NULL;
+        }
+        if (p && *p == ',') p++;
+    }
+    if (!p) return NULL;
+    if (strcmp(type, "folder") != 0 && strcmp(type, "file") != 0) return NULL;
+    e->is_dir = strcmp(type, "folder") == 0;
+    pg->count++;
+    return p + 1;
+}
+
+static bool parse_page(const char *p, page_t *pg) {
+    memset(pg, 0, sizeof(*pg));
+    pg->more = -1;
+    char key[16];
+    if (*p++ != '{') return false;
+    while (p && *p != '}') {
+        p = parse_string(p, key, sizeof(key));
+        if (!p || *p++ != ':') return false;
+        if (strcmp(key, "path") == 0) {
+            p = parse_string(p, pg->path, sizeof(pg->path));
+        } else if (strcmp(key, "offset") == 0) {
+            p = parse_number(p, &pg->offset);
+        } else if (strcmp(key, "limit") == 0) {
+            p = parse_number(p, &pg->limit);
+        } else if (strcmp(key, "total") == 0) {
+            p = parse_number(p, &pg->total);
+        } else if (strcmp(key, "more") == 0) {
+            pg->more = strncmp(p, "true", 4) == 0 ? 1 : strncmp(p, "false", 5) == 0 ? 0 : -1;
+            p = pg->more < 0 ? NULL : p + (pg->more ? 4 : 5);
+        } else if (strcmp(key, "files") == 0) {
+            if (*p++ != '[') return false;
+            while (p && *p != ']') {
+                if (pg->count == SD_LIST_MAX_LIMIT) return false;
+                p = parse_file(p, pg);
+                if (p && *p == ',') p++;
+            }
+            if (p) p++;
+        } else {
+            return false;
+        }
+        if (p && *p == ',') p++;
+    }
+    return p && p[0] == '}' && p[1] == '\0';
+}
+
+// one request; the page is parsed and its entries checked against the tree
+static esp_err_t list_page(const char *dir, uint32_t offset, uint32_t limit, bool sorted,
+                           bool desc, page_t *pg) {
+    static sink_t sink;
+    sink_reset(&sink);
+    sd_list_opts_t opts = {.offset = offset, .limit = limit, .sorted = sorted, .desc = desc};
+    esp_err_t err = sd_list_dir(dir, &opts, sink_write, &sink);
+    if (err != ESP_OK) return err;
+    CHECK(sink.max_write <= SD_LIST_CHUNK);
+    CHECK_EQ(sink.short_writes, 0);
+    if (!parse_page(sink.data, pg)) {
+        fprintf(stderr, "unparsable page: %.200s\n", sink.data);
+        host_test_failures++;
+        return ESP_FAIL;
+    }
+    CHECK_STR(pg->path, dir);
+    CHECK_EQ(pg->offset, offset);
+    CHECK_EQ(pg->limit, limit == 0 || limit > SD_LIST_MAX_LIMIT ? SD_LIST_MAX_LIMIT : limit);
+    CHECK(pg->more >= 0);
+    for (size_t i = 0; i < pg->count; i++) {
+        char want[1024];
+        snprintf(want, sizeof(want), "%s/%s", dir, pg->files[i].name);
+        if (!pg->files[i].is_dir) CHECK_STR(pg->file_paths[i], want);
+    }
+    return ESP_OK;
+}
+
+static const entry_t *find_expected(const char *name) {
+    for (size_t i = 0; i < s_expect_count; i++) {
+        if (strcmp(s_expect[i].name, name) == 0) return &s_expect[i];
+    }
+    return NULL;
+}
+
+// ---- tests ----
+
+// walking the pages gives the whole sorted listing once, in order
+static void test_sorted_pages(void) {
+    static const uint32_t limits[] = {1, 7, 100, 500};
+    static page_t pg;
+    for (int desc = 0; desc < 2; desc++) {
+        s_desc = desc;
+        qsort(s_expect, s_expect_count, sizeof(s_expect[0]), expect_cmp);
+        for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++) {
+            size_t seen = 0;
+            for (uint32_t offset = 0;; offset += limits[l]) {
+                if (list_page(s_root, offset, limits[l], true, desc, &pg) != ESP_OK) {
+                    host_test_failures++;
+                    break;
+                }
+                CHECK_EQ(pg.total, s_expect_count);
+                size_t left = s_expect_count - offset;
+                CHECK_EQ(pg.count, left < limits[l] ? left : limits[l]);
+                for (size_t i = 0; i < pg.count && seen < s_expect_count; i++, seen++) {
+                    const entry_t *want = &s_expect[seen];
+                    CHECK_STR(pg.files[i].name, want->name);
+                    CHECK_EQ(pg.files[i].is_dir, want->is_dir);
+                    CHECK_EQ(pg.files[i].size, want->size);
+                }
+                CHECK_EQ(pg.more, offset + pg.count < s_expect_count);
+                if (!pg.more || seen >= s_expect_count) break;
+            }
+            CHECK_EQ(seen, s_expect_count);
+        }
+    }
+    s_desc = false;
+    qsort(s_expect, s_expect_count, sizeof(s_expect[0]), expect_cmp);
+
+    // folders first in both orders, names compared ignoring case
+    list_page(s_root, 0, 5, true, false, &pg);
+    CHECK_STR(pg.files[0].name, "Alpha");
+    CHECK_STR(pg.files[1].name, "beta");
+    CHECK_STR(pg.files[2].name, "Zeta dir");
+    CHECK_STR(pg.files[3].name, "A.txt");
+    CHECK_STR(pg.files[4].name, "a.txt");
+    list_page(s_root, 0, 4, true, true, &pg);
+    CHECK_STR(pg.files[0].name, "Zeta dir");
+    CHECK_STR(pg.files[2].name, "Alpha");
+    CHECK_STR(pg.files[3].name, "\xc3\xbcnicode.nfc");
+}
+
+// directory order: every entry exactly once, even across pages
+static void test_unsorted_pages(void) {
+    static page_t pg;
+    static uint8_t seen[MAX_ENTRIES];
+    memset(seen, 0, sizeof(seen));
+    size_t count = 0;
+    for (uint32_t offset = 0;; offset += 37) {
+        if (list_page(s_root, offset, 37, false, false, &pg) != ESP_OK) {
+            host_test_failures++;
+            break;
+        }
+        CHECK_EQ(pg.total, s_expect_count);
+        for (size_t i = 0; i < pg.count; i++) {
+            const entry_t *want = find_expected(pg.files[i].name);
+            if (!want) {
+                fprintf(stderr, "unexpected entry \"%s\"\n", pg.files[i].name);
+                host_test_failures++;
+                continue;
+            }
+            CHECK_EQ(seen[want - s_expect]++, 0);
+            CHECK_EQ(pg.files[i].is_dir, want->is_dir);
+            CHECK_EQ(pg.files[i].size, want->size);
+            count++;
+        }
+        if (!pg.more) break;
+    }
+    CHECK_EQ(count, s_expect_count);
+}
+
+static void test_limits(void) {
+    static page_t pg;
+    // no limit or one past the cap is the cap
+    CHECK_EQ(list_page(s_root, 0, 0, true, false, &pg), ESP_OK);
+    CHECK_EQ(pg.limit, SD_LIST_MAX_LIMIT);
+    CHECK_EQ(pg.count, s_expect_count);
+    CHECK_EQ(pg.more, 0);
+    CHECK_EQ(list_page(s_root, 0, 100000, false, false, &pg), ESP_OK);
+    CHECK_EQ(pg.limit, SD_LIST_MAX_LIMIT);
+
+    // the last entry alone, then past the end, then far past it
+    for (int sorted = 0; sorted < 2; sorted++) {
+        CHECK_EQ(list_page(s_root, (uint32_t)s_expect_count - 1, 10, sorted, false, &pg), ESP_OK);
+        CHECK_EQ(pg.count, 1);
+        CHECK_EQ(pg.more, 0);
+        CHECK_EQ(list_page(s_root, (uint32_t)s_expect_count, 10, sorted, false, &pg), ESP_OK);
+        CHECK_EQ(pg.count, 0);
+        CHECK_EQ(pg.total, s_expect_count);
+        CHECK_EQ(pg.more, 0);
+        CHECK_EQ(list_page(s_root, 0xfffffff0u, 10, sorted, false, &pg), ESP_OK);
+        CHECK_EQ(pg.count, 0);
+        CHECK_EQ(pg.more, 0);
+    }
+
+    // an empty folder
+    char path[128];
+    snprintf(path, sizeof(path), "%s/beta", s_root);
+    CHECK_EQ(list_page(path, 0, 10, true, false, &pg), ESP_OK);
+    CHECK_EQ(pg.count, 0);
+    CHECK_EQ(pg.total, 0);
+    CHECK_EQ(pg.more, 0);
+}
+
+// names go out as json strings: quotes, backslashes and control chars
+static void test_escaping(void) {
+    sink_t sink = {0};
+    sd_list_opts_t opts = {.limit = SD_LIST_MAX_LIMIT, .sorted = true};
+    CHECK_EQ(sd_list_dir(s_root, &opts, sink_write, &sink), ESP_OK);
+    CHECK(strstr(sink.data, "\"quote\\\"name.ir\"") != NULL);
+    CHECK(strstr(sink.data, "\"back\\\\slash.sub\"") != NULL);
+    CHECK(strstr(sink.data, "\"tab\\u0009name\"") != NULL);
+    CHECK(strstr(sink.data, "\"\xc3\xbcnicode.nfc\"") != NULL);
+    CHECK(strstr(sink.data, ".hidden") == NULL);
+    CHECK(strstr(sink.data, "\"pipe\"") == NULL);
+    sink_reset(&sink);
+}
+
+static void test_write_errors(void) {
+    // a full page is several chunks; the first failed write ends it
+    for (int fail_at = 1; fail_at <= 3; fail_at++) {
+        sink_t sink = {0};
+        sink.fail_at = fail_at;
+        sd_list_opts_t opts = {.limit = SD_LIST_MAX_LIMIT, .sorted = fail_at & 1};
+        CHECK_EQ(sd_list_dir(s_root, &opts, sink_write, &sink), ESP_FAIL);
+        CHECK_EQ(sink.writes, fail_at);
+        sink_reset(&sink);
+    }
+
+    // nothing is written when the listing cannot start
+    sink_t sink = {0};
+    sd_list_opts_t opts = {.limit = 10, .sorted = true};
+    char path[128];
+    snprintf(path, sizeof(path), "%s/missing", s_root);
+    CHECK_EQ(sd_list_dir(path, &opts, sink_write, &sink), ESP_ERR_NOT_FOUND);
+    snprintf(path, sizeof(path), "%s/a.txt", s_root);
+    CHECK_EQ(sd_list_dir(path, &opts, sink_write, &sink), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(sink.writes, 0);
+}
+
+// more names than the sort arena holds: sorted refuses before writing
+// anything, directory order still pages through all of them
+static void test_too_large_to_sort(void) {
+    char dir[128];
+    snprintf(dir, sizeof(dir), "%s/Zeta dir", s_root);
+    char name[256];
+    size_t n = 0, bytes = 0;
+    while (bytes <= SD_LIST_SORT_MAX_BYTES) {
+        snprintf(name, sizeof(name), "%04zu%0235d", n++, 0);
+        add_file(dir, name, 0, false);
+        bytes += strlen(name) + 1 + 8;
+    }
+
+    sink_t sink = {0};
+    sd_list_opts_t opts = {.limit = 10, .sorted = true};
+    CHECK_EQ(sd_list_dir(dir, &opts, sink_write, &sink), ESP_ERR_INVALID_SIZE);
+    CHECK_EQ(sink.writes, 0);
+
+    static page_t pg;
+    size_t count = 0;
+    for (uint32_t offset = 0;; offset += SD_LIST_MAX_LIMIT) {
+        if (list_page(dir, offset, SD_LIST_MAX_LIMIT, false, false, &pg) != ESP_OK) {
+            host_test_failures++;
+            break;
+        }
+        CHECK_EQ(pg.total, n);
+        count += pg.count;
+        if (!pg.more) break;
+    }
+    CHECK_EQ(count, n);
+}
+
+int main(void) {
+    make_tree();
+    test_sorted_pages();
+    test_unsorted_pages();
+    test_limits();
+    test_escaping();
+    test_write_errors();
+    test_too_large_to_sort();
+    remove_tree(s_root);
+    return HOST_TEST_RESULT();
+}
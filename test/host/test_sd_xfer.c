@@ -0,0 +1,385 @@
+// sd_xfer against files in a scratch directory, its reader and writer tasks
+// as threads: Range header parsing, reads of any range across the buffer
+// boundaries, early stops, short files and read errors, the write pipeline
+// with and without preallocation, split, interrupted and failing writes, and
+// on a shared bus the chunking and hand-overs to a busy display client.
+
+#include "host_test.h"
+#include "host_sd_io.h"
+#include "managers/sd_card_manager.h"
+#include "managers/sd_xfer.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static char s_dir[] = "/tmp/test_sd_xfer_XXXXXX";
+static char s_path[256];
+
+static uint8_t pattern(size_t i) {
+    return (uint8_t)(i * 131 + (i >> 8) * 7);
+}
+
+static void make_file(const char *path, size_t size) {
+    FILE *f = fopen(path, "wb");
+    for (size_t i = 0; i < size; i++) fputc(pattern(i), f);
+    fclose(f);
+}
+
+static long file_size(const char *path) {
+    struct stat st;
+    return stat(path, &st) == 0 ? (long)st.st_size : -1;
+}
+
+// 1 when the file holds exactly pattern(0..size)
+static int file_matches(const char *path, size_t size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return 0;
+    int ok = 1;
+    size_t i = 0;
+    for (int c; (c = fgetc(f)) != EOF; i++) {
+        if (i >= size || (uint8_t)c != pattern(i)) {
+            ok = 0;
+            break;
+        }
+    }
+    fclose(f);
+    return ok && i == size;
+}
+
+static void test_parse_range(void) {
+    static const struct {
+        const char *hdr;
+        size_t size;
+        int ret;
+        size_t first, last;
+    } cases[] = {
+        {"bytes=0-99", 1000, 1, 0, 99},
+        {"bytes=100-", 1000, 1, 100, 999},
+        {"bytes=-100", 1000, 1, 900, 999},
+        {"bytes=-5000", 1000, 1, 0, 999},   // suffix longer than the file: all of it
+        {"bytes=900-5000", 1000, 1, 900, 999}, // end clamped
+        {"bytes=999-999", 1000, 1, 999, 999},
+        {"bytes=0-0", 1, 1, 0, 0},
+        {"bytes=1000-", 1000, -1, 0, 0},
+        {"bytes=1000-1001", 1000, -1, 0, 0},
+        {"bytes=-0", 1000, -1, 0, 0},
+        {"bytes=-1", 0, -1, 0, 0},
+        {"bytes=0-", 0, -1, 0, 0},
+        {"bytes=5-4", 1000, 0, 0, 0},       // backwards: ignored, not an error
+        {"bytes=0-1,5-6", 1000, 0, 0, 0},   // multi-range: whole file
+        {"items=0-1", 1000, 0, 0, 0},
+        {"bytes=", 1000, 0, 0, 0},
+        {"bytes=-", 1000, 0, 0, 0},
+        {"bytes=abc-", 1000, 0, 0, 0},
+        {"bytes=1-2x", 1000, 0, 0, 0},
+        {"bytes=-2x", 1000, 0, 0, 0},
+        {"bytes=10", 1000, 0, 0, 0},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        size_t first = 12345, last = 12345;
+        int ret = sd_xfer_parse_range(cases[i].hdr, cases[i].size, &first, &last);
+        if (ret != cases[i].ret) fprintf(stderr, "range \"%s\"\n", cases[i].hdr);
+        CHECK_EQ(ret, cases[i].ret);
+        if (ret == 1) {
+            CHECK_EQ(first, cases[i].first);
+            CHECK_EQ(last, cases[i].last);
+        }
+    }
+}
+
+// streams [offset, offset+length) and checks every byte; returns sd_xfer_end
+static esp_err_t read_range(const char *path, size_t offset, size_t length, size_t *got,
+                            size_t *max_buf) {
+    sd_xfer_t *x = sd_xfer_begin_read(open(path, O_RDONLY), (off_t)offset, length);
+    CHECK(x != NULL);
+    if (!x) return ESP_FAIL;
+    size_t len, pos = offset;
+    const uint8_t *buf;
+    *max_buf = 0;
+    while ((buf = sd_xfer_next(x, &len)) != NULL) {
+        CHECK(len > 0 && len <= SD_XFER_BUF_SIZE);
+        for (size_t i = 0; i < len; i++) {
+            if (buf[i] != pattern(pos + i)) {
+                CHECK_EQ(buf[i], pattern(pos + i));
+                break;
+            }
+        }
+        if (len > *max_buf) *max_buf = len;
+        pos += len;
+        sd_xfer_release(x);
+    }
+    *got = pos - offset;
+    return sd_xfer_end(x);
+}
+
+static void test_read(void) {
+    const size_t size = 3 * SD_XFER_BUF_SIZE + 1000;
+    snprintf(s_path, sizeof(s_path), "%s/read.bin", s_dir);
+    make_file(s_path, size);
+
+    static const struct {
+        size_t offset, length;
+    } ranges[] = {
+        {0, 3 * SD_XFER_BUF_SIZE + 1000},
+        {0, SD_XFER_BUF_SIZE},
+        {0, SD_XFER_BUF_SIZE + 1},
+        {SD_XFER_BUF_SIZE - 1, 2},
+        {1, 2 * SD_XFER_BUF_SIZE},
+        {3 * SD_XFER_BUF_SIZE + 999, 1},
+        {12345, 0},
+    };
+    for (int split = 0; split < 2; split++) {
+        host_sd_io_reset();
+        // the card hands back odd pieces and gets interrupted now and then
+        if (split) {
+            host_sd_io.max_io = 1500;
+            host_sd_io.eintr_every = 4;
+        }
+        for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+            size_t got, max_buf;
+            CHECK_EQ(read_range(s_path, ranges[i].offset, ranges[i].length, &got, &max_buf),
+                     ESP_OK);
+            CHECK_EQ(got, ranges[i].length);
+            if (!split && ranges[i].length >= SD_XFER_BUF_SIZE) {
+                CHECK_EQ(max_buf, SD_XFER_BUF_SIZE);
+            }
+        }
+        if (split) {
+            CHECK(host_sd_io.eintrs > 0);
+            CHECK(host_sd_io.max_read <= 1500);
+        } else {
+            CHECK_EQ(host_sd_io.max_read, SD_XFER_BUF_SIZE);
+        }
+    }
+
+    // a short file fails the transfer, the length was promised to the client
+    host_sd_io_reset();
+    size_t got, max_buf;
+    CHECK_EQ(read_range(s_path, 0, size + 100, &got, &max_buf), ESP_FAIL);
+    CHECK_EQ(got, size);
+    CHECK_EQ(read_range(s_path, size - 10, 20, &got, &max_buf), ESP_FAIL);
+    CHECK_EQ(got, 10);
+
+    // so does a read error, after the good part
+    host_sd_io_reset();
+    host_sd_io.fail_after = SD_XFER_BUF_SIZE + 100;
+    CHECK_EQ(read_range(s_path, 0, size, &got, &max_buf), ESP_FAIL);
+    CHECK_EQ(got, SD_XFER_BUF_SIZE + 100);
+    host_sd_io_reset();
+}
+
+static void test_read_stop_early(void) {
+    const size_t size = 64 * SD_XFER_BUF_SIZE;
+    snprintf(s_path, sizeof(s_path), "%s/big.bin", s_dir);
+    make_file(s_path, size);
+
+    // the client goes away after one buffer: the reader stops within the
+    // two buffers in flight instead of reading the whole file
+    host_sd_io_reset();
+    host_sd_io.delay_us = 200;
+    sd_xfer_t *x = sd_xfer_begin_read(open(s_path, O_RDONLY), 0, size);
+    CHECK(x != NULL);
+    size_t len;
+    CHECK(sd_xfer_next(x, &len) != NULL);
+    CHECK_EQ(sd_xfer_end(x), ESP_OK);
+    CHECK(host_sd_io.bytes_read <= 3 * SD_XFER_BUF_SIZE);
+
+    // ending while holding nothing, and right after the start
+    x = sd_xfer_begin_read(open(s_path, O_RDONLY), 0, size);
+    CHECK(x != NULL);
+    CHECK_EQ(sd_xfer_end(x), ESP_OK);
+    host_sd_io_reset();
+
+    CHECK(sd_xfer_begin_read(-1, 0, 10) == NULL);
+    CHECK_EQ(sd_xfer_end(NULL), ESP_ERR_INVALID_ARG);
+    unlink(s_path);
+}
+
+// feeds size bytes of pattern in pieces of step through sd_xfer; the bytes
+// the producer managed to hand over go to *sent
+static esp_err_t write_file(const char *path, size_t size, size_t prealloc, size_t step,
+                            size_t *written, size_t *sent) {
+    sd_xfer_t *x = sd_xfer_begin_write(open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644), prealloc);
+    CHECK(x != NULL);
+    if (!x) return ESP_FAIL;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t cap;
+        uint8_t *buf = sd_xfer_get_buffer(x, &cap);
+        if (!buf) break;
+        CHECK(cap >= SD_XFER_MIN_BUF_SIZE);
+        // fill the buffer in network sized pieces like the upload handler
+        size_t fill = 0;
+        while (fill < cap && pos < size) {
+            size_t n = step;
+            if (n > cap - fill) n = cap - fill;
+            if (n > size - pos) n = size - pos;
+            for (size_t i = 0; i < n; i++) buf[fill + i] = pattern(pos + i);
+            fill += n;
+            pos += n;
+        }
+        sd_xfer_commit(x, fill);
+    }
+    *sent = pos;
+    return sd_xfer_finish(x, written);
+}
+
+static void test_write(void) {
+    snprintf(s_path, sizeof(s_path), "%s/upload.bin", s_dir);
+    static const size_t sizes[] = {0, 1, SD_XFER_BUF_SIZE, 5 * SD_XFER_BUF_SIZE + 77};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t size = sizes[s];
+        // no preallocation, a generous one, a too small one
+        size_t preallocs[] = {0, size * 2 + 100, size / 2 + 1};
+        for (int p = 0; p < 3; p++) {
+            host_sd_io_reset();
+            size_t written, sent;
+            CHECK_EQ(write_file(s_path, size, preallocs[p], 1460, &written, &sent), ESP_OK);
+            CHECK_EQ(sent, size);
+            CHECK_EQ(written, size);
+            // the preallocated tail is trimmed again
+            CHECK_EQ(file_size(s_path), (long)size);
+            CHECK(file_matches(s_path, size));
+            // fatfs sees whole buffers, not the network pieces
+            if (size >= SD_XFER_BUF_SIZE) CHECK_EQ(host_sd_io.max_write, SD_XFER_BUF_SIZE);
+        }
+    }
+
+    // split and interrupted writes are continued
+    host_sd_io_reset();
+    host_sd_io.max_io = 1000;
+    host_sd_io.eintr_every = 3;
+    size_t written, sent, size = 3 * SD_XFER_BUF_SIZE + 5;
+    CHECK_EQ(write_file(s_path, size, 0, 4096, &written, &sent), ESP_OK);
+    CHECK_EQ(written, size);
+    CHECK(file_matches(s_path, size));
+    CHECK(host_sd_io.eintrs > 0);
+    CHECK(host_sd_io.max_write <= 1000);
+
+    // a full card: get_buffer gives up, finish reports it, and the file is
+    // trimmed to the buffers that made it
+    host_sd_io_reset();
+    host_sd_io.fail_after = 2 * SD_XFER_BUF_SIZE + 300;
+    size = 20 * SD_XFER_BUF_SIZE;
+    CHECK_EQ(write_file(s_path, size, 0, 1460, &written, &sent), ESP_FAIL);
+    CHECK(sent < size);
+    CHECK_EQ(written, 2 * SD_XFER_BUF_SIZE);
+    CHECK_EQ(file_size(s_path), (long)written);
+    CHECK(file_matches(s_path, written));
+
+    // failing while the preallocated space is still there
+    host_sd_io_reset();
+    host_sd_io.fail_after = SD_XFER_BUF_SIZE + 1 + 1; // the prealloc byte, then one buffer
+    CHECK_EQ(write_file(s_path, size, size, 1460, &written, &sent), ESP_FAIL);
+    CHECK_EQ(written, SD_XFER_BUF_SIZE);
+    CHECK_EQ(file_size(s_path), (long)written);
+    host_sd_io_reset();
+
+    CHECK(sd_xfer_begin_write(-1, 0) == NULL);
+    CHECK_EQ(sd_xfer_finish(NULL, NULL), ESP_ERR_INVALID_ARG);
+    unlink(s_path);
+}
+
+// the display flushing on the shared bus while an upload runs
+typedef struct {
+    volatile bool stop;
+    uint32_t flushes;
+} display_t;
+
+static void *display_thread(void *arg) {
+    display_t *d = arg;
+    bus_arbiter_t *arb = host_sd_arbiter();
+    bus_client_t *c = sd_card_bus_client(BUS_CLASS_INTERACTIVE);
+    while (!d->stop) {
+        bus_arbiter_acquire(arb, c);
+        usleep(300); // one flush
+        bus_arbiter_release(arb, c);
+        d->flushes++;
+        usleep(2000);
+    }
+    return NULL;
+}
+
+static void test_shared_bus(void) {
+    snprintf(s_path, sizeof(s_path), "%s/shared.bin", s_dir);
+    host_sd_io_reset();
+    host_sd_io.shared = true;
+    host_sd_io.us_per_kb = 100; // ~10 MB/s card
+    bus_client_t *disp = sd_card_bus_client(BUS_CLASS_INTERACTIVE);
+    uint32_t before = disp->acquires;
+
+    display_t d = {0};
+    pthread_t th;
+    pthread_create(&th, NULL, display_thread, &d);
+    size_t written, sent, size = 24 * SD_XFER_BUF_SIZE;
+    CHECK_EQ(write_file(s_path, size, size, 1460, &written, &sent), ESP_OK);
+    d.stop = true;
+    pthread_join(th, NULL);
+
+    CHECK_EQ(written, size);
+    CHECK(file_matches(s_path, size));
+    // every card call happened under the sd client, in bus sized chunks
+    CHECK_EQ(host_sd_io.unowned, 0);
+    CHECK(host_sd_io.max_write <= 4096);
+    // and the display kept flushing meanwhile without long waits
+    CHECK(disp->acquires - before >= 10);
+    CHECK(disp->wait_max_us < 50000);
+
+    // reads take the bus as well
+    size_t got, max_buf;
+    CHECK_EQ(read_range(s_path, 0, size, &got, &max_buf), ESP_OK);
+    CHECK_EQ(got, size);
+    CHECK_EQ(host_sd_io.unowned, 0);
+    host_sd_io_reset();
+    unlink(s_path);
+}
+
+// with card and network taking the same time per buffer the pipeline should
+// take about half of doing them one after the other
+static void test_overlap(void) {
+    snprintf(s_path, sizeof(s_path), "%s/overlap.bin", s_dir);
+    const int buffers = 24;
+    const uint32_t card_us = 3000, net_us = 3000;
+    host_sd_io_reset();
+    host_sd_io.delay_us = card_us;
+
+    int64_t t0 = host_now_ns();
+    sd_xfer_t *x = sd_xfer_begin_write(open(s_path, O_WRONLY | O_CREAT | O_TRUNC, 0644), 0);
+    CHECK(x != NULL);
+    for (int i = 0; i < buffers; i++) {
+        size_t cap;
+        uint8_t *buf = sd_xfer_get_buffer(x, &cap);
+        usleep(net_us);
+        memset(buf, i, cap);
+        sd_xfer_commit(x, cap);
+    }
+    size_t written;
+    CHECK_EQ(sd_xfer_finish(x, &written), ESP_OK);
+    double ms = (double)(host_now_ns() - t0) / 1e6;
+    double serial_ms = buffers * (card_us + net_us) / 1000.0;
+    if (ms >= 0.8 * serial_ms) {
+        fprintf(stderr, "pipelined upload %.1f ms, serial would be %.1f ms\n", ms, serial_ms);
+    }
+    CHECK(ms < 0.8 * serial_ms);
+    CHECK_EQ(host_sd_io.writes, buffers);
+    host_sd_io_reset();
+    unlink(s_path);
+}
+
+int main(void) {
+    if (!mkdtemp(s_dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    test_parse_range();
+    test_read();
+    test_read_stop_early();
+    test_write();
+    test_shared_bus();
+    test_overlap();
+    snprintf(s_path, sizeof(s_path), "%s/read.bin", s_dir);
+    unlink(s_path);
+    rmdir(s_dir);
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,347 @@
+// settings_manager.c built into the test against the in-memory nvs of
+// esp_stubs/nvs_stub.c, the commit task running as a thread. counts the nvs
+// writes and commits of each kind of save, round-trips every s_fields entry
+// through nvs and a reboot, and checks the commit task's batching. built
+// twice: as test_settings_manager with one key per field, and as
+// test_settings_manager_blob with CONFIG_SETTINGS_BLOB_LAYOUT, where the
+// migration from per-key storage and the blob checks are tested too.
+
+#include SETTINGS_MANAGER_C
+#include "host_nvs.h"
+#include "host_test.h"
+#include <unistd.h>
+
+#define NS "storage"
+
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+#define WRITES_PER_FLUSH(fields) 1
+#else
+#define WRITES_PER_FLUSH(fields) (fields)
+#endif
+
+// a power cycle: G_Settings starts as garbage and is loaded from nvs
+static void reboot(void) {
+    nvs_close(nvsHandle);
+    memset(&G_Settings, 0xa5, sizeof(G_Settings));
+    settings_init(&G_Settings);
+}
+
+// the first boot on an erased flash, then every field written once, so later
+// boots find each key
+static void first_boot(void) {
+    settings_flush();
+    host_nvs_erase_all();
+    reboot();
+    portENTER_CRITICAL(&s_dirty_mux);
+    s_dirty = (1ULL << FIELD_COUNT) - 1;
+    portEXIT_CRITICAL(&s_dirty_mux);
+    settings_flush();
+    host_nvs_clear_counts();
+}
+
+// changes field i to a value it does not have, within what the loader keeps
+static void poke(FSettings *s, int i) {
+    const settings_field_t *f = &s_fields[i];
+    uint8_t *p = (uint8_t *)s + f->offset;
+    uint32_t v = field_uint(s, f);
+    switch (f->type) {
+    case FT_STR:
+        snprintf((char *)p, f->size, "%d:%s", i, *f->key);
+        return;
+    case FT_BLOB: {
+        float x;
+        memcpy(&x, p, sizeof(x));
+        x += 2.5f;
+        memcpy(p, &x, sizeof(x));
+        return;
+    }
+    case FT_I32:
+        v = v == (uint32_t)(7 + i) ? (uint32_t)(8 + i) : (uint32_t)(7 + i);
+        break;
+    case FT_U16:
+        v ^= 0x5a5;
+        break;
+    case FT_U32:
+        v ^= 0x05a5a5a5;
+        break;
+    default:
+        v = v ? 0 : 1; // bools, and enums stored as u8
+        break;
+    }
+    memcpy(p, &v, f->size); // little endian, like the target
+}
+
+// the fields that differ, as a count; each one is reported
+static int differences(const FSettings *got, const FSettings *want, const char *what) {
+    int n = 0;
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        if (!field_changed(got, want, &s_fields[i])) continue;
+        fprintf(stderr, "%s: %s differs\n", what, *s_fields[i].key);
+        n++;
+    }
+    return n;
+}
+
+static bool wait_commits(uint32_t n) {
+    for (int i = 0; i < 2000; i++) {
+        if (__atomic_load_n(&host_nvs.commits, __ATOMIC_RELAXED) >= n) return true;
+        usleep(1000);
+    }
+    return false;
+}
+
+// long enough for any save in flight to reach nvs
+static void settle(void) {
+    usleep((SETTINGS_COMMIT_MAX_WAIT_MS + 100) * 1000);
+}
+
+// every key fits the 15 characters nvs allows, and no two fields share one
+static void test_keys(void) {
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        CHECK(s_fields[i].key != NULL && *s_fields[i].key != NULL);
+        if (!s_fields[i].key || !*s_fields[i].key) continue;
+        if (strlen(*s_fields[i].key) >= NVS_KEY_NAME_MAX_SIZE) {
+            fprintf(stderr, "key too long: %s\n", *s_fields[i].key);
+            CHECK(!"key too long");
+        }
+        for (int j = 0; j < i; j++) CHECK(strcmp(*s_fields[i].key, *s_fields[j].key) != 0);
+        CHECK(s_fields[i].size > 0);
+    }
+}
+
+// each field on its own: one write, one commit, and it survives a reboot
+static void test_round_trip_each(void) {
+    first_boot();
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        FSettings want;
+        settings_lock();
+        poke(&G_Settings, i);
+        memcpy(&want, &G_Settings, sizeof(want));
+        settings_unlock();
+
+        host_nvs_clear_counts();
+        settings_flush();
+        int before = host_test_failures;
+        CHECK_EQ(host_nvs.sets, 1);
+        CHECK_EQ(host_nvs.writes, 1);
+        CHECK_EQ(host_nvs.commits, 1);
+
+        reboot();
+        CHECK_EQ(differences(&G_Settings, &want, *s_fields[i].key), 0);
+        // nothing changed: a save after boot writes nothing
+        host_nvs_clear_counts();
+        settings_flush();
+        CHECK_EQ(host_nvs.sets, 0);
+        CHECK_EQ(host_nvs.commits, 0);
+        if (host_test_failures != before) fprintf(stderr, "field %s\n", *s_fields[i].key);
+    }
+}
+
+// every field at once
+static void test_round_trip_all(void) {
+    first_boot();
+    FSettings want;
+    settings_lock();
+    for (int i = 0; i < FIELD_COUNT; i++) poke(&G_Settings, i);
+    memcpy(&want, &G_Settings, sizeof(want));
+    settings_unlock();
+
+    settings_flush();
+    CHECK_EQ(host_nvs.sets, WRITES_PER_FLUSH(FIELD_COUNT));
+    CHECK_EQ(host_nvs.commits, 1);
+    reboot();
+    CHECK_EQ(differences(&G_Settings, &want, "all fields"), 0);
+
+    // and back to the defaults
+    FSettings defaults;
+    settings_set_defaults(&defaults);
+    settings_save(&defaults);
+    settings_flush();
+    reboot();
+    CHECK_EQ(differences(&G_Settings, &defaults, "defaults"), 0);
+}
+
+// what each way of saving costs through the commit task
+static void test_save_scenarios(void) {
+    first_boot();
+
+    // nothing changed
+    settings_save(&G_Settings);
+    settle();
+    CHECK_EQ(host_nvs.sets, 0);
+    CHECK_EQ(host_nvs.commits, 0);
+
+    // one setter
+    host_nvs_clear_counts();
+    settings_set_broadcast_speed(&G_Settings, 9);
+    settings_save(&G_Settings);
+    CHECK(wait_commits(1));
+    settle();
+    CHECK_EQ(host_nvs.sets, 1);
+    CHECK_EQ(host_nvs.commits, 1);
+
+    // a field written directly, as some views do, is found by comparing
+    host_nvs_clear_counts();
+    settings_lock();
+    G_Settings.max_screen_brightness = 40;
+    settings_unlock();
+    settings_save(&G_Settings);
+    CHECK(wait_commits(1));
+    settle();
+    CHECK_EQ(host_nvs.sets, 1);
+    CHECK_EQ(host_nvs.commits, 1);
+
+    // a setter storing the value nvs already holds is written again, but
+    // flash keeps it as it is
+    host_nvs_clear_counts();
+    settings_set_broadcast_speed(&G_Settings, 9);
+    settings_save(&G_Settings);
+    CHECK(wait_commits(1));
+    settle();
+    CHECK_EQ(host_nvs.sets, 1);
+    CHECK_EQ(host_nvs.writes, 0);
+
+    // a burst of saves, like a slider being dragged: one commit
+    host_nvs_clear_counts();
+    for (int i = 0; i < 20; i++) {
+        settings_set_max_screen_brightness(&G_Settings, (uint8_t)(50 + i));
+        settings_set_neopixel_max_brightness(&G_Settings, (uint8_t)(20 + i));
+        if (i % 4 == 0) settings_set_menu_theme(&G_Settings, (uint8_t)(i / 4));
+        settings_save(&G_Settings);
+        usleep(1000);
+    }
+    CHECK(wait_commits(1));
+    settle();
+    CHECK_EQ(host_nvs.sets, WRITES_PER_FLUSH(3));
+    CHECK_EQ(host_nvs.commits, 1);
+
+    // saves that never stop still reach nvs within the maximum wait
+    host_nvs_clear_counts();
+    int64_t t0 = host_now_ns();
+    int64_t first_commit_ms = -1;
+    for (int i = 0; i < 40; i++) {
+        settings_set_max_screen_brightness(&G_Settings, (uint8_t)i);
+        settings_save(&G_Settings);
+        usleep(10000);
+        if (first_commit_ms < 0 && __atomic_load_n(&host_nvs.commits, __ATOMIC_RELAXED)) {
+            first_commit_ms = (host_now_ns() - t0) / 1000000;
+        }
+    }
+    uint32_t during = __atomic_load_n(&host_nvs.commits, __ATOMIC_RELAXED);
+    settle();
+    printf("saves every 10 ms for %d ms: first commit after %lld ms, %u commits during the burst\n",
+           (int)((host_now_ns() - t0) / 1000000), (long long)first_commit_ms, during);
+    CHECK(during >= 2);
+    CHECK(first_commit_ms >= 0 && first_commit_ms < SETTINGS_COMMIT_MAX_WAIT_MS + 100);
+
+    // a pending save is flushed by the shutdown handler before a restart
+    host_nvs_clear_counts();
+    settings_set_broadcast_speed(&G_Settings, 3);
+    settings_save(&G_Settings);
+    settings_shutdown_flush();
+    CHECK_EQ(host_nvs.sets, 1);
+    CHECK_EQ(host_nvs.commits, 1);
+    settle();
+    CHECK_EQ(host_nvs.commits, 1);
+    reboot();
+    CHECK_EQ(G_Settings.broadcast_speed, 3);
+}
+
+// a write that fails is retried by the next flush, nothing is lost
+static void test_failed_write(void) {
+    first_boot();
+    settings_set_rgb_speed(&G_Settings, 42);
+    host_nvs.fail_sets = ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+    settings_flush();
+    host_nvs.fail_sets = ESP_OK;
+    CHECK_EQ(host_nvs.writes, 0);
+
+    host_nvs_clear_counts();
+    settings_flush();
+    CHECK_EQ(host_nvs.writes, 1);
+    reboot();
+    CHECK_EQ(G_Settings.rgb_speed, 42);
+}
+
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+// per-key settings from an older firmware
+static void write_keys(const FSettings *s) {
+    for (int i = 0; i < FIELD_COUNT; i++) CHECK_EQ(field_write(s, &s_fields[i]), ESP_OK);
+    CHECK_EQ(nvs_commit(nvsHandle), ESP_OK);
+}
+
+static void test_migration(void) {
+    settings_flush();
+    host_nvs_erase_all();
+    FSettings old;
+    settings_set_defaults(&old);
+    for (int i = 0; i < FIELD_COUNT; i++) poke(&old, i);
+    write_keys(&old);
+    CHECK_EQ(host_nvs_key_count(NS), FIELD_COUNT);
+
+    host_nvs_clear_counts();
+    reboot();
+    CHECK_EQ(differences(&G_Settings, &old, "migrated"), 0);
+    // one blob written, every per-key entry erased
+    CHECK_EQ(host_nvs.sets, 1);
+    CHECK_EQ(host_nvs.erases, FIELD_COUNT);
+    CHECK_EQ(host_nvs_key_count(NS), 1);
+    CHECK(host_nvs_has(NS, SETTINGS_BLOB_KEY));
+    CHECK(settings_ap_enabled_stored());
+
+    // the next boot reads the blob alone
+    host_nvs_clear_counts();
+    reboot();
+    CHECK_EQ(differences(&G_Settings, &old, "from blob"), 0);
+    CHECK_EQ(host_nvs.sets, 0);
+}
+
+// a blob that fails a check gives the defaults; stale per-key entries next
+// to it are not brought back, and are erased with the next blob write
+static void check_bad_blob(size_t offset, uint8_t xor, const char *what) {
+    first_boot();
+    settings_set_rgb_speed(&G_Settings, 77);
+    settings_flush();
+
+    FSettings stale;
+    settings_set_defaults(&stale);
+    stale.rgb_speed = 11;
+    write_keys(&stale);
+
+    settings_blob_t blob;
+    size_t len = sizeof(blob);
+    CHECK_EQ(nvs_get_blob(nvsHandle, SETTINGS_BLOB_KEY, &blob, &len), ESP_OK);
+    ((uint8_t *)&blob)[offset] ^= xor;
+    CHECK_EQ(nvs_set_blob(nvsHandle, SETTINGS_BLOB_KEY, &blob, sizeof(blob)), ESP_OK);
+
+    reboot();
+    FSettings defaults;
+    settings_set_defaults(&defaults);
+    CHECK_EQ(differences(&G_Settings, &defaults, what), 0);
+    CHECK_EQ(host_nvs_key_count(NS), 1);
+
+    reboot();
+    CHECK_EQ(differences(&G_Settings, &defaults, what), 0);
+}
+
+static void test_bad_blob(void) {
+    check_bad_blob(offsetof(settings_blob_t, data) + offsetof(FSettings, rgb_speed), 0x01, "crc");
+    check_bad_blob(offsetof(settings_blob_t, version), 0x02, "version");
+    check_bad_blob(offsetof(settings_blob_t, magic), 0x80, "magic");
+    check_bad_blob(offsetof(settings_blob_t, size), 0x04, "size");
+}
+#endif
+
+int main(void) {
+    test_keys();
+    test_round_trip_each();
+    test_round_trip_all();
+    test_save_scenarios();
+    test_failed_write();
+#ifdef CONFIG_SETTINGS_BLOB_LAYOUT
+    test_migration();
+    test_bad_blob();
+#endif
+    settings_flush();
+    return HOST_TEST_RESULT();
+}
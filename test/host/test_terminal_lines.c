@@ -0,0 +1,284 @@
+// terminal scrollback (managers/views/terminal_lines.c): the text arena
+// against a plain list of every appended line, with the free running arena
+// cursors wrapping past 2^32, the dualcomm classification, incremental
+// layout, and the y index and first visible line of each column against a
+// walk from the oldest line like the terminal did before the index.
+
+#include "host_test.h"
+#include "managers/views/terminal_lines.h"
+
+static term_line_t s_lines[TERM_MAX_LINES];
+static char s_arena[TERM_TEXT_BYTES];
+
+static void lines_reset(term_lines_t *t, uint32_t at) {
+    memset(s_arena, 0, sizeof(s_arena));
+    t->lines = s_lines;
+    t->arena = s_arena;
+    term_lines_clear(t);
+    t->arena_head = t->arena_tail = at;
+}
+
+static uint32_t s_rand = 0x6b8b4567;
+
+static uint32_t rnd(uint32_t n) {
+    s_rand ^= s_rand << 13;
+    s_rand ^= s_rand >> 17;
+    s_rand ^= s_rand << 5;
+    return s_rand % n;
+}
+
+// every line ever appended, as the terminal should show it
+#define REF_MAX 40000
+static char *s_ref[REF_MAX];
+static size_t s_ref_count;
+
+static const char *const dc_lines[] = {
+    "RX: scan done, 12 aps",
+    "I: Discovered peer: ghost-2",
+    "  W: Handshake timeout",
+    "ESP Comm Response: ok",
+    "I: Sent command: scanap",
+};
+
+// a numbered line of a random length; some are dualcomm traffic
+static size_t make_line(char *out, size_t max_len, unsigned n, int dc_pct) {
+    if ((int)rnd(100) < dc_pct) {
+        return (size_t)snprintf(out, 64, "%s %u", dc_lines[rnd(5)], n);
+    }
+    size_t len = rnd(20) == 0 ? rnd((uint32_t)max_len + 1) : rnd(max_len < 90 ? 30 : 90);
+    for (size_t i = 0; i < len; i++) out[i] = (char)('a' + (n + i) % 26);
+    if (len >= 8) snprintf(out, 9, "%08u", n % 100000000);
+    if (len >= 8) out[8] = 'x';
+    return len;
+}
+
+static void ref_push(const char *line, size_t len) {
+    if (len > TERM_MAX_LINE_LEN) len = TERM_MAX_LINE_LEN;
+    char *c = malloc(len + 1);
+    memcpy(c, line, len);
+    c[len] = '\0';
+    s_ref[s_ref_count++] = c;
+}
+
+static void ref_free(void) {
+    for (size_t i = 0; i < s_ref_count; i++) free(s_ref[i]);
+    s_ref_count = 0;
+}
+
+// the held lines are the newest ones, in order, nul terminated, never
+// straddling the arena end, and only as few as the caps force
+static void check_held(const term_lines_t *t) {
+    CHECK(t->count <= TERM_MAX_LINES);
+    CHECK(t->count <= s_ref_count);
+    uint32_t bytes = 0;
+    for (uint16_t i = 0; i < t->count; i++) {
+        const term_line_t *l = term_lines_at(t, i);
+        const char *want = s_ref[s_ref_count - t->count + i];
+        CHECK(l->off + l->len + 1u <= TERM_TEXT_BYTES);
+        CHECK_EQ(l->len, strlen(want));
+        if (strcmp(t->arena + l->off, want) != 0) {
+            CHECK_STR(t->arena + l->off, want);
+            return;
+        }
+        bytes += l->len + 1u;
+    }
+    CHECK(t->arena_head - t->arena_tail <= TERM_TEXT_BYTES);
+    CHECK(bytes <= t->arena_head - t->arena_tail);
+    if (t->count) CHECK_EQ(term_lines_at(t, 0)->off, t->arena_tail & TERM_TEXT_MASK);
+    // one more old line would not have fit, even with the worst end gap
+    if (t->count < TERM_MAX_LINES && t->count < s_ref_count) {
+        size_t older = strlen(s_ref[s_ref_count - t->count - 1]) + 1;
+        CHECK(bytes + older + TERM_MAX_LINE_LEN + 1 > TERM_TEXT_BYTES);
+    }
+}
+
+static void test_append(void) {
+    static char line[2048];
+    static const uint32_t starts[] = {0, 0xffffff00u, 0xfffff000u + 17};
+    static const size_t max_lens[] = {40, 1500};
+    for (size_t s = 0; s < sizeof(starts) / sizeof(starts[0]); s++) {
+        for (size_t m = 0; m < 2; m++) {
+            term_lines_t t;
+            lines_reset(&t, starts[s]);
+            for (unsigned n = 0; n < 6000; n++) {
+                size_t len = make_line(line, max_lens[m], n, 20);
+                term_lines_append(&t, line, len);
+                ref_push(line, len);
+                if (n % 97 == 0 || n > 5900) check_held(&t);
+            }
+            // lots of short lines hit the line cap, long ones the byte cap
+            if (m == 0) CHECK_EQ(t.count, TERM_MAX_LINES);
+            else CHECK(t.count < TERM_MAX_LINES);
+            ref_free();
+        }
+    }
+
+    // one line of every length around the cut
+    term_lines_t t;
+    lines_reset(&t, 0);
+    memset(line, 'q', sizeof(line));
+    for (size_t len = TERM_MAX_LINE_LEN - 2; len <= TERM_MAX_LINE_LEN + 2; len++) {
+        term_lines_append(&t, line, len);
+        ref_push(line, len);
+    }
+    check_held(&t);
+    CHECK_EQ(term_lines_at(&t, t.count - 1)->len, TERM_MAX_LINE_LEN);
+    ref_free();
+
+    // an empty line is drawn as a space, and clearing empties the arena
+    term_lines_append(&t, "", 0);
+    CHECK_STR(term_lines_text(&t, t.count - 1, TERM_COL_ALL), " ");
+    term_lines_clear(&t);
+    CHECK_EQ(t.count, 0);
+    CHECK_EQ(t.arena_head, t.arena_tail);
+
+    // nothing to append into before the buffers exist
+    term_lines_t none = {0};
+    term_lines_append(&none, "x", 1);
+    CHECK_EQ(none.count, 0);
+}
+
+static void test_dualcomm(void) {
+    static const struct {
+        const char *line;
+        bool dc;
+        const char *shown;
+    } cases[] = {
+        {"RX: hello", true, "hello"},
+        {"   RX: padded", true, "padded"},
+        {"I: Discovered peer: ghost", true, "Discovered peer: ghost"},
+        {"W: Connection lost, restarting discovery", true,
+         "Connection lost, restarting discovery"},
+        {"ESP Comm Response: scan done", true, "scan done"},
+        {"Handshake completed!", true, "Handshake completed!"},
+        {"Peer has smaller name, waiting", true, "Peer has smaller name, waiting"},
+        {"I: Scanning for APs", false, NULL},
+        {"plain output", false, NULL},
+        {"", false, NULL},
+    };
+    term_lines_t t;
+    lines_reset(&t, 0);
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        term_lines_append(&t, cases[i].line, strlen(cases[i].line));
+        const term_line_t *l = term_lines_at(&t, t.count - 1);
+        CHECK_EQ((l->flags & TERM_LINE_DUALCOMM) != 0, cases[i].dc);
+        CHECK_EQ(term_line_in_column(l, TERM_COL_DUALCOMM), cases[i].dc);
+        CHECK_EQ(term_line_in_column(l, TERM_COL_LOCAL), !cases[i].dc);
+        CHECK(term_line_in_column(l, TERM_COL_ALL));
+        if (cases[i].dc) CHECK_STR(term_lines_text(&t, t.count - 1, TERM_COL_DUALCOMM),
+                                   cases[i].shown);
+        // the local column shows the line as it came
+        if (cases[i].line[0]) CHECK_STR(term_lines_text(&t, t.count - 1, TERM_COL_ALL),
+                                        cases[i].line);
+    }
+    CHECK(!terminal_is_dualcomm_line(NULL));
+    CHECK_STR(terminal_dualcomm_display_text(NULL), "");
+}
+
+// a monospace font: 6 px per char, 10 px per wrapped row
+typedef struct {
+    int width;
+    unsigned calls;
+} measure_t;
+
+static uint16_t measure(void *ctx, const char *text) {
+    measure_t *m = ctx;
+    m->calls++;
+    size_t per_row = (size_t)(m->width / 6);
+    size_t len = strlen(text);
+    return (uint16_t)(10 * (len ? (len + per_row - 1) / per_row : 1));
+}
+
+static int32_t walk_y(const term_lines_t *t, uint16_t i, int col) {
+    int32_t y = 0;
+    for (uint16_t k = 0; k < i; k++) {
+        const term_line_t *l = term_lines_at(t, k);
+        if (term_line_in_column(l, col)) y += l->pxh;
+    }
+    return y;
+}
+
+// the old draw loop: walk from the oldest line to the first one reaching y
+static uint16_t walk_first_visible(const term_lines_t *t, int col, int32_t y) {
+    int32_t at = 0;
+    for (uint16_t i = 0; i < t->laid_out; i++) {
+        const term_line_t *l = term_lines_at(t, i);
+        if (term_line_in_column(l, col)) {
+            if (at + l->pxh >= y) return i;
+            at += l->pxh;
+        } else if (at >= y) {
+            return i;
+        }
+    }
+    return t->laid_out;
+}
+
+static void check_index(const term_lines_t *t) {
+    int32_t height[3] = {0};
+    for (int col = TERM_COL_ALL; col <= TERM_COL_DUALCOMM; col++) {
+        for (uint16_t i = 0; i < t->laid_out; i += 7) {
+            CHECK_EQ(term_lines_y(t, i, col), walk_y(t, i, col));
+        }
+        height[col] = walk_y(t, t->laid_out, col);
+        for (int k = 0; k < 50; k++) {
+            int32_t y = (int32_t)rnd((uint32_t)height[col] + 40) - 20;
+            uint16_t got = term_lines_first_visible(t, col, y);
+            if (got != walk_first_visible(t, col, y)) {
+                fprintf(stderr, "col %d y %d\n", col, y);
+                CHECK_EQ(got, walk_first_visible(t, col, y));
+                return;
+            }
+        }
+    }
+    CHECK_EQ(term_lines_height(t, false), height[TERM_COL_ALL]);
+    int32_t taller = height[TERM_COL_LOCAL] > height[TERM_COL_DUALCOMM] ? height[TERM_COL_LOCAL]
+                                                                         : height[TERM_COL_DUALCOMM];
+    CHECK_EQ(term_lines_height(t, true), taller);
+}
+
+static void test_layout(void) {
+    static char line[2048];
+    term_lines_t t;
+    lines_reset(&t, 0xffffc000u);
+    measure_t m = {.width = 240};
+    CHECK_EQ(term_lines_height(&t, false), 0);
+    CHECK_EQ(term_lines_first_visible(&t, TERM_COL_ALL, 0), 0);
+
+    unsigned n = 0;
+    for (int round = 0; round < 300; round++) {
+        unsigned add = rnd(40);
+        for (unsigned k = 0; k < add; k++, n++) {
+            size_t len = make_line(line, 400, n, 30);
+            term_lines_append(&t, line, len);
+        }
+        // only the new lines are measured
+        unsigned before = m.calls;
+        uint16_t pending = t.count - t.laid_out;
+        term_lines_layout(&t, measure, &m);
+        CHECK_EQ(m.calls - before, pending);
+        CHECK_EQ(t.laid_out, t.count);
+        if (round % 10 == 0) check_index(&t);
+
+        // a width change measures everything again
+        if (round % 50 == 49) {
+            m.width = m.width == 240 ? 120 : 240;
+            term_lines_invalidate(&t);
+            before = m.calls;
+            term_lines_layout(&t, measure, &m);
+            CHECK_EQ(m.calls - before, t.count);
+            check_index(&t);
+        }
+    }
+
+    // lines appended after a layout are not part of the index until the next
+    term_lines_append(&t, "late", 4);
+    CHECK_EQ(t.laid_out, t.count - 1);
+    check_index(&t);
+}
+
+int main(void) {
+    test_append();
+    test_dualcomm();
+    test_layout();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,248 @@
+// u-blox UBX decoder: data/ubx.txt (gen_ubx.py) run through one decoder byte
+// by byte, frames checked against the fields they were built from, plus the
+// config frames the receiver is set up with read back through the decoder.
+
+#include "vendor/GPS/ubx.h"
+#include "host_test.h"
+
+static size_t unhex(const char *s, uint8_t *out, size_t cap) {
+    size_t n = 0;
+    unsigned v;
+    while (n < cap && sscanf(s, "%2x", &v) == 1) {
+        out[n++] = (uint8_t)v;
+        s += 2;
+    }
+    return n;
+}
+
+static void check_pvt(const char *expect, const ubx_decoder_t *dec, int line) {
+    long long v[21];
+    char mag[16];
+    int n = sscanf(expect,
+                   "pvt %lld %lld %lld %lld %lld %lld %lld %lld %lld %lld %lld %lld %lld %lld "
+                   "%lld %lld %lld %lld %lld %lld %lld %15s",
+                   &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7], &v[8], &v[9], &v[10],
+                   &v[11], &v[12], &v[13], &v[14], &v[15], &v[16], &v[17], &v[18], &v[19], &v[20],
+                   mag);
+    CHECK_EQ(n, 22);
+    CHECK_EQ(dec->msg_class, UBX_CLASS_NAV);
+    CHECK_EQ(dec->msg_id, UBX_ID_NAV_PVT);
+
+    ubx_nav_pvt_t pvt;
+    CHECK(ubx_parse_nav_pvt(dec->payload, dec->len, &pvt));
+    int before = host_test_failures;
+    CHECK_EQ(pvt.itow_ms, v[0]);
+    CHECK_EQ(pvt.year, v[1]);
+    CHECK_EQ(pvt.month, v[2]);
+    CHECK_EQ(pvt.day, v[3]);
+    CHECK_EQ(pvt.hour, v[4]);
+    CHECK_EQ(pvt.min, v[5]);
+    CHECK_EQ(pvt.sec, v[6]);
+    CHECK_EQ(pvt.valid, v[7]);
+    CHECK_EQ(pvt.nano, v[8]);
+    CHECK_EQ(pvt.fix_type, v[9]);
+    CHECK_EQ(pvt.flags, v[10]);
+    CHECK_EQ(pvt.num_sv, v[11]);
+    CHECK_EQ(pvt.lon_e7, v[12]);
+    CHECK_EQ(pvt.lat_e7, v[13]);
+    CHECK_EQ(pvt.height_mm, v[14]);
+    CHECK_EQ(pvt.hmsl_mm, v[15]);
+    CHECK_EQ(pvt.h_acc_mm, v[16]);
+    CHECK_EQ(pvt.v_acc_mm, v[17]);
+    CHECK_EQ(pvt.g_speed_mmps, v[18]);
+    CHECK_EQ(pvt.head_mot_e5, v[19]);
+    CHECK_EQ(pvt.pdop_e2, v[20]);
+    // the short (u-blox 7) layout has no magnetic declination
+    CHECK_EQ(pvt.has_mag_dec, strcmp(mag, "-") != 0);
+    if (pvt.has_mag_dec) CHECK_EQ(pvt.mag_dec_e2, atoi(mag));
+    if (host_test_failures != before) fprintf(stderr, "pvt at line %d\n", line);
+
+    // anything shorter than the short layout is refused
+    CHECK(!ubx_parse_nav_pvt(dec->payload, UBX_NAV_PVT_LEN_MIN - 1, &pvt));
+}
+
+static void check_dop(const char *expect, const ubx_decoder_t *dec) {
+    unsigned itow, g, p, t, v, h;
+    CHECK_EQ(sscanf(expect, "dop %u %u %u %u %u %u", &itow, &g, &p, &t, &v, &h), 6);
+    CHECK_EQ(dec->msg_id, UBX_ID_NAV_DOP);
+    ubx_nav_dop_t dop;
+    CHECK(ubx_parse_nav_dop(dec->payload, dec->len, &dop));
+    CHECK_EQ(dop.itow_ms, itow);
+    CHECK_EQ(dop.gdop_e2, g);
+    CHECK_EQ(dop.pdop_e2, p);
+    CHECK_EQ(dop.tdop_e2, t);
+    CHECK_EQ(dop.vdop_e2, v);
+    CHECK_EQ(dop.hdop_e2, h);
+    CHECK(!ubx_parse_nav_dop(dec->payload, 17, &dop));
+}
+
+static void check_sat(const char *expect, const ubx_decoder_t *dec) {
+    CHECK_EQ(dec->msg_id, UBX_ID_NAV_SAT);
+    uint8_t count = ubx_nav_sat_count(dec->payload, dec->len);
+    const char *p = expect + 3;
+    uint8_t i = 0;
+    int gnss, sv, cno, elev, azim, used, used_n;
+    while (sscanf(p, " %d:%d:%d:%d:%d:%d%n", &gnss, &sv, &cno, &elev, &azim, &used, &used_n) == 6) {
+        ubx_sat_t sat;
+        CHECK(ubx_nav_sat_get(dec->payload, dec->len, i, &sat));
+        CHECK_EQ(sat.gnss_id, gnss);
+        CHECK_EQ(sat.sv_id, sv);
+        CHECK_EQ(sat.cno, cno);
+        CHECK_EQ(sat.elev, elev);
+        CHECK_EQ(sat.azim, azim);
+        CHECK_EQ(sat.used, used);
+        p += used_n;
+        i++;
+    }
+    CHECK_EQ(count, i);
+    ubx_sat_t sat;
+    CHECK(!ubx_nav_sat_get(dec->payload, dec->len, i, &sat));
+    // a count the payload cannot hold is malformed
+    CHECK_EQ(ubx_nav_sat_count(dec->payload, (uint16_t)(dec->len - 1)), 0);
+}
+
+static void test_corpus(void) {
+    FILE *f = fopen(host_data_path("ubx.txt"), "r");
+    CHECK(f != NULL);
+    if (!f) return;
+
+    ubx_decoder_t dec;
+    memset(&dec, 0, sizeof(dec));
+    ubx_decoder_reset(&dec);
+
+    static char line[8192], expect[512];
+    static uint8_t bytes[4096];
+    int lineno = 0, expect_line = 0, pieces = 0;
+    uint32_t want_frames = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (strncmp(line, "hex ", 4) != 0) {
+            snprintf(expect, sizeof(expect), "%.511s", line);
+            expect_line = lineno;
+            continue;
+        }
+
+        size_t n = unhex(line + 4, bytes, sizeof(bytes));
+        uint32_t frames = 0, handed_back = 0;
+        for (size_t i = 0; i < n; i++) {
+            ubx_push_result_t res = ubx_decoder_push(&dec, bytes[i]);
+            if (res == UBX_PUSH_NONE) handed_back++;
+            if (res != UBX_PUSH_FRAME) continue;
+            frames++;
+            // a frame only ever completes on the last byte of its piece
+            CHECK_EQ(i, n - 1);
+        }
+        CHECK(ubx_decoder_idle(&dec));
+        pieces++;
+
+        if (strncmp(expect, "none", 4) == 0) {
+            if (frames || handed_back != strtoul(expect + 5, NULL, 10)) {
+                fprintf(stderr, "piece at line %d: %u frames, %u bytes handed back\n",
+                        expect_line, frames, handed_back);
+                host_test_failures++;
+            }
+            continue;
+        }
+        want_frames++;
+        CHECK_EQ(frames, 1);
+        CHECK_EQ(handed_back, 0);
+        if (frames != 1) {
+            fprintf(stderr, "piece at line %d\n", expect_line);
+            continue;
+        }
+        if (strncmp(expect, "pvt", 3) == 0) {
+            check_pvt(expect, &dec, expect_line);
+        } else if (strncmp(expect, "dop", 3) == 0) {
+            check_dop(expect, &dec);
+        } else if (strncmp(expect, "sat", 3) == 0) {
+            check_sat(expect, &dec);
+        } else if (strncmp(expect, "ack", 3) == 0) {
+            unsigned cls, id;
+            CHECK_EQ(sscanf(expect, "ack %u %u", &cls, &id), 2);
+            CHECK_EQ(dec.msg_class, UBX_CLASS_ACK);
+            CHECK_EQ(dec.msg_id, UBX_ID_ACK_ACK);
+            CHECK_EQ(dec.len, 2);
+            CHECK_EQ(dec.payload[0], cls);
+            CHECK_EQ(dec.payload[1], id);
+        } else {
+            fprintf(stderr, "line %d: unknown expectation %s", expect_line, expect);
+            host_test_failures++;
+        }
+    }
+    fclose(f);
+
+    CHECK(pieces >= 10);
+    CHECK_EQ(dec.frames, want_frames);
+    CHECK_EQ(dec.bad_checksum, 2);
+    CHECK_EQ(dec.oversize, 1);
+}
+
+static void test_frame(void) {
+    // ACK-ACK for CFG-PRT and a MON-VER poll, as the u-blox manuals print them
+    static const uint8_t ack[] = {0xB5, 0x62, 0x05, 0x01, 0x02, 0x00, 0x06, 0x00, 0x0E, 0x37};
+    static const uint8_t mon_ver[] = {0xB5, 0x62, 0x0A, 0x04, 0x00, 0x00, 0x0E, 0x34};
+    uint8_t out[16];
+    uint8_t payload[] = {0x06, 0x00};
+
+    CHECK_EQ(ubx_frame(UBX_CLASS_ACK, UBX_ID_ACK_ACK, payload, 2, out, sizeof(out)), sizeof(ack));
+    CHECK(memcmp(out, ack, sizeof(ack)) == 0);
+    CHECK_EQ(ubx_frame(0x0A, 0x04, NULL, 0, out, sizeof(out)), sizeof(mon_ver));
+    CHECK(memcmp(out, mon_ver, sizeof(mon_ver)) == 0);
+    CHECK_EQ(ubx_frame(UBX_CLASS_ACK, UBX_ID_ACK_ACK, payload, 2, out, sizeof(ack) - 1), 0);
+}
+
+// decode the cfg frames in buf into their ids, the last one stays in dec
+static int decode_all(const uint8_t *buf, size_t len, uint8_t *msg_id, ubx_decoder_t *dec) {
+    int frames = 0;
+    ubx_decoder_reset(dec);
+    for (size_t i = 0; i < len; i++) {
+        ubx_push_result_t res = ubx_decoder_push(dec, buf[i]);
+        CHECK(res != UBX_PUSH_NONE);
+        if (res == UBX_PUSH_FRAME) {
+            CHECK_EQ(dec->msg_class, UBX_CLASS_CFG);
+            msg_id[frames++] = dec->msg_id;
+        }
+    }
+    CHECK(ubx_decoder_idle(dec));
+    return frames;
+}
+
+static void test_config(void) {
+    static ubx_decoder_t dec;
+    uint8_t buf[256], ids[8];
+
+    // CFG-MSG x3, CFG-RATE, then one CFG-VALSET
+    size_t len = ubx_build_enable(5, buf, sizeof(buf));
+    CHECK(len > 0);
+    CHECK_EQ(decode_all(buf, len, ids, &dec), 5);
+    CHECK_EQ(ids[0], 0x01);
+    CHECK_EQ(ids[3], 0x08);
+    CHECK_EQ(ids[4], 0x8A);
+    // the last frame ends with the measurement rate key and 200 ms
+    CHECK_EQ(dec.payload[dec.len - 2] | dec.payload[dec.len - 1] << 8, 200);
+    CHECK_EQ(ubx_build_enable(5, buf, len - 1), 0);
+    // rate 0 is taken as 1 Hz
+    len = ubx_build_enable(0, buf, sizeof(buf));
+    CHECK_EQ(decode_all(buf, len, ids, &dec), 5);
+    CHECK_EQ(dec.payload[dec.len - 2] | dec.payload[dec.len - 1] << 8, 1000);
+
+    // CFG-PRT, then CFG-VALSET with the baud rate last
+    len = ubx_build_baud(115200, buf, sizeof(buf));
+    CHECK(len > 0);
+    CHECK_EQ(decode_all(buf, len, ids, &dec), 2);
+    CHECK_EQ(ids[0], 0x00);
+    CHECK_EQ(ids[1], 0x8A);
+    uint32_t baud = dec.payload[dec.len - 4] | dec.payload[dec.len - 3] << 8 |
+                    dec.payload[dec.len - 2] << 16 | (uint32_t)dec.payload[dec.len - 1] << 24;
+    CHECK_EQ(baud, 115200);
+    CHECK_EQ(ubx_build_baud(115200, buf, len - 1), 0);
+}
+
+int main(void) {
+    test_frame();
+    test_corpus();
+    test_config();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,247 @@
+// wardrive_csv against the snprintf/double formatter it replaced: the same
+// observation must produce the same bytes. random records cover coordinates
+// across the globe, accuracy and altitude ranges, names that need quoting,
+// wifi channels on both bands and ble with and without a manufacturer id.
+
+#include "vendor/GPS/wardrive_csv.h"
+#include "host_test.h"
+#include <math.h>
+
+static uint32_t rng_state = 0x2545f491;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    bool ble;
+    uint8_t mac[6];
+    char name[33];
+    const char *enc;
+    int channel;
+    int rssi;
+    bool has_mfgr;
+    uint16_t mfgr;
+    int32_t lat_e7;
+    int32_t lon_e7;
+    int32_t alt_mm;
+    uint16_t dop_h_e2;
+    int year, month, day, hour, minute, second;
+} obs_t;
+
+// ---- the formatter before the binary records, fed what it was fed then ----
+
+static void ref_escape(char *out, size_t out_len, const char *in) {
+    wd_csv_escape_field(out, out_len, in); // unchanged, moved as is
+}
+
+static const char *ref_caps(const char *enc) {
+    if (!enc || !enc[0]) return "[ESS]";
+    if (!strcmp(enc, "WEP")) return "[WEP][ESS]";
+    if (!strcmp(enc, "WPA")) return "[WPA-PSK][ESS]";
+    if (!strcmp(enc, "WPA2")) return "[WPA2-PSK][ESS]";
+    if (!strcmp(enc, "WPA3")) return "[WPA3-SAE][ESS]";
+    if (!strcmp(enc, "OWE")) return "[OWE][ESS]";
+    return "[ESS]";
+}
+
+static int ref_format(const obs_t *o, char *out, size_t out_len) {
+    char mac[18], timestamp[24], name_esc[96], caps_esc[96];
+    // what gps_logger_populate / populate_gps_quality_data put in wardriving_data_t
+    double latitude = o->lat_e7 / 1e7;
+    double longitude = o->lon_e7 / 1e7;
+    double altitude = o->alt_mm / 1000.0;
+    double accuracy = o->dop_h_e2 * 0.05;
+
+    snprintf(mac, sizeof(mac), "%02x:%02x:%02x:%02x:%02x:%02x", o->mac[0], o->mac[1], o->mac[2],
+             o->mac[3], o->mac[4], o->mac[5]);
+    snprintf(timestamp, sizeof(timestamp), "%04d-%02d-%02d %02d:%02d:%02d", o->year, o->month,
+             o->day, o->hour, o->minute, o->second);
+    ref_escape(name_esc, sizeof(name_esc), o->name);
+
+    if (o->ble) {
+        char mfgr_str[12] = {0};
+        if (o->has_mfgr) snprintf(mfgr_str, sizeof(mfgr_str), "%u", (unsigned)o->mfgr);
+        ref_escape(caps_esc, sizeof(caps_esc), "Misc [LE]");
+        return snprintf(out, out_len, "%s,%s,%s,%s,0,,%d,%.6f,%.6f,%d,%.1f,,%s,BLE\n", mac,
+                        name_esc, caps_esc, timestamp, o->rssi, latitude, longitude,
+                        (int)lround(altitude), accuracy, mfgr_str);
+    }
+
+    int frequency;
+    if (o->channel == 14) frequency = 2484;
+    else if (o->channel > 14) frequency = 5000 + (o->channel * 5);
+    else frequency = 2407 + (o->channel * 5);
+    ref_escape(caps_esc, sizeof(caps_esc), ref_caps(o->enc));
+    return snprintf(out, out_len, "%s,%s,%s,%s,%d,%d,%d,%.6f,%.6f,%d,%.1f,,,WIFI\n", mac, name_esc,
+                    caps_esc, timestamp, o->channel, frequency, o->rssi, latitude, longitude,
+                    (int)lround(altitude), accuracy);
+}
+
+// ---- the record csv_write_data_to_buffer queues for the same observation ----
+
+static void to_record(const obs_t *o, wd_csv_record_t *rec) {
+    memset(rec, 0, sizeof(*rec));
+    memcpy(rec->mac, o->mac, 6);
+    rec->flags = o->ble ? WD_CSV_F_BLE : 0;
+    if (o->ble && o->has_mfgr) {
+        rec->flags |= WD_CSV_F_MFGR;
+        rec->mfgr_id = o->mfgr;
+    }
+    rec->rssi = (int8_t)o->rssi;
+    rec->channel = o->ble ? 0 : (uint8_t)o->channel;
+    rec->auth = o->ble ? WD_CSV_AUTH_OPEN : (uint8_t)wd_csv_auth_from_string(o->enc);
+    rec->year = (uint16_t)o->year;
+    rec->month = (uint8_t)o->month;
+    rec->day = (uint8_t)o->day;
+    rec->hour = (uint8_t)o->hour;
+    rec->minute = (uint8_t)o->minute;
+    rec->second = (uint8_t)o->second;
+    rec->lat_e7 = o->lat_e7;
+    rec->lon_e7 = o->lon_e7;
+    rec->altitude_m = wd_csv_div_round(o->alt_mm, 1000);
+    rec->dop_h_e2 = o->dop_h_e2;
+    memcpy(rec->name, o->name, sizeof(rec->name));
+}
+
+static void random_obs(obs_t *o) {
+    static const char *encs[] = {"", "WEP", "WPA", "WPA2", "WPA3", "OWE", "WPA2/WPA3"};
+    static const char alphabet[] = "abcXYZ019 -_,\"'.";
+    memset(o, 0, sizeof(*o));
+    o->ble = rng() % 4 == 0;
+    for (int i = 0; i < 6; i++) o->mac[i] = (uint8_t)rng();
+    int n = rng() % 4 == 0 ? 0 : (int)(rng() % 33);
+    for (int i = 0; i < n; i++) o->name[i] = alphabet[rng() % (sizeof(alphabet) - 1)];
+    o->enc = encs[rng() % 7];
+    static const int channels[] = {1, 6, 11, 13, 14, 36, 100, 149, 165};
+    o->channel = channels[rng() % 9];
+    o->rssi = -(int)(rng() % 100);
+    o->has_mfgr = rng() & 1;
+    o->mfgr = (uint16_t)rng();
+    switch (rng() % 4) {
+    case 0: // anywhere
+        o->lat_e7 = (int32_t)((int64_t)(rng() % 1800000001u) - 900000000);
+        o->lon_e7 = (int32_t)((int64_t)(rng() % 3600000001u) - 1800000000);
+        break;
+    case 1: // near the equator / prime meridian, where "-0.000000" matters
+        o->lat_e7 = (int32_t)(rng() % 41) - 20;
+        o->lon_e7 = (int32_t)(rng() % 41) - 20;
+        break;
+    case 2: // exact halfway points of the sixth decimal
+        o->lat_e7 = ((int32_t)(rng() % 180000000) - 90000000) * 10 + 5;
+        o->lon_e7 = ((int32_t)(rng() % 360000000) - 180000000) * 10 - 5;
+        break;
+    default: // a city
+        o->lat_e7 = 525200000 + (int32_t)(rng() % 2000000);
+        o->lon_e7 = 134000000 + (int32_t)(rng() % 2000000);
+        break;
+    }
+    o->alt_mm = (int32_t)(rng() % 9000000) - 500000;
+    if (rng() % 8 == 0) o->alt_mm = (int32_t)(rng() % 3000) - 1500; // halfway metres
+    o->dop_h_e2 = (uint16_t)(rng() % 4 ? rng() % 2000 : rng());
+    o->year = 2020 + rng() % 10;
+    o->month = 1 + rng() % 12;
+    o->day = 1 + rng() % 28;
+    o->hour = rng() % 24;
+    o->minute = rng() % 60;
+    o->second = rng() % 60;
+}
+
+static void test_matches_old_formatter(void) {
+    int mismatches = 0;
+    for (int i = 0; i < 200000; i++) {
+        obs_t o;
+        wd_csv_record_t rec;
+        char want[512], got[WD_CSV_LINE_MAX];
+        random_obs(&o);
+        to_record(&o, &rec);
+        int wn = ref_format(&o, want, sizeof(want));
+        int gn = wd_csv_format_record(&rec, got, sizeof(got));
+        CHECK(gn > 0 && gn < (int)sizeof(got));
+        if (wn != gn || strcmp(want, got) != 0) {
+            if (mismatches++ < 5) {
+                fprintf(stderr, "lat_e7 %ld lon_e7 %ld alt_mm %ld dop_h_e2 %u\n  old %s  new %s",
+                        (long)o.lat_e7, (long)o.lon_e7, (long)o.alt_mm, o.dop_h_e2, want, got);
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+static void test_fields(void) {
+    wd_csv_record_t rec = {0};
+    char line[WD_CSV_LINE_MAX];
+    memcpy(rec.mac, "\xaa\xbb\xcc\x01\x02\x03", 6);
+    strcpy(rec.name, "Cafe, \"Free\"");
+    rec.auth = WD_CSV_AUTH_WPA3;
+    rec.channel = 6;
+    rec.rssi = -61;
+    rec.year = 2026;
+    rec.month = 3;
+    rec.day = 9;
+    rec.hour = 7;
+    rec.minute = 5;
+    rec.second = 1;
+    rec.lat_e7 = -6;
+    rec.lon_e7 = -4; // "-0.000000", as printf has it
+    rec.altitude_m = -12;
+    rec.dop_h_e2 = 50;
+    wd_csv_format_record(&rec, line, sizeof(line));
+    CHECK_STR(line, "aa:bb:cc:01:02:03,\"Cafe, \"\"Free\"\"\",[WPA3-SAE][ESS],2026-03-09 07:05:01,"
+                    "6,2437,-61,-0.000001,-0.000000,-12,2.5,,,WIFI\n");
+
+    rec.flags = WD_CSV_F_BLE | WD_CSV_F_MFGR;
+    rec.mfgr_id = 76;
+    rec.name[0] = '\0';
+    rec.lat_e7 = 78125;  // 0.0078125 is exact in binary, printf rounds it to even
+    rec.lon_e7 = 0;
+    rec.dop_h_e2 = UINT16_MAX;
+    wd_csv_format_record(&rec, line, sizeof(line));
+    CHECK_STR(line, "aa:bb:cc:01:02:03,,Misc [LE],2026-03-09 07:05:01,0,,-61,0.007812,0.000000,"
+                    "-12,3276.8,,76,BLE\n");
+
+    // a 32 byte name made of quotes still fits the line
+    memset(rec.name, '"', 32);
+    rec.name[32] = '\0';
+    int n = wd_csv_format_record(&rec, line, sizeof(line));
+    CHECK(n > 0 && n < WD_CSV_LINE_MAX);
+
+    CHECK_EQ(wd_csv_auth_from_string(NULL), WD_CSV_AUTH_OPEN);
+    CHECK_EQ(wd_csv_auth_from_string("OWE"), WD_CSV_AUTH_OWE);
+    CHECK_EQ(wd_csv_div_round(-15, 10), -2);
+    CHECK_EQ(wd_csv_div_round(14, 10), 1);
+}
+
+static void bench(void) {
+    enum { N = 4096 };
+    static wd_csv_record_t recs[N];
+    static obs_t obs[N];
+    char line[512];
+    for (int i = 0; i < N; i++) {
+        random_obs(&obs[i]);
+        to_record(&obs[i], &recs[i]);
+    }
+    volatile size_t bytes = 0;
+    int64_t t0 = host_now_ns();
+    for (int r = 0; r < 25; r++) {
+        for (int i = 0; i < N; i++) bytes += wd_csv_format_record(&recs[i], line, sizeof(line));
+    }
+    int64_t rec_ns = host_now_ns() - t0;
+    t0 = host_now_ns();
+    for (int r = 0; r < 25; r++) {
+        for (int i = 0; i < N; i++) bytes += ref_format(&obs[i], line, sizeof(line));
+    }
+    int64_t ref_ns = host_now_ns() - t0;
+    printf("format: records %.0f ns/line, old double formatter %.0f ns/line\n",
+           (double)rec_ns / (25.0 * N), (double)ref_ns / (25.0 * N));
+}
+
+int main(void) {
+    test_fields();
+    test_matches_old_formatter();
+    bench();
+    return HOST_TEST_RESULT();
+}
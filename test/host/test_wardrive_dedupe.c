@@ -0,0 +1,313 @@
+// wardrive_dedupe: unit checks plus synthetic drive traces. the traces
+// print rows written and ns per check next to the 64-entry hash ring the set
+// replaced, so a regression in either shows up in the ctest log.
+
+#include "vendor/GPS/wardrive_dedupe.h"
+#include "host_test.h"
+
+static void test_mac_parse(void) {
+    uint8_t mac[6];
+    CHECK(wd_mac_parse("AA:bb:0c:dd:ee:0F", mac));
+    CHECK_EQ(mac[0], 0xAA);
+    CHECK_EQ(mac[2], 0x0C);
+    CHECK_EQ(mac[5], 0x0F);
+    CHECK(wd_mac_parse("aabb0cddee0f", mac));
+    CHECK_EQ(mac[1], 0xBB);
+    CHECK(!wd_mac_parse("aa:bb:cc:dd:ee", mac));
+    CHECK(!wd_mac_parse("", mac));
+    CHECK(!wd_mac_parse(NULL, mac));
+}
+
+static void test_relog_rules(void) {
+    static wd_dedupe_entry_t slots[64];
+    wd_dedupe_t set;
+    const uint8_t a[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+    const uint8_t b[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x56};
+
+    wd_dedupe_init(&set, slots, 64);
+    CHECK_EQ(set.mask, 63);
+    CHECK_EQ(wd_dedupe_check(&set, a, -80, true, 100), WD_DEDUPE_NEW);
+    CHECK_EQ(wd_dedupe_check(&set, a, -80, true, 101), WD_DEDUPE_SKIP);
+    CHECK_EQ(wd_dedupe_check(&set, b, -80, false, 101), WD_DEDUPE_NEW);
+    CHECK_EQ(set.used, 2);
+
+    // rssi must beat the best by more than the step
+    CHECK_EQ(wd_dedupe_check(&set, a, -75, true, 102), WD_DEDUPE_SKIP);
+    CHECK_EQ(wd_dedupe_check(&set, a, -74, true, 102), WD_DEDUPE_RELOG);
+    CHECK_EQ(wd_dedupe_check(&set, a, -74, true, 103), WD_DEDUPE_SKIP);
+
+    // a name showing up for a hidden entry re-logs once
+    CHECK_EQ(wd_dedupe_check(&set, a, -90, false, 104), WD_DEDUPE_RELOG);
+    CHECK_EQ(wd_dedupe_check(&set, a, -90, false, 105), WD_DEDUPE_SKIP);
+
+    // interval 0 never re-logs on time, otherwise at the interval
+    CHECK_EQ(wd_dedupe_check(&set, b, -80, false, 100000), WD_DEDUPE_SKIP);
+    set.relog_interval_s = 60;
+    CHECK_EQ(wd_dedupe_check(&set, b, -80, false, 100059), WD_DEDUPE_RELOG);
+    CHECK_EQ(wd_dedupe_check(&set, b, -80, false, 100118), WD_DEDUPE_SKIP);
+    CHECK_EQ(wd_dedupe_check(&set, b, -80, false, 100119), WD_DEDUPE_RELOG);
+
+    wd_dedupe_reset(&set);
+    CHECK_EQ(set.used, 0);
+    CHECK_EQ(wd_dedupe_check(&set, a, -80, true, 1), WD_DEDUPE_NEW);
+
+    // capacity is rounded down to a power of two
+    wd_dedupe_init(&set, slots, 40);
+    CHECK_EQ(set.mask, 31);
+
+    // no slots (allocation failed): everything is logged
+    wd_dedupe_init(&set, NULL, 0);
+    CHECK_EQ(wd_dedupe_check(&set, a, -80, true, 1), WD_DEDUPE_NEW);
+    CHECK_EQ(wd_dedupe_check(&set, a, -80, true, 1), WD_DEDUPE_NEW);
+}
+
+static void test_full_window_evicts_oldest(void) {
+    static wd_dedupe_entry_t slots[16];
+    wd_dedupe_t set;
+    wd_dedupe_init(&set, slots, 16);
+    uint8_t mac[6] = {0x02, 0, 0, 0, 0, 0};
+    for (uint32_t i = 0; i < 16; i++) {
+        mac[5] = (uint8_t)i;
+        CHECK_EQ(wd_dedupe_check(&set, mac, -70, false, 1000 + i), WD_DEDUPE_NEW);
+    }
+    CHECK_EQ(set.used, 16);
+    mac[5] = 16;
+    CHECK_EQ(wd_dedupe_check(&set, mac, -70, false, 2000), WD_DEDUPE_NEW);
+    CHECK_EQ(set.evictions, 1);
+    // the first mac (logged longest ago) is the one that went
+    mac[5] = 0;
+    CHECK_EQ(wd_dedupe_check(&set, mac, -70, false, 2001), WD_DEDUPE_NEW);
+    mac[5] = 15;
+    CHECK_EQ(wd_dedupe_check(&set, mac, -70, false, 2002), WD_DEDUPE_SKIP);
+}
+
+// a record the set let through but that never reached the csv queue: the
+// set goes back to what it was, so the next sighting is logged
+static void test_undo(void) {
+    static wd_dedupe_entry_t slots[16];
+    wd_dedupe_t set;
+    wd_dedupe_undo_t undo;
+    const uint8_t a[6] = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+    wd_dedupe_init(&set, slots, 16);
+
+    CHECK_EQ(wd_dedupe_check_undoable(&set, a, -80, true, 100, &undo), WD_DEDUPE_NEW);
+    wd_dedupe_undo(&set, &undo);
+    CHECK_EQ(set.used, 0);
+    CHECK_EQ(wd_dedupe_check_undoable(&set, a, -80, true, 101, &undo), WD_DEDUPE_NEW);
+    CHECK_EQ(set.used, 1);
+
+    // a re-log undone keeps the old best rssi and the hidden name
+    CHECK_EQ(wd_dedupe_check_undoable(&set, a, -60, false, 102, &undo), WD_DEDUPE_RELOG);
+    wd_dedupe_undo(&set, &undo);
+    CHECK_EQ(wd_dedupe_check(&set, a, -60, false, 103), WD_DEDUPE_RELOG);
+    CHECK_EQ(wd_dedupe_check(&set, a, -60, false, 104), WD_DEDUPE_SKIP);
+
+    // a skip changes nothing, its undo neither
+    CHECK_EQ(wd_dedupe_check_undoable(&set, a, -60, false, 105, &undo), WD_DEDUPE_SKIP);
+    wd_dedupe_undo(&set, &undo);
+    CHECK_EQ(wd_dedupe_check(&set, a, -60, false, 106), WD_DEDUPE_SKIP);
+
+    // an eviction undone brings the evicted mac back
+    wd_dedupe_reset(&set);
+    uint8_t mac[6] = {0x02, 0, 0, 0, 0, 0};
+    for (uint32_t i = 0; i < 16; i++) {
+        mac[5] = (uint8_t)i;
+        wd_dedupe_check(&set, mac, -70, false, 1000 + i);
+    }
+    mac[5] = 16;
+    CHECK_EQ(wd_dedupe_check_undoable(&set, mac, -70, false, 2000, &undo), WD_DEDUPE_NEW);
+    CHECK_EQ(set.evictions, 1);
+    wd_dedupe_undo(&set, &undo);
+    CHECK_EQ(set.evictions, 0);
+    CHECK_EQ(set.used, 16);
+    mac[5] = 0;
+    CHECK_EQ(wd_dedupe_check(&set, mac, -70, false, 2001), WD_DEDUPE_SKIP);
+
+    // too late: the set was reset in between
+    mac[5] = 17;
+    CHECK_EQ(wd_dedupe_check_undoable(&set, mac, -70, false, 2002, &undo), WD_DEDUPE_NEW);
+    wd_dedupe_init(&set, NULL, 0);
+    wd_dedupe_undo(&set, &undo);
+    CHECK_EQ(set.used, 0);
+}
+
+// ---- synthetic drives ----
+
+static uint32_t rng_state;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    uint8_t mac[6];
+    uint32_t pos_m;  // where along the route it sits
+    int8_t peak_rssi;
+    bool hidden;
+} drive_ap_t;
+
+// the 64-entry ring of fnv hashes of the mac string the set replaced
+typedef struct {
+    uint32_t hashes[64];
+    unsigned next;
+} old_ring_t;
+
+static bool old_ring_seen(old_ring_t *r, const uint8_t *mac) {
+    char str[18];
+    snprintf(str, sizeof(str), "%02x:%02x:%02x:%02x:%02x:%02x", mac[0], mac[1], mac[2], mac[3],
+             mac[4], mac[5]);
+    uint32_t h = 2166136261u;
+    for (const char *p = str; *p; p++) h = (h ^ (uint8_t)*p) * 16777619u;
+    for (unsigned i = 0; i < 64; i++) {
+        if (r->hashes[i] == h) return true;
+    }
+    r->hashes[r->next] = h;
+    r->next = (r->next + 1) & 63;
+    return false;
+}
+
+typedef struct {
+    const char *name;
+    uint32_t aps;
+    uint32_t route_m;
+    uint32_t speed_mps;
+    uint32_t range_m;   // how far away an ap is still heard
+    uint32_t passes;    // the route is driven this many times
+    uint32_t capacity;
+    uint32_t relog_interval_s;
+} drive_t;
+
+typedef struct {
+    uint32_t sightings;
+    uint32_t rows;
+    uint32_t relogs;
+    uint32_t old_rows;
+    uint32_t evictions;
+    double ns_per_check;
+} drive_result_t;
+
+// every second the scanner hears each ap within range a few times, rssi
+// falling off with distance plus noise
+static drive_result_t run_drive(const drive_t *d) {
+    drive_result_t res = {0};
+    drive_ap_t *aps = calloc(d->aps, sizeof(*aps));
+    wd_dedupe_entry_t *slots = calloc(d->capacity, sizeof(*slots));
+    wd_dedupe_t set;
+    old_ring_t ring = {0};
+    int64_t check_ns = 0;
+
+    rng_state = 0x12345678u ^ d->aps;
+    for (uint32_t i = 0; i < d->aps; i++) {
+        uint32_t r = rng();
+        static const uint8_t ouis[4][3] = {{0x00, 0x1d, 0x7e}, {0xa4, 0x2b, 0xb0},
+                                           {0x3c, 0x84, 0x6a}, {0xf0, 0x9f, 0xc2}};
+        memcpy(aps[i].mac, ouis[r & 3], 3);
+        aps[i].mac[3] = (uint8_t)(i >> 16);
+        aps[i].mac[4] = (uint8_t)(i >> 8);
+        aps[i].mac[5] = (uint8_t)i;
+        aps[i].pos_m = rng() % d->route_m;
+        aps[i].peak_rssi = (int8_t)(-35 - (int)(rng() % 30));
+        aps[i].hidden = (rng() % 10) == 0;
+    }
+    // sorted by position so each second only walks the aps in range
+    for (uint32_t i = 1; i < d->aps; i++) {
+        drive_ap_t t = aps[i];
+        uint32_t j = i;
+        while (j && aps[j - 1].pos_m > t.pos_m) {
+            aps[j] = aps[j - 1];
+            j--;
+        }
+        aps[j] = t;
+    }
+
+    wd_dedupe_init(&set, slots, d->capacity);
+    set.relog_interval_s = d->relog_interval_s;
+
+    uint32_t now_s = 1000;
+    uint32_t first = 0;
+    for (uint32_t pass = 0; pass < d->passes; pass++, now_s += 1200) {
+        first = 0;
+        for (uint32_t pos = 0; pos < d->route_m; pos += d->speed_mps, now_s++) {
+            while (first < d->aps && aps[first].pos_m + d->range_m < pos) first++;
+            for (uint32_t i = first; i < d->aps && aps[i].pos_m <= pos + d->range_m; i++) {
+                uint32_t dist = aps[i].pos_m > pos ? aps[i].pos_m - pos : pos - aps[i].pos_m;
+                for (int k = rng() % 3; k >= 0; k--) {
+                    int rssi = aps[i].peak_rssi - (int)(dist * 50 / d->range_m) + (int)(rng() % 9) - 4;
+                    if (rssi < -95) continue;
+                    // the probe response with the name arrives after a few beacons
+                    bool name_empty = aps[i].hidden && dist > d->range_m / 4;
+                    res.sightings++;
+
+                    int64_t t0 = host_now_ns();
+                    wd_dedupe_result_t r = wd_dedupe_check(&set, aps[i].mac, (int8_t)rssi,
+                                                           name_empty, now_s);
+                    check_ns += host_now_ns() - t0;
+                    if (r != WD_DEDUPE_SKIP) res.rows++;
+                    if (r == WD_DEDUPE_RELOG) res.relogs++;
+                    if (!old_ring_seen(&ring, aps[i].mac)) res.old_rows++;
+                }
+            }
+        }
+    }
+
+    res.evictions = set.evictions;
+    res.ns_per_check = res.sightings ? (double)check_ns / res.sightings : 0;
+    printf("%-8s %5u aps %u passes: %7u sightings, %6u rows (%u relogs, %u evictions), "
+           "64-entry ring %6u rows, %.0f ns/check\n",
+           d->name, d->aps, d->passes, res.sightings, res.rows, res.relogs, res.evictions,
+           res.old_rows, res.ns_per_check);
+    free(slots);
+    free(aps);
+    return res;
+}
+
+static void test_drives(void) {
+    // dense downtown, the set is big enough: each ap is logged once when
+    // first heard and again each time its rssi climbs by more than the step
+    // while the car approaches (about 50 dB over the range here)
+    drive_t city = {"city", 3000, 6000, 8, 120, 1, 8192, 0};
+    drive_result_t r = run_drive(&city);
+    CHECK_EQ(r.evictions, 0);
+    CHECK_EQ(r.rows - r.relogs, city.aps);
+    CHECK(r.relogs <= city.aps * (50 / WD_DEDUPE_DEFAULT_RSSI_STEP + 2));
+    CHECK(r.old_rows > r.rows * 3);
+
+    // driving the route again 20 minutes later adds almost nothing, the
+    // 64-entry ring logs everything a second time
+    drive_t revisit = city;
+    revisit.name = "revisit";
+    revisit.passes = 2;
+    drive_result_t rv = run_drive(&revisit);
+    CHECK_EQ(rv.rows - rv.relogs, city.aps);
+    CHECK(rv.rows < r.rows + city.aps / 5);
+    CHECK(rv.old_rows > r.old_rows * 19 / 10);
+
+    // with a 20 minute re-log interval the second pass logs every ap once more
+    drive_t relog = revisit;
+    relog.name = "relog";
+    relog.relog_interval_s = 1200;
+    drive_result_t rl = run_drive(&relog);
+    CHECK(rl.rows >= rv.rows + city.aps * 9 / 10);
+    CHECK(rl.rows <= rv.rows + city.aps * 11 / 10);
+
+    // highway with three times more aps than slots: the set evicts the
+    // stalest entries, which by then are kilometres behind, so no ap is
+    // logged as new twice
+    drive_t highway = {"highway", 12000, 60000, 30, 150, 1, 4096, 0};
+    drive_result_t h = run_drive(&highway);
+    CHECK(h.evictions > 0);
+    CHECK_EQ(h.rows - h.relogs, highway.aps);
+    CHECK(h.old_rows > highway.aps);
+}
+
+int main(void) {
+    test_mac_parse();
+    test_relog_rules();
+    test_full_window_evicts_oldest();
+    test_undo();
+    test_drives();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,349 @@
+// wardrive_fix: the fix history and the utc conversion against
+// data/wardrive_fix.txt, which holds a drive trace and the positions and
+// times records captured along it should get. see gen_wardrive_fix.py.
+// then synthetic tracks with 1 Hz fixes and captures between them: the
+// position error of a record stamped with the last fix against one placed
+// from the history, and the time the lookup adds per record.
+
+#include "vendor/GPS/wardrive_fix.h"
+#include "host_test.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const struct {
+    const char *name;
+    wd_fix_result_t res;
+} results[] = {
+    {"none", WD_FIX_NONE},
+    {"stale", WD_FIX_STALE},
+    {"interpolated", WD_FIX_INTERPOLATED},
+    {"dead_reckoned", WD_FIX_DEAD_RECKONED},
+    {"nearest", WD_FIX_NEAREST},
+};
+
+static bool result_of(const char *name, wd_fix_result_t *res) {
+    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++) {
+        if (strcmp(results[i].name, name) == 0) {
+            *res = results[i].res;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void check_utc(const char *line, int lineno) {
+    int y, mo, d, h, mi, s, ms;
+    long long want;
+    if (sscanf(line, "utc %d %d %d %d %d %d %d %lld", &y, &mo, &d, &h, &mi, &s, &ms, &want) != 8) {
+        CHECK(!"bad utc line");
+        return;
+    }
+    wd_fix_utc_t utc = {(uint16_t)y, (uint8_t)mo, (uint8_t)d, (uint8_t)h, (uint8_t)mi, (uint8_t)s};
+    int before = host_test_failures;
+    int64_t got = wd_fix_utc_ms(&utc, (uint16_t)ms);
+    CHECK_EQ(got, want);
+    if (want) {
+        wd_fix_utc_t back;
+        memset(&back, 0xff, sizeof(back));
+        wd_fix_utc_split(got, &back);
+        CHECK_EQ(back.year, y);
+        CHECK_EQ(back.month, mo);
+        CHECK_EQ(back.day, d);
+        CHECK_EQ(back.hour, h);
+        CHECK_EQ(back.minute, mi);
+        CHECK_EQ(back.second, s);
+    }
+    if (host_test_failures != before) fprintf(stderr, "line %d\n", lineno);
+}
+
+static void check_at(const wd_fix_history_t *hist, const char *line, int lineno) {
+    long long t_us, utc_ms = 0;
+    char name[32];
+    int lat, lon, alt, dop, tol = 0;
+    int n = sscanf(line, "at %lld %31s %d %d %d %d %lld %d", &t_us, name, &lat, &lon, &alt, &dop,
+                   &utc_ms, &tol);
+    wd_fix_result_t want;
+    if (n < 2 || !result_of(name, &want)) {
+        CHECK(!"bad at line");
+        return;
+    }
+
+    int before = host_test_failures;
+    wd_fix_t out;
+    memset(&out, 0x5a, sizeof(out));
+    wd_fix_result_t res = wd_fix_history_at(hist, t_us, &out);
+    CHECK_EQ(res, want);
+    if (n == 8 && res == want) {
+        CHECK(abs(out.lat_e7 - lat) <= tol);
+        CHECK(abs(out.lon_e7 - lon) <= tol);
+        CHECK_EQ(out.alt_mm, alt);
+        CHECK_EQ(out.dop_h_e2, dop);
+        CHECK_EQ(out.utc_ms, utc_ms);
+        CHECK_EQ(out.t_us, t_us);
+    } else {
+        CHECK_EQ(n, 2);
+    }
+    if (host_test_failures != before) fprintf(stderr, "line %d: %s", lineno, line);
+}
+
+static void test_corpus(void) {
+    FILE *f = fopen(host_data_path("wardrive_fix.txt"), "r");
+    CHECK(f != NULL);
+    if (!f) return;
+
+    wd_fix_history_t hist;
+    memset(&hist, 0, sizeof(hist));
+    char line[256];
+    int lineno = 0, utcs = 0, pushes = 0, ats = 0;
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (strncmp(line, "utc ", 4) == 0) {
+            check_utc(line, lineno);
+            utcs++;
+        } else if (strncmp(line, "history ", 8) == 0) {
+            unsigned max_age, max_hdop;
+            CHECK(sscanf(line, "history %u %u", &max_age, &max_hdop) == 2);
+            memset(&hist, 0, sizeof(hist));
+            hist.max_age_ms = max_age;
+            hist.max_hdop_e2 = (uint16_t)max_hdop;
+        } else if (strncmp(line, "push ", 5) == 0) {
+            long long t_us, utc_ms;
+            int lat, lon, alt;
+            unsigned speed, cog, dop;
+            char ok[8];
+            CHECK(sscanf(line, "push %lld %lld %d %d %d %u %u %u %7s", &t_us, &utc_ms, &lat, &lon,
+                         &alt, &speed, &cog, &dop, ok) == 9);
+            wd_fix_t fix = {
+                .t_us = t_us,
+                .utc_ms = utc_ms,
+                .lat_e7 = lat,
+                .lon_e7 = lon,
+                .alt_mm = alt,
+                .speed_mmps = speed,
+                .cog_e2 = (uint16_t)cog,
+                .dop_h_e2 = (uint16_t)dop,
+            };
+            wd_fix_set_velocity(&fix);
+            uint32_t rejected = hist.rejected;
+            bool want = strcmp(ok, "ok") == 0;
+            if (wd_fix_history_push(&hist, &fix) != want) fprintf(stderr, "line %d\n", lineno);
+            CHECK_EQ(hist.rejected, rejected + !want);
+            pushes++;
+        } else if (strncmp(line, "at ", 3) == 0) {
+            check_at(&hist, line, lineno);
+            ats++;
+        } else {
+            fprintf(stderr, "line %d: %s", lineno, line);
+            CHECK(!"unknown step");
+        }
+    }
+    fclose(f);
+    CHECK(utcs >= 10);
+    CHECK(pushes >= 20);
+    CHECK(ats >= 20);
+}
+
+// every day of the range splits back to itself
+static void test_utc_days(void) {
+    int64_t day_ms = 86400000;
+    wd_fix_utc_t utc = {2000, 1, 1, 0, 0, 0};
+    int64_t first = wd_fix_utc_ms(&utc, 0);
+    CHECK_EQ(first, 946684800000LL);
+    utc.year = 2099, utc.month = 12, utc.day = 31, utc.hour = 12;
+    int64_t last = wd_fix_utc_ms(&utc, 0);
+    int days = 0;
+    for (int64_t ms = first + day_ms / 2; ms <= last; ms += day_ms, days++) {
+        wd_fix_utc_t d;
+        wd_fix_utc_split(ms, &d);
+        CHECK_EQ(d.hour, 12);
+        if (wd_fix_utc_ms(&d, 0) != ms) {
+            fprintf(stderr, "%04u-%02u-%02u\n", d.year, d.month, d.day);
+            CHECK_EQ(wd_fix_utc_ms(&d, 0), ms);
+            break;
+        }
+    }
+    CHECK_EQ(days, 36525); // 2000-01-01 to 2099-12-31
+}
+
+static uint32_t rng_state = 0x2545f491;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+#define TRACK_S 600
+#define TRACK_STEP_MS 10
+#define TRACK_LAT0_E7 525200000
+#define TRACK_LON0_E7 134000000
+#define TRACK_UTC0_MS 1790000000000LL
+#define E7_PER_M 89.83152 // as wardrive_fix.c
+
+typedef struct {
+    const char *name;
+    double speed_mps;
+    double swing_deg; // the heading swings this far either side
+    double period_s;  // over this period
+} track_t;
+
+// metres north and east every TRACK_STEP_MS
+static double s_north[TRACK_S * 1000 / TRACK_STEP_MS + 1];
+static double s_east[TRACK_S * 1000 / TRACK_STEP_MS + 1];
+
+static double track_heading(const track_t *tr, double t_s) {
+    return 30.0 + tr->swing_deg * sin(2 * M_PI * t_s / tr->period_s);
+}
+
+static void track_build(const track_t *tr) {
+    double dt = TRACK_STEP_MS / 1000.0;
+    s_north[0] = s_east[0] = 0;
+    for (size_t i = 1; i < sizeof(s_north) / sizeof(s_north[0]); i++) {
+        double h = track_heading(tr, (i - 0.5) * dt) * M_PI / 180;
+        s_north[i] = s_north[i - 1] + tr->speed_mps * dt * cos(h);
+        s_east[i] = s_east[i - 1] + tr->speed_mps * dt * sin(h);
+    }
+}
+
+static void track_at(int64_t t_us, double *north, double *east) {
+    int64_t step_us = TRACK_STEP_MS * 1000;
+    size_t i = (size_t)(t_us / step_us);
+    double f = (double)(t_us % step_us) / step_us;
+    *north = s_north[i] + (s_north[i + 1] - s_north[i]) * f;
+    *east = s_east[i] + (s_east[i + 1] - s_east[i]) * f;
+}
+
+static double coslat0(void) {
+    return cos(TRACK_LAT0_E7 / 1e7 * M_PI / 180);
+}
+
+// the fix the receiver reports for second k, exact
+static wd_fix_t track_fix(const track_t *tr, int k) {
+    double north, east;
+    track_at((int64_t)k * 1000000, &north, &east);
+    double cog = fmod(track_heading(tr, k) + 360, 360);
+    wd_fix_t fix = {
+        .t_us = (int64_t)k * 1000000,
+        .utc_ms = TRACK_UTC0_MS + (int64_t)k * 1000,
+        .lat_e7 = TRACK_LAT0_E7 + (int32_t)lrint(north * E7_PER_M),
+        .lon_e7 = TRACK_LON0_E7 + (int32_t)lrint(east * E7_PER_M / coslat0()),
+        .speed_mmps = (uint32_t)lrint(tr->speed_mps * 1000),
+        .cog_e2 = (uint16_t)lrint(cog * 100) % 36000,
+        .dop_h_e2 = 90,
+    };
+    wd_fix_set_velocity(&fix);
+    return fix;
+}
+
+static double error_m(const wd_fix_t *pos, int64_t t_us) {
+    double north, east;
+    track_at(t_us, &north, &east);
+    double dn = (pos->lat_e7 - TRACK_LAT0_E7) / E7_PER_M - north;
+    double de = (pos->lon_e7 - TRACK_LON0_E7) / E7_PER_M * coslat0() - east;
+    return sqrt(dn * dn + de * de);
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// captures at random points of each second, written 0-1.5 s later (the
+// record queue, a scan that reports late); the history is what the logger
+// has at the write, the last fix is what records were stamped with before it
+static void test_tracks(void) {
+    static const track_t tracks[] = {
+        {"walk", 1.4, 60, 40},
+        {"city", 13.9, 90, 30},
+        {"highway", 33.0, 10, 120},
+    };
+    enum { PER_S = 4, N = (TRACK_S - 15) * PER_S };
+    static double before[N], after[N];
+    for (size_t ti = 0; ti < sizeof(tracks) / sizeof(tracks[0]); ti++) {
+        const track_t *tr = &tracks[ti];
+        track_build(tr);
+        int n = 0, usable = 0;
+        double sum_before = 0, sum_after = 0;
+        for (int sec = 10; sec < TRACK_S - 5; sec++) {
+            for (int c = 0; c < PER_S; c++) {
+                int64_t t_us = (int64_t)sec * 1000000 + rng() % 1000000;
+                int64_t write_us = t_us + rng() % 1500000;
+                int last = (int)(write_us / 1000000);
+                wd_fix_history_t hist;
+                memset(&hist, 0, sizeof(hist));
+                hist.max_age_ms = WD_FIX_DEFAULT_MAX_AGE_MS;
+                for (int k = last - WD_FIX_HISTORY_LEN + 1; k <= last; k++) {
+                    wd_fix_t fix = track_fix(tr, k);
+                    wd_fix_history_push(&hist, &fix);
+                }
+                wd_fix_t newest = track_fix(tr, last);
+                wd_fix_t pos;
+                wd_fix_result_t res = wd_fix_history_at(&hist, t_us, &pos);
+                usable += res == WD_FIX_INTERPOLATED || res == WD_FIX_DEAD_RECKONED;
+                before[n] = error_m(&newest, t_us);
+                after[n] = error_m(&pos, t_us);
+                sum_before += before[n];
+                sum_after += after[n];
+                n++;
+            }
+        }
+        CHECK_EQ(usable, n);
+        qsort(before, n, sizeof(before[0]), cmp_double);
+        qsort(after, n, sizeof(after[0]), cmp_double);
+        double p95_before = before[n * 95 / 100], p95_after = after[n * 95 / 100];
+        printf("%-8s %4.1f m/s: last fix %6.2f m mean %6.2f m p95, history %5.2f m mean "
+               "%5.2f m p95\n",
+               tr->name, tr->speed_mps, sum_before / n, p95_before, sum_after / n, p95_after);
+        CHECK(sum_after * 10 < sum_before);
+        CHECK(p95_after * 5 < p95_before);
+    }
+}
+
+// what the record path adds: the lookup at the capture time and the utc
+// split, on a full history, captures spread over its last two seconds
+static void bench_lookup(void) {
+    static const track_t tr = {"city", 13.9, 90, 30};
+    track_build(&tr);
+    enum { FIXES = 20, N = 4096, ROUNDS = 100 };
+    wd_fix_t fixes[FIXES];
+    for (int k = 0; k < FIXES; k++) fixes[k] = track_fix(&tr, k + 1);
+    wd_fix_history_t hist;
+    int64_t t0 = host_now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        memset(&hist, 0, sizeof(hist));
+        hist.max_age_ms = WD_FIX_DEFAULT_MAX_AGE_MS;
+        for (int k = 0; k < FIXES; k++) {
+            wd_fix_set_velocity(&fixes[k]);
+            wd_fix_history_push(&hist, &fixes[k]);
+        }
+    }
+    double fix_ns = (double)(host_now_ns() - t0) / (ROUNDS * FIXES);
+    static int64_t at[N];
+    for (int i = 0; i < N; i++) at[i] = (FIXES - 1) * 1000000LL + rng() % 2000000;
+    volatile int64_t sink = 0;
+    t0 = host_now_ns();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < N; i++) {
+            wd_fix_t pos;
+            wd_fix_utc_t utc;
+            wd_fix_history_at(&hist, at[i], &pos);
+            wd_fix_utc_split(pos.utc_ms, &utc);
+            sink += pos.lat_e7 + utc.second;
+        }
+    }
+    double rec_ns = (double)(host_now_ns() - t0) / ((double)ROUNDS * N);
+    printf("history: %.0f ns per record (lookup and utc split), %.0f ns per fix "
+           "(velocity and push)\n",
+           rec_ns, fix_ns);
+}
+
+int main(void) {
+    test_corpus();
+    test_utc_days();
+    test_tracks();
+    bench_lookup();
+    return HOST_TEST_RESULT();
+}
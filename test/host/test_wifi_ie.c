@@ -0,0 +1,179 @@
+#include "core/wifi_ie.h"
+#include "host_test.h"
+
+#define FCS 0xde, 0xad, 0xbe, 0xef
+
+// beacon header: fc, duration, da, sa, bssid, seq
+#define BEACON_HDR                                                             \
+    0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00,    \
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00
+// timestamp, interval, capability (privacy set)
+#define BEACON_FIXED 0, 0, 0, 0, 0, 0, 0, 0, 0x64, 0x00, 0x11, 0x04
+
+static void test_fcs_not_parsed(void) {
+    // the fcs happens to look like a complete vendor element
+    static const uint8_t frame[] = {BEACON_HDR, BEACON_FIXED, 0x00, 0x02, 'h', 'i',
+                                    0xdd, 0x02, 0x00, 0x50};
+    wifi_ie_info_t info;
+    CHECK(wifi_ie_parse_mgmt(frame, sizeof(frame), &info));
+    CHECK_EQ(info.ssid_len, 2);
+    CHECK_EQ(info.vendor_oui_count, 0);
+    CHECK(!(info.flags & WIFI_IE_F_TRUNCATED));
+
+    // a trailing fcs that would read as a truncated element
+    static const uint8_t frame2[] = {BEACON_HDR, BEACON_FIXED, 0x00, 0x01, 'x', FCS};
+    CHECK(wifi_ie_parse_mgmt(frame2, sizeof(frame2), &info));
+    CHECK_EQ(info.ssid_len, 1);
+    CHECK(!(info.flags & WIFI_IE_F_TRUNCATED));
+}
+
+static void test_short_frames(void) {
+    static const uint8_t frame[] = {BEACON_HDR, BEACON_FIXED, FCS};
+    wifi_ie_info_t info;
+    for (size_t len = 0; len < 28; len++) {
+        CHECK(!wifi_ie_parse_mgmt(frame, len, &info));
+    }
+    // header and fcs but a truncated fixed part
+    CHECK(wifi_ie_parse_mgmt(frame, 30, &info));
+    CHECK(info.flags & WIFI_IE_F_TRUNCATED);
+    CHECK(wifi_ie_parse_mgmt(frame, sizeof(frame), &info));
+    CHECK(!(info.flags & WIFI_IE_F_TRUNCATED));
+    CHECK(info.flags & WIFI_IE_F_PRIVACY);
+    CHECK(!wifi_ie_parse_mgmt(NULL, 100, &info));
+}
+
+static void test_first_ds_wins(void) {
+    static const uint8_t frame[] = {BEACON_HDR, BEACON_FIXED, 0x03, 0x01, 6, 0x03, 0x01, 11,
+                                    0x3d, 0x01, 3, FCS};
+    wifi_ie_info_t info;
+    CHECK(wifi_ie_parse_mgmt(frame, sizeof(frame), &info));
+    CHECK_EQ(info.ds_channel, 6);
+    CHECK_EQ(info.ht_channel, 3);
+    CHECK_EQ(wifi_ie_channel(&info), 6);
+}
+
+static void test_truncated_element(void) {
+    static const uint8_t ies[] = {0x00, 0x03, 'a', 'b', 'c', 0x30, 0x20, 0x01, 0x00};
+    wifi_ie_info_t info = {0};
+    CHECK(!wifi_ie_parse(ies, sizeof(ies), &info));
+    CHECK(info.flags & WIFI_IE_F_TRUNCATED);
+    CHECK_EQ(info.ssid_len, 3);
+}
+
+static void test_security(void) {
+    // rsn with psk + sae, mfp capable; wpa alongside
+    static const uint8_t ies[] = {
+        0x30, 0x18, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04,
+        0x02, 0x00, 0x00, 0x0f, 0xac, 0x02, 0x00, 0x0f, 0xac, 0x08, 0x80, 0x00,
+        0xdd, 0x16, 0x00, 0x50, 0xf2, 0x01, 0x01, 0x00, 0x00, 0x50, 0xf2, 0x02, 0x01, 0x00,
+        0x00, 0x50, 0xf2, 0x02, 0x01, 0x00, 0x00, 0x50, 0xf2, 0x02};
+    wifi_ie_info_t info = {0};
+    CHECK(wifi_ie_parse(ies, sizeof(ies), &info));
+    CHECK_EQ(info.rsn_akm, WIFI_IE_AKM_PSK | WIFI_IE_AKM_SAE);
+    CHECK_EQ(info.rsn_pairwise, WIFI_IE_CIPHER_CCMP);
+    CHECK_EQ(info.rsn_caps, WIFI_IE_RSN_CAP_MFPC);
+    CHECK_EQ(info.wpa_akm, WIFI_IE_AKM_PSK);
+    CHECK_EQ(info.wpa_group, WIFI_IE_CIPHER_TKIP);
+    CHECK_STR(wifi_ie_security_label(&info), "WPA3");
+
+    wifi_ie_info_t open = {0};
+    CHECK_STR(wifi_ie_security_label(&open), "OPEN");
+    open.flags = WIFI_IE_F_PRIVACY;
+    CHECK_STR(wifi_ie_security_label(&open), "WEP");
+}
+
+static void test_copy_ssid(void) {
+    static const uint8_t ies[] = {0x00, 0x05, 'g', 'h', 'o', 's', 't'};
+    wifi_ie_info_t info = {0};
+    char buf[4];
+    wifi_ie_parse(ies, sizeof(ies), &info);
+    CHECK_EQ(wifi_ie_copy_ssid(&info, buf, sizeof(buf)), 3);
+    CHECK_STR(buf, "gho");
+    CHECK_EQ(wifi_ie_copy_ssid(&info, buf, 0), 0);
+}
+
+typedef struct {
+    const char *ssid;
+    const char *label;
+    uint8_t channel;
+    uint16_t flags; // must all be set
+    uint16_t wps_methods;
+    uint8_t vendor_ouis;
+    int seen;
+} expect_ap_t;
+
+static expect_ap_t corpus_aps[] = {
+    {"HomeNet", "WPA2", 6, WIFI_IE_F_RSN | WIFI_IE_F_WPS | WIFI_IE_F_WPS_METHODS | WIFI_IE_F_HT, 0x238C, 1},
+    {"CafeGuest", "OPEN", 1, WIFI_IE_F_HT, 0, 1},
+    {"Office-5G", "WPA2", 36, WIFI_IE_F_RSN | WIFI_IE_F_VHT, 0, 1},
+    {"WPA3-Home", "WPA3", 11, WIFI_IE_F_RSN | WIFI_IE_F_HE, 0, 1},
+    {"Transition", "WPA3", 6, WIFI_IE_F_RSN, 0, 2},
+    {"OldRouter", "WPA", 3, WIFI_IE_F_WPA, 0, 1},
+    {"WEP-Net", "WEP", 9, WIFI_IE_F_PRIVACY, 0, 0},
+    {"OWE-Open", "OWE", 149, WIFI_IE_F_RSN | WIFI_IE_F_VHT, 0, 1},
+    {"", "WPA2", 1, WIFI_IE_F_RSN, 0, 1},
+    {"FreeWiFi", "OPEN", 11, WIFI_IE_F_HT, 0, 1},
+    {"Mixed", "WPA2", 4, WIFI_IE_F_RSN | WIFI_IE_F_WPA | WIFI_IE_F_WPS_METHODS, 0x0088, 1},
+    {"Legacy-b", "OPEN", 13, 0, 0, 0},
+    {"iPhone Hotspot", "WPA2", 6, WIFI_IE_F_RSN, 0, 3},
+    {"DoubleDS", "OPEN", 1, WIFI_IE_F_HT, 0, 0},
+};
+
+static void test_corpus(void) {
+    host_pcap_t pcap;
+    host_pcap_pkt_t pkt;
+    int beacons = 0, probe_reqs = 0, probe_resps = 0;
+
+    if (host_pcap_open(&pcap, host_data_path("mgmt_frames.pcap")) != 0) {
+        CHECK(!"cannot open mgmt_frames.pcap");
+        return;
+    }
+    int r;
+    while ((r = host_pcap_next(&pcap, &pkt)) == 1) {
+        wifi_ie_info_t info;
+        CHECK(wifi_ie_parse_mgmt(pkt.frame, pkt.len, &info));
+        CHECK(!(info.flags & WIFI_IE_F_TRUNCATED));
+        uint8_t subtype = pkt.frame[0] >> 4;
+        if (subtype == 4) {
+            probe_reqs++;
+            continue;
+        }
+        if (subtype == 8) beacons++;
+        if (subtype == 5) probe_resps++;
+
+        char ssid[33];
+        wifi_ie_copy_ssid(&info, ssid, sizeof(ssid));
+        expect_ap_t *e = NULL;
+        for (size_t i = 0; i < sizeof(corpus_aps) / sizeof(corpus_aps[0]); i++) {
+            if (strcmp(corpus_aps[i].ssid, ssid) == 0) e = &corpus_aps[i];
+        }
+        CHECK(e != NULL);
+        if (!e) continue;
+        e->seen++;
+        CHECK_STR(wifi_ie_security_label(&info), e->label);
+        CHECK_EQ(wifi_ie_channel(&info), e->channel);
+        CHECK_EQ(info.flags & e->flags, e->flags);
+        CHECK_EQ(info.wps_config_methods, e->wps_methods);
+        CHECK_EQ(info.vendor_oui_count, e->vendor_ouis);
+    }
+    CHECK_EQ(r, 0);
+    host_pcap_close(&pcap);
+
+    CHECK_EQ(beacons, 13 * 4 + 1);
+    CHECK_EQ(probe_reqs, 12);
+    CHECK_EQ(probe_resps, 12);
+    for (size_t i = 0; i < sizeof(corpus_aps) / sizeof(corpus_aps[0]); i++) {
+        CHECK(corpus_aps[i].seen > 0);
+    }
+}
+
+int main(void) {
+    test_fcs_not_parsed();
+    test_short_frames();
+    test_first_ds_wins();
+    test_truncated_element();
+    test_security();
+    test_copy_ssid();
+    test_corpus();
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,336 @@
+// replays a radiotap capture through the promiscuous callbacks of
+// core/callbacks.c and managers/wifi_station_sniffer.c, built unmodified
+// against the stand-ins in esp_stubs/ and replay_stubs.c.
+//
+//   test_wifi_replay                 data/replay.pcap, with assertions
+//   test_wifi_replay capture.pcap    any capture, report only
+//
+// per callback it prints ns per frame, heap calls per frame and what came
+// out (pcap frames, wardriving rows, log lines) for one pass over the
+// capture, then ns per frame over repeated passes once the callback's tables
+// are warm.
+
+#include "core/callbacks.h"
+#include "host_replay.h"
+#include "host_test.h"
+#include "managers/wifi_manager.h"
+
+#define REPEAT_PASSES 200
+#define TASK_BATCH 16 // frames between task runs, well under the pcap queue
+
+typedef struct {
+    int64_t ts_us;
+    wifi_promiscuous_pkt_type_t type;
+    wifi_promiscuous_pkt_t *pkt;
+} frame_t;
+
+typedef struct {
+    const char *name;
+    wifi_promiscuous_cb_t_t cb;
+    void (*start)(void);
+    void (*stop)(void);
+} replay_cb_t;
+
+typedef struct {
+    double ns;
+    double allocs;
+    double alloc_bytes;
+    uint32_t pcap_frames;
+    uint32_t rows;
+    uint32_t log_lines;
+    uint32_t drops;
+} replay_stats_t;
+
+static frame_t *frames;
+static size_t frame_count;
+
+static uint8_t freq_to_channel(uint16_t mhz) {
+    if (mhz == 2484) return 14;
+    if (mhz >= 2412 && mhz < 2484) return (uint8_t)((mhz - 2407) / 5);
+    if (mhz >= 5000 && mhz < 5900) return (uint8_t)((mhz - 5000) / 5);
+    return 0;
+}
+
+// the rx_ctrl the driver would fill in, payload as the callback sees it:
+// 802.11 header onwards, fcs included
+static bool load_capture(const char *path) {
+    host_pcap_t *p = malloc(sizeof(*p));
+    host_pcap_pkt_t in;
+    size_t cap = 256;
+    int rc;
+
+    frames = calloc(cap, sizeof(*frames));
+    if (!p || !frames || host_pcap_open(p, path) != 0) {
+        fprintf(stderr, "cannot read %s\n", path);
+        free(p);
+        return false;
+    }
+    while ((rc = host_pcap_next(p, &in)) == 1) {
+        if (in.len < 2 || in.len > 4095) continue;
+        if (frame_count == cap) {
+            cap *= 2;
+            frames = realloc(frames, cap * sizeof(*frames));
+        }
+        frame_t *f = &frames[frame_count++];
+        f->pkt = calloc(1, sizeof(wifi_promiscuous_pkt_t) + in.len);
+        memcpy(f->pkt->payload, in.frame, in.len);
+        f->pkt->rx_ctrl.sig_len = in.len;
+        f->pkt->rx_ctrl.rssi = in.rssi;
+        f->pkt->rx_ctrl.channel = freq_to_channel(in.freq_mhz);
+        f->pkt->rx_ctrl.timestamp = (uint32_t)in.ts_us;
+        f->ts_us = in.ts_us;
+        switch ((in.frame[0] >> 2) & 3) {
+        case 0:
+            f->type = WIFI_PKT_MGMT;
+            break;
+        case 1:
+            f->type = WIFI_PKT_CTRL;
+            break;
+        case 2:
+            f->type = WIFI_PKT_DATA;
+            break;
+        default:
+            f->type = WIFI_PKT_MISC;
+            break;
+        }
+    }
+    host_pcap_close(p);
+    free(p);
+    if (rc < 0) fprintf(stderr, "%s: malformed record after %zu frames\n", path, frame_count);
+    return frame_count > 0;
+}
+
+static int64_t replay_pass(wifi_promiscuous_cb_t_t cb, bool count_heap) {
+    int64_t ns = 0;
+    for (size_t i = 0; i < frame_count; i += TASK_BATCH) {
+        size_t end = i + TASK_BATCH < frame_count ? i + TASK_BATCH : frame_count;
+        host_replay.counting = count_heap;
+        int64_t t0 = host_now_ns();
+        for (size_t j = i; j < end; j++) {
+            host_replay_set_time_us(frames[j].ts_us);
+            cb(frames[j].pkt, frames[j].type);
+        }
+        ns += host_now_ns() - t0;
+        host_replay.counting = false;
+        host_replay_run_tasks();
+    }
+    return ns;
+}
+
+// the log tasks sleep 5 s before reporting
+static void finish_tasks(void) {
+    host_replay_set_time_us(frames[frame_count - 1].ts_us + 10 * 1000000LL);
+    host_replay_run_tasks();
+}
+
+static replay_stats_t run_callback(const replay_cb_t *c) {
+    replay_stats_t s = {0};
+    host_replay_reset();
+    if (c->start) c->start();
+
+    int64_t ns = replay_pass(c->cb, true);
+    finish_tasks();
+    s.ns = (double)ns / frame_count;
+    s.allocs = (double)host_replay.allocs / frame_count;
+    s.alloc_bytes = (double)host_replay.alloc_bytes / frame_count;
+    s.pcap_frames = host_replay.pcap_frames;
+    s.rows = host_replay.row_count;
+    s.log_lines = host_replay.glog_lines;
+    s.drops = host_replay.queue_drops;
+
+    if (c->stop) c->stop();
+    cleanup_pcap_queue();
+
+    printf("%-9s %6.0f ns/frame, %.3f allocs/frame (%5.1f B), pcap %4u, rows %4u, log %4u, "
+           "drops %u\n",
+           c->name, s.ns, s.allocs, s.alloc_bytes, s.pcap_frames, s.rows, s.log_lines, s.drops);
+    return s;
+}
+
+// the same capture over and over, once the callback's tables are warm
+static void bench_callback(const replay_cb_t *c) {
+    if (c->start) c->start();
+    int64_t ns = 0;
+    for (int r = 0; r < REPEAT_PASSES; r++) ns += replay_pass(c->cb, false);
+    finish_tasks();
+    if (c->stop) c->stop();
+    cleanup_pcap_queue();
+    host_replay_reset();
+    printf("%-9s %6.0f ns/frame over %d passes\n", c->name,
+           (double)ns / ((double)frame_count * REPEAT_PASSES), REPEAT_PASSES);
+}
+
+static void listen_probes_start(void) {
+    g_listen_probes_save_to_sd = true;
+}
+
+static void listen_probes_stop(void) {
+    g_listen_probes_save_to_sd = false;
+}
+
+static const replay_cb_t wardrive_cb = {"wardrive", wardriving_scan_callback, start_wardriving,
+                                        stop_wardriving};
+static const replay_cb_t pineap_cb = {"pineap", wifi_pineap_detector_callback,
+                                      start_pineap_detection, stop_pineap_detection};
+static const replay_cb_t wps_cb = {"wps", wifi_wps_detection_callback, NULL, NULL};
+static const replay_cb_t eapol_cb = {"eapol", wifi_eapol_scan_callback, NULL, NULL};
+static const replay_cb_t beacon_cb = {"beacon", wifi_beacon_scan_callback, NULL, NULL};
+static const replay_cb_t probe_cb = {"probe", wifi_probe_scan_callback, NULL, NULL};
+static const replay_cb_t deauth_cb = {"deauth", wifi_deauth_scan_callback, NULL, NULL};
+static const replay_cb_t raw_cb = {"raw", wifi_raw_scan_callback, NULL, NULL};
+static const replay_cb_t listen_cb = {"listen", wifi_listen_probes_callback,
+                                      listen_probes_start, listen_probes_stop};
+static const replay_cb_t stations_cb = {"stations", wifi_stations_sniffer_callback, NULL, NULL};
+
+// "scanap" before "scansta": the station sniffer matches against the APs the
+// wardriving pass logged, one record per bssid
+static void scanned_aps_from_rows(void) {
+    free(scanned_aps);
+    scanned_aps = calloc(host_replay.row_count ? host_replay.row_count : 1,
+                         sizeof(wifi_ap_record_t));
+    ap_count = 0;
+    for (uint32_t i = 0; i < host_replay.row_count; i++) {
+        const host_replay_row_t *row = &host_replay.rows[i];
+        bool seen = false;
+        for (uint16_t j = 0; j < ap_count && !seen; j++) {
+            seen = memcmp(scanned_aps[j].bssid, row->bssid, 6) == 0;
+        }
+        if (seen) continue;
+        wifi_ap_record_t *ap = &scanned_aps[ap_count++];
+        memcpy(ap->bssid, row->bssid, 6);
+        memcpy(ap->ssid, row->ssid, sizeof(ap->ssid));
+        ap->primary = (uint8_t)row->channel;
+        ap->rssi = (int8_t)row->rssi;
+    }
+    station_count = 0;
+}
+
+static const host_replay_row_t *find_row(const char *ssid) {
+    for (uint32_t i = 0; i < host_replay.row_count; i++) {
+        if (strcmp(host_replay.rows[i].ssid, ssid) == 0) return &host_replay.rows[i];
+    }
+    return NULL;
+}
+
+static bool has_station(const char *sta, const char *ap) {
+    uint8_t s[6], a[6];
+    sscanf(sta, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx", &s[0], &s[1], &s[2], &s[3], &s[4], &s[5]);
+    sscanf(ap, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx", &a[0], &a[1], &a[2], &a[3], &a[4], &a[5]);
+    for (int i = 0; i < station_count; i++) {
+        if (memcmp(station_ap_list[i].station_mac, s, 6) == 0 &&
+            memcmp(station_ap_list[i].ap_bssid, a, 6) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- data/replay.pcap, see data/gen_replay.py for the scenario ----
+
+static void check_corpus(void) {
+    CHECK_EQ(frame_count, 227);
+
+    // 15 APs beaconing for 12 s, the karma AP, Office-5G's probe response;
+    // the 14-byte frame is shorter than a header and skipped
+    replay_stats_t s = run_callback(&wardrive_cb);
+    CHECK_EQ(s.rows, 15 * 12 + 16 + 1);
+    CHECK_EQ(wardriving_get_ap_count(), 15 * 12 + 16 + 1);
+    const host_replay_row_t *row = find_row("WPA3-Home");
+    CHECK(row && strcmp(row->encryption, "WPA3") == 0 && row->channel == 11);
+    row = find_row("Office-5G");
+    CHECK(row && strcmp(row->encryption, "WPA2") == 0 && row->channel == 36);
+    row = find_row("OWE-Open");
+    CHECK(row && strcmp(row->encryption, "OWE") == 0);
+    row = find_row("WEP-Net");
+    CHECK(row && strcmp(row->encryption, "WEP") == 0);
+    row = find_row("CafeGuest");
+    CHECK(row && strcmp(row->encryption, "OPEN") == 0);
+    row = find_row("Starbucks WiFi");
+    CHECK(row && row->bssid[0] == 0x00 && row->bssid[1] == 0x13 && row->bssid[2] == 0x37);
+
+    // stations: the one that joined HomeNet and the randomized one Office-5G
+    // answered. the deauth frames name STA_HOME again and add nothing; the
+    // sniffer only looks at management frames, so the station that only
+    // sends null data to CafeGuest is not listed
+    scanned_aps_from_rows();
+    CHECK_EQ(ap_count, 16);
+    run_callback(&stations_cb);
+    CHECK_EQ(station_count, 2);
+    CHECK(has_station("f8:ff:c2:01:01:01", "a4:2b:b0:10:20:30"));
+    CHECK(has_station("da:a1:19:03:03:03", "f0:9f:c2:44:55:66"));
+    CHECK(!has_station("44:00:10:02:02:02", "00:1d:7e:11:22:33"));
+    CHECK_EQ(host_replay_log_count("New Station:"), 2);
+
+    // two handshakes, each reported twice. a real M4 (key info 0x030a) has
+    // no Install bit, so the classifier in callbacks.c names it M2
+    s = run_callback(&eapol_cb);
+    CHECK_EQ(host_replay_log_count("Handshake found!"), 4);
+    CHECK_EQ(host_replay_log_count("Pair=M1/M2"), 2);
+    CHECK_EQ(host_replay_log_count("Pair=M3/M2"), 2);
+    CHECK_EQ(s.drops, 0);
+
+    // printer (PIN), HomeNet and Mixed (push button), each stored once
+    detected_network_count = 0;
+    should_store_wps = 1;
+    run_callback(&wps_cb);
+    CHECK_EQ(detected_network_count, 3);
+    CHECK_EQ(host_replay_log_count("WPS PIN detected:\nPrinter-WPS"), 1);
+    CHECK_EQ(host_replay_log_count("WPS Push Button detected:\nHomeNet"), 1);
+    CHECK_EQ(host_replay_log_count("WPS Push Button detected:\nMixed"), 1);
+
+    // the karma AP: the oui match right away, the pineapple report once the
+    // 5 s log task runs, naming the legitimate attwifi AP as its twin
+    run_callback(&pineap_cb);
+    CHECK_EQ(host_replay_log_count("Pineapple OUI match!"), 2); // console + glog
+    CHECK(host_replay_log_count("Pineapple detected!") >= 2);
+    CHECK(host_replay_log_count("Evil Twin Detected:\nSame SSID 'attwifi'") >= 1);
+    CHECK(host_replay_log_count("70:3a:cb:00:00:02") >= 1);
+    CHECK_EQ(host_replay_log_count("BSSID: 00:13:37:00:00:01"), 4);
+
+    // filters: 3 deauth/disassoc; 195 beacons; probes are every mgmt frame
+    // above the floor; raw takes everything 24 bytes or longer
+    s = run_callback(&deauth_cb);
+    CHECK_EQ(s.pcap_frames, 3);
+    s = run_callback(&beacon_cb);
+    CHECK_EQ(s.pcap_frames, 15 * 12 + 16);
+    run_callback(&probe_cb);
+    s = run_callback(&raw_cb);
+    CHECK_EQ(s.pcap_frames, frame_count - 1);
+
+    // listen: three probes from STA_RANDOM, the second inside the dedupe
+    // window, the -93 dBm one below the floor
+    s = run_callback(&listen_cb);
+    CHECK_EQ(host_replay_log_count("Probe Req: da:a1:19:03:03:03 -> ff:ff:ff:ff:ff:ff for Broadcast"), 2);
+    CHECK_EQ(s.pcap_frames, 2);
+}
+
+static const replay_cb_t *const all_cbs[] = {&wardrive_cb, &stations_cb, &eapol_cb, &wps_cb,
+                                             &pineap_cb,   &deauth_cb,   &beacon_cb, &probe_cb,
+                                             &raw_cb,      &listen_cb};
+
+static void report(void) {
+    for (size_t i = 0; i < sizeof(all_cbs) / sizeof(all_cbs[0]); i++) {
+        run_callback(all_cbs[i]);
+        if (all_cbs[i] == &wardrive_cb) scanned_aps_from_rows();
+    }
+    printf("%d stations\n", station_count);
+}
+
+static void bench(void) {
+    for (size_t i = 0; i < sizeof(all_cbs) / sizeof(all_cbs[0]); i++) bench_callback(all_cbs[i]);
+}
+
+int main(int argc, char **argv) {
+    const char *path = argc > 1 ? argv[1] : host_data_path("replay.pcap");
+    if (!load_capture(path)) return 1;
+    printf("%s: %zu frames\n", path, frame_count);
+
+    if (argc > 1) {
+        report();
+        bench();
+        return 0;
+    }
+    check_corpus();
+    bench();
+    return HOST_TEST_RESULT();
+}